@@ -75,6 +75,9 @@ MAIN_SOURCES = \
     sta-src/Main/preferences.cpp \
     sta-src/Main/ViewActionGroup.cpp \
     sta-src/Main/OemImporter.cpp \
+    sta-src/Main/OemExporter.cpp \
+    sta-src/Main/binaryephemeris.cpp \
+    sta-src/Main/scenariosnapshot.cpp \
     sta-src/Main/findDataFolder.cpp
 
 MAIN_HEADERS = \
@@ -100,6 +103,9 @@ MAIN_HEADERS = \
     sta-src/Main/preferences.h \
     sta-src/Main/ViewActionGroup.h \
     sta-src/Main/OemImporter.h \
+    sta-src/Main/OemExporter.h \
+    sta-src/Main/binaryephemeris.h \
+    sta-src/Main/scenariosnapshot.h \
     sta-src/Main/findDataFolder.h
 
 MAIN_FORMS = sta-src/Main/initialstateeditor.ui \
@@ -155,6 +161,7 @@ ASTROCORE_SOURCES = sta-src/Astro-Core/calendarTOjulian.cpp \
     sta-src/Astro-Core/sphericalTOcartesian.cpp \
     sta-src/Astro-Core/cartesianTOrotating.cpp \
     sta-src/Astro-Core/threebodyParametersComputation.cpp \
+    sta-src/Astro-Core/threebodypropagator.cpp \
     sta-src/Astro-Core/ascendingNode.cpp \
 #    sta-src/Astro-Core/propagateTHREEbody.cpp \
     sta-src/Astro-Core/rotatingTOcartesian.cpp \
@@ -210,6 +217,7 @@ ASTROCORE_HEADERS = sta-src/Astro-Core/calendarTOjulian.h \
     sta-src/Astro-Core/sphericalTOcartesian.h \
     sta-src/Astro-Core/cartesianTOrotating.h \
     sta-src/Astro-Core/threebodyParametersComputation.h \
+    sta-src/Astro-Core/threebodypropagator.h \
     sta-src/Astro-Core/ascendingNode.h \
 #    sta-src/Astro-Core/propagateTHREEbody.h \
     sta-src/Astro-Core/rotatingTOcartesian.h \
@@ -233,6 +241,8 @@ ENTRY_SOURCES = sta-src/Entry/reentry.cpp \
     sta-src/Entry/BodyREM.cpp \
     sta-src/Entry/CelestialBody.cpp \
     sta-src/Entry/EntryTrajectory.cpp \
+    sta-src/Entry/entrydispersion.cpp \
+    sta-src/Entry/entrytables.cpp \
     sta-src/Entry/HeatRateClass.cpp
 ENTRY_HEADERS = sta-src/Entry/reentry.h \
     sta-src/Entry/reentrystructures.h \
@@ -240,6 +250,8 @@ ENTRY_HEADERS = sta-src/Entry/reentry.h \
     sta-src/Entry/BodyREM.h \
     sta-src/Entry/CelestialBody.h \
     sta-src/Entry/EntryTrajectory.h \
+    sta-src/Entry/entrydispersion.h \
+    sta-src/Entry/entrytables.h \
     sta-src/Entry/HeatRateClass.h
 ENTRY_FORMS = sta-src/Entry/reentry.ui
 
@@ -286,9 +298,11 @@ RENDEZVOUS_FORMS = sta-src/RendezVous/rendezVousDialog.ui
 
 # ############# Coverage Module ##############
 COVERAGE_SOURCES = sta-src/Coverage/commanalysis.cpp \
-    sta-src/Coverage/coverageanalysis.cpp
+    sta-src/Coverage/coverageanalysis.cpp \
+    sta-src/Coverage/itumaps.cpp
 COVERAGE_HEADERS = sta-src/Coverage/commanalysis.h \
-    sta-src/Coverage/coverageanalysis.h
+    sta-src/Coverage/coverageanalysis.h \
+    sta-src/Coverage/itumaps.h
 
 # ############# SEM Module ##############
 SEM_SOURCES = sta-src/SEM/sem.cpp \
@@ -307,7 +321,10 @@ SEM_SOURCES = sta-src/SEM/sem.cpp \
     sta-src/SEM/MissionDetails.cpp \
     sta-src/SEM/datacommgui.cpp \
     sta-src/SEM/Launcher.cpp \
-    sta-src/SEM/platformDialog.cpp
+    sta-src/SEM/platformDialog.cpp \
+    sta-src/SEM/semtimeseries.cpp \
+    sta-src/SEM/thermalnetwork.cpp \
+    sta-src/SEM/batterysimulation.cpp
 SEM_HEADERS = sta-src/SEM/sem.h \
     sta-src/SEM/TTCSubsystem.h \
     sta-src/SEM/ThermalSubsystem.h \
@@ -324,7 +341,10 @@ SEM_HEADERS = sta-src/SEM/sem.h \
     sta-src/SEM/MissionDetails.h \
     sta-src/SEM/datacommgui.h \
     sta-src/SEM/Launcher.h \
-    sta-src/SEM/platformDialog.h
+    sta-src/SEM/platformDialog.h \
+    sta-src/SEM/semtimeseries.h \
+    sta-src/SEM/thermalnetwork.h \
+    sta-src/SEM/batterysimulation.h
 SEM_FORMS = sta-src/SEM/sem.ui \
     sta-src/SEM/ThermalGUI.ui \
     sta-src/SEM/StructureGUI.ui \
@@ -342,8 +362,12 @@ INTERPLANETARY_FORMS = sta-src/Interplanetary/interplanetaryDialog.ui
 
 
 # ############# 3-Body Module ##############
-LAGRANGIAN_SOURCES = sta-src/Lagrangian/lagrangianDialog.cpp
-LAGRANGIAN_HEADERS = sta-src/Lagrangian/lagrangianDialog.h
+LAGRANGIAN_SOURCES = sta-src/Lagrangian/lagrangianDialog.cpp \
+    sta-src/Lagrangian/halomanifolds.cpp \
+    sta-src/Lagrangian/halofamily.cpp
+LAGRANGIAN_HEADERS = sta-src/Lagrangian/lagrangianDialog.h \
+    sta-src/Lagrangian/halomanifolds.h \
+    sta-src/Lagrangian/halofamily.h
 LAGRANGIAN_FORMS = sta-src/Lagrangian/lagrangianDialog.ui
 
 # ############# Optimization ##############
@@ -377,13 +401,19 @@ RAM_SOURCES = sta-src/RAM/parametrization.cpp \
     sta-src/RAM/partgeometry.cpp \
     sta-src/RAM/vehiclegeometry.cpp \
     sta-src/RAM/advancedselectionGUI.cpp \
-    sta-src/RAM/aeroanalysis.cpp
+    sta-src/RAM/aeroanalysis.cpp \
+    sta-src/RAM/panelstore.cpp \
+    sta-src/RAM/panelshadowing.cpp \
+    sta-src/RAM/aerodatabase.cpp
 RAM_HEADERS = sta-src/RAM/parametrization.h \
     sta-src/RAM/aerodynamicmethods.h \
     sta-src/RAM/partgeometry.h \
     sta-src/RAM/vehiclegeometry.h \
     sta-src/RAM/advancedselectionGUI.h \
-    sta-src/RAM/aeroanalysis.h
+    sta-src/RAM/aeroanalysis.h \
+    sta-src/RAM/panelstore.h \
+    sta-src/RAM/panelshadowing.h \
+    sta-src/RAM/aerodatabase.h
 RAM_FORMS = sta-src/RAM/parametrizedgeometry.ui \
     sta-src/RAM/advancedselectionGUI.ui \
     sta-src/RAM/aerodynamicmethods.ui
@@ -391,9 +421,13 @@ RAM_FORMS = sta-src/RAM/parametrizedgeometry.ui \
 # ################ Analysis ############
 ANALYSIS_SOURCES = \
            sta-src/Analysis/analysisParametersChoice.cpp \
+           sta-src/Analysis/analysisreport.cpp \
+           sta-src/Analysis/analysisreportexport.cpp \
            sta-src/Analysis/qtiplotmain.cpp
 ANALYSIS_HEADERS = \
            sta-src/Analysis/analysisParametersChoice.h \
+           sta-src/Analysis/analysisreport.h \
+           sta-src/Analysis/analysisreportexport.h \
            sta-src/Analysis/qtiplotmain.h
 ANALYSIS_FORMS = \
            sta-src/Analysis/analysisParametersChoice.ui
@@ -417,11 +451,13 @@ SCENARIO_SOURCES = sta-src/Scenario/staschema.cpp \
     sta-src/Scenario/stascenarioutil.cpp \
     sta-src/Scenario/scenario.cpp \
     sta-src/Scenario/scenarioPropagator.cpp \
+    sta-src/Scenario/propagationcache.cpp \
     sta-src/Scenario/missionsDefaults.cpp \
     sta-src/Scenario/missionAspectDialog.cpp
 SCENARIO_HEADERS = sta-src/Scenario/staschema.h \
     sta-src/Scenario/stascenarioutil.h \
     sta-src/Scenario/propagationfeedback.h \
+    sta-src/Scenario/propagationcache.h \
     sta-src/Scenario/scenario.h \
     sta-src/Scenario/scenarioPropagator.h \
     sta-src/Scenario/missionsDefaults.h \
@@ -434,12 +470,16 @@ CONSTELLATIONS_SOURCES = sta-src/Constellations/cwizard.cpp \
     sta-src/Constellations/constellationwizard.cpp \
     sta-src/Constellations/constellationmodule.cpp \
     sta-src/Constellations/discretization.cpp \
-    sta-src/Constellations/cstudy.cpp
+    sta-src/Constellations/cstudy.cpp \
+    sta-src/Constellations/coveragefom.cpp \
+    sta-src/Constellations/constellationsweep.cpp
 CONSTELLATIONS_HEADERS = sta-src/Constellations/cwizard.h \
     sta-src/Constellations/constellationwizard.h \
     sta-src/Constellations/constellationmodule.h \
     sta-src/Constellations/discretization.h \
-    sta-src/Constellations/cstudy.h
+    sta-src/Constellations/cstudy.h \
+    sta-src/Constellations/coveragefom.h \
+    sta-src/Constellations/constellationsweep.h
 CONSTELLATIONS_FORMS = sta-src/Constellations/cwizard.ui \
     sta-src/Constellations/constellationwizard.ui
 
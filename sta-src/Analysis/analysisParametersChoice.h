@@ -43,49 +43,7 @@
 
 #include "Scenario/staschema.h"
 #include "Main/propagatedscenario.h"
-
-
-/** AnalyisResult is a simple container for data produced during an
-  * analysis. After creation, the AnalysisResult structure is passed
-  * to QtiPlot.
-  */
-class AnalysisResult
-{
-public:
-    AnalysisResult(unsigned int columnCount);
-    //AnalysisResult(const AnalysisResult& other);
-    //AnalysisResult
-
-    void appendRow(const QVariantList& rowValues);
-    int columnCount() const;
-    int rowCount() const;
-
-    QString title() const
-    {
-        return m_title;
-    }
-    void setTitle(const QString& title);
-
-    QString columnName(int column) const;
-    void setColumnName(int column, const QString& name);
-
-    void clear();
-
-    QList<QVariant> data() const
-    {
-        return m_data;
-    }
-
-    bool isValid() const
-    {
-        return columnCount() > 0;
-    }
-
-private:
-    QString m_title;
-    QList<QString> m_columnNames;
-    QVariantList m_data;
-};
+#include "Analysis/analysisreport.h"
 
 
 class analysisParametersChoice : public QWidget , private Ui::analysisParametersChoiceTabWidget
@@ -104,6 +62,7 @@ public slots:
     void on_AddDefaultPushButton_clicked();
     void on_EditTimePushButton_clicked();
     void on_DeleteTimePushButton_clicked();
+    void on_ExportPushButton_clicked();
 
 protected slots:
 
@@ -111,6 +70,9 @@ public:
     AnalysisResult generateReport();
 
 private:
+    AnalysisReportEngine reportEngine();
+    QList<AnalysisReportRange> reportRanges();
+
     void addParameter(QTreeWidgetItem* item);
     void comboBoxOptions(QTreeWidgetItem* item);
     int objectsIndex(QStringList AllObjects, int Index, QString ObjectType);
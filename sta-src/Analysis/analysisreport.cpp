@@ -0,0 +1,933 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "analysisreport.h"
+
+#include <QHash>
+#include <QDebug>
+#include <cmath>
+
+#include "Main/propagatedscenario.h"
+#include "Astro-Core/stamath.h"
+#include "Astro-Core/date.h"
+#include "Astro-Core/calculateElements.h"
+#include "Services/serviceTimeParameter.h"
+
+using namespace sta;
+
+
+// ***** Report columns *****
+
+AnalysisColumn::AnalysisColumn() :
+    m_type(Numeric)
+{
+}
+
+
+void
+AnalysisColumn::setName(const QString& name)
+{
+    m_name = name;
+}
+
+
+int
+AnalysisColumn::size() const
+{
+    return m_type == Numeric ? m_values.size() : m_text.size();
+}
+
+
+void
+AnalysisColumn::setValues(const QVector<double>& values)
+{
+    m_type = Numeric;
+    m_values = values;
+    m_text.clear();
+}
+
+
+void
+AnalysisColumn::setTextValues(const QVector<QString>& values)
+{
+    m_type = Text;
+    m_text = values;
+    m_values.clear();
+}
+
+
+void
+AnalysisColumn::append(const AnalysisColumn& other)
+{
+    if (m_type == Numeric && other.m_type == Numeric)
+    {
+        m_values += other.m_values;
+        return;
+    }
+
+    if (m_type == Numeric)
+    {
+        QVector<QString> text(m_values.size());
+        for (int i = 0; i < m_values.size(); ++i)
+        {
+            text[i] = this->text(i);
+        }
+        setTextValues(text);
+    }
+
+    for (int i = 0; i < other.size(); ++i)
+    {
+        m_text.append(other.text(i));
+    }
+}
+
+
+void
+AnalysisColumn::clear()
+{
+    m_values.clear();
+    m_text.clear();
+}
+
+
+double
+AnalysisColumn::value(int row) const
+{
+    return m_type == Numeric ? m_values.at(row) : m_text.at(row).toDouble();
+}
+
+
+QString
+AnalysisColumn::text(int row) const
+{
+    return m_type == Numeric ? QString::number(m_values.at(row), 'g', 16) : m_text.at(row);
+}
+
+
+// ***** Analysis result *****
+
+AnalysisResult::AnalysisResult(unsigned int columnCount)
+{
+    for (unsigned int i = 0; i < columnCount; ++i)
+    {
+        m_columns << AnalysisColumn();
+    }
+}
+
+
+void
+AnalysisResult::appendRows(const QList<AnalysisColumn>& columns)
+{
+    if (columns.count() != columnCount())
+    {
+        qDebug() << "AnalysisResult: block of" << columns.count() << "columns for" << columnCount();
+        return;
+    }
+
+    for (int i = 0; i < columns.count(); ++i)
+    {
+        if (m_columns.at(i).size() == 0)
+        {
+            AnalysisColumn column = columns.at(i);
+            column.setName(m_columns.at(i).name());
+            m_columns[i] = column;
+        }
+        else
+        {
+            m_columns[i].append(columns.at(i));
+        }
+    }
+}
+
+
+int
+AnalysisResult::columnCount() const
+{
+    return m_columns.count();
+}
+
+
+int
+AnalysisResult::rowCount() const
+{
+    return m_columns.isEmpty() ? 0 : m_columns.first().size();
+}
+
+
+void
+AnalysisResult::setTitle(const QString& title)
+{
+    m_title = title;
+}
+
+
+QString
+AnalysisResult::columnName(int column) const
+{
+    if (column >= 0 && column < columnCount())
+    {
+        return m_columns.at(column).name();
+    }
+    else
+    {
+        return "";
+    }
+}
+
+
+void
+AnalysisResult::setColumnName(int column, const QString& name)
+{
+    if (column >= 0 && column < columnCount())
+    {
+        m_columns[column].setName(name);
+    }
+}
+
+
+QString
+AnalysisResult::text(int row, int column) const
+{
+    return m_columns.at(column).text(row);
+}
+
+
+void
+AnalysisResult::clear()
+{
+    for (int i = 0; i < m_columns.count(); ++i)
+    {
+        m_columns[i].clear();
+    }
+}
+
+
+// ***** Report engine *****
+
+// Convert a state vector to the coordinate system given by the specified name
+static StateVector ConvertStateVector(const StateVector& state, const QString& coordSys, const StaBody* center, double mjd)
+{
+    sta::CoordinateSystemType toSystem = sta::COORDSYS_INVALID;
+    if (coordSys == "Fixed")
+    {
+        toSystem = sta::COORDSYS_BODYFIXED;
+    }
+    else if (coordSys == "Ecliptic J2000")
+    {
+        toSystem = sta::COORDSYS_ECLIPTIC_J2000;
+    }
+    else if (coordSys == "EME J2000")
+    {
+        toSystem = sta::COORDSYS_EME_J2000;
+    }
+    else if (coordSys == "EME B1950")
+    {
+        toSystem = sta::COORDSYS_EME_B1950;
+    }
+    else if (coordSys == "ICRF")
+    {
+        toSystem = sta::COORDSYS_ICRF;
+    }
+    else if (coordSys == "Mean of Date")
+    {
+        toSystem = sta::COORDSYS_MEAN_OF_DATE;
+    }
+    else if (coordSys == "True of Date")
+    {
+        toSystem = sta::COORDSYS_TRUE_OF_DATE;
+    }
+    else if (coordSys == "Mean of Epoch")
+    {
+        toSystem = sta::COORDSYS_MEAN_OF_EPOCH;
+    }
+    Q_ASSERT(toSystem != sta::COORDSYS_INVALID);
+
+    return CoordinateSystem::convert(state,
+                                     mjd,
+                                     center,
+                                     sta::CoordinateSystem(sta::COORDSYS_EME_J2000),
+                                     center,
+                                     sta::CoordinateSystem(toSystem));
+}
+
+
+// Factor converting values from one unit to the units chosen by the user
+static double UnitScale(const QString& units, const QString& fromUnit)
+{
+    return sta::ConvertUnits(units, 1.0, fromUnit);
+}
+
+
+// Quantities a report column is computed from
+enum ReportQuantity
+{
+    CartesianQuantity,
+    TimeQuantity,
+    EpochQuantity,
+    PlanetDistanceQuantity,
+    KeplerianQuantity,
+    DelaunayQuantity,
+    EquinoctialQuantity,
+    SphericalQuantity,
+    VisibilityQuantity,
+    UnavailableQuantity
+};
+
+
+// Time formats given as numbers; the others are text
+static bool IsNumericTimeFormat(const QString& format)
+{
+    return format == "MJD" || format == "Julian TDB" || format == "Julian Date" ||
+           format == "Julian Ephemeris Date" || format == "Julian GPS" || format == "Earth canonical time" ||
+           format.endsWith(" from Epoch");
+}
+
+
+static ReportQuantity ColumnQuantity(const QString& name)
+{
+    if (name == "x position" || name == "y position" || name == "z position" ||
+        name == "x velocity" || name == "y velocity" || name == "z velocity")
+    {
+        return CartesianQuantity;
+    }
+    if (name == "Time")
+    {
+        return TimeQuantity;
+    }
+    if (name == "Epoch")
+    {
+        return EpochQuantity;
+    }
+    if (name == "Eccentricity" || name == "Inclination" || name == "RAAN" ||
+        name == "Argument of Periapsis" || name == "True Anomaly" || name == "Semimajor Axis")
+    {
+        return KeplerianQuantity;
+    }
+    if (name == "l" || name == "g" || name == "h" || name == "L" || name == "G" || name == "H")
+    {
+        return DelaunayQuantity;
+    }
+    if (name == "e*sin(omegaBar)" || name == "e*cos(omegaBar)" || name == "tan(i/2)*sin(raan)" ||
+        name == "tan(i/2)*cos(raan)" || name == "Mean Longitude")
+    {
+        return EquinoctialQuantity;
+    }
+    if (name == "Latitude" || name == "Longitude" || name == "Radial Distance" || name == "Flight Path Angle" ||
+        name == "Heading Angle" || name == "Velocity Modulus" || name == "Altitude")
+    {
+        return SphericalQuantity;
+    }
+    // Coverage and communication values are only given when the object is visible
+    if (name == "Azimuth" || name == "Elevation" || name == "Range" ||
+        name == "EIRP" || name == "Received Frequency" || name == "Doppler Shift" || name == "Received Power" ||
+        name == "Flux Density" || name == "Overlap Bandwidth Factor" ||
+        name == "Free Space Loss" || name == "Oxygen Loss" || name == "Water Vapour Loss" || name == "Rain Loss" ||
+        name == "Atmospheric Loss" || name == "Propagation Loss" ||
+        name == "G/T" || name == "C/No" || name == "C/N" || name == "Eb/No" || name == "BER")
+    {
+        return VisibilityQuantity;
+    }
+    if (STA_SOLAR_SYSTEM->lookup(name) != NULL)
+    {
+        return PlanetDistanceQuantity;
+    }
+
+    return UnavailableQuantity;
+}
+
+
+struct SphericalCoordinates
+{
+    double tau;     // longitude
+    double delta;   // latitude
+    double r;
+    double v;
+    double gamma;   // flight path angle
+    double chi;     // heading angle
+};
+
+
+/** States of a range of samples of a mission arc and the quantities derived
+  * from them. Each quantity is computed for the whole range the first time a
+  * column asks for it.
+  */
+class ReportSegment
+{
+public:
+    ReportSegment(const AnalysisReportRange& range, int first, int count);
+
+    int size() const { return m_mjd.size(); }
+
+    AnalysisColumn column(const AnalysisReportColumn& plan);
+
+private:
+    const QVector<StateVector>& cartesianStates(const QString& coordSys);
+    const QVector<StateVector>& elementStates(const QString& coordSys);
+    const QVector<KeplerianElements>& keplerianElements(const QString& coordSys);
+    const QVector<DelaunayElements>& delaunayElements(const QString& coordSys);
+    const QVector<EquinoctialElements>& equinoctialElements(const QString& coordSys);
+    const QVector<SphericalCoordinates>& sphericalCoordinates(const QString& coordSys);
+    const QVector<double>& planetDistances(const QString& bodyName);
+
+    AnalysisColumn timeColumn(const QString& format);
+
+    const MissionArc* m_arc;
+    double m_startEpoch;
+    double m_rangeStart;
+    QVector<double> m_mjd;
+    QVector<StateVector> m_states;
+
+    QHash<QString, QVector<StateVector> > m_cartesianStates;
+    QHash<QString, QVector<StateVector> > m_elementStates;
+    QHash<QString, QVector<KeplerianElements> > m_keplerianElements;
+    QHash<QString, QVector<DelaunayElements> > m_delaunayElements;
+    QHash<QString, QVector<EquinoctialElements> > m_equinoctialElements;
+    QHash<QString, QVector<SphericalCoordinates> > m_sphericalCoordinates;
+    QHash<QString, QVector<double> > m_planetDistances;
+};
+
+
+ReportSegment::ReportSegment(const AnalysisReportRange& range, int first, int count) :
+    m_arc(range.arc),
+    m_startEpoch(range.arc->trajectorySampleTime(0)),
+    m_rangeStart(range.arc->trajectorySampleTime(range.firstSample))
+{
+    int firstSample = range.firstSample + first;
+    m_mjd.resize(count);
+    m_states.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        m_mjd[i] = m_arc->trajectorySampleTime(firstSample + i);
+        m_states[i] = m_arc->trajectorySample(firstSample + i);
+    }
+}
+
+
+// States in a coordinate system of the position and velocity columns. The
+// mean of epoch system is the one of the first sample of the time range.
+const QVector<StateVector>&
+ReportSegment::cartesianStates(const QString& coordSys)
+{
+    if (!m_cartesianStates.contains(coordSys))
+    {
+        QVector<StateVector> states(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            double mjd = coordSys == "Mean of Epoch" ? m_rangeStart : m_mjd.at(i);
+            states[i] = ConvertStateVector(m_states.at(i), coordSys, m_arc->centralBody(), mjd);
+        }
+        m_cartesianStates.insert(coordSys, states);
+    }
+
+    return m_cartesianStates[coordSys];
+}
+
+
+// States in a coordinate system of the orbital element and spherical columns
+const QVector<StateVector>&
+ReportSegment::elementStates(const QString& coordSys)
+{
+    if (!m_elementStates.contains(coordSys))
+    {
+        QVector<StateVector> states(size());
+        CoordinateSystem fromSystem = CoordSys("EME J2000");
+        CoordinateSystem toSystem = CoordSys(coordSys);
+        for (int i = 0; i < size(); ++i)
+        {
+            states[i] = CoordinateSystem::convert(m_states.at(i), m_mjd.at(i),
+                                                  m_arc->centralBody(), fromSystem,
+                                                  m_arc->centralBody(), toSystem);
+        }
+        m_elementStates.insert(coordSys, states);
+    }
+
+    return m_elementStates[coordSys];
+}
+
+
+const QVector<KeplerianElements>&
+ReportSegment::keplerianElements(const QString& coordSys)
+{
+    if (!m_keplerianElements.contains(coordSys))
+    {
+        const QVector<StateVector>& states = elementStates(coordSys);
+        double mu = m_arc->centralBody()->mu();
+        QVector<KeplerianElements> elements(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            elements[i] = cartesianTOorbital(mu, states.at(i));
+        }
+        m_keplerianElements.insert(coordSys, elements);
+    }
+
+    return m_keplerianElements[coordSys];
+}
+
+
+const QVector<DelaunayElements>&
+ReportSegment::delaunayElements(const QString& coordSys)
+{
+    if (!m_delaunayElements.contains(coordSys))
+    {
+        const QVector<StateVector>& states = elementStates(coordSys);
+        double mu = m_arc->centralBody()->mu();
+        QVector<DelaunayElements> elements(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            elements[i] = cartesianTOdelaunay(mu, states.at(i));
+        }
+        m_delaunayElements.insert(coordSys, elements);
+    }
+
+    return m_delaunayElements[coordSys];
+}
+
+
+const QVector<EquinoctialElements>&
+ReportSegment::equinoctialElements(const QString& coordSys)
+{
+    if (!m_equinoctialElements.contains(coordSys))
+    {
+        const QVector<StateVector>& states = elementStates(coordSys);
+        double mu = m_arc->centralBody()->mu();
+        QVector<EquinoctialElements> elements(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            elements[i] = cartesianTOequinoctial(mu, states.at(i));
+        }
+        m_equinoctialElements.insert(coordSys, elements);
+    }
+
+    return m_equinoctialElements[coordSys];
+}
+
+
+const QVector<SphericalCoordinates>&
+ReportSegment::sphericalCoordinates(const QString& coordSys)
+{
+    if (!m_sphericalCoordinates.contains(coordSys))
+    {
+        const QVector<StateVector>& states = elementStates(coordSys);
+        QVector<SphericalCoordinates> coordinates(size());
+        for (int i = 0; i < size(); ++i)
+        {
+            const StateVector& s = states.at(i);
+            SphericalCoordinates& c = coordinates[i];
+            cartesianTOspherical(s.position.x(), s.position.y(), s.position.z(),
+                                 s.velocity.x(), s.velocity.y(), s.velocity.z(),
+                                 c.tau, c.delta, c.r, c.v, c.gamma, c.chi);
+        }
+        m_sphericalCoordinates.insert(coordSys, coordinates);
+    }
+
+    return m_sphericalCoordinates[coordSys];
+}
+
+
+// Distances (km) to a Solar System body, from the samples of the arc
+const QVector<double>&
+ReportSegment::planetDistances(const QString& bodyName)
+{
+    if (!m_planetDistances.contains(bodyName))
+    {
+        const StaBody* body = STA_SOLAR_SYSTEM->lookup(bodyName);
+        Q_ASSERT(body != NULL);
+
+        QVector<double> distances(size());
+        CoordinateSystem eme2000(COORDSYS_EME_J2000);
+        for (int i = 0; i < size(); ++i)
+        {
+            StateVector state = CoordinateSystem::convert(m_states.at(i), m_mjd.at(i),
+                                                          m_arc->centralBody(), m_arc->coordinateSystem(),
+                                                          body, eme2000);
+            distances[i] = state.position.norm();
+        }
+        m_planetDistances.insert(bodyName, distances);
+    }
+
+    return m_planetDistances[bodyName];
+}
+
+
+AnalysisColumn
+ReportSegment::timeColumn(const QString& format)
+{
+    AnalysisColumn column;
+    double* mjd = m_mjd.data();
+    int n = size();
+
+    if (format.endsWith(" from Epoch"))
+    {
+        QString units = format.section(' ', 0, 0);
+        QVector<double> values(n);
+        for (int i = 0; i < n; ++i)
+        {
+            values[i] = sta::MjdToFromEpoch(m_startEpoch, mjd[i], units);
+        }
+        column.setValues(values);
+        return column;
+    }
+
+    double (*julianDate)(double[], int) = NULL;
+    if (format == "MJD")
+        julianDate = convertToMJDUTC;
+    else if (format == "Julian TDB" || format == "Julian Date")
+        julianDate = convertToJulianTDB;
+    else if (format == "Julian Ephemeris Date")
+        julianDate = convertToJulianEphDate;
+    else if (format == "Julian GPS")
+        julianDate = convertToJulianGPS;
+
+    if (julianDate || format == "Earth canonical time")
+    {
+        QVector<double> values(n);
+        for (int i = 0; i < n; ++i)
+        {
+            values[i] = julianDate ? julianDate(mjd, i) : convertToEarthCanTime(mjd, i, m_startEpoch);
+        }
+        column.setValues(values);
+        return column;
+    }
+
+    QVector<QString> text(n);
+    for (int i = 0; i < n; ++i)
+    {
+        if (format == "Gregorian UTC")
+        {
+            text[i] = convertToGregUTC(mjd, i);
+        }
+        else if (format == "Gregorian TDB")
+        {
+            text[i] = convertToGregTDB(mjd, i);
+        }
+        else if (format == "Gregorian TAI")
+        {
+            text[i] = convertToGregTAI(mjd, i);
+        }
+        else if (format == "Gregorian TDT")
+        {
+            text[i] = convertToGregTDT(mjd, i);
+        }
+        else if (format == "Gregorian GPS")
+        {
+            text[i] = convertToGregGPS(mjd, i);
+        }
+        else if (format == "Mission Elapsed")
+        {
+            text[i] = sta::MissionElapsedTime(mjd[i], m_startEpoch);
+        }
+        else if (format == "Julian UTC" || format == "YYDDD TDB")
+        {
+            int last2Digits;
+            QList<double> DDD;
+            double hour, minute, second;
+            if (format == "Julian UTC")
+            {
+                convertToJulianUTC(mjd, i, &last2Digits, &DDD, &hour, &minute, &second);
+            }
+            else
+            {
+                convertToYYDDD(mjd, i, &last2Digits, &DDD);
+            }
+
+            text[i] = QString::number(last2Digits) + "/";
+            foreach (double digit, DDD)
+            {
+                text[i] += QString::number(digit);
+            }
+            if (format == "Julian UTC")
+            {
+                text[i] += QString(" %1:%2:%3").arg(hour).arg(minute).arg(second);
+            }
+        }
+        // The local time formats aren't supported: their values are left empty
+    }
+    column.setTextValues(text);
+    return column;
+}
+
+
+AnalysisColumn
+ReportSegment::column(const AnalysisReportColumn& plan)
+{
+    const QString& name = plan.name;
+    int n = size();
+    QVector<double> values(n);
+    AnalysisColumn column;
+
+    switch (ColumnQuantity(name))
+    {
+    case CartesianQuantity:
+        {
+            const QVector<StateVector>& states = cartesianStates(plan.coordinateSystem);
+            bool velocity = name.endsWith("velocity");
+            int axis = name.startsWith("x") ? 0 : (name.startsWith("y") ? 1 : 2);
+            double scale = UnitScale(plan.units, velocity ? "km/s" : "km");
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = scale * (velocity ? states.at(i).velocity[axis] : states.at(i).position[axis]);
+            }
+        }
+        break;
+
+    case TimeQuantity:
+        return timeColumn(plan.coordinateSystem);
+
+    case EpochQuantity:
+        for (int i = 0; i < n; ++i)
+        {
+            values[i] = sta::MjdToFromEpoch(m_startEpoch, m_mjd.at(i), plan.units);
+        }
+        break;
+
+    case PlanetDistanceQuantity:
+        {
+            const QVector<double>& distances = planetDistances(name);
+            double scale = UnitScale(plan.units, "km");
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = scale * distances.at(i);
+            }
+        }
+        break;
+
+    case KeplerianQuantity:
+        {
+            const QVector<KeplerianElements>& elements = keplerianElements(plan.coordinateSystem);
+            double KeplerianElements::* element = &KeplerianElements::SemimajorAxis;
+            double scale = UnitScale(plan.units, "rad");
+            if (name == "Eccentricity")
+            {
+                element = &KeplerianElements::Eccentricity;
+                scale = 1.0;
+            }
+            else if (name == "Inclination")
+                element = &KeplerianElements::Inclination;
+            else if (name == "RAAN")
+                element = &KeplerianElements::AscendingNode;
+            else if (name == "Argument of Periapsis")
+                element = &KeplerianElements::ArgumentOfPeriapsis;
+            else if (name == "True Anomaly")
+                element = &KeplerianElements::TrueAnomaly;
+            else
+                scale = UnitScale(plan.units, "km");
+
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = scale * (elements.at(i).*element);
+            }
+        }
+        break;
+
+    case DelaunayQuantity:
+        {
+            const QVector<DelaunayElements>& elements = delaunayElements(plan.coordinateSystem);
+            double DelaunayElements::* element = &DelaunayElements::H;
+            if (name == "l")
+                element = &DelaunayElements::l;
+            else if (name == "g")
+                element = &DelaunayElements::g;
+            else if (name == "h")
+                element = &DelaunayElements::h;
+            else if (name == "L")
+                element = &DelaunayElements::L;
+            else if (name == "G")
+                element = &DelaunayElements::G;
+
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = elements.at(i).*element;
+            }
+        }
+        break;
+
+    case EquinoctialQuantity:
+        {
+            const QVector<EquinoctialElements>& elements = equinoctialElements(plan.coordinateSystem);
+            double EquinoctialElements::* element = &EquinoctialElements::MeanLon;
+            if (name == "e*sin(omegaBar)")
+                element = &EquinoctialElements::esin;
+            else if (name == "e*cos(omegaBar)")
+                element = &EquinoctialElements::ecos;
+            else if (name == "tan(i/2)*sin(raan)")
+                element = &EquinoctialElements::tansin;
+            else if (name == "tan(i/2)*cos(raan)")
+                element = &EquinoctialElements::tancos;
+
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = elements.at(i).*element;
+            }
+        }
+        break;
+
+    case SphericalQuantity:
+        {
+            const QVector<SphericalCoordinates>& coordinates = sphericalCoordinates(plan.coordinateSystem);
+            double SphericalCoordinates::* coordinate = &SphericalCoordinates::v;
+            QString fromUnit = "rad";
+            double offset = 0.0;
+            if (name == "Latitude")
+                coordinate = &SphericalCoordinates::delta;
+            else if (name == "Longitude")
+                coordinate = &SphericalCoordinates::tau;
+            else if (name == "Flight Path Angle")
+                coordinate = &SphericalCoordinates::gamma;
+            else if (name == "Heading Angle")
+                coordinate = &SphericalCoordinates::chi;
+            else if (name == "Radial Distance" || name == "Altitude")
+            {
+                coordinate = &SphericalCoordinates::r;
+                fromUnit = "km";
+                if (name == "Altitude")
+                {
+                    offset = m_arc->centralBody()->meanRadius();
+                }
+            }
+            else
+                fromUnit = "km/s";
+
+            double scale = UnitScale(plan.units, fromUnit);
+            for (int i = 0; i < n; ++i)
+            {
+                values[i] = scale * (coordinates.at(i).*coordinate - offset);
+            }
+        }
+        break;
+
+    case VisibilityQuantity:
+        // The coverage and communication analyses are disabled: no object is reported visible
+        column.setTextValues(QVector<QString>(n, "No visibility"));
+        return column;
+
+    case UnavailableQuantity:
+        column.setTextValues(QVector<QString>(n));
+        return column;
+    }
+
+    column.setValues(values);
+    return column;
+}
+
+
+AnalysisReportEngine::AnalysisReportEngine()
+{
+}
+
+
+void
+AnalysisReportEngine::addColumn(const QString& name, const QString& coordinateSystem, const QString& units)
+{
+    AnalysisReportColumn column;
+    column.name = name;
+    column.coordinateSystem = coordinateSystem;
+    column.units = units;
+    m_plan << column;
+}
+
+
+QStringList
+AnalysisReportEngine::columnNames() const
+{
+    QStringList names;
+    foreach (const AnalysisReportColumn& column, m_plan)
+    {
+        if (column.name != "Access Time")
+        {
+            // The units of the time column are its format
+            QString units = column.name == "Time" ? column.coordinateSystem : column.units;
+            names << QString("%1 (%2)").arg(column.name, units);
+        }
+        else
+        {
+            names << "Access Number" << "Start Time (MJD)" << "Stop Time (MJD)" << "Duration of each access (seconds)";
+        }
+    }
+
+    return names;
+}
+
+
+QList<AnalysisColumn::Type>
+AnalysisReportEngine::columnTypes() const
+{
+    QList<AnalysisColumn::Type> types;
+    foreach (const AnalysisReportColumn& column, m_plan)
+    {
+        if (column.name == "Access Time")
+        {
+            types << AnalysisColumn::Text << AnalysisColumn::Text << AnalysisColumn::Text << AnalysisColumn::Text;
+            continue;
+        }
+
+        switch (ColumnQuantity(column.name))
+        {
+        case TimeQuantity:
+            types << (IsNumericTimeFormat(column.coordinateSystem) ? AnalysisColumn::Numeric : AnalysisColumn::Text);
+            break;
+        case VisibilityQuantity:
+        case UnavailableQuantity:
+            types << AnalysisColumn::Text;
+            break;
+        default:
+            types << AnalysisColumn::Numeric;
+            break;
+        }
+    }
+
+    return types;
+}
+
+
+QList<AnalysisColumn>
+AnalysisReportEngine::evaluate(const AnalysisReportRange& range) const
+{
+    return evaluate(range, 0, range.sampleCount());
+}
+
+
+QList<AnalysisColumn>
+AnalysisReportEngine::evaluate(const AnalysisReportRange& range, int first, int count) const
+{
+    ReportSegment segment(range, first, count);
+
+    QList<AnalysisColumn> columns;
+    foreach (const AnalysisReportColumn& plan, m_plan)
+    {
+        if (plan.name == "Access Time")
+        {
+            // Access times are computed by the coverage analysis, which is disabled
+            for (int i = 0; i < 4; ++i)
+            {
+                AnalysisColumn column;
+                column.setTextValues(QVector<QString>(segment.size()));
+                columns << column;
+            }
+        }
+        else
+        {
+            columns << segment.column(plan);
+        }
+    }
+
+    return columns;
+}
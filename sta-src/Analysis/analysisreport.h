@@ -0,0 +1,207 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef ANALYSISREPORT_H
+#define ANALYSISREPORT_H
+
+#include <QList>
+#include <QVector>
+#include <QString>
+#include <QStringList>
+
+class MissionArc;
+
+
+/** Values of one column of an analysis report. Numeric columns keep their
+  * values as doubles; the text columns hold the values that aren't numbers
+  * (calendar dates, "No visibility").
+  */
+class AnalysisColumn
+{
+public:
+    enum Type
+    {
+        Numeric,
+        Text
+    };
+
+    AnalysisColumn();
+
+    QString name() const
+    {
+        return m_name;
+    }
+    void setName(const QString& name);
+
+    Type type() const
+    {
+        return m_type;
+    }
+    int size() const;
+
+    const QVector<double>& values() const
+    {
+        return m_values;
+    }
+    const QVector<QString>& textValues() const
+    {
+        return m_text;
+    }
+    void setValues(const QVector<double>& values);
+    void setTextValues(const QVector<QString>& values);
+
+    /** Append the values of another column. A numeric column becomes a text
+      * column when text is appended to it.
+      */
+    void append(const AnalysisColumn& other);
+    void clear();
+
+    double value(int row) const;
+    QString text(int row) const;
+
+private:
+    QString m_name;
+    Type m_type;
+    QVector<double> m_values;
+    QVector<QString> m_text;
+};
+
+
+/** AnalyisResult is a simple container for data produced during an
+  * analysis. After creation, the AnalysisResult structure is passed
+  * to QtiPlot.
+  *
+  * The data is stored column by column: the rows of a report are appended in
+  * blocks, as produced by AnalysisReportEngine::evaluate().
+  */
+class AnalysisResult
+{
+public:
+    AnalysisResult(unsigned int columnCount = 0);
+
+    void appendRows(const QList<AnalysisColumn>& columns);
+    int columnCount() const;
+    int rowCount() const;
+
+    QString title() const
+    {
+        return m_title;
+    }
+    void setTitle(const QString& title);
+
+    QString columnName(int column) const;
+    void setColumnName(int column, const QString& name);
+
+    const AnalysisColumn& column(int column) const
+    {
+        return m_columns.at(column);
+    }
+    QString text(int row, int column) const;
+
+    void clear();
+
+    bool isValid() const
+    {
+        return columnCount() > 0;
+    }
+
+private:
+    QString m_title;
+    QList<AnalysisColumn> m_columns;
+};
+
+
+/** Parameter of a report column, as chosen in the report tree: its name, the
+  * coordinate system (or the time format, for the Time parameter) and the
+  * units.
+  */
+struct AnalysisReportColumn
+{
+    QString name;
+    QString coordinateSystem;
+    QString units;
+};
+
+
+/** Samples of a mission arc within a time range of a report. The indices
+  * identify the space object, the arc and the time range in the selection.
+  */
+struct AnalysisReportRange
+{
+    int spaceObject;
+    int missionArc;
+    int timeRange;
+    const MissionArc* arc;
+    int firstSample;
+    int lastSample;     // before firstSample when there is no sample in the time range
+
+    int sampleCount() const
+    {
+        return lastSample >= firstSample ? lastSample - firstSample + 1 : 0;
+    }
+};
+
+
+/** The report engine evaluates a plan of report columns over the samples of
+  * mission arcs.
+  *
+  * The states of a range of samples are fetched once, then each column is
+  * computed for the whole range at a time. The quantities shared by several
+  * columns (states converted to a coordinate system, orbital elements,
+  * spherical coordinates, distances to a body) are only computed when a
+  * column of the plan needs them, and once for all the columns that use them.
+  */
+class AnalysisReportEngine
+{
+public:
+    AnalysisReportEngine();
+
+    void addColumn(const QString& name, const QString& coordinateSystem, const QString& units);
+    const QList<AnalysisReportColumn>& plan() const
+    {
+        return m_plan;
+    }
+
+    /** Names of the report columns, with their units. The Access Time
+      * parameter takes four columns.
+      */
+    QStringList columnNames() const;
+
+    /** Type of the report columns, in the order of columnNames()
+      */
+    QList<AnalysisColumn::Type> columnTypes() const;
+
+    /** Evaluate the columns over the samples of a range.
+      */
+    QList<AnalysisColumn> evaluate(const AnalysisReportRange& range) const;
+
+    /** Evaluate the columns over count samples of a range, from the sample
+      * first of the range. The values are those of a whole range evaluation,
+      * so a range can be evaluated in independent chunks.
+      */
+    QList<AnalysisColumn> evaluate(const AnalysisReportRange& range, int first, int count) const;
+
+private:
+    QList<AnalysisReportColumn> m_plan;
+};
+
+#endif // ANALYSISREPORT_H
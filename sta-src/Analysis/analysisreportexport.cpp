@@ -0,0 +1,308 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "analysisreportexport.h"
+
+#include <QFile>
+#include <QDataStream>
+#include <QThread>
+#include <QDebug>
+#include <QtConcurrentMap>
+
+static const char* ColumnarMagic = "STA columnar report 1";
+// Bytes of a value of a text column in a columnar file
+static const int TextWidth = 32;
+// The values of a columnar file start on a multiple of this offset
+static const int ColumnarAlignment = 64;
+
+
+// Rows [first, first + count) of a range, to format in the given format
+struct ExportChunk
+{
+    const AnalysisReportEngine* engine;
+    const AnalysisReportRange* range;
+    int first;
+    int count;
+    AnalysisReportExporter::Format format;
+};
+
+// Rows of a chunk, ready to be written: the CSV lines, or the values of each column
+struct FormattedChunk
+{
+    QByteArray text;
+    QList<QByteArray> columns;
+};
+
+
+static QByteArray CsvField(const QString& value)
+{
+    if (value.contains(',') || value.contains('"') || value.contains('\n'))
+    {
+        QString quoted = value;
+        quoted.replace("\"", "\"\"");
+        return ("\"" + quoted + "\"").toUtf8();
+    }
+
+    return value.toUtf8();
+}
+
+
+static QByteArray RepeatedInt32(qint32 value, int count)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::LittleEndian);
+    for (int i = 0; i < count; ++i)
+    {
+        out << value;
+    }
+
+    return data;
+}
+
+
+static QByteArray ColumnarValues(const AnalysisColumn& column)
+{
+    QByteArray data;
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::LittleEndian);
+    out.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+    if (column.type() == AnalysisColumn::Numeric)
+    {
+        foreach (double value, column.values())
+        {
+            out << value;
+        }
+    }
+    else
+    {
+        foreach (const QString& value, column.textValues())
+        {
+            QByteArray text = value.toUtf8().left(TextWidth);
+            text.append(QByteArray(TextWidth - text.size(), '\0'));
+            out.writeRawData(text.constData(), TextWidth);
+        }
+    }
+
+    return data;
+}
+
+
+static FormattedChunk formatChunk(const ExportChunk& chunk)
+{
+    FormattedChunk formatted;
+    const AnalysisReportRange& range = *chunk.range;
+    QList<AnalysisColumn> columns = chunk.engine->evaluate(range, chunk.first, chunk.count);
+
+    if (chunk.format == AnalysisReportExporter::Csv)
+    {
+        QByteArray prefix = QByteArray::number(range.spaceObject + 1) + "," +
+                            QByteArray::number(range.missionArc + 1) + "," +
+                            QByteArray::number(range.timeRange + 1);
+        for (int row = 0; row < chunk.count; ++row)
+        {
+            formatted.text += prefix;
+            foreach (const AnalysisColumn& column, columns)
+            {
+                formatted.text += ',';
+                if (column.type() == AnalysisColumn::Numeric)
+                {
+                    formatted.text += QByteArray::number(column.values().at(row), 'g', 17);
+                }
+                else
+                {
+                    formatted.text += CsvField(column.textValues().at(row));
+                }
+            }
+            formatted.text += '\n';
+        }
+    }
+    else
+    {
+        formatted.columns << RepeatedInt32(range.spaceObject + 1, chunk.count)
+                          << RepeatedInt32(range.missionArc + 1, chunk.count)
+                          << RepeatedInt32(range.timeRange + 1, chunk.count);
+        foreach (const AnalysisColumn& column, columns)
+        {
+            formatted.columns << ColumnarValues(column);
+        }
+    }
+
+    return formatted;
+}
+
+
+AnalysisReportExporter::AnalysisReportExporter(const AnalysisReportEngine& engine,
+                                               const QList<AnalysisReportRange>& ranges) :
+    m_engine(engine),
+    m_ranges(ranges),
+    m_chunkSize(4096)
+{
+}
+
+
+void
+AnalysisReportExporter::setChunkSize(int rows)
+{
+    m_chunkSize = qMax(1, rows);
+}
+
+
+qint64
+AnalysisReportExporter::rowCount() const
+{
+    qint64 rows = 0;
+    foreach (const AnalysisReportRange& range, m_ranges)
+    {
+        rows += range.sampleCount();
+    }
+
+    return rows;
+}
+
+
+bool
+AnalysisReportExporter::exportReport(const QString& fileName, Format format, AnalysisExportFeedback* feedback)
+{
+    m_errorString.clear();
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        m_errorString = QString("Unable to write %1").arg(fileName);
+        qDebug() << "AnalysisReportExporter:" << m_errorString;
+        return false;
+    }
+
+    QStringList names;
+    names << "Satellite" << "Mission Arc" << "Time Range" << m_engine.columnNames();
+    qint64 rows = rowCount();
+
+    // Header, and bytes per value and position of the columns of a columnar file
+    QByteArray header;
+    QList<int> widths;
+    QList<qint64> offsets;
+    if (format == Csv)
+    {
+        for (int i = 0; i < names.size(); ++i)
+        {
+            header += (i == 0 ? "" : ",") + CsvField(names.at(i));
+        }
+        header += '\n';
+    }
+    else
+    {
+        widths << 4 << 4 << 4;
+        QStringList types;
+        types << "<i4" << "<i4" << "<i4";
+        foreach (AnalysisColumn::Type type, m_engine.columnTypes())
+        {
+            widths << (type == AnalysisColumn::Numeric ? 8 : TextWidth);
+            types << (type == AnalysisColumn::Numeric ? "<f8" : QString("|S%1").arg(TextWidth));
+        }
+
+        // The offsets are written with a fixed number of digits, so that the
+        // size of the header doesn't depend on them
+        int headerSize = QString("%1\nrows %2\n").arg(ColumnarMagic).arg(rows).toUtf8().size() + QByteArray("end\n").size();
+        for (int i = 0; i < names.size(); ++i)
+        {
+            headerSize += QString("column %1 %2 %3\n").arg(types.at(i)).arg(0, 16, 10, QChar('0')).arg(names.at(i)).toUtf8().size();
+        }
+        qint64 offset = (headerSize + ColumnarAlignment - 1) / ColumnarAlignment * ColumnarAlignment;
+
+        QString text = QString("%1\nrows %2\n").arg(ColumnarMagic).arg(rows);
+        for (int i = 0; i < names.size(); ++i)
+        {
+            offsets << offset;
+            text += QString("column %1 %2 %3\n").arg(types.at(i)).arg(offset, 16, 10, QChar('0')).arg(names.at(i));
+            offset += rows * widths.at(i);
+        }
+        text += "end\n";
+
+        header = text.toUtf8();
+        header.append(QByteArray(int(offsets.first() - header.size()), '\0'));
+    }
+
+    bool ok = file.write(header) == header.size();
+
+    QList<ExportChunk> chunks;
+    for (int r = 0; r < m_ranges.size(); ++r)
+    {
+        for (int first = 0; first < m_ranges.at(r).sampleCount(); first += m_chunkSize)
+        {
+            ExportChunk chunk;
+            chunk.engine = &m_engine;
+            chunk.range = &m_ranges.at(r);
+            chunk.first = first;
+            chunk.count = qMin(m_chunkSize, m_ranges.at(r).sampleCount() - first);
+            chunk.format = format;
+            chunks << chunk;
+        }
+    }
+
+    // A batch keeps every thread busy; only one batch of rows is in memory at a time
+    int batchSize = 2 * qMax(1, QThread::idealThreadCount());
+    qint64 rowsWritten = 0;
+
+    for (int b = 0; b < chunks.size() && ok; b += batchSize)
+    {
+        QList<ExportChunk> batch = chunks.mid(b, batchSize);
+        QList<FormattedChunk> formatted = QtConcurrent::blockingMapped<QList<FormattedChunk> >(batch, formatChunk);
+
+        for (int i = 0; i < formatted.size() && ok; ++i)
+        {
+            if (format == Csv)
+            {
+                ok = file.write(formatted.at(i).text) == formatted.at(i).text.size();
+            }
+            else
+            {
+                for (int c = 0; c < formatted.at(i).columns.size() && ok; ++c)
+                {
+                    const QByteArray& values = formatted.at(i).columns.at(c);
+                    ok = file.seek(offsets.at(c) + rowsWritten * widths.at(c)) && file.write(values) == values.size();
+                }
+            }
+            rowsWritten += batch.at(i).count;
+        }
+
+        if (ok && feedback && !feedback->progress(rowsWritten, rows))
+        {
+            m_errorString = "The export was canceled";
+            file.close();
+            file.remove();
+            return false;
+        }
+    }
+
+    if (!ok)
+    {
+        m_errorString = QString("Error writing %1: %2").arg(fileName, file.errorString());
+        qDebug() << "AnalysisReportExporter:" << m_errorString;
+        file.close();
+        file.remove();
+        return false;
+    }
+
+    return true;
+}
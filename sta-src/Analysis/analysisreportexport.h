@@ -0,0 +1,104 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef ANALYSISREPORTEXPORT_H
+#define ANALYSISREPORTEXPORT_H
+
+#include "analysisreport.h"
+#include <QtGlobal>
+
+
+/** Receives the progress of a report export.
+  */
+class AnalysisExportFeedback
+{
+public:
+    virtual ~AnalysisExportFeedback() {}
+
+    /** Called after each block of rows is written. Return false to cancel the
+      * export.
+      */
+    virtual bool progress(qint64 rowsWritten, qint64 rowCount) = 0;
+};
+
+
+/** Export of a report to a file, without keeping the report in memory.
+  *
+  * The ranges of the report are cut in chunks of rows. The chunks are
+  * evaluated and formatted concurrently, a batch at a time, and each batch is
+  * written in order before the next one is evaluated.
+  *
+  * Every row starts with the satellite, mission arc and time range numbers
+  * (counted from 1, as in the text report), followed by the report columns.
+  *
+  * Two formats are written:
+  *  - Csv: a line with the column names, then one line per row.
+  *  - Columnar: a text header followed by the values, column after column,
+  *    so that every column can be memory mapped. The header is
+  *
+  *        STA columnar report 1
+  *        rows <row count>
+  *        column <dtype> <offset> <name>     (once per column)
+  *        end
+  *
+  *    where dtype is the numpy type of the values: <i4 for the satellite, arc
+  *    and time range numbers, <f8 for the numeric columns and |S32 for the
+  *    text columns (32 bytes, padded with zeros). offset is the position of
+  *    the first value of the column in the file. With numpy:
+  *
+  *        numpy.memmap(fileName, dtype, 'r', offset, (rows,))
+  */
+class AnalysisReportExporter
+{
+public:
+    enum Format
+    {
+        Csv,
+        Columnar
+    };
+
+    AnalysisReportExporter(const AnalysisReportEngine& engine, const QList<AnalysisReportRange>& ranges);
+
+    /** Number of rows evaluated at a time by a thread. The default is 4096.
+      */
+    void setChunkSize(int rows);
+
+    qint64 rowCount() const;
+
+    /** Write the report to fileName. Return false if the file can't be
+      * written or the export is canceled; the file is then removed.
+      */
+    bool exportReport(const QString& fileName, Format format, AnalysisExportFeedback* feedback = NULL);
+
+    QString errorString() const
+    {
+        return m_errorString;
+    }
+
+private:
+    AnalysisReportEngine m_engine;
+    QList<AnalysisReportRange> m_ranges;
+    int m_chunkSize;
+    QString m_errorString;
+};
+
+#endif // ANALYSISREPORTEXPORT_H
@@ -74,12 +74,24 @@ QtiPlotMain::createReport(AnalysisResult *analysis)
         t->setColName(i, analysis->columnName(i));
     }
 
-    const QVariantList data = analysis->data();
-    for (int row = 0; row < analysis->rowCount(); ++row)
+    for (int col = 0; col < analysis->columnCount(); ++col)
     {
-        for (int col = 0; col < analysis->columnCount(); ++col)
+        const AnalysisColumn& column = analysis->column(col);
+        if (column.type() == AnalysisColumn::Numeric)
         {
-            t->setText(row, col, data.at(row * analysis->columnCount() + col).toString());
+            const QVector<double>& values = column.values();
+            for (int row = 0; row < values.size(); ++row)
+            {
+                t->setCell(row, col, values.at(row));
+            }
+        }
+        else
+        {
+            t->setTextFormat(col);
+            for (int row = 0; row < column.size(); ++row)
+            {
+                t->setText(row, col, column.text(row));
+            }
         }
     }
 }
@@ -50,6 +50,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <cmath>
+#include <algorithm>
 #include <Eigen/Core>
 
 USING_PART_OF_NAMESPACE_EIGEN
@@ -720,6 +722,113 @@ rk4(typename DERIVCALC::State& state,
 }
 
 
+/** Continuous extension of a Dormand-Prince 5(4) step: interpolates the solution
+  * with 4th order accuracy anywhere inside the step, e.g. to locate events.
+  */
+template<class STATE> class DormandPrinceDenseOutput
+{
+public:
+    double t0;
+    double h;
+    STATE r1;
+    STATE r2;
+    STATE r3;
+    STATE r4;
+    STATE r5;
+
+    STATE interpolate(double t) const
+    {
+        double theta = (t - t0) / h;
+        double theta1 = 1.0 - theta;
+        return r1 + theta * (r2 + theta1 * (r3 + theta * (r4 + theta1 * r5)));
+    }
+};
+
+/** One step of the adaptive Dormand-Prince 5(4) integrator (Hairer, Norsett, Wanner,
+  * "Solving Ordinary Differential Equations I"), designed to work with a subclass of
+  * DerivativeCalculator like rk4.
+  *
+  * derivative is the derivative at (t, state). On output newState and newDerivative
+  * are the 5th order solution at t+h and its derivative, which is also the first
+  * stage of the next step; they must not be the same objects as the inputs. The return value is the RMS norm of the error estimate
+  * scaled by absTol + relTol*|y|: the step is accepted when it's not larger than 1.
+  * If dense isn't null, it's filled with the continuous extension of the step.
+  */
+template<class DERIVCALC> double
+dopri54(const typename DERIVCALC::State& state,
+        const typename DERIVCALC::State& derivative,
+        double t,
+        double h,
+        double absTol,
+        double relTol,
+        const DERIVCALC* derivativeCalculator,
+        typename DERIVCALC::State& newState,
+        typename DERIVCALC::State& newDerivative,
+        DormandPrinceDenseOutput<typename DERIVCALC::State>* dense = NULL)
+{
+    typedef typename DERIVCALC::State State;
+
+    const State& k1 = derivative;
+    State k2;
+    State k3;
+    State k4;
+    State k5;
+    State k6;
+    State& k7 = newDerivative;
+    State state_temp;
+
+    state_temp = state + h * (1.0 / 5.0) * k1;
+    derivativeCalculator->compute(state_temp, t + h / 5.0, k2);
+
+    state_temp = state + h * ((3.0 / 40.0) * k1 + (9.0 / 40.0) * k2);
+    derivativeCalculator->compute(state_temp, t + h * 3.0 / 10.0, k3);
+
+    state_temp = state + h * ((44.0 / 45.0) * k1 - (56.0 / 15.0) * k2 + (32.0 / 9.0) * k3);
+    derivativeCalculator->compute(state_temp, t + h * 4.0 / 5.0, k4);
+
+    state_temp = state + h * ((19372.0 / 6561.0) * k1 - (25360.0 / 2187.0) * k2 + (64448.0 / 6561.0) * k3
+                              - (212.0 / 729.0) * k4);
+    derivativeCalculator->compute(state_temp, t + h * 8.0 / 9.0, k5);
+
+    state_temp = state + h * ((9017.0 / 3168.0) * k1 - (355.0 / 33.0) * k2 + (46732.0 / 5247.0) * k3
+                              + (49.0 / 176.0) * k4 - (5103.0 / 18656.0) * k5);
+    derivativeCalculator->compute(state_temp, t + h, k6);
+
+    newState = state + h * ((35.0 / 384.0) * k1 + (500.0 / 1113.0) * k3 + (125.0 / 192.0) * k4
+                            - (2187.0 / 6784.0) * k5 + (11.0 / 84.0) * k6);
+    derivativeCalculator->compute(newState, t + h, k7);
+
+    // Difference between the 5th and the embedded 4th order solutions
+    State error = h * ((71.0 / 57600.0) * k1 - (71.0 / 16695.0) * k3 + (71.0 / 1920.0) * k4
+                       - (17253.0 / 339200.0) * k5 + (22.0 / 525.0) * k6 - (1.0 / 40.0) * k7);
+
+    double sum = 0.0;
+    for (int i = 0; i < state.size(); i++)
+    {
+        double scale = absTol + relTol * std::max(std::abs(state[i]), std::abs(newState[i]));
+        double e = error[i] / scale;
+        sum += e * e;
+    }
+
+    if (dense)
+    {
+        State difference = newState - state;
+        State bspl = h * k1 - difference;
+        dense->t0 = t;
+        dense->h = h;
+        dense->r1 = state;
+        dense->r2 = difference;
+        dense->r3 = bspl;
+        dense->r4 = difference - h * k7 - bspl;
+        dense->r5 = h * ((-12715105075.0 / 11282082432.0) * k1 + (87487479700.0 / 32700410799.0) * k3
+                         - (10690763975.0 / 1880347072.0) * k4 + (701980252875.0 / 199316789632.0) * k5
+                         - (1453857185.0 / 822651844.0) * k6 + (69997945.0 / 29380423.0) * k7);
+    }
+
+    return std::sqrt(sum / state.size());
+}
+
+
 
 /*!
    \brief Adams-Bashforth multistep method
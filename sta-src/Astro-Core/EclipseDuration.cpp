@@ -29,12 +29,6 @@
 
 #include <math.h>
 
-//to Read and write to file
-#include <QFile>
-#include <QTextStream>
-#include <QDir>
-#include <QProcess>
-
 #include <QDebug>
 
 //erase -#include "Astro-Core/date.h"- after analysis module integration
@@ -135,249 +129,47 @@ bool EclipseDuration::IsSpacecraftInPenumbra(MyVector3d StarCoordinates,
         return false;
 }
 
-void EclipseDuration::StarLightTimeFunction(QList<double> &sampleTimes,
-                                            QList<sta::StateVector> &SCCoordinates,
-                                            StaBody* Planet,
-                                            StaBody* Star)
+QVector<double> EclipseDuration::StarLightTimeFunction(const QList<double> &sampleTimes,
+                                                       const QList<sta::StateVector> &SCCoordinates,
+                                                       StaBody* Planet,
+                                                       StaBody* Star)
 {
     m_PlanetMeanDiameter = 2 * Planet->meanRadius();
     m_StarMeanDiameter = 2 * Star->meanRadius();
 
-    QString path = QString("data/EclipseStarLight.stad");
-
-    QFile EclipseStarLight(path);
-    EclipseStarLight.open(QIODevice::ReadWrite);
-//       qDebug()<<"EclipseStarLight.fileName()"<<EclipseStarLight.fileName();
-//       qDebug()<<"EclipseStarLight.isOpen()"<<EclipseStarLight.isOpen();
-    QTextStream EclipseStarLightStream(&EclipseStarLight);
-    EclipseStarLightStream.setRealNumberPrecision(16);
-
-//    MyVector3d  PlanetCoordinates;
-//    PlanetCoordinates.setZero(3);
+    QVector<double> starLight(sampleTimes.size());
 
     int i;
     for (i=0;i<sampleTimes.size();i++)
     {
-        //sample Time
-//        EclipseStarLightStream<<sta::JdToCalendar
-//                (sta::MjdToJd(sampleTimes.at(i))).toString(Qt::ISODate);
-        EclipseStarLightStream<<sampleTimes.at(i);
-        EclipseStarLightStream<<"\t";
-
         double tempEclipse = 0.0;
 
+        MyVector3d StarCoordinates = Star->stateVector(sampleTimes.at(i),
+                                                       Planet,
+                                                       sta::COORDSYS_EME_J2000).position;
+        MyVector3d PlanetCoordinates = Planet->stateVector(sampleTimes.at(i),
+                                                           Planet,
+                                                           sta::COORDSYS_EME_J2000).position;
+
         //check if it is in Penumbra or Umbra
-        if (EclipseDuration::IsSpacecraftInUmbra
-            ((Star->stateVector(sampleTimes.at(i),
-                                Planet,
-                                sta::COORDSYS_EME_J2000).position),
-             (Planet->stateVector(sampleTimes.at(i),
-                                  Planet,
-                                  sta::COORDSYS_EME_J2000).position),
-             SCCoordinates.at(i).position))
+        if (EclipseDuration::IsSpacecraftInUmbra(StarCoordinates,
+                                                 PlanetCoordinates,
+                                                 SCCoordinates.at(i).position))
             tempEclipse = 0.0;
-        //            (Star->stateVector(sampleTimes.at(i),
-        //                               Planet,
-        //                               sta::COORDSYS_BODYFIXED).position,
-        //             PlanetCoordinates,
-        //             SCCoordinates.at(i).position))
-        //            tempEclipse = 0.0;
         else
         {
-            if (EclipseDuration::IsSpacecraftInPenumbra
-                ((Star->stateVector(sampleTimes.at(i),
-                                    Planet,
-                                    sta::COORDSYS_EME_J2000).position),
-                 (Planet->stateVector(sampleTimes.at(i),
-                                      Planet,
-                                      sta::COORDSYS_EME_J2000).position),
-                 SCCoordinates.at(i).position))
-                //                (Star->stateVector(sampleTimes.at(i),
-                //                                   Planet,
-                //                                   sta::COORDSYS_EME_J2000).position,
-                //                 PlanetCoordinates,
-                //                 SCCoordinates.at(i).position))
+            if (EclipseDuration::IsSpacecraftInPenumbra(StarCoordinates,
+                                                        PlanetCoordinates,
+                                                        SCCoordinates.at(i).position))
                 tempEclipse = 0.5;
             else
                 tempEclipse = 1.0;
         }
 
-        EclipseStarLightStream<<tempEclipse;
-        EclipseStarLightStream<<"\n";
+        starLight[i] = tempEclipse;
     }
 
-    EclipseStarLightStream<<endl;
-
-    EclipseStarLight.close();
-    CreateEclipseDetailsFile();
-
-}
-
-void EclipseDuration::CreateEclipseDetailsFile()
-{
-    //open the eclipse time function to read
-    //reach to the Eclipse information file------------
-    QString path = QString("data/EclipseStarLight.stad");
-
-    QFile EclipseStarLight(path);
-    EclipseStarLight.open(QIODevice::ReadOnly);
-//       qDebug()<<"EclipseStarLight.fileName()"<<EclipseStarLight.fileName();
-//       qDebug()<<"EclipseStarLight.isOpen()"<<EclipseStarLight.isOpen();
-    QTextStream EclipseStarLightStream(&EclipseStarLight);
-//    EclipseStarLightStream.setRealNumberPrecision(16);
-
-    //open the file you want to put the results--------
-    QString path2 = QString
-                   ("data/EclipseDetailedReport.stad");
-
-    QFile DetailedReport(path2);
-    DetailedReport.open(QIODevice::ReadWrite);
-//           qDebug()<<"GeneratedPowerTime.fileName()"<<DetailedReport.fileName();
-//           qDebug()<<"GeneratedPowerTime.isOpen()"<<DetailedReport.isOpen();
-    QTextStream DetailedReportStream(&DetailedReport);
-    DetailedReportStream.setRealNumberPrecision(16);
-
-    //write a description to the title of the report
-    DetailedReportStream << "State" << "\t\t";
-    DetailedReportStream << "Start(mjd)" << "\t\t";
-    DetailedReportStream << "End(mjd)" << "\t\t";
-    DetailedReportStream << "Duration(s)" << "\t";
-    DetailedReportStream << "#ofSteps"<<"\n";
-
-    double State;
-    double missionStartMjd = 0.0;
-    double missionEndMjd = 0.0;
-    double tempState;
-    double tempMissionEndMjd = 0.0;
-    int    numberOfStepsInState = 0;
-
-    numberOfStepsInState = 1;
-    EclipseStarLightStream >> missionStartMjd;
-    tempMissionEndMjd = missionStartMjd;
-    EclipseStarLightStream >> State;
-    tempState = State;
-
-    while (!EclipseStarLightStream.atEnd())
-    {
-        while (State <= 0.5 )//Penumbra + Umbra
-        {
-            if (!EclipseStarLightStream.atEnd())
-            {
-                missionEndMjd = tempMissionEndMjd;
-                State = tempState;
-
-                //if the state is changed or the file is ended
-                if (State > 0.5)
-                {
-                    //write the detailed report
-                    DetailedReportStream << "Eclipse" << "\t\t";
-                    DetailedReportStream << missionStartMjd << "\t";
-                    DetailedReportStream << missionEndMjd << "\t";
-                    //calculate duration from ANas module but it has
-                    //to be replied after her commit
-                    DetailedReportStream << MjdToFromEpoch(missionStartMjd,
-                                                           missionEndMjd,
-                                                           "Seconds") << "\t";
-                    DetailedReportStream << (numberOfStepsInState -1) << "\n";
-
-                    missionStartMjd = missionEndMjd;
-                    numberOfStepsInState = 1;
-                    break;
-                }
-
-            }
-            else
-            {
-                //write the detailed report
-                DetailedReportStream << "Eclipse" << "\t\t";
-                DetailedReportStream << missionStartMjd << "\t";
-                DetailedReportStream << missionEndMjd << "\t";
-                //calculate duration from ANas module but it has
-                //to be replied after her commit
-                DetailedReportStream << MjdToFromEpoch(missionStartMjd,
-                                                       missionEndMjd,
-                                                       "Seconds") << "\t";
-                DetailedReportStream << (numberOfStepsInState -1) << "\n";
-
-                missionStartMjd = missionEndMjd;
-                numberOfStepsInState = 1;
-                break;
-            }
-
-            EclipseStarLightStream >> tempMissionEndMjd;
-            EclipseStarLightStream >> tempState;
-            numberOfStepsInState++; //increase the number of steps
-        }
-
-        while (State > 0.5) //Daylight
-        {
-            if (!EclipseStarLightStream.atEnd())
-            {
-                missionEndMjd = tempMissionEndMjd;
-                State = tempState;
-
-                if (State <= 0.5)
-                {
-                    //write the detailed report
-                    DetailedReportStream << "Daylight" << "\t";
-                    DetailedReportStream << missionStartMjd << "\t";
-                    DetailedReportStream << missionEndMjd << "\t";
-                    //calculate duration from ANas module but it has
-                    //to be replied after her commit
-                    DetailedReportStream << MjdToFromEpoch(missionStartMjd,
-                                                           missionEndMjd,
-                                                           "Seconds") << "\t";
-                    DetailedReportStream << (numberOfStepsInState -1) << "\n";
-
-                    missionStartMjd = missionEndMjd;
-                    numberOfStepsInState = 1;
-
-    //                qDebug()<<"missionStartMjd"<<missionStartMjd;
-    //                qDebug()<<"missionEndMjd"<<missionEndMjd;
-    //                qDebug()<<"numberOfStepsInState"<<numberOfStepsInState;
-                    break;
-                }
-            }
-            else
-            {
-                //write the detailed report
-                DetailedReportStream << "Daylight" << "\t";
-                DetailedReportStream << missionStartMjd << "\t";
-                DetailedReportStream << missionEndMjd << "\t";
-                //calculate duration from ANas module but it has
-                //to be replied after her commit
-                DetailedReportStream << MjdToFromEpoch(missionStartMjd,
-                                                       missionEndMjd,
-                                                       "Seconds") << "\t";
-                DetailedReportStream << (numberOfStepsInState -1) << "\n";
-
-                missionStartMjd = missionEndMjd;
-                numberOfStepsInState = 1;
-
-//                qDebug()<<"missionStartMjd"<<missionStartMjd;
-//                qDebug()<<"missionEndMjd"<<missionEndMjd;
-//                qDebug()<<"numberOfStepsInState"<<numberOfStepsInState;
-                break;
-            }
-
-//            qDebug()<<"******missionStartMjd"<<missionStartMjd;
-//            qDebug()<<"missionEndMjd"<<missionEndMjd;
-//            qDebug()<<"numberOfStepsInState"<<numberOfStepsInState;
-
-            EclipseStarLightStream >> tempMissionEndMjd;
-            EclipseStarLightStream >> tempState;
-            numberOfStepsInState++; //increase the number of steps
-        }
-    }
-
-//    qDebug()<<"missionStartMjd"<<missionStartMjd;
-//    qDebug()<<"missionEndMjd"<<missionEndMjd;
-//    qDebug()<<"numberOfStepsInState"<<numberOfStepsInState;
-    
-    DetailedReportStream << endl;
-
-    DetailedReport.close();
-    EclipseStarLight.close();
+    return starLight;
 }
 
 
@@ -25,6 +25,7 @@
 #define ECLIPSEDURATION_H
 
 #include <QList>
+#include <QVector>
 
 #include "Astro-Core/statevector.h"
 #include "Astro-Core/stabody.h"
@@ -52,17 +53,16 @@ public:
     // Creates the Eclipse State vs Time Function of the mission for any module
     /*
       * StarLightTimeFunction gives 0 in Umbra, 0.5 in Penumbra
-      * and 1 under Starlught conditions and fills "EclipseStarLight.stad"
+      * and 1 under Starlight conditions, one value per sample time.
+      * The values are kept in memory; the systems engineering module
+      * writes them to file only when a report is requested
+      * (see SemTimeSeries)
     */
 
-    void StarLightTimeFunction(QList<double>& sampleTimes,
-                              QList<sta::StateVector>& SCCoordinates,
-                              StaBody* Planet,
-                              StaBody* StarRadius);
-
-    // Creates UMBRA-PENUMBRA-DAYLIGHT details for the user
-    //(for now it is not doing penumbra calculations, umbra include penumbra)
-    void CreateEclipseDetailsFile();
+    QVector<double> StarLightTimeFunction(const QList<double>& sampleTimes,
+                                          const QList<sta::StateVector>& SCCoordinates,
+                                          StaBody* Planet,
+                                          StaBody* StarRadius);
 
 
     //Erase after Analysis module integration
@@ -24,9 +24,14 @@
 #include "SpiceEphemeris.h"
 #include "SpiceUsr.h"
 #include <QMap>
+#include <QMutex>
 
 using namespace sta;
 
+// CSPICE keeps global state and is not reentrant, so all calls made after the
+// kernels are loaded must be serialized.
+static QMutex SpiceMutex;
+
 
 SpiceEphemeris::SpiceEphemeris()
 {
@@ -135,6 +140,8 @@ SpiceEphemeris::stateVector(const StaBody* body,
     double state[6];
     double lightTime = 0.0;
 
+    QMutexLocker locker(&SpiceMutex);
+
     // The time argument for SPICE is seconds since J2000 TDB
     double et = sta::MjdToSecJ2000(mjd);
 
@@ -51,6 +51,9 @@ public:
     virtual const QList<StaBodyId>& bodyList() const;
     virtual const StaBody* parentBody(const StaBody* body) const;
     virtual const sta::CoordinateSystemType coordinateSystem(const StaBody* body) const;
+    /** Thread safe: CSPICE is not reentrant, so concurrent calls
+      * are serialized.
+      */
     virtual StateVector stateVector(const StaBody* body,
                                     double mjd,
                                     const StaBody* center,
@@ -42,6 +42,7 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 #include "Entry/capsule.h"
+#include "RAM/aerodatabase.h"
 #include <QErrorMessage>
 #include <QDebug>
 
@@ -260,7 +261,8 @@ double doublefactorial(int num)
 }
 
 /////////////////////////////// Atmospheric Drag Perturbation ///////////////////////////////
-AtmosphericDragPerturbations::AtmosphericDragPerturbations(const QString& atmosphereModel)
+AtmosphericDragPerturbations::AtmosphericDragPerturbations(const QString& atmosphereModel) :
+    m_dragCoefficient(-1)
 {
 #if OLDSCENARIO
     m_atmosphericModel = perturbation->atmosphericModel();
@@ -285,23 +287,80 @@ AtmosphericDragPerturbations::calculateAcceleration(sta::StateVector state, doub
     double h = altitude(body(), state, time);
     double rho = atmosphere.density(h * pow(10,3.0)) * pow(10,9.0);
 
-    //Calculating the CD coefficient from the altitude (calling re-entry module functions)
-    capsule_class vehicle;
-    vehicle.selectCdCprofile(cdCoefficients());
-    double cd = vehicle.cdc(h * pow(10,3.0));
-
     //Considering the atmosphere rotating with the Earth
     //TO DO put omega as a property of StaBody; only earth rotation has been considered
     double omega = 7.29211585494e-5;
     state.velocity.x() += omega * state.position.y();
     state.velocity.y() -= omega * state.position.x();
 
+    double cd;
+    if (AeroDatabase::isDatabaseFile(cdCoefficients()))
+    {
+        //Binary database, loaded once and evaluated at the Mach number of the relative velocity
+        if (m_aeroDatabase.isNull())
+        {
+            loadAeroDatabase();
+        }
+        if (m_dragCoefficient < 0)
+        {
+            cd = 0.0;
+        }
+        else
+        {
+            double mach = state.velocity.norm() * pow(10,3.0) / atmosphere.speedofsound(h * pow(10,3.0));
+            cd = m_aeroDatabase->coefficient(AeroDatabase::Coefficient(m_dragCoefficient), mach, 0.0, 0.0);
+        }
+    }
+    else
+    {
+        //Calculating the CD coefficient from the altitude (calling re-entry module functions)
+        capsule_class vehicle;
+        vehicle.selectCdCprofile(cdCoefficients());
+        cd = vehicle.cdc(h * pow(10,3.0));
+    }
+
     //Calculating the accelerations vector
     Vector3d acceleration = - 0.5 * rho * state.velocity.norm() * state.velocity * (cd * surface()*pow(10,-6.0))/mass();
 
     return acceleration;
 }
 
+/** Load the binary aerodynamic database and select its drag coefficient: CD,
+  * or else CA, which is equal to CD at zero incidence. If neither can be read
+  * the error is reported and the drag is ignored.
+  */
+bool AtmosphericDragPerturbations::loadAeroDatabase()
+{
+    QString fileName = "data/aerodynamics/" + cdCoefficients();
+    m_aeroDatabase = QSharedPointer<AeroDatabase>(new AeroDatabase());
+    m_dragCoefficient = -1;
+
+    if (!m_aeroDatabase->load(fileName))
+    {
+        m_errorString = QString("Unable to load the aerodynamic database %1").arg(fileName);
+    }
+    else if (m_aeroDatabase->hasCoefficient(AeroDatabase::CD))
+    {
+        m_dragCoefficient = AeroDatabase::CD;
+    }
+    else if (m_aeroDatabase->hasCoefficient(AeroDatabase::CA))
+    {
+        m_dragCoefficient = AeroDatabase::CA;
+    }
+    else
+    {
+        m_errorString = QString("The aerodynamic database %1 has neither CD nor CA").arg(fileName);
+    }
+
+    if (!m_errorString.isEmpty())
+    {
+        qWarning() << "Atmospheric drag:" << m_errorString;
+        return false;
+    }
+
+    return true;
+}
+
 /////////////////////////////// Solar Pressure Perturbation ///////////////////////////////
 SolarPressurePerturbations::SolarPressurePerturbations(StaBody* centralBody,
                                                        double reflectivity,
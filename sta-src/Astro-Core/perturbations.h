@@ -33,9 +33,12 @@
 #include "Scenario/scenario.h"
 #include "Astro-Core/stabody.h"
 #include <Eigen/Core>
+#include <QSharedPointer>
 
 USING_PART_OF_NAMESPACE_EIGEN
 
+class AeroDatabase;
+
 /**
  * Abstract base class of all perturbations.
  */
@@ -140,17 +143,28 @@ public:
      * Return the string of the name of the file containig the cd coefficients.
      */
     QString cdCoefficients() const {return m_cdCoefficients;}
+    /**
+     * Return the error met while reading the drag coefficients, or an empty
+     * string if there was none. The drag is zero after an error.
+     */
+    QString errorString() const {return m_errorString;}
     /**
      * Return the perturbing acceleration due to the atmospheric drag.
      */
     virtual Vector3d calculateAcceleration(sta::StateVector, double, double);
 
+private:
+    bool loadAeroDatabase();
+
 private:
     QString m_atmosphericModel;
     const StaBody* m_body;
     double m_surface;
     double m_mass;
     QString m_cdCoefficients;
+    QSharedPointer<AeroDatabase> m_aeroDatabase;   // loaded on first use when m_cdCoefficients is a binary database
+    int m_dragCoefficient;                         // AeroDatabase::Coefficient used as drag coefficient, -1 if none
+    QString m_errorString;
 };
 
 /**
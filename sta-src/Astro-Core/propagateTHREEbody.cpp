@@ -27,6 +27,7 @@
  */
 
 #include "propagateTHREEbody.h"
+#include "threebodypropagator.h"
 #include <cmath>
 #include "EODE/eode.h"
 #include <iomanip>
@@ -116,3 +117,19 @@ void radius (double mi, double x, double y, double z, double &R1, double &R2)
         R2 = sqrt(pow(x-1+mi,2)+pow(y,2)+pow(z,2));	//(distance of mass 3 from mass 2)
 
 }
+
+
+bool threebody_propagate (double mi, double sol[], double duration, double tolerance)
+
+{
+        ThreeBodyPropagator propagator(mi);
+        propagator.setTolerance(tolerance, tolerance);
+
+        ThreeBodyPropagator::State state;
+        state << sol[3], sol[4], sol[5], sol[0], sol[1], sol[2];
+        bool ok = propagator.propagate(state, duration);
+
+        sol[3]=state(0); sol[4]=state(1); sol[5]=state(2);
+        sol[0]=state(3); sol[1]=state(4); sol[2]=state(5);
+        return ok;
+}
@@ -37,6 +37,9 @@ void halorbit_EOM (double time , double sol[], double par[], double deriv[]);
 
 void radius (double mi, double x, double y, double z, double &R1, double &R2);
 
+//propagation of sol, laid out as in threebody_EOM, over duration with the reentrant ThreeBodyPropagator
+bool threebody_propagate (double mi, double sol[], double duration, double tolerance);
+
 
 
 #endif // PROPAGATETHREEBODY_H
@@ -0,0 +1,342 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "threebodypropagator.h"
+#include <QtGlobal>
+#include <cmath>
+
+static const double InitialStep = 1.0e-2;
+static const double MinimumStep = 1.0e-12;
+static const double CrossingTolerance = 1.0e-13;
+static const int MaximumSteps = 1000000;
+
+
+// Second derivatives Uxx, Uxy, Uxz, Uyy, Uyz, Uzz of the effective potential
+// U = (x^2 + y^2)/2 + (1 - mu)/r1 + mu/r2
+static void potentialHessian(double mu, double x, double y, double z, double* H)
+{
+    double dx1 = x + mu;
+    double dx2 = x - 1.0 + mu;
+    double r1Squared = dx1 * dx1 + y * y + z * z;
+    double r2Squared = dx2 * dx2 + y * y + z * z;
+    double k1 = (1.0 - mu) / (r1Squared * sqrt(r1Squared));
+    double k2 = mu / (r2Squared * sqrt(r2Squared));
+    double l1 = 3.0 * k1 / r1Squared;
+    double l2 = 3.0 * k2 / r2Squared;
+
+    H[0] = 1.0 - k1 - k2 + l1 * dx1 * dx1 + l2 * dx2 * dx2;
+    H[1] = l1 * dx1 * y + l2 * dx2 * y;
+    H[2] = l1 * dx1 * z + l2 * dx2 * z;
+    H[3] = 1.0 - k1 - k2 + (l1 + l2) * y * y;
+    H[4] = (l1 + l2) * y * z;
+    H[5] = -k1 - k2 + (l1 + l2) * z * z;
+}
+
+
+void ThreeBodyDerivativeCalculator::compute(const State& s, double /* t */, State& derivatives) const
+{
+    double dx1 = s(0) + m_mu;
+    double dx2 = s(0) - 1.0 + m_mu;
+    double r1 = sqrt(dx1 * dx1 + s(1) * s(1) + s(2) * s(2));
+    double r2 = sqrt(dx2 * dx2 + s(1) * s(1) + s(2) * s(2));
+    double k1 = (1.0 - m_mu) / (r1 * r1 * r1);
+    double k2 = m_mu / (r2 * r2 * r2);
+
+    derivatives(0) = s(3);
+    derivatives(1) = s(4);
+    derivatives(2) = s(5);
+    derivatives(3) = 2.0 * s(4) + s(0) - k1 * dx1 - k2 * dx2;
+    derivatives(4) = -2.0 * s(3) + s(1) - k1 * s(1) - k2 * s(1);
+    derivatives(5) = -k1 * s(2) - k2 * s(2);
+}
+
+
+/**
+ * Equations of motion together with the variational equations. The state is
+ * (x, y, z, vx, vy, vz) followed by the state transition matrix, row after row.
+ */
+class ThreeBodyVariationalCalculator : public DerivativeCalculator<42>
+{
+public:
+    explicit ThreeBodyVariationalCalculator(double massParameter) : m_motion(massParameter), m_mu(massParameter) {}
+
+    void compute(const State& s, double t, State& derivatives) const
+    {
+        ThreeBodyDerivativeCalculator::State x;
+        ThreeBodyDerivativeCalculator::State dx;
+        for (int i = 0; i < 6; i++)
+        {
+            x(i) = s(i);
+        }
+        m_motion.compute(x, t, dx);
+        for (int i = 0; i < 6; i++)
+        {
+            derivatives(i) = dx(i);
+        }
+
+        double H[6];
+        potentialHessian(m_mu, s(0), s(1), s(2), H);
+
+        // d(stm)/dt = [0 I; H Omega] * stm, with Omega the Coriolis terms
+        for (int j = 0; j < 6; j++)
+        {
+            double p0 = s(6 + j);
+            double p1 = s(12 + j);
+            double p2 = s(18 + j);
+            double v0 = s(24 + j);
+            double v1 = s(30 + j);
+            double v2 = s(36 + j);
+            derivatives(6 + j) = v0;
+            derivatives(12 + j) = v1;
+            derivatives(18 + j) = v2;
+            derivatives(24 + j) = H[0] * p0 + H[1] * p1 + H[2] * p2 + 2.0 * v1;
+            derivatives(30 + j) = H[1] * p0 + H[3] * p1 + H[4] * p2 - 2.0 * v0;
+            derivatives(36 + j) = H[2] * p0 + H[4] * p1 + H[5] * p2;
+        }
+    }
+
+private:
+    ThreeBodyDerivativeCalculator m_motion;
+    double m_mu;
+};
+
+typedef ThreeBodyVariationalCalculator::State VariationalState;
+
+
+static VariationalState packState(const ThreeBodyPropagator::State& state, const ThreeBodyPropagator::Matrix6& stm)
+{
+    VariationalState s;
+    for (int i = 0; i < 6; i++)
+    {
+        s(i) = state(i);
+        for (int j = 0; j < 6; j++)
+        {
+            s(6 + 6 * i + j) = stm(i, j);
+        }
+    }
+    return s;
+}
+
+
+static void unpackState(const VariationalState& s, ThreeBodyPropagator::State& state, ThreeBodyPropagator::Matrix6& stm)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        state(i) = s(i);
+        for (int j = 0; j < 6; j++)
+        {
+            stm(i, j) = s(6 + 6 * i + j);
+        }
+    }
+}
+
+
+/**
+ * Integrate from t to endTime, advancing t. With stopOnCrossing, the integration
+ * stops instead at the first sign change of y, and crossed is set. Return false
+ * if the integrator gave up before the end time.
+ */
+template<class DERIVCALC> static bool
+integrate(const DERIVCALC& calculator, typename DERIVCALC::State& state, double& t, double endTime,
+          double absTol, double relTol, bool stopOnCrossing, bool* crossed)
+{
+    typedef typename DERIVCALC::State State;
+
+    if (crossed)
+    {
+        *crossed = false;
+    }
+    if (endTime <= t)
+    {
+        return endTime == t;
+    }
+
+    State derivative;
+    calculator.compute(state, t, derivative);
+
+    // Side of the plane y = 0 the trajectory starts from
+    double side = state(1) != 0.0 ? state(1) : derivative(1);
+    double direction = side >= 0.0 ? 1.0 : -1.0;
+
+    double step = qMin(InitialStep, endTime - t);
+    for (int steps = 0; steps < MaximumSteps; steps++)
+    {
+        bool lastStep = step >= endTime - t;
+        double h = lastStep ? endTime - t : step;
+        State newState;
+        State newDerivative;
+        DormandPrinceDenseOutput<State> dense;
+        double error = dopri54(state, derivative, t, h, absTol, relTol,
+                               &calculator, newState, newDerivative, &dense);
+
+        double factor = qBound(0.2, 0.9 * pow(qMax(error, 1.0e-10), -0.2), 5.0);
+        if (error > 1.0 && h > MinimumStep)
+        {
+            step = qMax(MinimumStep, h * factor);
+            continue;
+        }
+        if (h < step)
+            step = qMax(step, h * factor);    // step shortened to end on the end time
+        else
+            step = h * factor;
+
+        double stepEnd = lastStep ? endTime : t + h;
+        if (stopOnCrossing)
+        {
+            double g0 = direction * state(1);
+            double g1 = direction * newState(1);
+            if (g0 > 0.0 && g1 <= 0.0)
+            {
+                // Illinois method on the continuous extension of the step
+                double t0 = t;
+                double t1 = stepEnd;
+                int lastSide = 0;
+                for (int i = 0; i < 100 && t1 - t0 > CrossingTolerance; i++)
+                {
+                    double tc = (t0 * g1 - t1 * g0) / (g1 - g0);
+                    double g = direction * dense.interpolate(tc)(1);
+                    if (g > 0.0)
+                    {
+                        t0 = tc;
+                        g0 = g;
+                        if (lastSide == -1)
+                            g1 *= 0.5;
+                        lastSide = -1;
+                    }
+                    else
+                    {
+                        t1 = tc;
+                        g1 = g;
+                        if (lastSide == 1)
+                            g0 *= 0.5;
+                        lastSide = 1;
+                    }
+                }
+
+                // A fifth order step to the crossing rather than the interpolant
+                dopri54(state, derivative, t, t1 - t, absTol, relTol,
+                        &calculator, newState, newDerivative);
+                state = newState;
+                t = t1;
+                if (crossed)
+                {
+                    *crossed = true;
+                }
+                return true;
+            }
+        }
+
+        t = stepEnd;
+        state = newState;
+        derivative = newDerivative;
+        if (lastStep)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+ThreeBodyPropagator::ThreeBodyPropagator(double massParameter) :
+    m_massParameter(massParameter),
+    m_absTol(1.0e-12),
+    m_relTol(1.0e-12)
+{
+}
+
+
+void ThreeBodyPropagator::setTolerance(double absTol, double relTol)
+{
+    m_absTol = absTol;
+    m_relTol = relTol;
+}
+
+
+bool ThreeBodyPropagator::propagate(State& state, double duration) const
+{
+    ThreeBodyDerivativeCalculator calculator(m_massParameter);
+    double t = 0.0;
+    return integrate(calculator, state, t, duration, m_absTol, m_relTol, false, NULL);
+}
+
+
+bool ThreeBodyPropagator::propagate(State& state, Matrix6& stm, double duration) const
+{
+    ThreeBodyVariationalCalculator calculator(m_massParameter);
+    VariationalState s = packState(state, stm);
+    double t = 0.0;
+    bool ok = integrate(calculator, s, t, duration, m_absTol, m_relTol, false, NULL);
+    unpackState(s, state, stm);
+    return ok;
+}
+
+
+bool ThreeBodyPropagator::propagateToPlaneCrossing(State& state, Matrix6& stm, double& time,
+                                                   double minimumTime, double maximumTime) const
+{
+    ThreeBodyVariationalCalculator calculator(m_massParameter);
+    VariationalState s = packState(state, stm);
+    double t = 0.0;
+    bool crossed = false;
+    bool ok = integrate(calculator, s, t, qMax(0.0, minimumTime), m_absTol, m_relTol, false, NULL) &&
+              integrate(calculator, s, t, maximumTime, m_absTol, m_relTol, true, &crossed);
+    unpackState(s, state, stm);
+    time = t;
+    return ok && crossed;
+}
+
+
+ThreeBodyPropagator::State ThreeBodyPropagator::derivatives(const State& state) const
+{
+    ThreeBodyDerivativeCalculator calculator(m_massParameter);
+    State d;
+    calculator.compute(state, 0.0, d);
+    return d;
+}
+
+
+ThreeBodyPropagator::Matrix6 ThreeBodyPropagator::jacobian(const State& state) const
+{
+    double H[6];
+    potentialHessian(m_massParameter, state(0), state(1), state(2), H);
+
+    Matrix6 A = Matrix6::Zero();
+    A(0, 3) = A(1, 4) = A(2, 5) = 1.0;
+    A(3, 0) = H[0]; A(3, 1) = H[1]; A(3, 2) = H[2];
+    A(4, 0) = H[1]; A(4, 1) = H[3]; A(4, 2) = H[4];
+    A(5, 0) = H[2]; A(5, 1) = H[4]; A(5, 2) = H[5];
+    A(3, 4) = 2.0;
+    A(4, 3) = -2.0;
+    return A;
+}
+
+
+double ThreeBodyPropagator::jacobiConstant(const State& state) const
+{
+    double mu = m_massParameter;
+    double r1 = sqrt((state(0) + mu) * (state(0) + mu) + state(1) * state(1) + state(2) * state(2));
+    double r2 = sqrt((state(0) - 1.0 + mu) * (state(0) - 1.0 + mu) + state(1) * state(1) + state(2) * state(2));
+    double v2 = state(3) * state(3) + state(4) * state(4) + state(5) * state(5);
+    return state(0) * state(0) + state(1) * state(1) + 2.0 * (1.0 - mu) / r1 + 2.0 * mu / r2 - v2;
+}
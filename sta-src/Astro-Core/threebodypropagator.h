@@ -0,0 +1,103 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef THREEBODYPROPAGATOR_H
+#define THREEBODYPROPAGATOR_H
+
+#include "Astro-Core/EODE/eode.h"
+#include <Eigen/Core>
+
+
+/**
+ * Equations of motion of the circular restricted three body problem in the
+ * normalized rotating frame (unit distance between the primaries, unit mean
+ * motion). The state is (x, y, z, vx, vy, vz).
+ */
+class ThreeBodyDerivativeCalculator : public DerivativeCalculator<6>
+{
+public:
+    explicit ThreeBodyDerivativeCalculator(double massParameter) : m_mu(massParameter) {}
+
+    void compute(const State& s, double t, State& derivatives) const;
+
+private:
+    double m_mu;
+};
+
+
+/**
+ * Propagator of the circular restricted three body problem, with an adaptive
+ * Dormand-Prince 5(4) integrator. The state transition matrix can be propagated
+ * along with the state by the variational equations.
+ *
+ * The propagator only holds the mass parameter and the tolerances: all the
+ * integration state lives on the stack of the calls, so one propagator can be
+ * shared by several threads, e.g. to correct or continue orbits concurrently.
+ */
+class ThreeBodyPropagator
+{
+public:
+    typedef Eigen::Matrix<double, 6, 1> State;
+    typedef Eigen::Matrix<double, 6, 6> Matrix6;
+
+    explicit ThreeBodyPropagator(double massParameter);
+
+    double massParameter() const { return m_massParameter; }
+    void setTolerance(double absTol, double relTol);
+
+    /**
+     * Propagate state over duration (normalized time, not negative). Return
+     * false if the integrator couldn't reach the end time.
+     */
+    bool propagate(State& state, double duration) const;
+    /**
+     * Propagate state and the state transition matrix stm over duration. Pass
+     * the identity to get the state transition matrix of the arc.
+     */
+    bool propagate(State& state, Matrix6& stm, double duration) const;
+
+    /**
+     * Propagate state and stm until the first crossing of the plane y = 0 after
+     * minimumTime, and set time to the time of the crossing. Return false if
+     * there is no crossing before maximumTime.
+     */
+    bool propagateToPlaneCrossing(State& state, Matrix6& stm, double& time,
+                                  double minimumTime, double maximumTime) const;
+
+    State derivatives(const State& state) const;
+    /**
+     * Jacobian of the equations of motion, i.e. the matrix of the variational
+     * equations: d(stm)/dt = jacobian * stm
+     */
+    Matrix6 jacobian(const State& state) const;
+    /**
+     * Jacobi constant C = 2U - v^2 of the state
+     */
+    double jacobiConstant(const State& state) const;
+
+private:
+    double m_massParameter;
+    double m_absTol;
+    double m_relTol;
+};
+
+#endif // THREEBODYPROPAGATOR_H
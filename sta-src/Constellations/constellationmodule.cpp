@@ -431,76 +431,104 @@ bool visibility(GroundObject* transmitter, SpaceObject* receiver, const StaBody*
     }
 }
 
-/** function calculates if a space object can see this point on the surface
-  *
-  **/
-bool visibility(SpaceObject* transmitter, DiscretizationPoint receiver, const StaBody* body, double currentTime, Antenna* obsAntenna)
+/** Rotation from the VDG frame of a space object (velocity dependent) to the
+  * frame its state is expressed in.
+  */
+static Matrix3d vdgRotation(const sta::StateVector& vTransmitter)
+{
+    // first step: get theta (angle between NED and VDG)
+    double azimuth, elevation;
+    double r; // radius, we don't need this
+    // get elevation and azimuth
+    rectangularTOpolar(vTransmitter.position,r,azimuth,elevation);
+    // calculate NED e_x and e_z and e_x' = e_x1
+    Eigen::Vector3d e_x;
+    nedTOfixed(elevation, azimuth, Vector3d::UnitX(), e_x);
+    Eigen::Vector3d e_z;
+    nedTOfixed(elevation, azimuth, Vector3d::UnitZ(), e_z);
+    Eigen::Vector3d e_x1 = (vTransmitter.velocity - vTransmitter.velocity.dot(e_z)*e_z).normalized();
+    // calculate theta'
+    double theta1 = acos(e_x.dot(e_x1));
+    // signum of determinant
+    double sigdet = e_x.dot(e_x1.cross(e_z));
+    if (sigdet != 0)
+    {
+        sigdet = sigdet/fabs(sigdet);
+    }
+    double theta;
+    if (theta1 >= 0)
+    {
+        theta = sigdet*theta1;
+    }
+    else
+    {
+        theta = sigdet*(sta::Pi() - theta1);
+    }
+    // second step: get CBCF coordinates for d
+    Matrix3d rotation;
+    double sinaz = sin(azimuth);
+    double cosaz = cos(azimuth);
+    double sinth = sin(theta);
+    double costh = cos(theta);
+    double sinel = sin(elevation);
+    double cosel = cos(elevation);
+    rotation << Vector3d(-costh*cosaz*sinel-sinth*sinaz,-costh*sinaz*sinel+sinth*cosaz,costh*cosel),
+                Vector3d(sinth*cosaz*sinel-costh*sinaz,sinth*sinaz*sinel+costh*cosaz,-sinth*cosel),
+                Vector3d(-cosaz*cosel,-cosel*sinaz,-sinel);
+    return rotation;
+}
+
+/** Geometry of an observation antenna at one epoch. The space object state
+  * and the antenna direction are computed once and rotated into the body
+  * fixed frame, where the discretization points have a constant position.
+  */
+ObservationFootprint::ObservationFootprint(SpaceObject* transmitter, const StaBody* body, double currentTime, Antenna* obsAntenna)
 {
     sta::StateVector vTransmitter;
-    Eigen::Vector3d vReceiverPos;
     transmitter->getStateVector(currentTime, *body, CoordinateSystem(COORDSYS_EME_J2000), &vTransmitter);
-    // get the 3D coordinates for discretization point (altitude on surface is set to 0.0) in J2000 (CBCI) (longitude + greenwich hour angle)
-    vReceiverPos = body->planetographicToCartesian(receiver.latitude, receiver.longitude + radToDeg(getGreenwichHourAngle(MjdToJd(currentTime))), 0.0);
-    // check, if line of sight is not interrupted by central body
-    Vector3d distRT = vReceiverPos - vTransmitter.position;
-    double k = - vTransmitter.position.dot(distRT)/pow(distRT.norm(),2);
-    double dist = (vTransmitter.position + k*(distRT)).norm();
-    if (!(k > 0 & k < 1 & dist < body->meanRadius()))
-    {
-        // first step: get theta (angle between NED and VDG)
-        double azimuth, elevation;
-        double r; // radius, we don't need this
-        // get elevation and azimuth
-        rectangularTOpolar(vTransmitter.position,r,azimuth,elevation);
-        // calculate NED e_x and e_z and e_x' = e_x1
-        Eigen::Vector3d e_x;
-        nedTOfixed(elevation, azimuth, Vector3d::UnitX(), e_x);
-        Eigen::Vector3d e_z;
-        nedTOfixed(elevation, azimuth, Vector3d::UnitZ(), e_z);
-        Eigen::Vector3d e_x1 = (vTransmitter.velocity - vTransmitter.velocity.dot(e_z)*e_z).normalized();
-        // calculate theta'
-        double theta1 = acos(e_x.dot(e_x1));
-        // signum of determinant
-        double sigdet = e_x.dot(e_x1.cross(e_z));
-        if (sigdet != 0)
-        {
-            sigdet = sigdet/fabs(sigdet);
-        }
-        double theta;
-        if (theta1 >= 0)
-        {
-            theta = sigdet*theta1;
-        }
-        else
-        {
-            theta = sigdet*(sta::Pi() - theta1);
-        }
-        // second step: get CBCF coordinates for d (per Antenna)
-        Matrix3d rotation;
-        double sinaz = sin(azimuth);
-        double cosaz = cos(azimuth);
-        double sinth = sin(theta);
-        double costh = cos(theta);
-        double sinel = sin(elevation);
-        double cosel = cos(elevation);
-        rotation << Vector3d(-costh*cosaz*sinel-sinth*sinaz,-costh*sinaz*sinel+sinth*cosaz,costh*cosel),
-                    Vector3d(sinth*cosaz*sinel-costh*sinaz,sinth*sinaz*sinel+costh*cosaz,-sinth*cosel),
-                    Vector3d(-cosaz*cosel,-cosel*sinaz,-sinel);
+    Vector3d direction = vdgRotation(vTransmitter) * obsAntenna->VDGdirection();
 
-        return (obsAntenna->hasInCone(vReceiverPos, vTransmitter.position, rotation));
+    // J2000 -> body fixed: rotation about z by minus the Greenwich hour angle
+    double greenwAng = getGreenwichHourAngle(MjdToJd(currentTime));
+    double cosgw = cos(greenwAng);
+    double singw = sin(greenwAng);
+    const Vector3d& pos = vTransmitter.position;
+    m_position = Vector3d(cosgw*pos.x() + singw*pos.y(), -singw*pos.x() + cosgw*pos.y(), pos.z());
+    m_direction = Vector3d(cosgw*direction.x() + singw*direction.y(), -singw*direction.x() + cosgw*direction.y(), direction.z()).normalized();
 
-        // check for each antenna
-        /*foreach(Antenna* antenna, antennas)
-        {
-            if (antenna->hasInCone(vReceiverPos, vTransmitter.position, rotation))
-            {
-                return true;
-            }
-        }
-        return false;*/
-    } else {
+    m_radius = body->meanRadius();
+    m_cosConeAngle = cos(obsAntenna->coneAngle());
+    m_circularCone = obsAntenna->getShape() == 1;
+}
+
+/** Same test as Antenna::hasInCone, preceded by the check that the line of
+  * sight is not interrupted by the central body; it only needs dot products.
+  */
+bool ObservationFootprint::hasInView(const DiscretizationPoint& receiver) const
+{
+    if (!m_circularCone)
+    {
         return false;
     }
+
+    Vector3d distRT = receiver.position - m_position;
+    double distRT2 = distRT.squaredNorm();
+    double k = - m_position.dot(distRT)/distRT2;
+    if (k > 0 && k < 1 && (m_position + k*distRT).norm() < m_radius)
+    {
+        return false;
+    }
+
+    // angle to the boresight smaller than the cone angle
+    return m_direction.dot(distRT) > m_cosConeAngle * sqrt(distRT2);
 }
 
+/** function calculates if a space object can see this point on the surface
+  * To test many points at the same epoch, build an ObservationFootprint once
+  * and call hasInView() for each point instead.
+  **/
+bool visibility(SpaceObject* transmitter, DiscretizationPoint receiver, const StaBody* body, double currentTime, Antenna* obsAntenna)
+{
+    return ObservationFootprint(transmitter, body, currentTime, obsAntenna).hasInView(receiver);
+}
 
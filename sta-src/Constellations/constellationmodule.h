@@ -59,6 +59,23 @@ double getfa(double a, int np, int nd, double inc, double hp, double radiusCB, d
 
 double getfmean(double arg, double e, double mean);
 
+/** Footprint of an observation antenna of a space object at a given time,
+  * used to test many discretization points against the same epoch.
+  */
+class ObservationFootprint
+{
+public:
+    ObservationFootprint(SpaceObject* transmitter, const StaBody* body, double currentTime, Antenna* obsAntenna);
+    bool hasInView(const DiscretizationPoint& receiver) const;
+
+private:
+    Eigen::Vector3d m_position;     // space object, body fixed frame
+    Eigen::Vector3d m_direction;    // antenna boresight, body fixed frame
+    double m_radius;
+    double m_cosConeAngle;
+    bool m_circularCone;
+};
+
 // antennas stick always on transmitter
 bool visibility(SpaceObject* transmitter, SpaceObject* receiver, const StaBody* body, double currentTime, QList<Antenna*> antennas);
 bool visibility(SpaceObject* transmitter, GroundObject* receiver, const StaBody* body, double currentTime, QList<Antenna*> antennas);
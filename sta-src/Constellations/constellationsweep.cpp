@@ -0,0 +1,489 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "Constellations/constellationsweep.h"
+#include "Constellations/coveragefom.h"
+#include "Constellations/discretization.h"
+#include "Astro-Core/stabody.h"
+#include "Astro-Core/stamath.h"
+#include "Astro-Core/propagateJ2.h"
+#include <QtConcurrentMap>
+#include <QtAlgorithms>
+#include <cmath>
+
+using namespace sta;
+
+
+int ConstellationDesign::satelliteCount() const
+{
+    if (type == Walker)
+    {
+        return planes * satellitesPerPlane;
+    }
+    else
+    {
+        return satellites;
+    }
+}
+
+
+QString ConstellationDesign::label() const
+{
+    if (type == Walker)
+    {
+        return QString("Walker %1/%2/%3 h=%4 km i=%5 deg")
+                .arg(planes * satellitesPerPlane).arg(planes).arg(phasing)
+                .arg(altitude).arg(inclination);
+    }
+    else
+    {
+        return QString("Flower %1-%2-%3 hp=%4 km i=%5 deg")
+                .arg(petals).arg(days).arg(satellites)
+                .arg(perigeeHeight).arg(inclination);
+    }
+}
+
+
+/** True if this result is at least as good as the other one in every
+  * figure of merit and strictly better in at least one.
+  */
+bool ConstellationDesignResult::dominates(const ConstellationDesignResult& other) const
+{
+    int count = design.satelliteCount();
+    int otherCount = other.design.satelliteCount();
+
+    bool noWorse = count <= otherCount &&
+                   meanCoverage >= other.meanCoverage &&
+                   minimumCoverage >= other.minimumCoverage &&
+                   maxRevisitTime <= other.maxRevisitTime;
+    bool better = count < otherCount ||
+                  meanCoverage > other.meanCoverage ||
+                  minimumCoverage > other.minimumCoverage ||
+                  maxRevisitTime < other.maxRevisitTime;
+
+    return noWorse && better;
+}
+
+
+/** @param body central body of the constellations
+  * @param meshRows number of rows of the DiscreteMesh used for the coverage
+  */
+ConstellationSweep::ConstellationSweep(const StaBody* body, int meshRows) :
+    m_body(body),
+    m_mesh(new DiscreteMesh(body, meshRows)),
+    m_duration(86400.0),
+    m_timeStep(60.0),
+    m_minElevation(degToRad(10.0)),
+    m_rotationRate(0.0)
+{
+    if (body->rotationState())
+    {
+        m_rotationRate = 2 * sta::Pi() / (body->rotationState()->rotationPeriod() * 86400);
+    }
+
+    // The mesh points never move in the body fixed frame, so their direction
+    // is computed once for all candidates.
+    int numberPoints = m_mesh->meshAsList.count();
+    m_pointX.resize(numberPoints);
+    m_pointY.resize(numberPoints);
+    m_pointZ.resize(numberPoints);
+    for (int p = 0; p < numberPoints; p++)
+    {
+        double lat = degToRad(m_mesh->meshAsList.at(p).latitude);
+        double lon = degToRad(m_mesh->meshAsList.at(p).longitude);
+        m_pointX[p] = cos(lat) * cos(lon);
+        m_pointY[p] = cos(lat) * sin(lon);
+        m_pointZ[p] = sin(lat);
+    }
+}
+
+
+ConstellationSweep::~ConstellationSweep()
+{
+    delete m_mesh;
+}
+
+
+/** @param duration length of the propagation of each candidate [s]
+  * @param timeStep time between two coverage evaluations [s]
+  */
+void ConstellationSweep::setTimeSpan(double duration, double timeStep)
+{
+    m_duration = duration;
+    m_timeStep = timeStep;
+}
+
+
+/** @param elevation minimum elevation above the horizon for a mesh point to be seen [deg]
+  */
+void ConstellationSweep::setMinimumElevation(double elevation)
+{
+    m_minElevation = degToRad(elevation);
+}
+
+
+/** Enumerate all the Walker T/P/F patterns for the given total numbers of
+  * satellites: every number of planes P dividing T and every relative
+  * phasing 0 <= F < P, for each altitude [km] and inclination [deg].
+  */
+void ConstellationSweep::addWalkerDesigns(const QList<int>& totalSatellites,
+                                          const QList<double>& altitudes,
+                                          const QList<double>& inclinations)
+{
+    ConstellationDesign design;
+    design.type = ConstellationDesign::Walker;
+    design.petals = 0;
+    design.days = 0;
+    design.satellites = 0;
+    design.perigeeHeight = 0.0;
+    design.argumentOfPerigee = 0.0;
+
+    foreach (int t, totalSatellites)
+    {
+        for (int p = 1; p <= t; p++)
+        {
+            if (t % p != 0)
+            {
+                continue;
+            }
+            for (int f = 0; f < p; f++)
+            {
+                foreach (double altitude, altitudes)
+                {
+                    foreach (double inclination, inclinations)
+                    {
+                        design.planes = p;
+                        design.satellitesPerPlane = t / p;
+                        design.phasing = f;
+                        design.altitude = altitude;
+                        design.inclination = inclination;
+                        m_designs.append(design);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/** Enumerate symmetric Flower constellations.
+  * @param petals numbers of petals
+  * @param days numbers of days to repeat the ground track
+  * @param satellites numbers of satellites
+  * @param perigeeHeights heights of perigee [km]
+  * @param inclinations inclinations [deg], usually the critical 63.4 or 116.6
+  * @param argumentOfPerigee argument of perigee of every satellite [deg]
+  */
+void ConstellationSweep::addFlowerDesigns(const QList<int>& petals,
+                                          const QList<int>& days,
+                                          const QList<int>& satellites,
+                                          const QList<double>& perigeeHeights,
+                                          const QList<double>& inclinations,
+                                          double argumentOfPerigee)
+{
+    ConstellationDesign design;
+    design.type = ConstellationDesign::Flower;
+    design.planes = 0;
+    design.satellitesPerPlane = 0;
+    design.phasing = 0;
+    design.altitude = 0.0;
+    design.argumentOfPerigee = argumentOfPerigee;
+
+    foreach (int np, petals)
+    {
+        foreach (int nd, days)
+        {
+            foreach (int ns, satellites)
+            {
+                foreach (double hp, perigeeHeights)
+                {
+                    foreach (double inclination, inclinations)
+                    {
+                        design.petals = np;
+                        design.days = nd;
+                        design.satellites = ns;
+                        design.perigeeHeight = hp;
+                        design.inclination = inclination;
+                        m_designs.append(design);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/** Generate the Keplerian elements of the satellites of a candidate with the
+  * same functions used by the constellation wizard.
+  */
+bool ConstellationSweep::generateSatellites(const ConstellationDesign& design, QVector<SatelliteKeplerian>& satellites) const
+{
+    int n = design.satelliteCount();
+    if (n <= 0)
+    {
+        return false;
+    }
+    satellites.resize(n);
+
+    if (design.type == ConstellationDesign::Walker)
+    {
+        return walkerConstellation(design.planes, design.satellitesPerPlane,
+                                   m_body->meanRadius() + design.altitude, design.inclination,
+                                   design.phasing, satellites.data());
+    }
+    else
+    {
+        return flowerConstellation(design.petals, design.days, design.satellites,
+                                   degToRad(design.argumentOfPerigee), degToRad(design.inclination),
+                                   design.perigeeHeight, true, 0.0, 0.0, 0.0,
+                                   m_body->meanRadius(), m_rotationRate, m_body->mu(),
+                                   m_body->gravityModel().J2(), satellites.data());
+    }
+}
+
+
+/** Propagate one candidate and compute its coverage figures of merit. This
+  * function only reads the sweep settings, so it may be called from several
+  * threads at the same time.
+  */
+ConstellationDesignResult ConstellationSweep::evaluate(const ConstellationDesign& design) const
+{
+    ConstellationDesignResult result;
+    result.design = design;
+    result.valid = false;
+    result.meanCoverage = 0.0;
+    result.minimumCoverage = 0.0;
+    result.maxRevisitTime = 0.0;
+    result.meanResponseTime = 0.0;
+
+    QVector<SatelliteKeplerian> satellites;
+    if (!generateSatellites(design, satellites))
+    {
+        return result;
+    }
+
+    double mu = m_body->mu();
+    double radius = m_body->meanRadius();
+    double j2 = m_body->gravityModel().J2();
+
+    // initial orbital elements in radians, with the mean anomaly expected by propagateJ2
+    int numberSatellites = satellites.size();
+    QVector<double> a(numberSatellites);
+    QVector<double> e(numberSatellites);
+    QVector<double> inc(numberSatellites);
+    QVector<double> raan(numberSatellites);
+    QVector<double> argp(numberSatellites);
+    QVector<double> meanAnomaly(numberSatellites);
+    for (int s = 0; s < numberSatellites; s++)
+    {
+        const double* param = satellites.at(s).param;
+        a[s] = param[0];
+        e[s] = param[1];
+        inc[s] = degToRad(param[2]);
+        raan[s] = degToRad(param[3]);
+        argp[s] = degToRad(param[4]);
+        double trueAnomaly = degToRad(param[5]);
+        double ecc = 2 * atan(sqrt((1 - e[s]) / (1 + e[s])) * tan(trueAnomaly / 2));
+        meanAnomaly[s] = ecc - e[s] * sin(ecc);
+    }
+
+    CoverageAccumulator coverage(m_mesh);
+    int numberPoints = m_pointX.size();
+    const double* pointX = m_pointX.constData();
+    const double* pointY = m_pointY.constData();
+    const double* pointZ = m_pointZ.constData();
+    QVector<unsigned char> viewCount(numberPoints);
+    double cosMinElevation = cos(m_minElevation);
+
+    int steps = int(m_duration / m_timeStep);
+    for (int k = 0; k <= steps; k++)
+    {
+        double t = k * m_timeStep;
+        double theta = m_rotationRate * t;
+        double cosTheta = cos(theta);
+        double sinTheta = sin(theta);
+        viewCount.fill(0);
+        unsigned char* views = viewCount.data();
+
+        for (int s = 0; s < numberSatellites; s++)
+        {
+            double ran1, ap1, ma1;
+            StateVector state = propagateJ2(mu, radius, j2,
+                                            a[s], e[s], inc[s], argp[s], raan[s], meanAnomaly[s],
+                                            t, ran1, ap1, ma1);
+
+            // position in the body fixed frame
+            double x =  cosTheta * state.position.x() + sinTheta * state.position.y();
+            double y = -sinTheta * state.position.x() + cosTheta * state.position.y();
+            double z = state.position.z();
+            double rho = sqrt(x * x + y * y + z * z);
+            if (rho <= radius)
+            {
+                continue;
+            }
+
+            // A point of the (spherical) body sees the satellite above the
+            // minimum elevation when its central angle from the sub-satellite
+            // point is smaller than the footprint half angle.
+            double halfAngle = acos(radius * cosMinElevation / rho) - m_minElevation;
+            double cosHalfAngle = cos(halfAngle);
+            x /= rho;
+            y /= rho;
+            z /= rho;
+            for (int p = 0; p < numberPoints; p++)
+            {
+                if (x * pointX[p] + y * pointY[p] + z * pointZ[p] >= cosHalfAngle && views[p] < 255)
+                {
+                    views[p]++;
+                }
+            }
+        }
+
+        coverage.addEpoch(t / 86400.0, viewCount);
+    }
+    coverage.finish();
+
+    double coverageSum = 0.0;
+    double worstCoverage = 1.0;
+    double worstRevisit = 0.0;
+    double responseSum = 0.0;
+    double studyLength = coverage.endTime() - coverage.startTime();
+    for (int p = 0; p < numberPoints; p++)
+    {
+        double averageCoverage = coverage.timeAverageCoverage(p);
+        coverageSum += averageCoverage;
+        worstCoverage = qMin(worstCoverage, averageCoverage);
+        responseSum += coverage.meanResponseTime(p);
+
+        // the wait before the first pass counts as a revisit gap too
+        double revisit;
+        if (coverage.firstCoverageTime(p) > coverage.endTime())
+        {
+            revisit = studyLength;
+        }
+        else
+        {
+            revisit = qMax(coverage.maxRevisitGap(p), coverage.firstCoverageTime(p) - coverage.startTime());
+        }
+        worstRevisit = qMax(worstRevisit, revisit);
+    }
+
+    if (numberPoints > 0)
+    {
+        result.meanCoverage = 100.0 * coverageSum / numberPoints;
+        result.minimumCoverage = 100.0 * worstCoverage;
+        result.maxRevisitTime = worstRevisit * 1440.0;
+        result.meanResponseTime = responseSum / numberPoints * 1440.0;
+        result.valid = true;
+    }
+
+    return result;
+}
+
+
+/** Insert a result into a set of mutually non-dominated results, dropping
+  * the results it dominates. Invalid and dominated results are ignored.
+  */
+void ConstellationSweep::addToParetoFront(QList<ConstellationDesignResult>& front, const ConstellationDesignResult& result)
+{
+    if (!result.valid)
+    {
+        return;
+    }
+
+    for (int i = 0; i < front.count(); i++)
+    {
+        if (front.at(i).dominates(result))
+        {
+            return;
+        }
+    }
+
+    for (int i = front.count() - 1; i >= 0; i--)
+    {
+        if (result.dominates(front.at(i)))
+        {
+            front.removeAt(i);
+        }
+    }
+
+    front.append(result);
+}
+
+
+// A design to evaluate, with the sweep providing the mesh and the time span
+struct ConstellationCandidate
+{
+    const ConstellationSweep* sweep;
+    ConstellationDesign design;
+};
+
+static ConstellationDesignResult evaluateCandidate(const ConstellationCandidate& candidate)
+{
+    return candidate.sweep->evaluate(candidate.design);
+}
+
+static bool fewerSatellites(const ConstellationDesignResult& r1, const ConstellationDesignResult& r2)
+{
+    return r1.design.satelliteCount() < r2.design.satelliteCount();
+}
+
+
+/** Sort a Pareto front by number of satellites.
+  */
+void ConstellationSweep::sortParetoFront(QList<ConstellationDesignResult>& front)
+{
+    qStableSort(front.begin(), front.end(), fewerSatellites);
+}
+
+
+/** Start evaluating all the candidates added to the sweep on the global
+  * thread pool. The result of the future is the unsorted Pareto front; its
+  * progress counts the evaluated candidates. The sweep must not be destroyed
+  * before the future has finished.
+  */
+QFuture<QList<ConstellationDesignResult> > ConstellationSweep::start() const
+{
+    QList<ConstellationCandidate> candidates;
+    foreach (const ConstellationDesign& design, m_designs)
+    {
+        ConstellationCandidate candidate;
+        candidate.sweep = this;
+        candidate.design = design;
+        candidates.append(candidate);
+    }
+
+    return QtConcurrent::mappedReduced(candidates, evaluateCandidate, addToParetoFront,
+                                       QtConcurrent::UnorderedReduce);
+}
+
+
+/** Evaluate all the candidates added to the sweep on the global thread pool
+  * and return the Pareto-optimal ones, sorted by number of satellites.
+  */
+QList<ConstellationDesignResult> ConstellationSweep::run() const
+{
+    QList<ConstellationDesignResult> front = start().result();
+    sortParetoFront(front);
+
+    return front;
+}
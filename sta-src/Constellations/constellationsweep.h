@@ -0,0 +1,142 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef CONSTELLATIONSWEEP_H
+#define CONSTELLATIONSWEEP_H
+
+#include "Constellations/constellationmodule.h"
+#include <QFuture>
+#include <QList>
+#include <QVector>
+#include <QString>
+
+class StaBody;
+class DiscreteMesh;
+
+
+/** Parameters of one candidate of a constellation trade study. Only the
+  * fields of the selected type are meaningful.
+  */
+struct ConstellationDesign
+{
+    enum Type
+    {
+        Walker,
+        Flower
+    };
+
+    Type type;
+
+    // Walker T/P/F
+    int planes;
+    int satellitesPerPlane;
+    int phasing;
+    double altitude;           // km
+    double inclination;        // deg, also used by Flower constellations
+
+    // Flower
+    int petals;
+    int days;
+    int satellites;
+    double perigeeHeight;      // km
+    double argumentOfPerigee;  // deg
+
+    int satelliteCount() const;
+    QString label() const;
+};
+
+
+/** Coverage figures of merit of one candidate. Percentages are averaged over
+  * the mesh points, durations are in minutes.
+  */
+struct ConstellationDesignResult
+{
+    ConstellationDesign design;
+    bool valid;
+
+    double meanCoverage;       // time averaged coverage of the mean mesh point [%]
+    double minimumCoverage;    // time averaged coverage of the worst mesh point [%]
+    double maxRevisitTime;     // longest time any mesh point waits to be seen
+    double meanResponseTime;
+
+    bool dominates(const ConstellationDesignResult& other) const;
+};
+
+
+/** Batch trade study over Walker and Flower constellation parameters.
+  *
+  * Candidates are propagated with the analytic J2 secular model
+  * (propagateJ2) and their coverage of a DiscreteMesh of the central body is
+  * evaluated for a minimum elevation angle. The candidates are evaluated
+  * concurrently on the global thread pool, and only the Pareto-optimal ones
+  * (fewest satellites, highest mean and worst-point coverage, shortest
+  * revisit time) are kept.
+  */
+class ConstellationSweep
+{
+public:
+    ConstellationSweep(const StaBody* body, int meshRows = 40);
+    ~ConstellationSweep();
+
+    void setTimeSpan(double duration, double timeStep);
+    void setMinimumElevation(double elevation);
+
+    void addWalkerDesigns(const QList<int>& totalSatellites,
+                          const QList<double>& altitudes,
+                          const QList<double>& inclinations);
+    void addFlowerDesigns(const QList<int>& petals,
+                          const QList<int>& days,
+                          const QList<int>& satellites,
+                          const QList<double>& perigeeHeights,
+                          const QList<double>& inclinations,
+                          double argumentOfPerigee = 270.0);
+
+    const StaBody* body() const { return m_body; }
+    const QList<ConstellationDesign>& designs() const { return m_designs; }
+
+    QList<ConstellationDesignResult> run() const;
+    QFuture<QList<ConstellationDesignResult> > start() const;
+    ConstellationDesignResult evaluate(const ConstellationDesign& design) const;
+
+    static void addToParetoFront(QList<ConstellationDesignResult>& front, const ConstellationDesignResult& result);
+    static void sortParetoFront(QList<ConstellationDesignResult>& front);
+
+private:
+    bool generateSatellites(const ConstellationDesign& design, QVector<SatelliteKeplerian>& satellites) const;
+
+private:
+    const StaBody* m_body;
+    DiscreteMesh* m_mesh;
+    double m_duration;         // s
+    double m_timeStep;         // s
+    double m_minElevation;     // rad
+    double m_rotationRate;     // rad/s
+
+    // unit vectors of the mesh points in the body fixed frame
+    QVector<double> m_pointX;
+    QVector<double> m_pointY;
+    QVector<double> m_pointZ;
+
+    QList<ConstellationDesign> m_designs;
+};
+
+#endif // CONSTELLATIONSWEEP_H
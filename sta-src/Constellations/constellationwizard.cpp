@@ -16,6 +16,7 @@
 
 #include "Constellations/constellationwizard.h"
 #include "Constellations/constellationmodule.h"
+#include "Constellations/constellationsweep.h"
 #include "Scenario/scenarioPropagator.h"
 #include "Scenario/missionsDefaults.h"
 #include "Loitering/loitering.h"
@@ -23,6 +24,9 @@
 #include "Main/mainwindow.h"
 #include "Main/scenariotree.h"
 #include <QMessageBox>
+#include <QInputDialog>
+#include <QProgressDialog>
+#include <QApplication>
 #include <QDebug>
 #include <iostream>
 #include <QTextStream>
@@ -31,7 +35,10 @@
 
 
 ConstellationWizardDialog::ConstellationWizardDialog(MainWindow* parent)
-    : mainwindow(parent)
+    : mainwindow(parent),
+    m_tradeStudy(NULL),
+    m_tradeStudyWatcher(NULL),
+    m_tradeStudyProgress(NULL)
 {
     setupUi(this);
 
@@ -61,6 +68,10 @@ ConstellationWizardDialog::ConstellationWizardDialog(MainWindow* parent)
 
     // signals
     QObject::connect(schemeComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(disableflower()));
+    QObject::connect(tradeStudyButton, SIGNAL(clicked()), this, SLOT(runTradeStudy()));
+
+    m_tradeStudyWatcher = new QFutureWatcher<QList<ConstellationDesignResult> >(this);
+    QObject::connect(m_tradeStudyWatcher, SIGNAL(finished()), this, SLOT(tradeStudyFinished()));
 
 
 }
@@ -70,6 +81,13 @@ ConstellationWizardDialog::ConstellationWizardDialog(MainWindow* parent)
 
 ConstellationWizardDialog::~ConstellationWizardDialog()
 {
+    // The trade study still running refers to the sweep
+    if (m_tradeStudy)
+    {
+        m_tradeStudyWatcher->cancel();
+        m_tradeStudyWatcher->waitForFinished();
+        delete m_tradeStudy;
+    }
 }
 
 void ConstellationWizardDialog::disableflower()
@@ -79,6 +97,224 @@ void ConstellationWizardDialog::disableflower()
 }
 
 
+// Parse a comma separated list of numbers between minimum and maximum. An
+// empty list is replaced by the default value.
+static bool ParseValueList(const QString& text, double defaultValue, double minimum, double maximum, QList<double>* values)
+{
+    if (text.trimmed().isEmpty())
+    {
+        *values << defaultValue;
+        return true;
+    }
+
+    foreach (QString item, text.split(',', QString::SkipEmptyParts))
+    {
+        bool ok = false;
+        double value = item.trimmed().toDouble(&ok);
+        if (!ok || value < minimum || value > maximum)
+        {
+            return false;
+        }
+        *values << value;
+    }
+
+    return !values->isEmpty();
+}
+
+
+/** Start a coverage trade study over the designs neighbouring the parameters
+  * entered in the wizard, using the sweep ranges of the trade study group.
+  * The candidates are evaluated in the background; tradeStudyFinished() lets
+  * the user pick one of the Pareto-optimal designs.
+  */
+void ConstellationWizardDialog::runTradeStudy()
+{
+    const StaBody* body = STA_SOLAR_SYSTEM->lookup("Earth");
+    bool ok;
+
+    double duration = tradeDurationLineEdit->text().toDouble(&ok) * 3600.0;
+    if (!ok || duration <= 0.0)
+    {
+        QMessageBox::warning(this, "Error", "Enter a positive simulated time for the trade study!");
+        return;
+    }
+
+    double timeStep = tradeTimeStepLineEdit->text().toDouble(&ok);
+    if (!ok || timeStep <= 0.0 || timeStep > duration)
+    {
+        QMessageBox::warning(this, "Error", "The trade study time step must be positive and shorter than the simulated time!");
+        return;
+    }
+
+    double elevation = tradeElevationLineEdit->text().toDouble(&ok);
+    if (!ok || elevation < 0.0 || elevation >= 90.0)
+    {
+        QMessageBox::warning(this, "Error", "The minimum elevation must be between 0 and 90 degrees!");
+        return;
+    }
+
+    int spread = tradeSatelliteSpreadSpinBox->value();
+
+    ConstellationSweep* sweep = new ConstellationSweep(body);
+    sweep->setTimeSpan(duration, timeStep);
+    sweep->setMinimumElevation(elevation);
+
+    if (constTypeComboBox->currentIndex() == 0) // Walker
+    {
+        int npl = numberOfOrbitPlanesLineEdit->text().toInt(&ok,10);
+        int nspl = numberOfSatellitesLineEdit->text().toInt(&ok,10);
+        double a = semiMajoraxisLineEdit->text().toDouble(&ok);
+        double inc = inclinationLineEdit->text().toDouble(&ok);
+        int n = npl * nspl;
+        if (n <= 0 || a <= body->meanRadius())
+        {
+            QMessageBox::warning(this, "Error", "Enter a valid Walker constellation first!");
+            delete sweep;
+            return;
+        }
+
+        QList<double> altitudes;
+        QList<double> inclinations;
+        if (!ParseValueList(tradeAltitudesLineEdit->text(), a - body->meanRadius(), 1.0, 1.0e6, &altitudes) ||
+            !ParseValueList(tradeInclinationsLineEdit->text(), inc, 0.0, 180.0, &inclinations))
+        {
+            QMessageBox::warning(this, "Error", "The trade study altitudes and inclinations must be lists of positive altitudes and of inclinations between 0 and 180 degrees!");
+            delete sweep;
+            return;
+        }
+
+        QList<int> totalSatellites;
+        for (int t = qMax(1, n - spread); t <= n + spread; t++)
+        {
+            totalSatellites << t;
+        }
+        sweep->addWalkerDesigns(totalSatellites, altitudes, inclinations);
+    }
+    else if (constTypeComboBox->currentIndex() == 1) // Flower
+    {
+        int np = numberOfPetalsLineEdit->text().toInt(&ok,10);
+        int nd = numberOfDaysToRepeatGroundTrackLineEdit->text().toInt(&ok,10);
+        int n = numberOfSatellitesLineEdit_2->text().toInt(&ok,10);
+        double om = perigeeLineEdit->text().toDouble(&ok);
+        double hp = heightOfPerigeeLineEdit->text().toDouble(&ok);
+        double inc = inclinationComboBox->currentText().toDouble();
+        if (np <= 0 || nd <= 0 || n <= 0)
+        {
+            QMessageBox::warning(this, "Error", "Enter a valid Flower constellation first!");
+            delete sweep;
+            return;
+        }
+
+        QList<double> inclinations;
+        if (!ParseValueList(tradeInclinationsLineEdit->text(), inc, 0.0, 180.0, &inclinations))
+        {
+            QMessageBox::warning(this, "Error", "The trade study inclinations must be between 0 and 180 degrees!");
+            delete sweep;
+            return;
+        }
+
+        QList<int> satellites;
+        for (int ns = qMax(1, n - spread); ns <= n + spread; ns++)
+        {
+            satellites << ns;
+        }
+        sweep->addFlowerDesigns(QList<int>() << np, QList<int>() << nd, satellites,
+                                QList<double>() << hp, inclinations, om);
+    }
+    else
+    {
+        QMessageBox::warning(this, "", "Trade studies are only available for Walker and Flower constellations!");
+        delete sweep;
+        return;
+    }
+
+    m_tradeStudy = sweep;
+    tradeStudyButton->setEnabled(false);
+
+    m_tradeStudyProgress = new QProgressDialog("Evaluating the candidate constellations...", "Cancel", 0, sweep->designs().count(), this);
+    m_tradeStudyProgress->setWindowModality(Qt::WindowModal);
+    m_tradeStudyProgress->setMinimumDuration(0);
+
+    connect(m_tradeStudyWatcher, SIGNAL(progressRangeChanged(int,int)), m_tradeStudyProgress, SLOT(setRange(int,int)));
+    connect(m_tradeStudyWatcher, SIGNAL(progressValueChanged(int)), m_tradeStudyProgress, SLOT(setValue(int)));
+    connect(m_tradeStudyProgress, SIGNAL(canceled()), m_tradeStudyWatcher, SLOT(cancel()));
+
+    m_tradeStudyWatcher->setFuture(sweep->start());
+}
+
+
+/** Let the user choose one of the Pareto-optimal designs of the finished
+  * trade study, and copy it back into the wizard fields.
+  */
+void ConstellationWizardDialog::tradeStudyFinished()
+{
+    const StaBody* body = m_tradeStudy->body();
+    bool canceled = m_tradeStudyWatcher->isCanceled();
+
+    QList<ConstellationDesignResult> front;
+    if (!canceled)
+    {
+        front = m_tradeStudyWatcher->result();
+        ConstellationSweep::sortParetoFront(front);
+    }
+
+    delete m_tradeStudyProgress;
+    m_tradeStudyProgress = NULL;
+    m_tradeStudyWatcher->setFuture(QFuture<QList<ConstellationDesignResult> >());
+    delete m_tradeStudy;
+    m_tradeStudy = NULL;
+    tradeStudyButton->setEnabled(true);
+
+    if (canceled)
+    {
+        return;
+    }
+
+    if (front.isEmpty())
+    {
+        QMessageBox::warning(this, "Error", "None of the candidate constellations could be generated!");
+        return;
+    }
+
+    QStringList items;
+    foreach (const ConstellationDesignResult& result, front)
+    {
+        items << QString("%1: coverage %2% (worst %3%), max revisit %4 min")
+                 .arg(result.design.label())
+                 .arg(result.meanCoverage, 0, 'f', 1)
+                 .arg(result.minimumCoverage, 0, 'f', 1)
+                 .arg(result.maxRevisitTime, 0, 'f', 1);
+    }
+
+    bool ok;
+    QString choice = QInputDialog::getItem(this, "Constellation Trade Study",
+                                           "Pareto-optimal designs:", items, 0, false, &ok);
+    if (!ok)
+    {
+        return;
+    }
+
+    const ConstellationDesign& design = front.at(items.indexOf(choice)).design;
+    if (design.type == ConstellationDesign::Walker)
+    {
+        numberOfOrbitPlanesLineEdit->setText(QString::number(design.planes));
+        numberOfSatellitesLineEdit->setText(QString::number(design.satellitesPerPlane));
+        relSpacingLineEdit->setText(QString::number(design.phasing));
+        semiMajoraxisLineEdit->setText(QString::number(body->meanRadius() + design.altitude));
+        inclinationLineEdit->setText(QString::number(design.inclination));
+    }
+    else
+    {
+        numberOfSatellitesLineEdit_2->setText(QString::number(design.satellites));
+        int index = inclinationComboBox->findText(QString::number(design.inclination));
+        if (index >= 0)
+        {
+            inclinationComboBox->setCurrentIndex(index);
+        }
+    }
+}
+
+
 
 
 void ConstellationWizardDialog::accept()
@@ -38,12 +38,15 @@
 #include "Main/scenariotree.h"
 #include "Main/mainwindow.h"
 #include "Scenario/scenario.h"
+#include "Constellations/constellationsweep.h"
 
 #include <QDialog>
+#include <QFutureWatcher>
 
 #include "ui_constellationwizard.h"
 
 class MainWindow;
+class QProgressDialog;
 //class ScenarioTree;
 //class ScenarioView;
 
@@ -58,9 +61,17 @@ private:
     MainWindow* mainwindow;
     void accept();
 
+    ConstellationSweep* m_tradeStudy;
+    QFutureWatcher<QList<ConstellationDesignResult> >* m_tradeStudyWatcher;
+    QProgressDialog* m_tradeStudyProgress;
+
 
 public slots:
     void disableflower();
+    void runTradeStudy();
+
+private slots:
+    void tradeStudyFinished();
 };
 
 #endif  //CONSTELLATIONWIZARD_H
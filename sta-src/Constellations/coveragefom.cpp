@@ -0,0 +1,238 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "Constellations/coveragefom.h"
+#include "Constellations/discretization.h"
+
+// Marker for points that have never been seen
+static const double NeverCovered = 1.0e30;
+
+
+CoverageAccumulator::CoverageAccumulator(const DiscreteMesh* mesh) :
+    m_startTime(0.0),
+    m_lastTime(0.0),
+    m_finished(false)
+{
+    int n = mesh->meshAsList.count();
+
+    m_views.fill(0, n);
+    m_coveredTime.fill(0.0, n);
+    m_viewTime.fill(0.0, n);
+    m_firstCoverage.fill(NeverCovered, n);
+    m_uncoveredSince.fill(0.0, n);
+    m_maxGap.fill(0.0, n);
+    m_gapSum.fill(0.0, n);
+    m_gapCount.fill(0, n);
+    m_responseIntegral.fill(0.0, n);
+    m_maxViews.fill(0, n);
+}
+
+
+/** Integrate the state of the last epoch up to the time mjd
+  */
+void
+CoverageAccumulator::closeInterval(double mjd)
+{
+    double dt = mjd - m_lastTime;
+    int n = m_views.size();
+    for (int p = 0; p < n; p++)
+    {
+        if (m_views[p] > 0)
+        {
+            m_coveredTime[p] += dt;
+            m_viewTime[p] += m_views[p] * dt;
+        }
+    }
+}
+
+
+/** Add the next epoch of the study.
+  * @param mjd time of the epoch, must be later than the previous one
+  * @param viewCount number of objects seeing each mesh point (in meshAsList order)
+  */
+void
+CoverageAccumulator::addEpoch(double mjd, const QVector<unsigned char>& viewCount)
+{
+    Q_ASSERT(!m_finished);
+    Q_ASSERT(viewCount.size() == m_views.size());
+
+    bool firstEpoch = m_epochTimes.isEmpty();
+    if (firstEpoch)
+    {
+        m_startTime = mjd;
+        m_uncoveredSince.fill(mjd);
+    }
+    else
+    {
+        closeInterval(mjd);
+    }
+
+    int n = m_views.size();
+    int coveredPoints = 0;
+    for (int p = 0; p < n; p++)
+    {
+        unsigned char views = viewCount[p];
+        bool wasCovered = m_views[p] > 0;
+
+        if (views > 0)
+        {
+            coveredPoints++;
+            if (!wasCovered)
+            {
+                // End of a gap
+                double gap = mjd - m_uncoveredSince[p];
+                m_responseIntegral[p] += 0.5 * gap * gap;
+                if (m_firstCoverage[p] == NeverCovered)
+                {
+                    m_firstCoverage[p] = mjd;
+                }
+                else
+                {
+                    // Only gaps between two coverage periods are revisit gaps
+                    m_gapSum[p] += gap;
+                    m_gapCount[p]++;
+                    if (gap > m_maxGap[p])
+                        m_maxGap[p] = gap;
+                }
+            }
+            if (views > m_maxViews[p])
+                m_maxViews[p] = views;
+        }
+        else if (wasCovered)
+        {
+            // Start of a gap
+            m_uncoveredSince[p] = mjd;
+        }
+
+        m_views[p] = views;
+    }
+
+    m_lastTime = mjd;
+    m_epochTimes.append(mjd);
+    m_percentCoverage.append(n > 0 ? float(100.0 * coveredPoints / n) : 0.0f);
+}
+
+
+/** Convenience version of addEpoch() for a single observer.
+  */
+void
+CoverageAccumulator::addEpoch(double mjd, const QBitArray& covered)
+{
+    int n = m_views.size();
+    QVector<unsigned char> viewCount(n, 0);
+    for (int p = 0; p < n && p < covered.size(); p++)
+    {
+        if (covered.testBit(p))
+            viewCount[p] = 1;
+    }
+    addEpoch(mjd, viewCount);
+}
+
+
+/** Close the statistics at the time of the last epoch. Gaps still open at the
+  * end of the study contribute to the maximum gap and to the response time
+  * (as a lower bound), but not to the mean revisit gap.
+  */
+void
+CoverageAccumulator::finish()
+{
+    if (m_finished)
+        return;
+
+    int n = m_views.size();
+    for (int p = 0; p < n; p++)
+    {
+        if (m_views[p] == 0 && !m_epochTimes.isEmpty())
+        {
+            double gap = m_lastTime - m_uncoveredSince[p];
+            m_responseIntegral[p] += 0.5 * gap * gap;
+            if (m_firstCoverage[p] != NeverCovered && gap > m_maxGap[p])
+                m_maxGap[p] = gap;
+        }
+    }
+
+    m_finished = true;
+}
+
+
+double
+CoverageAccumulator::timeAverageCoverage(int point) const
+{
+    double duration = m_lastTime - m_startTime;
+    return duration > 0.0 ? m_coveredTime[point] / duration : 0.0;
+}
+
+
+double
+CoverageAccumulator::meanRevisitGap(int point) const
+{
+    return m_gapCount[point] > 0 ? m_gapSum[point] / m_gapCount[point] : 0.0;
+}
+
+
+double
+CoverageAccumulator::meanResponseTime(int point) const
+{
+    double duration = m_lastTime - m_startTime;
+    return duration > 0.0 ? m_responseIntegral[point] / duration : 0.0;
+}
+
+
+double
+CoverageAccumulator::meanSimultaneousViews(int point) const
+{
+    double duration = m_lastTime - m_startTime;
+    return duration > 0.0 ? m_viewTime[point] / duration : 0.0;
+}
+
+
+/** Return the set of mesh points that were seen at least once up to the time mjd.
+  */
+QBitArray
+CoverageAccumulator::coveredBefore(double mjd) const
+{
+    int n = m_firstCoverage.size();
+    QBitArray covered(n);
+    for (int p = 0; p < n; p++)
+    {
+        if (m_firstCoverage[p] <= mjd)
+            covered.setBit(p);
+    }
+
+    return covered;
+}
+
+
+double
+CoverageAccumulator::meanPercentCoverage() const
+{
+    if (m_percentCoverage.isEmpty())
+        return 0.0;
+
+    double sum = 0.0;
+    foreach (float percent, m_percentCoverage)
+    {
+        sum += percent;
+    }
+
+    return sum / m_percentCoverage.size();
+}
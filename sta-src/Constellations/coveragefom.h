@@ -0,0 +1,100 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef COVERAGEFOM_H
+#define COVERAGEFOM_H
+
+#include <QVector>
+#include <QBitArray>
+
+class DiscreteMesh;
+
+
+/** Streaming coverage figures of merit over the points of a DiscreteMesh.
+  *
+  * Epochs are fed in increasing time order with the number of simultaneous
+  * views of every mesh point; the accumulator only keeps running statistics
+  * per point, so the memory needed doesn't grow with the length of the study.
+  * The state observed at one epoch is assumed to hold until the next epoch.
+  *
+  * All times and durations are in days (MJD).
+  */
+class CoverageAccumulator
+{
+public:
+    CoverageAccumulator(const DiscreteMesh* mesh);
+
+    void addEpoch(double mjd, const QVector<unsigned char>& viewCount);
+    void addEpoch(double mjd, const QBitArray& covered);
+    void finish();
+
+    int pointCount() const { return m_coveredTime.size(); }
+    int epochCount() const { return m_epochTimes.size(); }
+    double startTime() const { return m_startTime; }
+    double endTime() const { return m_lastTime; }
+
+    /** Fraction of the elapsed time during which the point was seen */
+    double timeAverageCoverage(int point) const;
+    /** Longest interval between two coverage periods of the point */
+    double maxRevisitGap(int point) const { return m_maxGap[point]; }
+    double meanRevisitGap(int point) const;
+    /** Time averaged delay from a random request until the point is next seen */
+    double meanResponseTime(int point) const;
+    /** Time averaged number of objects seeing the point */
+    double meanSimultaneousViews(int point) const;
+    int maxSimultaneousViews(int point) const { return m_maxViews[point]; }
+    /** First time the point was seen, or a value greater than endTime() if never */
+    double firstCoverageTime(int point) const { return m_firstCoverage[point]; }
+
+    QBitArray coveredBefore(double mjd) const;
+
+    /** Percentage of mesh points seen at each epoch */
+    const QVector<double>& epochTimes() const { return m_epochTimes; }
+    const QVector<float>& percentCoverage() const { return m_percentCoverage; }
+    double meanPercentCoverage() const;
+
+private:
+    void closeInterval(double mjd);
+
+private:
+    double m_startTime;
+    double m_lastTime;
+    bool m_finished;
+
+    // Statistics per mesh point
+    QVector<unsigned char> m_views;       // views at the last epoch
+    QVector<double> m_coveredTime;
+    QVector<double> m_viewTime;           // integral of the number of views
+    QVector<double> m_firstCoverage;
+    QVector<double> m_uncoveredSince;     // start of the current gap
+    QVector<double> m_maxGap;
+    QVector<double> m_gapSum;
+    QVector<int> m_gapCount;
+    QVector<double> m_responseIntegral;
+    QVector<int> m_maxViews;
+
+    // Global time series (small: one value per epoch)
+    QVector<double> m_epochTimes;
+    QVector<float> m_percentCoverage;
+};
+
+#endif // COVERAGEFOM_H
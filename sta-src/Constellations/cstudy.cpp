@@ -34,6 +34,7 @@ ConstellationStudySpaceObject::ConstellationStudySpaceObject(SpaceObject* spaceO
         linksamples(QList<LinkSample>()),
         groundlinksamples(QList<GroundLinkSample>()),
         coveragesample(QList<CoverageSample>()),
+        coverage(NULL),
         observation(QList<Antenna*>()),
         visibilityR(QList<Antenna*>()),
         visibilityT(QList<Antenna*>()),
@@ -100,6 +101,8 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
 {
     // Initialization
     m_scenario = scenario;
+    m_discreteMesh = NULL;
+    m_constellationCoverage = NULL;
     m_constellationStudySpaceObjectList = QList<ConstellationStudySpaceObject>();
     m_startTime =  2000000000.;
     m_endTime   = -2000000000.;
@@ -138,6 +141,10 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                 int numberRows = 80;
                 m_discreteMesh = new DiscreteMesh(m_body,numberRows);
             }
+            if (m_calcCoverage)
+            {
+                m_constellationStudySpaceObjectList[i].coverage = new CoverageAccumulator(m_discreteMesh);
+            }
             foreach(double currentTime, m_sampleTimes)
             {
                 CoverageSample coveragesample;
@@ -148,8 +155,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
 
                     // coverage
                     coveragesample.curtime = currentTime;
-                    coveragesample.curpoints = QList<DiscretizationPoint>();
-                    coveragesample.histpoints = QList<DiscretizationPoint>();
+                    coveragesample.curpoints = QBitArray(m_discreteMesh->numberPoints);
 
                     // for searching time optimization:
                     coveragesample.lowestRow = m_discreteMesh->numberRows;
@@ -157,15 +163,13 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                     coveragesample.firstPoints = new int[m_discreteMesh->numberRows];
                     coveragesample.anyPointSeen = false;
 
-                    coveragesampleTmp.histpoints.clear();
-
                     // for each observation Antenna do
                     foreach(Antenna* curObservationAntenna, m_constellationStudySpaceObjectList.at(i).observation)
                     //if(m_constellationStudySpaceObjectList.at(i).observation)
                     {
 
                     coveragesampleTmp.curtime = currentTime;
-                    coveragesampleTmp.curpoints.clear();
+                    coveragesampleTmp.curpoints = QBitArray(m_discreteMesh->numberPoints);
                     coveragesampleTmp.lowestRow = m_discreteMesh->numberRows;
                     coveragesampleTmp.highestRow = -1;
                     coveragesampleTmp.firstPoints = new int[m_discreteMesh->numberRows];
@@ -173,6 +177,8 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
 
 
                     int ntemp = m_constellationStudySpaceObjectList.at(i).coveragesample.length();
+                    // geometry of the antenna at this epoch, shared by all the mesh points
+                    ObservationFootprint footprint(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_body, currentTime, curObservationAntenna);
                     // first time step: all points are checked whether they are in the observation
                     // cone of view of the actual space object
    // following, there are tree algorithms, the covered points can be computed.
@@ -290,7 +296,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                         {
                             int column = 0;
                             while(column < m_discreteMesh->discreteMesh[row].count()
-                                  && !visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                  && !footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                             {
                                 column++;
                             }
@@ -311,7 +317,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                 rowInView = false;
                                 int column = 0;
                                 while(column < m_discreteMesh->discreteMesh[row].count()
-                                      && !visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                      && !footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                 {
                                     column++;
                                 }
@@ -322,7 +328,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                     if(column == 0)
                                     {
                                         int tempColumn = m_discreteMesh->discreteMesh[row].count() - 1;
-                                        while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(tempColumn), m_body, currentTime, curObservationAntenna)
+                                        while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(tempColumn))
                                               && tempColumn > 0)
                                         {
                                             coveragesampleTmp.firstPoints[row] = tempColumn;
@@ -331,22 +337,20 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                         }
                                     }
                                     coveragesampleTmp.highestRow = row;
-                                    coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                    coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                     if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                     {
                                         m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                        coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                     }
                                     column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                     int columnCounter = 1;
                                     while (columnCounter < m_discreteMesh->discreteMesh[row].count()
-                                           && visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna) )
+                                           && footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)) )
                                     {
-                                        coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                        coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                         if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                         {
                                             m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                            coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                         }
                                         columnCounter++;
                                         column = (column+1) % m_discreteMesh->discreteMesh[row].count();
@@ -357,10 +361,6 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                         }
                         if (lowestRowFound) coveragesampleTmp.anyPointSeen = true;
                     }else{
-                        if (coveragesampleTmp.histpoints.isEmpty())
-                        {
-                            coveragesampleTmp.histpoints.append(m_constellationStudySpaceObjectList.at(i).coveragesample.at(ntemp-1).histpoints);
-                        }
                         bool lowestRowFound = false;
                         if(m_constellationStudySpaceObjectList.at(i).coveragesample.at(ntemp-1).anyPointSeen)
                         {
@@ -372,7 +372,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                 bool rowInView = false;
                                 int column = m_constellationStudySpaceObjectList.at(i).coveragesample.at(ntemp-1).firstPoints[row];
                                 int columnCounter = 0;
-                                if(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                if(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                 { // search to the left
                                     rowInView = true;
                                     coveragesampleTmp.firstPoints[row]=column;
@@ -382,27 +382,25 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                         lowestRowFound = true;
                                     }
                                     coveragesampleTmp.highestRow = row;
-                                    coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                    coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                     if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                     {
                                         m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                        coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                     }
                                     column -= 1;
                                     if(column<0)
                                     {
                                         column += m_discreteMesh->discreteMesh[row].count();
                                     }
-                                    while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna)
+                                    while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column))
                                           && columnCounter < m_discreteMesh->discreteMesh[row].count() )
                                     {
                                         columnCounter++;
                                         coveragesampleTmp.firstPoints[row]=column;
-                                        coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                        coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                         if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                         {
                                             m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                            coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                         }
                                         column -= 1;
                                         if(column<0)
@@ -411,22 +409,21 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                         }
                                     }
                                     column = (m_constellationStudySpaceObjectList.at(i).coveragesample.at(ntemp-1).firstPoints[row]+1) % m_discreteMesh->discreteMesh[row].count();
-                                    while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna) &&
+                                    while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)) &&
                                           columnCounter < m_discreteMesh->discreteMesh[row].count() )
                                     {
                                         columnCounter++;
-                                        coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                        coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                         if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                         {
                                             m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                            coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                         }
                                         column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                     }
                                 }else{ // search to the right
                                     column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                     columnCounter++;
-                                    while(!visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna)
+                                    while(!footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column))
                                           && columnCounter < m_discreteMesh->discreteMesh[row].count() )
                                     {
                                         columnCounter++;
@@ -442,22 +439,20 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                             coveragesampleTmp.lowestRow = row;
                                             lowestRowFound = true;
                                         }
-                                        coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                        coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                         if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                         {
                                             m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                            coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                         }
                                         column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                         columnCounter++;
-                                        while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna) &&
+                                        while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)) &&
                                               columnCounter < m_discreteMesh->discreteMesh[row].count() )
                                         {
-                                            coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                            coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                             if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                             {
                                                 m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                                coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                             }
                                             column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                             columnCounter++;
@@ -476,7 +471,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                     rowInView = false;
                                     for(int column=0; column<m_discreteMesh->discreteMesh[row].count(); column++)
                                     {
-                                        if(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                        if(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                         {
                                             if(!rowInView)
                                             {
@@ -485,7 +480,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                                 if(column == 0)
                                                 {
                                                     int tempColumn = m_discreteMesh->discreteMesh[row].count() - 1;
-                                                    while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(tempColumn), m_body, currentTime, curObservationAntenna)
+                                                    while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(tempColumn))
                                                           && tempColumn > 0)
                                                     {
                                                         coveragesampleTmp.firstPoints[row] = tempColumn;
@@ -495,11 +490,10 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                                 coveragesampleTmp.highestRow = row;
 
                                             }
-                                            coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                            coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                             if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                             {
                                                 m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                                coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                             }
                                         }
                                     }
@@ -518,7 +512,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                         rowInView = false;
                                         for(int column=0; column<m_discreteMesh->discreteMesh[row].count(); column++)
                                         {
-                                            if(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                            if(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                             {
                                                 if(!rowInView)
                                                 {
@@ -527,7 +521,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                                     if(column == 0)
                                                     {
                                                         int tempColumn = m_discreteMesh->discreteMesh[row].count() - 1;
-                                                        while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(tempColumn), m_body, currentTime, curObservationAntenna)
+                                                        while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(tempColumn))
                                                               && tempColumn > 0)
                                                         {
                                                             coveragesampleTmp.firstPoints[row] = tempColumn;
@@ -536,11 +530,10 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                                     }
                                                     coveragesampleTmp.lowestRow = row;
                                                 }
-                                                coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                                coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                                 if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                                 {
                                                     m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                                    coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                                 }
                                             }
                                         }
@@ -556,7 +549,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                 {
                                     int column = 0;
                                     while(column < m_discreteMesh->discreteMesh[row].count()
-                                          && !visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                          && !footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                     {
                                         column++;
                                     }
@@ -577,7 +570,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                         rowInView = false;
                                         int column = 0;
                                         while(column < m_discreteMesh->discreteMesh[row].count()
-                                              && !visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                              && !footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                         {
                                             column++;
                                         }
@@ -588,7 +581,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                             if(column == 0)
                                             {
                                                 int tempColumn = m_discreteMesh->discreteMesh[row].count() - 1;
-                                                while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(tempColumn), m_body, currentTime, curObservationAntenna)
+                                                while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(tempColumn))
                                                       && tempColumn > 0)
                                                 {
                                                     coveragesampleTmp.firstPoints[row] = tempColumn;
@@ -597,22 +590,20 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                                 }
                                             }
                                             coveragesampleTmp.highestRow = row;
-                                            coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                            coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                             if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                             {
                                                 m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                                coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                             }
                                             column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                             int columnCounter = 1;
                                             while (columnCounter < m_discreteMesh->discreteMesh[row].count()
-                                                   && visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna) )
+                                                   && footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)) )
                                             {
-                                                coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                                coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                                 if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                                 {
                                                     m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                                    coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                                 }
                                                 columnCounter++;
                                                 column = (column+1) % m_discreteMesh->discreteMesh[row].count();
@@ -633,7 +624,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                             {
                                 int column = 0;
                                 while(column < m_discreteMesh->discreteMesh[row].count()
-                                      && !visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                      && !footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                 {
                                     column++;
                                 }
@@ -654,7 +645,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                     rowInView = false;
                                     int column = 0;
                                     while(column < m_discreteMesh->discreteMesh[row].count()
-                                          && !visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna))
+                                          && !footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)))
                                     {
                                         column++;
                                     }
@@ -665,7 +656,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                         if(column == 0)
                                         {
                                             int tempColumn = m_discreteMesh->discreteMesh[row].count() - 1;
-                                            while(visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(tempColumn), m_body, currentTime, curObservationAntenna)
+                                            while(footprint.hasInView(m_discreteMesh->discreteMesh[row].at(tempColumn))
                                                   && tempColumn > 0)
                                             {
                                                 coveragesampleTmp.firstPoints[row] = tempColumn;
@@ -674,22 +665,20 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                                             }
                                         }
                                         coveragesampleTmp.highestRow = row;
-                                        coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                        coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                         if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                         {
                                             m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                            coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                         }
                                         column = (column+1) % m_discreteMesh->discreteMesh[row].count();
                                         int columnCounter = 1;
                                         while (columnCounter < m_discreteMesh->discreteMesh[row].count()
-                                               && visibility(m_constellationStudySpaceObjectList.at(i).m_spaceObject, m_discreteMesh->discreteMesh[row].at(column), m_body, currentTime, curObservationAntenna) )
+                                               && footprint.hasInView(m_discreteMesh->discreteMesh[row].at(column)) )
                                         {
-                                            coveragesampleTmp.curpoints.append(m_discreteMesh->discreteMesh[row].at(column));
+                                            coveragesampleTmp.curpoints.setBit(m_discreteMesh->pointIndex(row, column));
                                             if(!m_discreteMesh->discreteMesh[row].at(column).seen[i])
                                             {
                                                 m_discreteMesh->discreteMesh[row].at(column).seen[i]=true;
-                                                coveragesampleTmp.histpoints.append(m_discreteMesh->discreteMesh[row].at(column));
                                             }
                                             columnCounter++;
                                             column = (column+1) % m_discreteMesh->discreteMesh[row].count();
@@ -708,17 +697,15 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
 
                     // restore coveragesampleTmp and add values to coveragesample
                     coveragesample.anyPointSeen &= coveragesampleTmp.anyPointSeen;
-                    coveragesample.curpoints.append(coveragesampleTmp.curpoints);
+                    coveragesample.curpoints |= coveragesampleTmp.curpoints;
 
                     //delete coveragesample.firstPoints;
                     //coveragesampleTmp.histpoints.clear();
 
 
                     }
-                    coveragesample.histpoints.append(coveragesampleTmp.histpoints);
-
                     // covered area in per cent
-                    coveragesample.coveredAreaInPerCent = 100.*( ((double)(coveragesample.curpoints.length())) / (double)m_discreteMesh->numberPoints  );
+                    coveragesample.coveredAreaInPerCent = 100.*( ((double)(coveragesample.curpoints.count(true))) / (double)m_discreteMesh->numberPoints  );
                     // covered area in square kilometers
                     coveragesample.coveredArea = (4.*mypi*m_body->meanRadius()*m_body->meanRadius())*coveragesample.coveredAreaInPerCent/100.;
 //                    cout<<coveragesample.coveredAreaInPerCent<<currentTime<<endl;
@@ -785,6 +772,7 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
                 ConstellationStudySpaceObject tmpASO = m_constellationStudySpaceObjectList.takeAt(i);
                 if (m_calcCoverage){
                     tmpASO.coveragesample.append(coveragesample);
+                    tmpASO.coverage->addEpoch(currentTime, coveragesample.curpoints);
                 }
                 if (m_calcSOLink){
                     tmpASO.linksamples.append(linksample);
@@ -796,6 +784,11 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
 
             }
         }
+
+        if (m_calcCoverage)
+        {
+            computeConstellationCoverage();
+        }
     }
 }
 
@@ -803,6 +796,44 @@ ConstellationStudy::ConstellationStudy(PropagatedScenario* scenario, bool m_calc
 
 ConstellationStudy::~ConstellationStudy()
 {
+    for (int i = 0; i < m_constellationStudySpaceObjectList.length(); i++)
+    {
+        delete m_constellationStudySpaceObjectList.at(i).coverage;
+    }
+    delete m_constellationCoverage;
+}
+
+
+/** Close the coverage statistics of every space object and combine their
+  * footprints into the figures of merit of the whole constellation: at each
+  * time sample a mesh point is counted once for every space object seeing it.
+  */
+void ConstellationStudy::computeConstellationCoverage()
+{
+    m_constellationCoverage = new CoverageAccumulator(m_discreteMesh);
+
+    int numberPoints = m_discreteMesh->numberPoints;
+    QVector<unsigned char> viewCount(numberPoints);
+    for (int k = 0; k < m_sampleTimes.length(); k++)
+    {
+        viewCount.fill(0);
+        foreach (const ConstellationStudySpaceObject& aso, m_constellationStudySpaceObjectList)
+        {
+            const QBitArray& inView = aso.coveragesample.at(k).curpoints;
+            for (int p = 0; p < numberPoints; p++)
+            {
+                if (inView.testBit(p) && viewCount[p] < 255)
+                    viewCount[p]++;
+            }
+        }
+        m_constellationCoverage->addEpoch(m_sampleTimes.at(k), viewCount);
+    }
+
+    for (int i = 0; i < m_constellationStudySpaceObjectList.length(); i++)
+    {
+        m_constellationStudySpaceObjectList.at(i).coverage->finish();
+    }
+    m_constellationCoverage->finish();
 }
 bool linkSampleLessThan(const LinkSample &s1, const LinkSample &s2)
 {
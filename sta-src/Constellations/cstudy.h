@@ -29,7 +29,9 @@
 #include "Main/propagatedscenario.h"
 #include "Constellations/constellationmodule.h"
 #include "Constellations/discretization.h"
+#include "Constellations/coveragefom.h"
 #include <QObject>
+#include <QBitArray>
 
 //using namespace Eigen;
 
@@ -82,6 +84,10 @@ class Antenna
     {
         return m_elevation;
     }
+    double coneAngle()
+    {
+        return m_cone.coneangle;
+    }
     /**
       * the antenna needs its current Position (CBCF frame), the position of the Object (CBCF frame) that is visible or not
       * and the rotation matrix (rotation between VDG and CBCF frame) to decide, dependent on the
@@ -118,8 +124,7 @@ class Antenna
 struct CoverageSample
 {
     double curtime;
-    QList<DiscretizationPoint> histpoints;
-    QList<DiscretizationPoint> curpoints;
+    QBitArray curpoints;    // mesh points in view, indexed as DiscreteMesh::meshAsList
     double coveredArea;
     double coveredAreaInPerCent;
 
@@ -152,6 +157,7 @@ class ConstellationStudySpaceObject
         QList<LinkSample> linksamples;
         QList<GroundLinkSample> groundlinksamples;
         QList<CoverageSample> coveragesample;
+        CoverageAccumulator* coverage;  // owned by the ConstellationStudy
         QList<Antenna*> observation;
         QList<Antenna*> visibilityR;
         QList<Antenna*> visibilityT;
@@ -171,7 +177,11 @@ class ConstellationStudy
 
         QList<ConstellationStudySpaceObject> m_constellationStudySpaceObjectList;
         DiscreteMesh* m_discreteMesh;
+        // coverage figures of merit of the whole constellation
+        CoverageAccumulator* m_constellationCoverage;
     private:
+        void computeConstellationCoverage();
+
 
         PropagatedScenario* m_scenario;
         //QList<double> m_samples;
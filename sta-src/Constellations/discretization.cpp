@@ -74,6 +74,7 @@ void DiscreteMesh::generateMesh(int numberRows)
             p.longitude = 180.0f - ((float)(j+1) - 0.5f) * columnSpacing[k];
             p.seen = new bool[36];
             p.rectangleWidth = columnSpacing[k];
+            p.position = centralBody->planetographicToCartesian(p.latitude, p.longitude, 0.0);
             for(int jj=0; jj<36; jj++)
             {
                 p.seen[jj]=false;
@@ -84,6 +85,7 @@ void DiscreteMesh::generateMesh(int numberRows)
     // transform an array of QLists into a long QList
     for (int k=0; k<numberRows; k++)
     {
+        firstPointOfRow.append(meshAsList.count());
         for (int j=0; j<discreteMesh[k].count(); j++)
         {
             DiscretizationPoint point = discreteMesh[k].at(j);
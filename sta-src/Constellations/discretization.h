@@ -40,6 +40,7 @@ struct DiscretizationPoint
     float latitude;
     bool *seen;
     float rectangleWidth;
+    Eigen::Vector3d position;   // body fixed position on the surface [km]
 };
 class DiscreteMesh
 {
@@ -55,6 +56,13 @@ class DiscreteMesh
         QList<DiscretizationPoint> *discreteMesh;
         QList<DiscretizationPoint> meshAsList;
 
+        /** Index in meshAsList of the point at (row, column) of discreteMesh */
+        int pointIndex(int row, int column) const
+        {
+            return firstPointOfRow.at(row) + column;
+        }
+        QList<int> firstPointOfRow;
+
 };
 
 #endif // DISCRETIZATION_H
@@ -27,14 +27,15 @@ Commenting properly all methods to allow the poor new guy that will update the c
 #include <QDebug>
 
 #include <math.h>
+#include <limits>
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
 #include "commanalysis.h"
+#include "itumaps.h"
 #include "Main/findDataFolder.h"
 #include "Locations/environmentdialog.h"
 #include "Payloads/receiverPayloadDialog.h"
-#include <Astro-Core/surfaceVelocity.h>
 
 #ifdef Q_WS_MAC
 #include <CoreFoundation/CFBundle.h>
@@ -70,118 +71,106 @@ double Pi=mypi;
 
 ////////////////////////////////////////////// FUNCTIONS ////////////////////////////////////////////////////////
 
-/** Calculates the Doppler shift due to motion between a receiver and a emmitter
-  * The calculation is done for a given participant a a given mission arc of this participant
-  * Accepts as parameters the lenght of the list that actually corresponds to each of the
-  *
-  * \return a QList of double numbers containing all doppler shifts in time
-  *
-  */
-QList<double> CommAnalysis::getDopplerShiftList(int numberOfRows)
+void LinkBudgetTable::resize(int rows)
 {
-
-    QList<double> myDopplerShiftList;
-    double dopplerShift;
-
-    for(int i=0; i<numberOfRows; i++)
-    {
-        double frequency=m_transmitter->Budget()->FrequencyBand();
-        double t=m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleTime(i);
-
-        bool visibility;
-        if(m_propagatedScenario->groundObjects().at(m_indexGS)->elevationAngle(m_propagatedScenario->spaceObjects().at(m_indexSC),t)>=5.0*DEG2RAD)
-        {
-            visibility=true;
-            sta::StateVector samples;
-
-            samples=m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySample(i);
-
-            double latitudeGS=m_propagatedScenario->groundObjects().at(m_indexGS)->latitude;
-            double longitudeGS=m_propagatedScenario->groundObjects().at(m_indexGS)->longitude;
-            double altitudeGS=m_propagatedScenario->groundObjects().at(m_indexGS)->altitude;
-
-            latitudeGS=DEG2RAD*(latitudeGS);
-            longitudeGS=DEG2RAD*(longitudeGS);
-
-            longitudeGS=longitudeGS+getGreenwichHourAngle(m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleTime(i)+2400000.5);
-
-            Vector3d normPosition(cos(latitudeGS) * cos(longitudeGS),
-                                  cos(latitudeGS) * sin(longitudeGS),
-                                  sin(latitudeGS));
-
-            Vector3d stationPos=normPosition.cwise() * STA_SOLAR_SYSTEM->lookup("Earth")->radii() + normPosition * altitudeGS;
-
-            Vector3d toSpacecraft = (samples.position - stationPos).normalized();
-
-            Vector3d velSat=samples.velocity;
-            surfaceVelocity earthVel;
-            double speedGS=earthVel.earthStationLinearVelocity(latitudeGS);
-            Vector3d velGS(speedGS*sin(longitudeGS),speedGS*cos(longitudeGS),0);
-            toSpacecraft.normalize();
-
-            double radialVelToGS = ((velGS-velSat).dot(toSpacecraft)) * 1000; //The result is in Km/sec so I convert it to m/s
-
-            dopplerShift=radialVelToGS*frequency/lightSpeed;
-
-            myDopplerShiftList.append(dopplerShift);
-
-        }
-        else
-        {
-            visibility=false;
-            myDopplerShiftList.append(0.0);
-        }
-    }
-
-    return myDopplerShiftList;
-} ///////////////////////////////////////// end of the method //////////////////////////////////////////
-
-
+    mjd.resize(rows);
+    visible.resize(rows);
+    range.resize(rows);
+    rangeRate.resize(rows);
+    elevation.resize(rows);
+    pathElevation.resize(rows);
+    dopplerShift.resize(rows);
+    freeSpaceLoss.resize(rows);
+    oxygenAttenuation.resize(rows);
+    waterVapourAttenuation.resize(rows);
+    atmosphericAttenuation.resize(rows);
+    rainAttenuation.resize(rows);
+    pathLoss.resize(rows);
+    antennaTemperature.resize(rows);
+    systemTemperature.resize(rows);
+    fluxDensity.resize(rows);
+    receivedPower.resize(rows);
+    gOverT.resize(rows);
+    carrierToNoiseDensity.resize(rows);
+    carrierToNoise.resize(rows);
+    ebOverN0.resize(rows);
+    bitErrorRate.resize(rows);
+}
 
 
-/** Calculates the free space loss due to motion between a receiver and a emmitter
-  * The calculation is done for a given participant a a given mission arc of this participant
-  * Accepts as parameters the lenght of the list that actually corresponds to each of the
-  *
-  * \return a QList of double numbers containing all free space losses in time
+/** Calculates the geometry of the link between the ground station and the spacecraft
+  * for every trajectory sample of the mission arc: range, range rate, elevation and
+  * visibility, together with the Doppler shift and the free space loss that only depend
+  * on them.
+  * The spacecraft state is converted once per sample to the body fixed frame of the
+  * ground station, where the station is at rest. The range rate is then simply the
+  * projection of the spacecraft velocity on the line of sight.
   *
+  * \param elevationMask minimum elevation of a visible spacecraft, in radians
   */
-QList<double> CommAnalysis::getFreeSpaceLossList(int numberOfRows)
+void CommAnalysis::computeLinkGeometry(LinkBudgetTable& table, double elevationMask) const
 {
-    QList<double> myFreeSpaceLossList;
-    double eachFreeSpaceLoss, eachFreeSpaceLossIndBs;
+    const MissionArc* arc = m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA);
+    const GroundObject* groundStation = m_propagatedScenario->groundObjects().at(m_indexGS);
+    const StaBody* body = groundStation->centralBody;
+    const sta::CoordinateSystem bodyFixed(sta::COORDSYS_BODYFIXED);
 
-    //The inputs for this function will be the frequency and the range between both participants
+    // The station doesn't move in the body fixed frame
+    Vector3d stationPos = body->planetographicToCartesian(groundStation->latitude, groundStation->longitude, 0.0);
+    Vector3d up = stationPos.normalized();
+
+    // Frequency only terms of the Doppler shift and the free space loss
     double frequency = m_transmitter->Budget()->FrequencyBand();
-    double range, t;
+    double dopplerFactor = frequency / lightSpeed;
+    double fslConstant = 20 * log10(4 * Pi * frequency / lightSpeed);
+
+    double pointingElevation = 0.0;
+    if(m_flagTX==false && m_flagRX==true)
+        pointingElevation = m_transmitter->Transmitter()->PointingDirection()->elevation();
+    else if(m_flagRX==false && m_flagTX==true)
+        pointingElevation = m_receiver->Receiver()->PointingDirection()->elevation();
+
+    int numberOfRows = table.rowCount();
 
     for(int i=0; i<numberOfRows; i++)
     {
-        t = m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleTime(i);
-        range = m_propagatedScenario->groundObjects().at(m_indexGS)->getRange(m_propagatedScenario->spaceObjects().at(m_indexSC), t) * 1000;  // In meters
-
-        bool visibility;
-        // The following condition shall be upgraded to make it gereric (not only 5.0*DEG2GRAD times)
-        if (m_propagatedScenario->groundObjects().at(m_indexGS)->elevationAngle(m_propagatedScenario->spaceObjects().at(m_indexSC),t) >= 5.0*DEG2RAD)
+        double t = arc->trajectorySampleTime(i);
+        sta::StateVector state = sta::CoordinateSystem::convert(arc->trajectorySample(i), t,
+                                                                arc->centralBody(), arc->coordinateSystem(),
+                                                                body, bodyFixed);
+
+        Vector3d lineOfSight = state.position - stationPos;
+        double range = lineOfSight.norm();                      // In Km
+        Vector3d toSpacecraft = lineOfSight / range;
+
+        double sinElevation = up.dot(toSpacecraft);
+        if (sinElevation > 1.0)
+            sinElevation = 1.0;
+        else if (sinElevation < -1.0)
+            sinElevation = -1.0;
+        double elevation = asin(sinElevation);
+
+        double rangeRate = state.velocity.dot(toSpacecraft) * 1000;  // The result is in Km/sec so I convert it to m/s
+
+        table.mjd[i] = t;
+        table.range[i] = range * 1000;  // In meters
+        table.rangeRate[i] = rangeRate;
+        table.elevation[i] = elevation;
+        table.pathElevation[i] = tracking ? elevation : pointingElevation;
+        table.visible[i] = elevation >= elevationMask;
+
+        if (table.visible[i])
         {
-            visibility=true;
-            //mjdList.append(t);
-            //range=range*1000;
-            //rangeList.append(range);//In metres
-            eachFreeSpaceLoss = pow((4 * Pi * range * frequency / lightSpeed), 2);  // This formula is defined to be in the denominator
-                                                                                    // of the C/No when it is expressed in natural units
-            eachFreeSpaceLossIndBs = 10*log10(eachFreeSpaceLoss); //This value shall be preceded by a minus when it is in decibels
-            myFreeSpaceLossList.append(eachFreeSpaceLossIndBs);
+            table.dopplerShift[i] = -rangeRate * dopplerFactor;
+            // (4 * pi * range * f / c)^2 in dB. This value shall be preceded by a minus in the C/No budget
+            table.freeSpaceLoss[i] = fslConstant + 20 * log10(table.range[i]);
         }
         else
         {
-            visibility=false;
-            myFreeSpaceLossList.append(0.0);
+            table.dopplerShift[i] = 0.0;
+            table.freeSpaceLoss[i] = 0.0;
         }
-
     }
-
-    return myFreeSpaceLossList;
 } ///////////////////////////////////////// end of the method //////////////////////////////////////////
 
 
@@ -225,64 +214,18 @@ double CommAnalysis::WaterVapourSpecificAttenuation(double frequency, double lat
 
     wvcheck=m_environment->WaterVapourChoice();
 
-    QString whereIsTheDataFolder = findDataFolder();
-
     if(wvcheck=="true")
     {
-        QString pathLat(whereIsTheDataFolder + "/" + "data/maps/surfwv_lat.txt"); QFile fileLat(pathLat);
-        QString pathLon(whereIsTheDataFolder + "/" + "data/maps/surfwv_lon.txt"); QFile fileLon(pathLon);
-        QString pathWaterVapour(whereIsTheDataFolder + "/" + "data/maps/surfwv_50.txt"); QFile fileWaterVapour(pathWaterVapour);
-
-        if((!fileLat.exists()) || (!fileLon.exists()) || (!fileWaterVapour.exists()))
+        // Surface water vapour density from the preloaded ITU-R P.836 map
+        const ItuGridMap& waterVapourMap = STA_ITU_MAPS->waterVapourDensity();
+        if(!waterVapourMap.isValid())
         {
-            qDebug()<<" file error: surfwv_lat.txt does not exist";
+            qDebug()<<" file error: surfwv_50.txt could not be read";
+            wpSpecAtt=0.0;
         }
-        else // In this case we found the file and we can read it
+        else
         {
-            fileLat.open(QIODevice::ReadOnly);
-            QTextStream latStream(&fileLat);
-            double latPoint;
-
-            int i=0;
-            do
-            {
-                latStream>>latPoint;
-                i++;
-            } while(latPoint>latitude);
-
-            fileLat.close();
-            if(longitude<0) longitude=longitude+360;
-
-            fileLon.open(QIODevice::ReadOnly);
-            QTextStream lonStream(&fileLon);
-            double lonPoint;
-
-            int k;
-            for(k=0; k<i; k++)
-            {
-                lonStream>>lonPoint;
-            }
-
-            int j=0;
-            do
-            {
-                lonStream>>lonPoint;
-                j++;
-            } while(lonPoint<longitude);
-
-            fileLon.close();
-
-            fileWaterVapour.open(QIODevice::ReadOnly);
-            QTextStream waterVapourStream(&fileWaterVapour);
-
-            int z=0;
-            int target=i+j;
-
-            for(z; z<target; z++)
-            {
-                waterVapourStream>>waterDensity;
-            }
-
+            waterDensity=waterVapourMap.value(latitude, longitude);
             wpSpecAtt=(0.067+(3/(pow(((frequency)-22.3),2)+7.3)))*waterDensity*pow((frequency),2)/10000; //This result is in dB/Km
         }
     }
@@ -295,396 +238,169 @@ double CommAnalysis::WaterVapourSpecificAttenuation(double frequency, double lat
 } ///////////////////////////////////////// end of the method //////////////////////////////////////////
 
 
-/** Calculates the atmospheric attenuation
-  * This takes the elevation angle of the participant that is on the ground station.
-  * Satellites cannot carry antennas with tracking systems since there is not attitude control in STA
-  *
-  * \return a double
-  *
-  */
-QList<double> CommAnalysis::getAtmosphericAttenuation(double frequency, double wpSpecAtt, double oxSpecAtt, int numberOfRows)
-{
-    QList<double> myAtmosphericAttenuationList;
-    double eachAtmosphericAttenuation;
-
-    double h0 = 6;//equivalent height of a uniform medium for oxygen calculations (Km)
-    double hw; //equivalent height for water vapour calculations
-    frequency = frequency / 1000000000;
-    hw = 2.2 + (3 / (pow((frequency - 22.3),2) + 3)); // In Km
-    double elevationAngle;
-
-    for(int i=0; i<numberOfRows; i++)
-    {
-        double t=m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleTime(i);
-
-        if(tracking==true)
-        {
-            elevationAngle = m_propagatedScenario->groundObjects().at(m_indexGS)->elevationAngle(m_propagatedScenario->spaceObjects().at(m_indexSC),t);
-        }
-        else if(tracking==false)
-        {
-            if(m_flagTX==false && m_flagRX==true)
-                elevationAngle = m_transmitter->Transmitter()->PointingDirection()->elevation();
-            else if(m_flagRX==false && m_flagTX==true)
-                elevationAngle = m_receiver->Receiver()->PointingDirection()->elevation();
-        }
-
-        bool visibility;
-
-        if(m_propagatedScenario->groundObjects().at(m_indexGS)->elevationAngle(m_propagatedScenario->spaceObjects().at(m_indexSC),t)>=5.0*DEG2RAD)
-        {
-            visibility=true;
-            //elevationAngleList.append(elevationAngle);
-            //oxAttList.append(h0*oxSpecAtt*exp(-(hw/h0))/sin(elevationAngle));
-            //wvAttList.append((hw*wpSpecAtt)/sin(elevationAngle));
-            eachAtmosphericAttenuation = (((h0 * oxSpecAtt * exp(-(hw / h0))) + (hw * wpSpecAtt))) / sin(elevationAngle);
-            myAtmosphericAttenuationList.append(eachAtmosphericAttenuation);
-        }
-        else
-        {
-            visibility=false;
-            myAtmosphericAttenuationList.append(0.0);
-        }
-    }
-
-    return myAtmosphericAttenuationList;
-
-} ///////////////////////////////////////// end of the method //////////////////////////////////////////
-
-
-/** Calculates the rain attenuation
-  * This is the position of the groundstation, the parent object should be read
-  * This function is following the recommendation ITU-R P.618-10 for Rain Attenuation estimation (section 2.2)
-  *
-  * \return a double
+/** Calculates the gaseous (oxygen and water vapour) and the rain attenuation along the
+  * slant path for every sample of the table. The geometry columns must already be filled
+  * by computeLinkGeometry.
+  * The gaseous attenuation uses the equivalent heights of ITU-R P.676 and the rain attenuation
+  * follows the recommendation ITU-R P.618-10 (section 2.2). All the terms that depend only on
+  * the frequency and on the ground station position are evaluated once before the time loop.
+  * Satellites cannot carry antennas with tracking systems since there is not attitude control in STA,
+  * so the elevation is the one of the participant that is on the ground station.
   *
   */
-QList<double>  CommAnalysis::getRainAttenuation(double latitude, double longitude, int numberOfRows)
+void CommAnalysis::computePropagationLosses(LinkBudgetTable& table)
 {
-    QList<double> myRainAttenuationList;
-    double eachRainAttenuation;
-
-    ////////////////////////////// DATA AND COEFFICIENTS FOR THIS FUNCTION ////////////////////////////////////////
-    double akh[4]={-5.3398, -0.3531, -0.23789, -0.94158};
-    double bkh[4]={-0.10008, 1.26970, 0.86036, 0.64552};
-    double ckh[4]={1.13098, 0.45400, 0.15354, 0.16817};
-
-    double akv[4]={-3.80595, -3.44965, -0.39902, 0.50167};
-    double bkv[4]={0.56934, -0.22911, 0.73042, 1.07319};
-    double ckv[4]={0.81061, 0.51059, 0.11899, 0.27195};
-
-    double aah[5]={-0.14318, 0.29591, 0.32177, -5.37610, 16.1721};
-    double bah[5]={1.82442, 0.77564, 0.63773, -0.96230, -3.29980};
-    double cah[5]={-0.55187, 0.19822, 0.13164, 1.47828, 3.43990};
-
-    double aav[5]={-0.07771, 0.56727, -0.20238, -48.2991, 48.5833};
-    double bav[5]={2.33840, 0.95545, 1.14520, 0.791669, 0.791459};
-    double cav[5]={-0.76284, 0.54039, 0.26809, 0.116226, 0.116479};
-
-    double logf;
-    double frequency;
+    const GroundObject* groundStation = m_propagatedScenario->groundObjects().at(m_indexGS);
+    double latitude = groundStation->latitude;
+    double longitude = groundStation->longitude;
+    double gsAlt = groundStation->altitude / 1000;  // Now gsAlt is in Km
 
+    double frequency = 0.0;  // In GHz
+    double tilt = 0.0;
     if(m_flagTX==false && m_flagRX==true)
     {
-        logf=log10(m_transmitter->Budget()->FrequencyBand()/1000000000);
-        frequency= m_transmitter->Budget()->FrequencyBand()/1000000000;
+        frequency = m_transmitter->Budget()->FrequencyBand()/1000000000;
+        tilt = m_transmitter->Transmitter()->EMproperties()->TiltAngle();
     }
     else if(m_flagRX==false && m_flagTX==true)
     {
-        logf=log10(m_receiver->Budget()->FrequencyBand()/1000000000);
-        frequency= m_receiver->Budget()->FrequencyBand()/1000000000;
+        frequency = m_receiver->Budget()->FrequencyBand()/1000000000;
+        tilt = m_receiver->Receiver()->EMproperties()->TiltAngle();
     }
 
-    double logkh= (akh[0]*exp(-pow((logf-bkh[0])/ckh[0],2)))+(akh[1]*exp(-pow((logf-bkh[1])/ckh[1],2)))+(akh[2]*exp(-pow((logf-bkh[2])/ckh[2],2)))+(akh[3]*exp(-pow((logf-bkh[3])/ckh[3],2)))-(logf*0.18961)+0.71147;
-    double logkv= (akv[0]*exp(-pow((logf-bkv[0])/ckv[0],2)))+(akv[1]*exp(-pow((logf-bkv[1])/ckv[1],2)))+(akv[2]*exp(-pow((logf-bkv[2])/ckv[2],2)))+(akv[3]*exp(-pow((logf-bkv[3])/ckv[3],2)))-(logf*0.16398)+0.63297;
-
-    double alphah=(aah[0]*exp(-pow((logf-bah[0])/cah[0],2)))+(aah[1]*exp(-pow((logf-bah[1])/cah[1],2)))+(aah[2]*exp(-pow((logf-bah[2])/cah[2],2)))+(aah[3]*exp(-pow((logf-bah[3])/cah[3],2)))+(aah[4]*exp(-pow((logf-bah[4])/cah[4],2)))+(logf*0.67849)-1.95537;
-    double alphav=(aav[0]*exp(-pow((logf-bav[0])/cav[0],2)))+(aav[1]*exp(-pow((logf-bav[1])/cav[1],2)))+(aav[2]*exp(-pow((logf-bav[2])/cav[2],2)))+(aav[3]*exp(-pow((logf-bav[3])/cav[3],2)))+(aav[4]*exp(-pow((logf-bav[4])/cav[4],2)))-(logf*0.053739)+0.83433;
+    ////////////////////////////// GASEOUS ATTENUATION: ZENITH VALUE ////////////////////////////////////////
+    double oxSpecAtt = OxygenSpecificAttenuation(frequency);
+    double wpSpecAtt = WaterVapourSpecificAttenuation(frequency, latitude, longitude);
 
-    double kh=pow(10, logkh);
+    double h0 = 6;  // equivalent height of a uniform medium for oxygen calculations (Km)
+    double hw = 2.2 + (3 / (pow((frequency - 22.3),2) + 3));  // equivalent height for water vapour calculations (Km)
+    double oxZenithAtt = h0 * oxSpecAtt * exp(-(hw / h0));
+    double wvZenithAtt = hw * wpSpecAtt;
 
-    double kv=pow(10, logkv);
+    ////////////////////////////// RAIN: DATA AND COEFFICIENTS OF ITU-R P.838-3 ////////////////////////////////////////
+    static const double akh[4]={-5.3398, -0.3531, -0.23789, -0.94158};
+    static const double bkh[4]={-0.10008, 1.26970, 0.86036, 0.64552};
+    static const double ckh[4]={1.13098, 0.45400, 0.15354, 0.16817};
 
-    double tilt;
+    static const double akv[4]={-3.80595, -3.44965, -0.39902, 0.50167};
+    static const double bkv[4]={0.56934, -0.22911, 0.73042, 1.07319};
+    static const double ckv[4]={0.81061, 0.51059, 0.11899, 0.27195};
 
-    if(m_flagTX==false && m_flagRX==true)
-        tilt=m_transmitter->Transmitter()->EMproperties()->TiltAngle();
-    else if(m_flagRX==false && m_flagTX==true)
-        tilt=m_receiver->Receiver()->EMproperties()->TiltAngle();
-
-    //////////////////////////////////////STEP 1: Determination of rain height given in ITU-R P.839//////////////////////////////
-
-    // Find out now the correct path of the files
-    QString staResourcesPath = findDataFolder();
+    static const double aah[5]={-0.14318, 0.29591, 0.32177, -5.37610, 16.1721};
+    static const double bah[5]={1.82442, 0.77564, 0.63773, -0.96230, -3.29980};
+    static const double cah[5]={-0.55187, 0.19822, 0.13164, 1.47828, 3.43990};
 
-    QString pathLat(staResourcesPath + "/" + "data/maps/ESALAT.TXT");
-    QFile fileLat(pathLat);
+    static const double aav[5]={-0.07771, 0.56727, -0.20238, -48.2991, 48.5833};
+    static const double bav[5]={2.33840, 0.95545, 1.14520, 0.791669, 0.791459};
+    static const double cav[5]={-0.76284, 0.54039, 0.26809, 0.116226, 0.116479};
 
-    if(!fileLat.exists())
-        qDebug()<<" file error";
-    fileLat.open(QIODevice::ReadOnly);
+    double logf = log10(frequency);
 
-    QTextStream latStream(&fileLat);
-    double latPoint;
-
-    int i1=0;
-    do
+    double logkh = -(logf*0.18961)+0.71147;
+    double logkv = -(logf*0.16398)+0.63297;
+    for (int j=0; j<4; j++)
     {
-        latStream>>latPoint;
-        i1++;
-
-    } while(latPoint>latitude);
-
-
-    fileLat.close();
-
-    if(longitude<0)
-        longitude=longitude+360;
-
-    QString pathLon(staResourcesPath + "/" + "data/maps/ESALON.TXT");
-
-    QFile fileLon(pathLon);
-
-    if(!fileLon.exists())
-        qDebug()<<" file error";
-    fileLon.open(QIODevice::ReadOnly);
-
-    QTextStream lonStream(&fileLon);
-    double lonPoint;
-
-    int k1=0;
-    for(k1; k1<i1; k1++)
-        lonStream>>lonPoint;
+        logkh += akh[j]*exp(-pow((logf-bkh[j])/ckh[j],2));
+        logkv += akv[j]*exp(-pow((logf-bkv[j])/ckv[j],2));
+    }
 
-    int j1=0;
-    do
+    double alphah = (logf*0.67849)-1.95537;
+    double alphav = -(logf*0.053739)+0.83433;
+    for (int j=0; j<5; j++)
     {
-        lonStream>>lonPoint;
-        j1++;
-    } while(lonPoint<longitude);
-
-
-    fileLon.close();
-
-    QString pathHeight(staResourcesPath + "/" + "data/maps/ESA0HEIGHT.TXT");
-
-    QFile fileHeight(pathHeight);
-
-    if(!fileHeight.exists())
-        qDebug()<<" file error";
-    fileHeight.open(QIODevice::ReadOnly);
-
-    QTextStream heightStream(&fileHeight);
-    double heightPoint;
-
-    int z1=0;
-    int target1=i1+j1;
-
-    for(z1; z1<target1; z1++)
-        heightStream>>heightPoint;
-
-    double hr;
+        alphah += aah[j]*exp(-pow((logf-bah[j])/cah[j],2));
+        alphav += aav[j]*exp(-pow((logf-bav[j])/cav[j],2));
+    }
 
-    hr=heightPoint+0.36; //in Km
+    double kh = pow(10, logkh);
+    double kv = pow(10, logkv);
+    double cos2tilt = cos(2*tilt);
 
-    //This step is working properly
+    //////////////////////////////////////STEP 1: Determination of rain height given in ITU-R P.839//////////////////////////////
+    // The ITU-R maps are parsed once and shared by all the link computations
+    double hr = STA_ITU_MAPS->isothermHeight().value(latitude, longitude) + 0.36;  // in Km
 
     ///////////////////////////////////////////STEP 4: Get the rainfall rate exceeded for 0.01% of an average year//////////////////////////////////////////////
+    double r001 = STA_ITU_MAPS->rainfallRate001().value(latitude, longitude);
 
-    QString pathLatRain(staResourcesPath + "/" + "data/maps/ESARAIN_LAT_v5.TXT");
-
-    QFile fileLatRain(pathLatRain);
-
-    if(!fileLatRain.exists())
-        qDebug()<<" file error";
-    fileLatRain.open(QIODevice::ReadOnly);
-
-    QTextStream latStreamRain(&fileLatRain);
-    double latPointRain;
-
-    int i2=0;
-    do
-    {
-        latStreamRain>>latPointRain;
-        i2++;
-    }while(latPointRain>latitude);
-
-    fileLatRain.close();
-
-    if(longitude<0)
-        longitude=longitude+360;
+    ///////////////////////////////////////// STEP 7 and 10: latitude dependent terms ///////////////////////////////////////////////////
+    double chi = fabs(latitude) < 36 ? (36-fabs(latitude))*DEG2RAD : 0.0;
+    double percentage = m_environment->Rain()->PercentageExceededLimit();
 
-    QString pathLonRain(staResourcesPath + "/" + "data/maps/ESARAIN_LON_v5.TXT");
+    raincheck = m_environment->Rain()->RainChoice();
+    bool rainEnabled = raincheck=="true";
 
-    QFile fileLonRain(pathLonRain);
-
-    if(!fileLonRain.exists())
-        qDebug()<<" file error";
-    fileLonRain.open(QIODevice::ReadOnly);
-
-    QTextStream lonStreamRain(&fileLonRain);
-    double lonPointRain;
-
-    int k2=0;
-    for(k2; k2<i2; k2++)
-        lonStreamRain>>lonPointRain;
-
-    int j2=0;
-    do
-    {
-        lonStreamRain>>lonPointRain;
-        j2++;
-
-    } while(lonPointRain<longitude);
-    fileLonRain.close();
-
-
-    QString pathRain001(staResourcesPath + "/" + "data/maps/R0_01.TXT");
-
-    QFile fileRain001(pathRain001);
-
-    if(!fileRain001.exists())
-        qDebug()<<" file error";
-    fileRain001.open(QIODevice::ReadOnly);
-
-    QTextStream rain001Stream(&fileRain001);
-    double r001;
-
-    int t=0;
-    int target2=i2+j2;
-
-    for(t; t<target2; t++)
-        rain001Stream>>r001;
-
-
-    //////////////////////////////////////////STEP 2, 3: Get the slant-path range length, below the rain height and its projection////////////////////////////////////////////
-
-    //////////////////////////////////////////STEP 5: get the Specific Attenuation in dB/Km according to ITU-R P.838-3////////////////////////////////////////////////////////
-
-    ///////////////////////////////////////// STEP 6: Calculate the horizontal reduction factor for 0.01% of the time ////////////////////////////////////////////////////////
-
-    //////////////////////////////////////////STEP 7: Calculate the vertical reduction factor for 0.01% of the time //////////////////////////////////////////////////////////
-
-    //////////////////////////////////////////STEP 8: The effective path length //////////////////////////////////////////////////////////
-
-    //////////////////////////////////////////STEP 9: The predicted attenuation exceeded for 0.01% of an average year //////////////////////////////////////////////////////////
-
-    //////////////////////////////////////////STEP 10: Other percentages //////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    double elevationAngle;
-    double finalAtt;
-
-    for(int counter=0; counter<numberOfRows; counter++)
+    int numberOfRows = table.rowCount();
+    for(int i=0; i<numberOfRows; i++)
     {
-        double t=m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleTime(counter);
-
-        if(tracking==true)
+        if (!table.visible[i])
         {
-            elevationAngle=m_propagatedScenario->groundObjects().at(m_indexGS)->elevationAngle(m_propagatedScenario->spaceObjects().at(m_indexSC),t);
+            table.oxygenAttenuation[i] = 0.0;
+            table.waterVapourAttenuation[i] = 0.0;
+            table.atmosphericAttenuation[i] = 0.0;
+            table.rainAttenuation[i] = 0.0;
+            continue;
         }
-        else if(tracking==false)
-        {
 
-            if(m_flagTX==false && m_flagRX==true)
-                elevationAngle=m_transmitter->Transmitter()->PointingDirection()->elevation();
-            else if(m_flagRX==false && m_flagTX==true)
-                elevationAngle=m_receiver->Receiver()->PointingDirection()->elevation();
+        double elevationAngle = table.pathElevation[i];
+        double sinElevation = sin(elevationAngle);
+        double cosElevation = cos(elevationAngle);
+        double cos2Elevation = cosElevation*cosElevation;
 
-        } //This takes the elevation angle of the participant that is on the ground station. Satellites cannot carry antennas with tracking systems since there is not attitude control in STA
+        table.oxygenAttenuation[i] = oxZenithAtt / sinElevation;
+        table.waterVapourAttenuation[i] = wvZenithAtt / sinElevation;
+        table.atmosphericAttenuation[i] = table.oxygenAttenuation[i] + table.waterVapourAttenuation[i];
 
-        bool visibility;
-        if(m_propagatedScenario->groundObjects().at(m_indexGS)->elevationAngle(m_propagatedScenario->spaceObjects().at(m_indexSC),t)>=5.0*DEG2RAD)
-        {
-            visibility=true;
-        }
-        else
+        if (!rainEnabled)
         {
-            visibility=false;
+            table.rainAttenuation[i] = 0.0;
+            continue;
         }
 
-        double gsAlt=m_propagatedScenario->groundObjects().at(m_indexGS)->altitude;
-        gsAlt=gsAlt/1000;//Now gsAlt is in Km
+        //////////////////////////////////////////STEP 2, 3: Get the slant-path range length, below the rain height and its projection////////////////////////////////////////////
+        double slantPath = (hr-gsAlt)/sinElevation;
+        double Lg = slantPath*cosElevation;  // Horizontal projection of the slant path length
 
-        if(visibility==true )
-        {
-            raincheck=m_environment->Rain()->RainChoice();
-
-            if(raincheck=="true")
-            {
-                double slantPath;
-                slantPath=(hr-gsAlt)/sin(elevationAngle);
-
-                double Lg=slantPath*cos(elevationAngle); //Horizontal projection of the slant path length
-
-                //////////////////////// This belongs to step 5 //////////////////////
-                double ktot=(kh+kv+((kh-kv)*pow(cos(elevationAngle),2)*cos(2*tilt)))/2;
-                double alphatot=((kh*alphah)+(kv*alphav)+((kh*alphah-kv*alphav)*pow(cos(elevationAngle),2)*cos(2*tilt)))/(2*ktot);
-                double specAttenuation= ktot*pow(r001, alphatot); //Since it is specific attenuation, the units are dB/Km.
-
-                ////////////////////////// This belongs to step 6 /////////////////////
-                double horiz_reduc=1/(1+(0.78*sqrt(Lg*specAttenuation/frequency))-(0.38*(1-exp(-2*Lg))));
-
-                ////////////////////////// This belongs to step 7 ////////////////////////
-                double zeta=atan((hr-gsAlt)/(Lg*horiz_reduc));
-
-                double Lr;
-                double chi;
-
-                if(zeta>elevationAngle)
-                    Lr=(Lg*horiz_reduc)/cos(elevationAngle);
-                else
-                    Lr=slantPath;
+        //////////////////////////////////////////STEP 5: get the Specific Attenuation in dB/Km according to ITU-R P.838-3////////////////////////////////////////////////////////
+        double ktot = (kh+kv+((kh-kv)*cos2Elevation*cos2tilt))/2;
+        double alphatot = ((kh*alphah)+(kv*alphav)+((kh*alphah-kv*alphav)*cos2Elevation*cos2tilt))/(2*ktot);
+        double specAttenuation = ktot*pow(r001, alphatot);  // Since it is specific attenuation, the units are dB/Km.
 
-                if(fabs(latitude)<36)
-                    chi=36-fabs(latitude);
-                else
-                    chi=0;
+        ///////////////////////////////////////// STEP 6: Calculate the horizontal reduction factor for 0.01% of the time ////////////////////////////////////////////////////////
+        double horiz_reduc = 1/(1+(0.78*sqrt(Lg*specAttenuation/frequency))-(0.38*(1-exp(-2*Lg))));
 
+        //////////////////////////////////////////STEP 7: Calculate the vertical reduction factor for 0.01% of the time //////////////////////////////////////////////////////////
+        double zeta = atan((hr-gsAlt)/(Lg*horiz_reduc));
+        double Lr;
+        if(zeta>elevationAngle)
+            Lr = (Lg*horiz_reduc)/cosElevation;
+        else
+            Lr = slantPath;
 
-                chi=chi*DEG2RAD;
-                double ver_reduc=1/(1+(sqrt(sin(elevationAngle))*((31*(1-exp(-(elevationAngle/(1+chi))))*(sqrt((Lr*specAttenuation))/pow(frequency, 2)))-0.45)));
-
-                ////////////////////////// This belongs to step 8 /////////////////////////
-                double Le=Lr*ver_reduc;
-
-                ////////////////////////// This belongs to step 9 /////////////////////////
-                double estimatedAtt001=specAttenuation*Le;
-
-                //////////////////////// This belongs to step 10 //////////////////////////
-                double beta;
-                double percentage=m_environment->Rain()->PercentageExceededLimit();
-                if(percentage>1 || fabs(latitude)>=36)
-                    beta=0;
-                else if(percentage<1 && fabs(latitude)<36 && elevationAngle>=(25*DEG2RAD))
-                    beta=-0.005*(fabs(latitude)-36);
-                else
-                    beta=-0.005*(fabs(latitude)-36)+1.8-(4.25*sin(elevationAngle));
-
-                eachRainAttenuation = estimatedAtt001*pow((percentage/0.01),(-(0.655+(0.033*log(percentage))-(0.045*log(estimatedAtt001))-(beta*sin(elevationAngle)*(1-percentage))))); //In dB!!
+        double ver_reduc = 1/(1+(sqrt(sinElevation)*((31*(1-exp(-(elevationAngle/(1+chi))))*(sqrt((Lr*specAttenuation))/pow(frequency, 2)))-0.45)));
 
-            }
-            else if(raincheck=="false")
-            {
-                eachRainAttenuation = 0;
-            }
+        //////////////////////////////////////////STEP 8: The effective path length //////////////////////////////////////////////////////////
+        double Le = Lr*ver_reduc;
 
-            myRainAttenuationList.append(eachRainAttenuation);
+        //////////////////////////////////////////STEP 9: The predicted attenuation exceeded for 0.01% of an average year //////////////////////////////////////////////////////////
+        double estimatedAtt001 = specAttenuation*Le;
 
-        }
+        //////////////////////////////////////////STEP 10: Other percentages //////////////////////////////////////////////////////////////////////////////////////////////////////
+        double beta;
+        if(percentage>1 || fabs(latitude)>=36)
+            beta=0;
+        else if(percentage<1 && fabs(latitude)<36 && elevationAngle>=(25*DEG2RAD))
+            beta=-0.005*(fabs(latitude)-36);
         else
-        {
-            myRainAttenuationList.append(0.0);
-        }
+            beta=-0.005*(fabs(latitude)-36)+1.8-(4.25*sinElevation);
 
-        
+        table.rainAttenuation[i] = estimatedAtt001*pow((percentage/0.01),(-(0.655+(0.033*log(percentage))-(0.045*log(estimatedAtt001))-(beta*sinElevation*(1-percentage)))));  // In dB!!
     }
-
-    return myRainAttenuationList;
 } ///////////////////////////////////////// end of the method //////////////////////////////////////////
 
 
 
-double CommAnalysis::SystemTempCalculations()
+void CommAnalysis::SystemTempCalculations(LinkBudgetTable& table)
 {
 
     double antennaTemp, skyTemp, groundTemp, rainAttenuation, systemTemp, equivalentTemp, rxFigureNoise, rxFeederLoss, thermoTempFeeder;
@@ -692,13 +408,16 @@ double CommAnalysis::SystemTempCalculations()
     rxFigureNoise=pow(10, m_receiver->Receiver()->SystemTemperature()->RxNoiseFigure()/10);//Now in natural units
     rxFeederLoss=pow(10, m_receiver->Receiver()->FeederLossRx()/10); //Now in natural units
     thermoTempFeeder=m_receiver->Receiver()->SystemTemperature()->ThermoFeeder();
+    equivalentTemp=290*(rxFigureNoise-1);
 
     double elevationAngle;
     antennaTempChoice=m_receiver->Receiver()->SystemTemperature()->choiceTantenna();
+    double constantAntennaTemp=m_receiver->Receiver()->SystemTemperature()->Tantenna();
 
-    for (int j=0; j<elevationAngleList.length(); j++){
+    for (int j=0; j<table.rowCount(); j++){
 
-        elevationAngle=elevationAngleList[j];
+        elevationAngle=table.elevation[j];
+        antennaTemp=constantAntennaTemp;
         if(antennaTempChoice=="calculated")
         {
                if(m_flagRX==true)
@@ -706,36 +425,30 @@ double CommAnalysis::SystemTempCalculations()
                 else if(m_flagRX==false)
                 {
 
-                        skyTemp=4+275*(1-pow(10,(-atmosphericAttList[j]/10)));
-                        rainAttenuation=pow(10, rainAttenuationList[j]/10);
+                        skyTemp=4+275*(1-pow(10,(-table.atmosphericAttenuation[j]/10)));
+                        rainAttenuation=pow(10, table.rainAttenuation[j]/10);
 
                         if (elevationAngle<=-10*DEG2RAD){ groundTemp=290;}
                         else if (elevationAngle>-10*DEG2RAD && elevationAngle<=0*DEG2RAD){ groundTemp=150;}
                         else if (elevationAngle>0*DEG2RAD && elevationAngle<=10*DEG2RAD){ groundTemp=50;}
-                        else if (elevationAngle>10*DEG2RAD && elevationAngle<=90*DEG2RAD){ groundTemp=10;}
+                        else { groundTemp=10;}
 
                         antennaTemp=(skyTemp/rainAttenuation)+groundTemp+275*(1-(1/rainAttenuation));
 
                  }
-         }else if(antennaTempChoice=="constant"){
-             antennaTemp=m_receiver->Receiver()->SystemTemperature()->Tantenna();
          }
-        antennaTempList.append(antennaTemp);
+        table.antennaTemperature[j]=antennaTemp;
 
-        equivalentTemp=290*(rxFigureNoise-1);
-
-    systemTemp=(antennaTemp/rxFeederLoss)+equivalentTemp+(thermoTempFeeder*(1-(1/rxFeederLoss))); //In Kelvin
-    systemTempList.append(systemTemp);
+        systemTemp=(antennaTemp/rxFeederLoss)+equivalentTemp+(thermoTempFeeder*(1-(1/rxFeederLoss))); //In Kelvin
+        table.systemTemperature[j]=systemTemp;
 
     }
-
-  return systemTemp;
 } ///////////////////////////////////////// end of the method //////////////////////////////////////////
 
 
 
 double CommAnalysis::Modulations(double EbNo)
-{ //the EbNo is passed in dB
+{ //the EbNo is passed in natural units
 
     QString modType=m_transmitter->Transmitter()->Modulation()->ModulationType();
     double ber, a, b;
@@ -785,6 +498,84 @@ double CommAnalysis::Modulations(double EbNo)
 
 
 
+/** Computes the complete link budget of the analysed mission arc as a set of columns.
+  * The geometry is evaluated once per sample, then the propagation losses, the noise
+  * temperatures and the budget itself are computed column by column with all the
+  * terms that do not change in time hoisted out of the loops.
+  *
+  * There's no link when the spacecraft isn't visible: the budget columns of these
+  * rows, from the path loss to the bit error rate, are set to NaN.
+  *
+  * \param elevationMaskDeg minimum elevation of a visible spacecraft, in degrees
+  * \return the link budget table, one row per trajectory sample
+  *
+  */
+LinkBudgetTable CommAnalysis::computeLinkBudget(double elevationMaskDeg)
+{
+    LinkBudgetTable table;
+    int numberOfRows = m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleCount();
+    table.resize(numberOfRows);
+
+    computeLinkGeometry(table, elevationMaskDeg*DEG2RAD);
+    computePropagationLosses(table);
+    SystemTempCalculations(table);
+
+    /////////////// FIXED VALUES THAT COME FROM TRANSMITTER AND RECEIVER //////////////////////
+    double potTxDb = 10*log10(m_transmitter->Transmitter()->TransmittingPower());
+    double gainTxDb = m_transmitter->Transmitter()->EMproperties()->GainMax();
+    double txFeederLossDb = m_transmitter->Transmitter()->FedderLossTx();
+    double txDepointingLossDb = m_transmitter->Transmitter()->DepointingLossTx();
+
+    double gainRxDb = m_receiver->Receiver()->EMproperties()->GainMax();
+    double rxFeederLossDb = m_receiver->Receiver()->FeederLossRx();
+    double rxDepointingLossDb = m_receiver->Receiver()->DepointingLossRx();
+
+    //Calculate some fix parameters
+    double eirp = potTxDb + gainTxDb - (txFeederLossDb + txDepointingLossDb);  //The units are in dBW
+    double txBW = m_transmitter->Transmitter()->EMproperties()->BandWidth();
+    double rxBW = m_receiver->Receiver()->EMproperties()->BandWidth();
+    double txDataRate = m_transmitter->Transmitter()->Modulation()->DataRate();
+
+    double overLapBWfactor = txBW>=rxBW ? rxBW/txBW : txBW/rxBW;
+
+    double fluxConstant = eirp - 10*log10(4*Pi);
+    double noiseConstant = eirp + 228.6 + 10*log10(overLapBWfactor);  // the 228.6 factor is in dBW/HzK and it is the Bolztman constant in decibels
+    double bandWidthDb = 10*log10(txBW);
+    double dataRateDb = 10*log10(txDataRate);
+    double rxLossesDb = rxFeederLossDb + rxDepointingLossDb;
+
+    const double noLink = std::numeric_limits<double>::quiet_NaN();
+
+    for(int i=0; i<numberOfRows; i++)
+    {
+        table.fluxDensity[i] = fluxConstant - 20*log10(table.range[i]);
+        table.gOverT[i] = gainRxDb - rxLossesDb - 10*log10(table.systemTemperature[i]);
+
+        if (!table.visible[i])
+        {
+            table.pathLoss[i] = noLink;
+            table.receivedPower[i] = noLink;
+            table.carrierToNoiseDensity[i] = noLink;
+            table.carrierToNoise[i] = noLink;
+            table.ebOverN0[i] = noLink;
+            table.bitErrorRate[i] = noLink;
+            continue;
+        }
+
+        double pathLoss = table.rainAttenuation[i] + table.atmosphericAttenuation[i] + table.freeSpaceLoss[i];
+        table.pathLoss[i] = pathLoss;
+        table.receivedPower[i] = eirp - pathLoss;
+        table.carrierToNoiseDensity[i] = noiseConstant - pathLoss + table.gOverT[i];  //The units are dBHz
+        table.carrierToNoise[i] = table.carrierToNoiseDensity[i] - bandWidthDb;
+        table.ebOverN0[i] = table.carrierToNoiseDensity[i] - dataRateDb;
+        table.bitErrorRate[i] = Modulations(pow(10, table.ebOverN0[i]/10));
+    }
+
+    return table;
+} ///////////////////////////////////////// end of the method //////////////////////////////////////////
+
+
+
 void CommAnalysis::CommReports()
 {
     // Find out now the correct path of the files
@@ -798,10 +589,6 @@ void CommAnalysis::CommReports()
     QFile reportComm2(secondFile);
     QFile reportComm3(thirdFile);
 
-    //qDebug() << firstFile << endl;
-    //qDebug() << secondFile << endl;
-    //qDebug() << thirdFile << endl;
-
     reportComm1.open(QIODevice::WriteOnly|QIODevice::ReadWrite);
     reportComm2.open(QIODevice::WriteOnly|QIODevice::ReadWrite);
     reportComm3.open(QIODevice::WriteOnly|QIODevice::ReadWrite);
@@ -819,97 +606,27 @@ void CommAnalysis::CommReports()
     streamReportComm3<<"MJD"<<"\t"<<"G/Y"<<"\t"<<"C/No"<<"\t"<<"C/N"<<"\t"<<"Eb/No"<<"\t"<<"BER"<<endl;
 
     // Starting now the calculations
-    double frequency;
+    LinkBudgetTable table = computeLinkBudget();
 
-    if(m_flagTX==false && m_flagRX==true)
-    {
-        frequency = m_transmitter->Budget()->FrequencyBand()/1000000000;
-    }
-    else if(m_flagRX==false && m_flagTX==true)
-    {
-        frequency = m_receiver->Budget()->FrequencyBand()/1000000000;
-    }
-
-    /////////////// FIXED VALUES THAT COME FROM TRANSMITTER AND RECEIVER //////////////////////
     double potTxDb = 10*log10(m_transmitter->Transmitter()->TransmittingPower());
-    double gainTxDb = m_transmitter->Transmitter()->EMproperties()->GainMax();
-    double txFeederLossDb = m_transmitter->Transmitter()->FedderLossTx();
-    double txDepointingLossDb = m_transmitter->Transmitter()->DepointingLossTx();
-
-    double polLoss, rcvdPower, fluxDensity;
-
-    if (m_transmitter->Transmitter()->EMproperties()->Polarisation()=="rightCircular" && m_receiver->Receiver()->EMproperties()->Polarisation()=="leftCircular")
-        polLoss=20;//in dB
-    else if (m_receiver->Receiver()->EMproperties()->Polarisation()=="rightCircular" && m_transmitter->Transmitter()->EMproperties()->Polarisation()=="leftCircular")
-        polLoss=20;//in dB
-    else
-    {
-        double txAngle = m_transmitter->Transmitter()->EMproperties()->TiltAngle();
-        double rxAngle = m_receiver->Receiver()->EMproperties()->TiltAngle();
-        polLoss = -20*(log10(cos(fabs(txAngle-rxAngle))));
-    }
-
-    double gainRxDb = m_receiver->Receiver()->EMproperties()->GainMax();
-    double rxFeederLossDb = m_receiver->Receiver()->FeederLossRx();
-    double rxDepointingLossDb = m_receiver->Receiver()->DepointingLossRx();
-    double transmittedFrequency = m_transmitter->Budget()->FrequencyBand();
-
-    //Calculate some fix parameters
-    double eirp = potTxDb + gainTxDb - (txFeederLossDb + txDepointingLossDb);  //The units are in dBW
+    double eirp = potTxDb + m_transmitter->Transmitter()->EMproperties()->GainMax()
+                  - (m_transmitter->Transmitter()->FedderLossTx() + m_transmitter->Transmitter()->DepointingLossTx());  //The units are in dBW
     double txBW = m_transmitter->Transmitter()->EMproperties()->BandWidth();
     double rxBW = m_receiver->Receiver()->EMproperties()->BandWidth();
-    double txDataRate = m_transmitter->Transmitter()->Modulation()->DataRate();
+    double overLapBWfactor = txBW>=rxBW ? rxBW/txBW : txBW/rxBW;
+    double transmittedFrequency = m_transmitter->Budget()->FrequencyBand();
 
-    double overLapBWfactor;
-
-    if(txBW>=rxBW)
-        overLapBWfactor=rxBW/txBW;
-    else if(rxBW>txBW)
-        overLapBWfactor=txBW/rxBW;
-
-    double propLoss;
-    double carrierToNoise;
-    double EbNo, BER;
-    QList<double> rcvdFrequencyList;
-    QList<double> pathLossList;
-    QList<double> GoverTList;
-
-    double myJulianDay;
-    int myIndex;
-    int p;
-    int myNumberOfRows = m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleCount();  qDebug() << "myNumberOfRows" << myNumberOfRows << endl;
-
-    double receiverFrequency, receiverPower, myGoverT, pathLoss, carrierToNoiseDensity;
-    double theRange;
-
-    // Get the list of all Doppler shifts:
-    QList<double> myRealDopplerShiftList = CommAnalysis::getDopplerShiftList(myNumberOfRows);  qDebug() << "myRealDopplerShiftListLenght" << myRealDopplerShiftList.length() << endl;
-    // Get the list of all free space losses:
-    QList<double> myRealFreeSpaceLossList = CommAnalysis::getFreeSpaceLossList(myNumberOfRows);
-    double oxAttenuation = CommAnalysis::OxygenSpecificAttenuation(frequency);
-    double wpAttenuation = CommAnalysis::WaterVapourSpecificAttenuation(frequency, m_propagatedScenario->groundObjects().at(m_indexGS)->latitude,m_propagatedScenario->groundObjects().at(m_indexGS)->longitude);
-    QList<double> myRealAtmosphericAttenuationList = CommAnalysis::getAtmosphericAttenuation(frequency, wpAttenuation, oxAttenuation, myNumberOfRows); qDebug() << "myRealAtmosphericAttenuationListLenght" << myRealAtmosphericAttenuationList.length() << endl;
-    QList<double> myRealRainAttenuationList = CommAnalysis::getRainAttenuation(m_propagatedScenario->groundObjects().at(m_indexGS)->latitude,m_propagatedScenario->groundObjects().at(m_indexGS)->longitude, myNumberOfRows);  qDebug() << "myRealRainAttenuationListLengh" << myRealRainAttenuationList.length() << endl;
-    double SystemTempCalculations = CommAnalysis::SystemTempCalculations();
-
-    for(myIndex=0; myIndex<myNumberOfRows; myIndex++)
+    // Only the samples where the link exists are reported
+    for(int i=0; i<table.rowCount(); i++)
     {
-        myJulianDay = m_propagatedScenario->spaceObjects().at(m_indexSC)->mission().at(m_indexMA)->trajectorySampleTime(myIndex);
-        receiverFrequency = transmittedFrequency + myRealDopplerShiftList[myIndex];  //qDebug() << receiverFrequency << endl;
-        theRange = m_propagatedScenario->groundObjects().at(m_indexGS)->getRange(m_propagatedScenario->spaceObjects().at(m_indexSC), myIndex) * 1000;
-        fluxDensity = eirp - (10 * log10(4 * theRange * theRange * Pi)); //qDebug() << fluxDensity << endl;
-        pathLoss = myRealRainAttenuationList[myIndex] + myRealAtmosphericAttenuationList[myIndex] + myRealFreeSpaceLossList[myIndex];
-        //myGoverT = gainRxDb - (rxFeederLossDb + rxDepointingLossDb + pathLoss) - (10*log10(systemTempList[myIndex]));  //The units are dBHz
-        myGoverT = gainRxDb - (rxFeederLossDb + rxDepointingLossDb + pathLoss) - (10*log10(1.0));
-        carrierToNoiseDensity = eirp - pathLoss + myGoverT + 228.6 + (10*log10(overLapBWfactor));  //The units are dBHz, the 228.6 factor is in dBW/HzK and it is the Bolztman constant in decibels
-        receiverPower = eirp - propLoss;
-        carrierToNoise = carrierToNoiseDensity - (10*log10(txBW));
-        BER = CommAnalysis::Modulations(EbNo);
-
-        streamReportComm1 << myJulianDay << "\t" << eirp << "\t" << receiverFrequency << "\t" << myRealDopplerShiftList[myIndex] << "\t" << receiverPower << "\t" << fluxDensity << "\t" << overLapBWfactor << endl;
-        //streamReportComm2 << myJulianDay << "\t" << myRealFreeSpaceLossList[myIndex] << "\t" << oxAttList[p] << "\t" << wvAttList[myIndex] << "\t" << myRealRainAttenuationList[myIndex] << "\t" << myRealAtmosphericAttenuationList[myIndex] << "\t" << pathLoss << endl;
-        streamReportComm2 << myJulianDay << "\t" << myRealFreeSpaceLossList[myIndex] << "\t" << 0.0 << "\t" << 0.0 << "\t" << myRealRainAttenuationList[myIndex] << "\t" << myRealAtmosphericAttenuationList[myIndex] << "\t" << pathLoss << endl;
-        streamReportComm3 << myJulianDay << "\t" << myGoverT << "\t" << carrierToNoiseDensity << "\t" << carrierToNoise << "\t" << EbNo << "\t" << BER <<endl;
+        if (!table.visible[i])
+            continue;
+
+        double receiverFrequency = transmittedFrequency + table.dopplerShift[i];
+
+        streamReportComm1 << table.mjd[i] << "\t" << eirp << "\t" << receiverFrequency << "\t" << table.dopplerShift[i] << "\t" << table.receivedPower[i] << "\t" << table.fluxDensity[i] << "\t" << overLapBWfactor << endl;
+        streamReportComm2 << table.mjd[i] << "\t" << table.freeSpaceLoss[i] << "\t" << table.oxygenAttenuation[i] << "\t" << table.waterVapourAttenuation[i] << "\t" << table.rainAttenuation[i] << "\t" << table.atmosphericAttenuation[i] << "\t" << table.pathLoss[i] << endl;
+        streamReportComm3 << table.mjd[i] << "\t" << table.gOverT[i] << "\t" << table.carrierToNoiseDensity[i] << "\t" << table.carrierToNoise[i] << "\t" << table.ebOverN0[i] << "\t" << table.bitErrorRate[i] << endl;
     }
 
     reportComm1.close();
@@ -31,6 +31,7 @@
 #include <QFile>
 #include <QDebug>
 #include <QTextStream>
+#include <QVector>
 #include <QDir>
 #include <QProcess>
 #include <string.h>
@@ -45,6 +46,41 @@
 
 using namespace sta;
 
+
+/*! Columnar storage of a link budget time series. All the columns have one
+ *  entry per trajectory sample of the analysed mission arc, so the quantities
+ *  of one epoch are found at the same index in every column.
+ */
+struct LinkBudgetTable
+{
+    void resize(int rows);
+    int rowCount() const { return mjd.size(); }
+
+    QVector<double> mjd;
+    QVector<bool> visible;                   // elevation above the elevation mask; the budget columns are NaN otherwise
+    QVector<double> range;                   // in metres
+    QVector<double> rangeRate;               // in m/s, positive when receding
+    QVector<double> elevation;               // in radians, true elevation from the ground station
+    QVector<double> pathElevation;           // in radians, elevation used for the atmospheric path
+    QVector<double> dopplerShift;            // in Hz
+    QVector<double> freeSpaceLoss;           // in dB
+    QVector<double> oxygenAttenuation;       // in dB
+    QVector<double> waterVapourAttenuation;  // in dB
+    QVector<double> atmosphericAttenuation;  // in dB
+    QVector<double> rainAttenuation;         // in dB
+    QVector<double> pathLoss;                // in dB
+    QVector<double> antennaTemperature;      // in K
+    QVector<double> systemTemperature;       // in K
+    QVector<double> fluxDensity;             // in dBW/m^2
+    QVector<double> receivedPower;           // in dBW
+    QVector<double> gOverT;                  // in dB/K
+    QVector<double> carrierToNoiseDensity;   // in dBHz
+    QVector<double> carrierToNoise;          // in dB
+    QVector<double> ebOverN0;                // in dB
+    QVector<double> bitErrorRate;
+};
+
+
 class CommAnalysis
 {
 public:
@@ -59,19 +95,20 @@ public:
     ~CommAnalysis();
     //Public function to create the output of this module. It is the only public function in order to preserve the input data
     void CommReports();
+    //Computes the whole link budget time series of the mission arc in one pass. The
+    //spacecraft is visible when its elevation is above the mask (in degrees)
+    LinkBudgetTable computeLinkBudget(double elevationMaskDeg = 5.0);
 
 
 private:
 
     ///////////////////////////// PRIVATE FUNCTIONS NOT TO BE USED OUTSIDE THIS CLASS /////////////////////////////////////
     
-    QList<double> getDopplerShiftList(int numberOfRows);
-    QList<double> getFreeSpaceLossList(int numberOfRows);
+    void computeLinkGeometry(LinkBudgetTable& table, double elevationMask) const;
+    void computePropagationLosses(LinkBudgetTable& table);
     double OxygenSpecificAttenuation(double frequency); //Here I pass the frequency as argument coz It has to be the groundStation frequency...I don't know how to get the parent object yet!
     double WaterVapourSpecificAttenuation(double frequency, double latitude, double longitude);
-    QList<double> getAtmosphericAttenuation(double frequency, double wpSpecAtt, double oxSpecAtt, int numberOfRows);
-    QList<double> getRainAttenuation(double latitude, double longitude, int numberOfRows);
-    double SystemTempCalculations();
+    void SystemTempCalculations(LinkBudgetTable& table);
     double Modulations(double EbNo);
 
     ///////////////////////////// PRIVATE MEMBERS NOT TO BE USED OUTSIDE THIS CLASS /////////////////////////////////////
@@ -86,19 +123,6 @@ private:
     bool m_flagTX; //If this flag is 1 means that the transmitter is on board a spacecraft, if it is 0, on a ground station
     bool m_flagRX; //If this flag is 1 means that the receiver is on board a spacecraft, if it is 0, on a ground station
 
-    QList<double> elevationAngleList;//in radians
-    QList<double> rangeList;//in metres
-    QList<double> dopplerList;
-    QList<double> freeSpaceLossList;//in dB
-    QList<double> oxAttList;//in dB
-    QList<double> wvAttList;//in dB
-    QList<double> mjdList;//in mjd
-    QList<double> atmosphericAttList;//in dB
-    QList<double> rainAttenuationList;//in dB
-    QList<double> antennaTempList;//in K
-    QList<double> systemTempList;//in K
-    QList<double> carrierToNoiseDensityList;//in dB
-
     QString antennaTempChoice;
     QString oxcheck;
     QString wvcheck;
@@ -0,0 +1,288 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+ */
+
+#include "itumaps.h"
+#include "Main/findDataFolder.h"
+
+#include <QFile>
+#include <QByteArray>
+#include <QMutexLocker>
+#include <QDebug>
+
+#include <cmath>
+#include <cstdlib>
+
+
+ItuMapStore* ItuMapStore::s_instance = NULL;
+static QMutex s_instanceMutex;
+
+
+ItuGridMap::ItuGridMap() :
+    m_latitudeStep(0.0),
+    m_longitudeStep(0.0),
+    m_periodicColumns(0)
+{
+}
+
+
+/** Read all the numbers of a map file into a flat array. The number of
+  * non empty lines of the file is returned in rows.
+  */
+bool
+ItuGridMap::readGrid(const QString& fileName, QVector<double>& values, int* rows)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qDebug() << "ITU map file error: cannot open" << fileName;
+        return false;
+    }
+
+    // The maps are small (a few hundred kB), so read them in one go and
+    // tokenize the buffer directly instead of going through QTextStream.
+    QByteArray contents = file.readAll();
+    file.close();
+
+    values.clear();
+    *rows = 0;
+
+    const char* p = contents.constData();
+    const char* end = p + contents.size();
+    bool lineHasValues = false;
+
+    while (p < end)
+    {
+        char c = *p;
+        if (c == '\n')
+        {
+            if (lineHasValues)
+            {
+                ++*rows;
+            }
+            lineHasValues = false;
+            ++p;
+        }
+        else if (c == ' ' || c == '\t' || c == '\r')
+        {
+            ++p;
+        }
+        else
+        {
+            char* next = NULL;
+            double x = strtod(p, &next);
+            if (next == p)
+            {
+                qDebug() << "ITU map file error: unexpected character in" << fileName;
+                return false;
+            }
+            values.append(x);
+            lineHasValues = true;
+            p = next;
+        }
+    }
+
+    if (lineHasValues)
+    {
+        ++*rows;
+    }
+
+    return *rows > 0 && values.size() % *rows == 0;
+}
+
+
+/** Load a map from its latitude, longitude and value files. All three files
+  * must have the same number of rows and columns.
+  *
+  * \return true if the map was read successfully
+  */
+bool
+ItuGridMap::load(const QString& latitudeFile, const QString& longitudeFile, const QString& valueFile)
+{
+    QVector<double> latGrid;
+    QVector<double> lonGrid;
+    int latRows = 0;
+    int lonRows = 0;
+    int valueRows = 0;
+
+    m_latitudes.clear();
+    m_longitudes.clear();
+    m_values.clear();
+
+    if (!readGrid(latitudeFile, latGrid, &latRows) ||
+        !readGrid(longitudeFile, lonGrid, &lonRows) ||
+        !readGrid(valueFile, m_values, &valueRows))
+    {
+        m_values.clear();
+        return false;
+    }
+
+    if (latRows != valueRows || lonRows != valueRows ||
+        latGrid.size() != m_values.size() || lonGrid.size() != m_values.size())
+    {
+        qDebug() << "ITU map file error: inconsistent grid size in" << valueFile;
+        m_values.clear();
+        return false;
+    }
+
+    int columns = m_values.size() / valueRows;
+    if (valueRows < 2 || columns < 2)
+    {
+        m_values.clear();
+        return false;
+    }
+
+    // The latitude is constant along a row, the longitude along a column
+    m_latitudes.resize(valueRows);
+    for (int i = 0; i < valueRows; ++i)
+    {
+        m_latitudes[i] = latGrid[i * columns];
+    }
+
+    m_longitudes.resize(columns);
+    for (int j = 0; j < columns; ++j)
+    {
+        m_longitudes[j] = lonGrid[j];
+    }
+
+    // ITU-R grids are uniformly spaced, which lets value() locate the
+    // surrounding nodes without searching.
+    m_latitudeStep = (m_latitudes.first() - m_latitudes.last()) / (valueRows - 1);
+    m_longitudeStep = (m_longitudes.last() - m_longitudes.first()) / (columns - 1);
+
+    // Some maps repeat the 0 degree column at 360 degrees, others stop one
+    // step before it.
+    if (m_longitudes.last() - m_longitudes.first() >= 360.0 - 0.5 * m_longitudeStep)
+        m_periodicColumns = columns - 1;
+    else
+        m_periodicColumns = columns;
+
+    return true;
+}
+
+
+/** Bilinear interpolation of the map at the given geodetic position.
+  * Latitude and longitude are in degrees; the longitude may be given
+  * either in [-180, 180] or in [0, 360].
+  */
+double
+ItuGridMap::value(double latitude, double longitude) const
+{
+    if (!isValid())
+    {
+        return 0.0;
+    }
+
+    int rows = m_latitudes.size();
+    int columns = m_longitudes.size();
+
+    // Row coordinate, clamped to the poles
+    double rowf = (m_latitudes.first() - latitude) / m_latitudeStep;
+    if (rowf < 0.0)
+        rowf = 0.0;
+    else if (rowf > rows - 1)
+        rowf = rows - 1;
+    int i0 = (int) floor(rowf);
+    if (i0 > rows - 2)
+        i0 = rows - 2;
+    double u = rowf - i0;
+
+    // Column coordinate, wrapped around the globe
+    double lon = fmod(longitude - m_longitudes.first(), 360.0);
+    if (lon < 0.0)
+        lon += 360.0;
+    double colf = lon / m_longitudeStep;
+    int j0 = (int) floor(colf);
+    double v = colf - j0;
+    j0 = j0 % m_periodicColumns;
+    int j1 = (j0 + 1) % m_periodicColumns;
+
+    const double* row0 = m_values.constData() + i0 * columns;
+    const double* row1 = row0 + columns;
+
+    return (1.0 - u) * ((1.0 - v) * row0[j0] + v * row0[j1]) +
+           u         * ((1.0 - v) * row1[j0] + v * row1[j1]);
+}
+
+
+ItuMapStore::ItuMapStore() :
+    m_waterVapourLoaded(false),
+    m_isothermLoaded(false),
+    m_rainfallLoaded(false)
+{
+}
+
+
+ItuMapStore*
+ItuMapStore::instance()
+{
+    QMutexLocker locker(&s_instanceMutex);
+    if (s_instance == NULL)
+    {
+        s_instance = new ItuMapStore();
+    }
+
+    return s_instance;
+}
+
+
+const ItuGridMap&
+ItuMapStore::lazyLoad(ItuGridMap& map, bool& loaded,
+                      const char* latitudeFile, const char* longitudeFile, const char* valueFile)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!loaded)
+    {
+        QString mapsPath = findDataFolder() + "/data/maps/";
+        if (!map.load(mapsPath + latitudeFile, mapsPath + longitudeFile, mapsPath + valueFile))
+        {
+            qDebug() << "ITU map" << valueFile << "could not be loaded";
+        }
+
+        // Don't retry on failure; an invalid map evaluates to zero
+        loaded = true;
+    }
+
+    return map;
+}
+
+
+const ItuGridMap&
+ItuMapStore::waterVapourDensity()
+{
+    return lazyLoad(m_waterVapourDensity, m_waterVapourLoaded,
+                    "surfwv_lat.txt", "surfwv_lon.txt", "surfwv_50.txt");
+}
+
+
+const ItuGridMap&
+ItuMapStore::isothermHeight()
+{
+    return lazyLoad(m_isothermHeight, m_isothermLoaded,
+                    "ESALAT.TXT", "ESALON.TXT", "ESA0HEIGHT.TXT");
+}
+
+
+const ItuGridMap&
+ItuMapStore::rainfallRate001()
+{
+    return lazyLoad(m_rainfallRate001, m_rainfallLoaded,
+                    "ESARAIN_LAT_v5.TXT", "ESARAIN_LON_v5.TXT", "R0_01.TXT");
+}
@@ -0,0 +1,108 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+ */
+
+#ifndef ITUMAPS_H
+#define ITUMAPS_H
+
+#include <QString>
+#include <QVector>
+#include <QMutex>
+
+
+/*! A global latitude/longitude grid of one ITU-R propagation parameter
+ *  (surface water vapour density, 0 degree isotherm height, rainfall rate...).
+ *
+ *  The ITU-R maps distributed in sta-data/data/maps come as three text files
+ *  of identical shape: one with the latitude of every grid node, one with the
+ *  longitude and one with the value. The grid is read once into a contiguous
+ *  row-major array (rows = latitudes from north to south, columns =
+ *  longitudes from 0 to 360 degrees East) and is afterwards sampled with
+ *  bilinear interpolation.
+ */
+class ItuGridMap
+{
+public:
+    ItuGridMap();
+
+    bool load(const QString& latitudeFile, const QString& longitudeFile, const QString& valueFile);
+
+    bool isValid() const
+    {
+        return !m_values.isEmpty();
+    }
+
+    int rowCount() const { return m_latitudes.size(); }
+    int columnCount() const { return m_longitudes.size(); }
+
+    double value(double latitude, double longitude) const;
+
+private:
+    static bool readGrid(const QString& fileName, QVector<double>& values, int* rows);
+
+private:
+    QVector<double> m_latitudes;      // degrees, one per row (descending)
+    QVector<double> m_longitudes;     // degrees East, one per column (ascending)
+    QVector<double> m_values;         // rowCount() x columnCount(), row-major
+
+    double m_latitudeStep;
+    double m_longitudeStep;
+    int m_periodicColumns;            // number of distinct columns around the globe
+};
+
+
+/*! Singleton holding the ITU-R maps used by the link budget computations.
+ *  Each map is parsed from disk the first time it is requested and is then
+ *  shared by every CommAnalysis instance. The store is safe to use from
+ *  several threads at the same time.
+ */
+class ItuMapStore
+{
+public:
+    static ItuMapStore* instance();
+
+    /** Surface water vapour density (g/m^3) exceeded for 50% of the year, ITU-R P.836-3 */
+    const ItuGridMap& waterVapourDensity();
+    /** Mean 0 degree isotherm height (km) above mean sea level, ITU-R P.839 */
+    const ItuGridMap& isothermHeight();
+    /** Rainfall rate (mm/h) exceeded for 0.01% of an average year, ITU-R P.837 */
+    const ItuGridMap& rainfallRate001();
+
+private:
+    ItuMapStore();
+
+    const ItuGridMap& lazyLoad(ItuGridMap& map, bool& loaded,
+                               const char* latitudeFile, const char* longitudeFile, const char* valueFile);
+
+private:
+    QMutex m_mutex;
+    ItuGridMap m_waterVapourDensity;
+    ItuGridMap m_isothermHeight;
+    ItuGridMap m_rainfallRate001;
+    bool m_waterVapourLoaded;
+    bool m_isothermLoaded;
+    bool m_rainfallLoaded;
+
+    static ItuMapStore* s_instance;
+};
+
+#define STA_ITU_MAPS ItuMapStore::instance()
+
+#endif // ITUMAPS_H
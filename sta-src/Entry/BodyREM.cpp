@@ -83,14 +83,14 @@ void BodyREM::updateGravity (sta::StateVector stateVector, Vector3d& gravity)
 }
 
 
-//The input parameters.uncertainties have been deleted to not generate errors: insert it again
-//when adding the dipersion functionality!!
-void BodyREM::updateAero (sta::StateVector stateVector, VectorXd& state2, AtmosphereModel atmosphere, capsule_class capsule, Vector3d& aero, double& Cdc)
+void BodyREM::updateAero (const sta::StateVector& stateVector, EntryState2& state2, EntryForceContext& context,
+                          Vector3d& aero, double& Cdc)
 {
     double r, V, delta,local_altitude, tau, rho, M,gamma,chi, Cdp, Clc, Csc;
+    const EntryModelTables* tables = context.tables;
 
-    r = sqrt(pow(stateVector.position.x(),2) + pow(stateVector.position.y(),2) + pow(stateVector.position.z(),2));
-    V = sqrt(pow(stateVector.velocity.x(),2) + pow(stateVector.velocity.y(),2) + pow(stateVector.velocity.z(),2));
+    r = stateVector.position.norm();
+    V = stateVector.velocity.norm();
     delta = atan2(stateVector.position.z(), sqrt(pow(stateVector.position.x(),2) + pow(stateVector.position.y(),2)));
     tau = atan2(stateVector.position.y(),stateVector.position.x());
     Vector3d VelocityR = stateVector.velocity;
@@ -104,24 +104,31 @@ void BodyREM::updateAero (sta::StateVector stateVector, VectorXd& state2, Atmosp
     gamma=-atan2(VelocityV.z(),sqrt(pow(VelocityV.x(),2)+pow(VelocityV.y(),2)));
     Cvt=Eigen::AngleAxisd(chi, Vector3d::UnitZ())*Eigen::AngleAxisd(gamma, Vector3d::UnitY());
     local_altitude = altitude(r, delta);
-    M = V / atmosphere.speedofsound(local_altitude);
+
+    //------ Density and speed of sound, the density is zero above the top of the atmosphere table
+    double atmosphereValues[4];
+    tables->atmosphere().values(local_altitude, context.atmosphereHint, atmosphereValues);
+    M = V / (atmosphereValues[EntryModelTables::SpeedOfSound] * context.speedOfSoundFactor);
     //qDebug()<<M<<"Mach";
-    rho = atmosphere.density(local_altitude);// * (1 + uncertainties.density);
-    Cdc = capsule.cdc(M);// * (1 + uncertainties.cdcapsule);                             //This is where the capsule's cd value is updated, since it will be used in the heat rate calculation
-    Clc = capsule.clc(M);
-    Csc = capsule.csc(M);
+    if (local_altitude > tables->atmosphere().maximum())
+        rho = 0.0;
+    else
+        rho = atmosphereValues[EntryModelTables::Density] * context.densityFactor;
+    Cdc = tables->capsuleDrag().value(0, M, context.dragHint) * context.capsuleDragFactor;    //This is where the capsule's cd value is updated, since it will be used in the heat rate calculation
+    Clc = tables->capsuleLift().value(0, M, context.liftHint);
+    Csc = tables->capsuleSide().value(0, M, context.sideHint);
 
     //------
-    if (state2[7] < 0.5) {
+    if (state2[7] < 0.5 || tables->parachuteDrag().isEmpty()) {
         Cdp = 0.0;
     }
 
     else {
-        Cdp = capsule.cdp(M);// * (1 + uncertainties.cdparachute);
+        Cdp = tables->parachuteDrag().value(0, M, context.parachuteHint) * context.parachuteDragFactor;
     }
-    Vector3d FA=-0.5*rho*pow(V,2.0)*capsule.Sc*Vector3d(Cdc,Csc,Clc);
+    Vector3d FA=-0.5*rho*V*V*context.capsuleArea*Vector3d(Cdc,Csc,Clc);
     Vector3d aR;
-    aR=Crv*Cvt*FA/capsule.m;
+    aR=Crv*Cvt*FA/context.mass;
     //qDebug()<<Crv(0,0)<<Crv(0,1)<<Crv(0,2)<<Crv(1,0)<<Crv(1,1)<<Crv(1,2)<<Crv(2,0)<<Crv(2,1)<<Crv(2,2)<<"Crv";
     //qDebug()<<Cvt(0,0)<<Cvt(0,1)<<Cvt(0,2)<<Cvt(1,0)<<Cvt(1,1)<<Cvt(1,2)<<Cvt(2,0)<<Cvt(2,1)<<Cvt(2,2)<<"Cvt";
 
@@ -32,9 +32,8 @@
 #define BODYREM_H_INCLUDED
 
 #include "CelestialBody.h"
-#include "capsule.h"
+#include "entrytables.h"
 #include <Eigen/Core>
-#include "Astro-Core/Atmosphere/AtmosphereModel.h"
 #include "Astro-Core/statevector.h"
 
 USING_PART_OF_NAMESPACE_EIGEN
@@ -55,9 +54,11 @@ public:
      */
     void updateGravity (sta::StateVector, Vector3d&);
     /**
-     * Function that updates the aerodynamic acceleration vector, Cd, and some elements of state2
+     * Function that updates the aerodynamic acceleration vector, Cd, and some elements of state2.
+     * The atmosphere and aerodynamic tables, the vehicle data and the dispersion factors are
+     * taken from the force context, which also keeps the bracket hints of the table lookups.
      */
-    void updateAero (sta::StateVector, VectorXd&, AtmosphereModel, capsule_class, Vector3d&, double&);
+    void updateAero (const sta::StateVector&, EntryState2&, EntryForceContext&, Vector3d&, double&);
 
 private:
     /**
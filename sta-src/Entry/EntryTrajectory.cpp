@@ -69,12 +69,11 @@ public:
         sta::StateVector stateVector=StateVector(position,velocity);
         Vector3d gravity;                   //Components of gravitational acceleration in appropriate elements
         Vector3d aero;                     	//Components of aerodynamic acceleration in appropriate elements
-        VectorXd parameters(9);             //List of parameters to send to integration: 0,1,2 = gravity, 3,4,5 = aero, 6 = omega, 7 = Qdot
+        EntryState2 state2 = m_trajectory->state2;  //Local copy: the stages of a step, possibly rejected, must not change the trajectory
         double Cdc;
-        double tau = m_trajectory->settings.stepsize;
 
         m_trajectory->body.updateGravity(stateVector, gravity);
-        m_trajectory->body.updateAero(stateVector, m_trajectory->state2, m_trajectory->atmosphere, m_trajectory->capsule, aero, Cdc);
+        m_trajectory->body.updateAero(stateVector, state2, m_trajectory->forces, aero, Cdc);
         /*
         Vector3d perturbingAcceleration(0, 0, 0);
         foreach (Perturbations* perturbation, perturbationList)
@@ -83,28 +82,37 @@ public:
         }
         gravity += perturbingAcceleration;
         */
-        m_trajectory->calculateState2(aero, Cdc);
-        m_trajectory->updateEndstate();
+        //Equations of motion in the rotating frame; fixed size quantities only, since this
+        //is evaluated at every stage of every step
+        double omega = m_trajectory->body.getOmega();
+
+        derivatives[0] = velocity[0];
+        derivatives[1] = velocity[1];
+        derivatives[2] = velocity[2];
+        derivatives[3] = aero[0] + gravity[0] + omega*omega*position[0] + 2.0*omega*velocity[1];
+        derivatives[4] = aero[1] + gravity[1] + omega*omega*position[1] - 2.0*omega*velocity[0];
+        derivatives[5] = aero[2] + gravity[2];
+        derivatives[6] = m_trajectory->heatrate.ConvectiveHeatRate(state2(6), state2(0), m_trajectory->capsule.Rn);
+        derivatives[7] = m_trajectory->heatrate.RadiativeHeatRate(state2(6), state2(0), m_trajectory->capsule.Rn);
+    }
 
-        //Test for status
-        m_trajectory->checkStatus();
-        if ( m_trajectory->status != OK) {
-            m_trajectory->result.status = m_trajectory->status;
-        }
-        parameters << gravity, aero, m_trajectory->body.getOmega(), m_trajectory->state2(3), m_trajectory->state2(4);
-        //TO DO : re-insert the heat load integration (now heat flux is always set to zero)
-        VectorXd state3(8);
-                state3 << stateVector.position, stateVector.velocity, 0, 0;
-
-
-                derivatives[0] = state3[3];
-                derivatives[1] = state3[4];
-                derivatives[2] = state3[5];
-                derivatives[3] = parameters[3] + parameters[0] + pow(parameters[6],2)*state3[0] + 2.0*parameters[6]*state3[4];
-                derivatives[4] = parameters[4] + parameters[1] + pow(parameters[6],2)*state3[1] - 2.0*parameters[6]*state3[3];
-                derivatives[5] = parameters[5] + parameters[2];
-                derivatives[6] = parameters[7];
-                derivatives[7] = parameters[8];
+    /**
+     * Evaluate the extra information of the trajectory at a state, without changing the trajectory
+     */
+    void evaluateState2(const State& state, EntryState2& state2) const
+    {
+        Vector3d position = state.segment<3>(0);
+        Vector3d velocity = state.segment<3>(3);
+        sta::StateVector stateVector=StateVector(position,velocity);
+        Vector3d aero;
+        double Cdc;
+
+        state2 = m_trajectory->state2;
+        m_trajectory->body.updateAero(stateVector, state2, m_trajectory->forces, aero, Cdc);
+        state2(2) = aero.norm() / 9.81;
+        state2(3) = m_trajectory->heatrate.ConvectiveHeatRate(state2(6), state2(0), m_trajectory->capsule.Rn);
+        state2(4) = m_trajectory->heatrate.RadiativeHeatRate(state2(6), state2(0), m_trajectory->capsule.Rn);
+        state2(8) = state2(3) + state2(4);
     }
 
 private:
@@ -114,28 +122,116 @@ private:
 
 };
 
-EntryTrajectory::EntryTrajectory(EntrySettings _settings)
+
+//Tolerances of the adaptive integrator: positions in m, velocities in m/s
+static const double EntryAbsoluteTolerance = 1.0e-3;
+static const double EntryRelativeTolerance = 1.0e-9;
+static const double EntryMinimumStep = 1.0e-6;
+static const double EntryEventTolerance = 1.0e-6;
+
+//Events located inside the steps of the adaptive integrator
+enum EntryEvent
+{
+    GroundImpactEvent,
+    ParachuteDeployEvent,
+    HeatRatePeakEvent,
+    EntryEventCount
+};
+
+typedef DormandPrinceDenseOutput<EntryDerivativeCalculator::State> EntryDenseOutput;
+
+
+/*Value of an event function at time t inside a step; the events occur where the
+  function changes from positive to zero or negative*/
+static double entryEventValue(const EntryDerivativeCalculator& calculator, const EntryDenseOutput& dense,
+                              int event, double t, double deployMach)
+{
+    EntryState2 state2;
+
+    if (event == GroundImpactEvent)
+    {
+        calculator.evaluateState2(dense.interpolate(t), state2);
+        return state2(5);
+    }
+    else if (event == ParachuteDeployEvent)
+    {
+        calculator.evaluateState2(dense.interpolate(t), state2);
+        return state2(1) - deployMach;
+    }
+    else
+    {
+        //Slope of the total heat rate, from the continuous extension of the step
+        double dt = 1.0e-4 * dense.h;
+        calculator.evaluateState2(dense.interpolate(t + dt), state2);
+        double after = state2(8);
+        calculator.evaluateState2(dense.interpolate(t - dt), state2);
+        return after - state2(8);
+    }
+}
+
+
+/*Locate an event between t0 (g0 > 0) and t1 (g1 <= 0) with the Illinois method. The
+  returned time is on the side of t1, i.e. just after the event*/
+static double locateEntryEvent(const EntryDerivativeCalculator& calculator, const EntryDenseOutput& dense,
+                               int event, double deployMach,
+                               double t0, double g0, double t1, double g1)
+{
+    int side = 0;
+    for (int i = 0; i < 100 && t1 - t0 > EntryEventTolerance; i++)
+    {
+        double t = (t0 * g1 - t1 * g0) / (g1 - g0);
+        double g = entryEventValue(calculator, dense, event, t, deployMach);
+        if (g > 0.0)
+        {
+            t0 = t;
+            g0 = g;
+            if (side == -1)
+                g1 *= 0.5;
+            side = -1;
+        }
+        else
+        {
+            t1 = t;
+            g1 = g;
+            if (side == 1)
+                g0 *= 0.5;
+            side = 1;
+        }
+    }
+
+    return t1;
+}
+
+
+EntryTrajectory::EntryTrajectory(EntrySettings _settings) :
+    tables(new EntryModelTables(_settings))
+{
+    setup(_settings);
+}
+
+
+EntryTrajectory::EntryTrajectory(EntrySettings _settings, QSharedPointer<const EntryModelTables> _tables) :
+    tables(_tables)
+{
+    setup(_settings);
+}
+
+
+void EntryTrajectory::setup(EntrySettings _settings)
 {
     //Set the entry trajectory's settings to the input settings
     //---------------------------------------------------------
     settings = _settings;
     //---------------------------------------------------------
 
-    //Assign body, atmosphere and heat rate, and capsule Cd profile
+    //Copy the body and heat rate data from the shared tables, which also
+    //hold the atmosphere and the capsule aerodynamic profiles
     //---------------------------------------------------------
-    atmosphere.selectModel(settings.modelname);
-    body.selectBody(settings.bodyname);
-    heatrate.selectBody(settings.bodyname);
-    capsule.flag = 0;
-    capsule.selectCdCprofile(settings.CdCprofilename);
-    capsule.selectClCprofile(settings.ClCprofilename);
-    capsule.selectCsCprofile(settings.CsCprofilename);
-
-    //capsule.selectCdPprofile(settings.CdPprofilename);
-    //capsule.Sp = settings.parachuteArea;
+    static_cast<CelestialBody&>(body) = tables->body();
+    heatrate = tables->heatRate();
+    capsule.flag = tables->flag();
 
-    state.resize(8);
-    state2.resize(10);
+    //capsule.Sp = settings.parachuteArea;
 }
 
 
@@ -147,6 +243,7 @@ sta::StateVector EntryTrajectory::initialise(EntryParameters _parameters,sta::St
     capsule.Sc = parameters.Sref;
     capsule.m = parameters.m;
     capsule.Rn = parameters.Rn;
+    forces.reset(tables.data(), capsule.Sc, capsule.m, parameters.uncertainties);
 
     double theta = getGreenwichHourAngle(startTime);
     int celestialbody;
@@ -184,8 +281,7 @@ sta::StateVector EntryTrajectory::initialise(EntryParameters _parameters,sta::St
     result.maxradheatrate.value = 0.0;
     result.maxtotalheatrate.value = 0.0;
     result.maxloadfactor.value = 0.0;
-
-    trajectory.open("data/REMTrajectory.stae");
+    adaptiveStep = qMin(settings.stepsize, 1.0);    //First trial step of the adaptive integrator
 
     return initialState;
 }
@@ -253,11 +349,19 @@ sta::StateVector EntryTrajectory::integrate(sta::StateVector stateVector, QList<
         rk4 (state, 8, time, tau, derivstate, parameters);
     */
     EntryDerivativeCalculator entryCalculator(this);// entryCalculator(this,QList<Perturbations*> perturbationsList);
-    Matrix<double, 8, 1> state;
-    state<<stateVector.position, stateVector.velocity, 0, 0;
-    rk4(state, time, tau, &entryCalculator);
-
+    state.segment<3>(0) = stateVector.position;     //The heat loads in state(6) and state(7) are carried over
+    state.segment<3>(3) = stateVector.velocity;
 
+    if (settings.integrator == "DOPRI54")
+    {
+        integrateAdaptive(tau, entryCalculator);
+    }
+    else
+    {
+        rk4(state, time, tau, &entryCalculator);
+        time += tau;
+        updateState2();
+    }
 
     const Vector3d vec1(state(0), state(1), state(2));
     const Vector3d vec2(state(3), state(4), state(5));
@@ -265,8 +369,6 @@ sta::StateVector EntryTrajectory::integrate(sta::StateVector stateVector, QList<
 
     stateVector = vector;
 
-    time += tau;
-
     //------ Calculate the rest of the endstate structure ------
     calculateEndstate();
 
@@ -274,6 +376,120 @@ sta::StateVector EntryTrajectory::integrate(sta::StateVector stateVector, QList<
 }
 
 
+void EntryTrajectory::integrateAdaptive(double interval, const EntryDerivativeCalculator& calculator)
+{
+    typedef EntryDerivativeCalculator::State State;
+
+    double endTime = time + interval;
+    double deployMach = settings.parachuteDeployMach;
+    State derivative;
+    calculator.compute(state, time, derivative);
+
+    while (status == OK && time < endTime)
+    {
+        double h = qMin(adaptiveStep, endTime - time);
+        State newState;
+        State newDerivative;
+        EntryDenseOutput dense;
+        double error = dopri54(state, derivative, time, h, EntryAbsoluteTolerance, EntryRelativeTolerance,
+                               &calculator, newState, newDerivative, &dense);
+
+        //------ Step size control ------
+        double factor = qBound(0.2, 0.9 * pow(qMax(error, 1.0e-10), -0.2), 5.0);
+        if (error > 1.0 && h > EntryMinimumStep)
+        {
+            adaptiveStep = qMax(EntryMinimumStep, h * factor);
+            continue;
+        }
+        if (h < adaptiveStep)
+            adaptiveStep = qMax(adaptiveStep, h * factor);    //Step shortened to end on the output time
+        else
+            adaptiveStep = h * factor;
+
+        //------ Locate the events inside the step. Ground impact and parachute deployment
+        //------ end the step, since they end the trajectory or change the dynamics.
+        double stepEnd = time + h;
+        double eventTime = stepEnd;
+        int firstEvent = -1;
+        double peakTime = -1.0;
+        for (int event = 0; event < EntryEventCount; event++)
+        {
+            if (event == ParachuteDeployEvent && (deployMach <= 0.0 || result.parachutedeploy_altitude != 0.0))
+                continue;
+
+            double g0 = entryEventValue(calculator, dense, event, time, deployMach);
+            double g1 = entryEventValue(calculator, dense, event, stepEnd, deployMach);
+            if (g0 > 0.0 && g1 <= 0.0)
+            {
+                double t = locateEntryEvent(calculator, dense, event, deployMach, time, g0, stepEnd, g1);
+                if (event == HeatRatePeakEvent)
+                {
+                    peakTime = t;
+                }
+                else if (t < eventTime)
+                {
+                    eventTime = t;
+                    firstEvent = event;
+                }
+            }
+        }
+
+        if (peakTime >= 0.0 && peakTime <= eventTime)
+        {
+            EntryState2 peak;
+            calculator.evaluateState2(dense.interpolate(peakTime), peak);
+            if (peak(8) > result.maxtotalheatrate.value)
+            {
+                result.maxtotalheatrate.value = peak(8);
+                result.maxtotalheatrate.time = peakTime;
+                result.maxtotalheatrate.altitude = peak(5);
+            }
+        }
+
+        //------ Advance to the end of the step or to the event ------
+        if (firstEvent < 0)
+        {
+            state = newState;
+            time = stepEnd;
+            derivative = newDerivative;
+            updateState2();
+        }
+        else
+        {
+            state = dense.interpolate(eventTime);
+            time = eventTime;
+            updateState2();
+            if (firstEvent == GroundImpactEvent)
+            {
+                status = landed;
+                result.status = status;
+            }
+            calculator.compute(state, time, derivative);
+        }
+    }
+}
+
+
+void EntryTrajectory::updateState2()
+{
+    Vector3d position = state.segment<3>(0);
+    Vector3d velocity = state.segment<3>(3);
+    sta::StateVector stateVector = sta::StateVector(position, velocity);
+    Vector3d aero;
+    double Cdc;
+
+    body.updateAero(stateVector, state2, forces, aero, Cdc);
+    calculateState2(aero, Cdc);
+    updateEndstate();
+
+    //Test for status
+    checkStatus();
+    if ( status != OK) {
+        result.status = status;
+    }
+}
+
+
 void EntryTrajectory::calculateState2(Vector3d& aero, double Cdc)
 {
     state2(2) = aero.norm() / 9.81; //n = magnitude of resultant vector of accelerations / g
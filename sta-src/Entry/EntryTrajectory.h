@@ -54,6 +54,8 @@
 #include "Astro-Core/getGreenwichHourAngle.h"
 #include "Astro-Core/perturbations.h"
 #include "reentrystructures.h"
+#include "entrytables.h"
+#include <QSharedPointer>
 #include <Eigen/Core>
 
 
@@ -61,6 +63,7 @@ USING_PART_OF_NAMESPACE_EIGEN
 
 //class StateVector;
 class Perturbations;
+class EntryDerivativeCalculator;
 
 
 class EntryTrajectory
@@ -74,12 +77,18 @@ public:
      * Constructor for the entry trajectory object
      */
     EntryTrajectory(EntrySettings);
+    /**
+     * Constructor for an entry trajectory sharing already loaded atmosphere and aerodynamic tables
+     */
+    EntryTrajectory(EntrySettings, QSharedPointer<const EntryModelTables>);
     /**
      * Return the StateVector at the beginnig of the simulation
      */
     sta::StateVector initialise(EntryParameters,sta::StateVector, double);
     /**
-     * Integrate the entry trajectory at a generic step
+     * Integrate the entry trajectory over one output step of settings.stepsize. With the adaptive
+     * integrator (settings.integrator == "DOPRI54") the output step is covered by as many
+     * error-controlled Dormand-Prince steps as needed; it ends early at ground impact.
      */
     sta::StateVector integrate(sta::StateVector stateVector, QList<Perturbations*> perturbationsList);
     /**
@@ -102,10 +111,12 @@ private:
     EntryParameters parameters;
 
     double time;
-    VectorXd state;
-    VectorXd state2; //Extra information: 0 = density, 1 = mach number, 2 = load factor, 3 = qdot_c, 4 = qdot_r, 5 = altitude, 6 = velocity, 7 = parachuteDeploy (0 = entry, 1 = descent), 8 = total heat rate, 9 = total heat load
+    Matrix<double, 8, 1> state;     //Position, velocity and heat loads (convective, radiative) in the rotating frame
+    EntryState2 state2;
+    double adaptiveStep;            //Next step size of the adaptive integrator
 
-    AtmosphereModel atmosphere;
+    QSharedPointer<const EntryModelTables> tables;
+    EntryForceContext forces;
     BodyREM body;
     HeatRateClass heatrate;
 
@@ -113,6 +124,19 @@ private:
     ofstream misc;
     Endstate result;
 
+    /**
+     * Copy the body and heat rate data from the tables, common to both constructors
+     */
+    void setup(EntrySettings);
+    /**
+     * Integrate over an output step with the adaptive integrator, locating ground impact,
+     * parachute deployment and the heat rate peak inside the steps
+     */
+    void integrateAdaptive(double, const EntryDerivativeCalculator&);
+    /**
+     * Update state2, the maxima and the status at the current state
+     */
+    void updateState2();
     /**
      * Calculate the state2 vector
      */
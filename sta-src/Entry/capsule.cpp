@@ -35,10 +35,33 @@
 #include <QDir>
 #include <QProcess>
 #include "Scenario/propagationfeedback.h"
+#include "RAM/aerodatabase.h"
 
 
 using namespace std;
 
+//-------------------------------------------------------------------------------------------------
+// Read a coefficient of a binary aerodynamic database as a function of the Mach number,
+// at zero angle of attack and sideslip
+static bool readDatabaseProfile(const QString& path, AeroDatabase::Coefficient coefficient,
+                                int& Ndatapoints, double*& Mach_array, double*& C_array)
+{
+    AeroDatabase database;
+    QVector<double> mach;
+    QVector<double> values;
+    if (!database.load(path) || !database.machProfile(coefficient, 0.0, 0.0, mach, values))
+        return false;
+
+    Ndatapoints = mach.size();
+    Mach_array = new double[Ndatapoints];
+    C_array = new double[Ndatapoints];
+    for (int i=0; i<Ndatapoints; i++) {
+        Mach_array[i] = mach[i];
+        C_array[i] = values[i];
+    }
+    return true;
+}
+
 //-------------------------------------------------------------------------------------------------
 void capsule_class::selectCdCprofile(QString name) {
 
@@ -47,6 +70,12 @@ void capsule_class::selectCdCprofile(QString name) {
 
     //QTextStream out (stdout); out << "===> aerodynamics path: " << path << endl;
 
+    if (AeroDatabase::isDatabaseFile(name)) {
+        if (!readDatabaseProfile(path, AeroDatabase::CD, NdatapointsC, MachC_array, Cdc_array))
+            flag = 1;
+        return;
+    }
+
     QFile cprofile(path);
 
     if (!cprofile.exists() || name == "")
@@ -135,6 +164,12 @@ void capsule_class::selectClCprofile(QString name) {//Added by Dominic to includ
 
     //QTextStream out (stdout); out << "===> aerodynamics path: " << path << endl;
 
+    if (AeroDatabase::isDatabaseFile(name)) {
+        if (!readDatabaseProfile(path, AeroDatabase::CL, NdatapointsC, MachC_array, Clc_array))
+            flag = 1;
+        return;
+    }
+
     QFile cprofile(path);
 
     if (!cprofile.exists() || name == "")
@@ -180,6 +215,12 @@ void capsule_class::selectCsCprofile(QString name) {//Added by Dominic to includ
 
     //QTextStream out (stdout); out << "===> aerodynamics path: " << path << endl;
 
+    if (AeroDatabase::isDatabaseFile(name)) {
+        if (!readDatabaseProfile(path, AeroDatabase::CS, NdatapointsC, MachC_array, Csc_array))
+            flag = 1;
+        return;
+    }
+
     QFile cprofile(path);
 
     if (!cprofile.exists() || name == "")
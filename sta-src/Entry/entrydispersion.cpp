@@ -0,0 +1,402 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "entrydispersion.h"
+#include "EntryTrajectory.h"
+#include "Astro-Core/sphericalTOcartesian.h"
+#include "Astro-Core/stamath.h"
+#include <QtConcurrentMap>
+#include <QList>
+#include <cmath>
+
+
+// Wrap an angle (rad) into [-pi, pi]
+static double wrapAngle(double angle)
+{
+    return angle - 2.0 * sta::Pi() * floor((angle + sta::Pi()) / (2.0 * sta::Pi()));
+}
+
+
+//------------------------------------------------------------------------------------------------------------
+DispersionRandomStream::DispersionRandomStream(quint64 seed, quint64 stream) :
+    m_state(seed * Q_UINT64_C(0x9E3779B97F4A7C15) + stream),
+    m_hasSpare(false),
+    m_spare(0.0)
+{
+    // Decorrelate neighbouring seeds and stream numbers
+    m_state = next();
+}
+
+
+// splitmix64 generator
+quint64 DispersionRandomStream::next()
+{
+    quint64 z = (m_state += Q_UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * Q_UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * Q_UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+
+double DispersionRandomStream::uniform()
+{
+    // 53 random bits, shifted away from 0 and 1
+    return (double(next() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+
+double DispersionRandomStream::gaussian()
+{
+    // Box-Muller transform, the second value is kept for the next call
+    if (m_hasSpare)
+    {
+        m_hasSpare = false;
+        return m_spare;
+    }
+
+    double r = sqrt(-2.0 * log(uniform()));
+    double phi = 2.0 * sta::Pi() * uniform();
+    m_spare = r * sin(phi);
+    m_hasSpare = true;
+    return r * cos(phi);
+}
+
+
+//------------------------------------------------------------------------------------------------------------
+RunningStatistic::RunningStatistic() :
+    m_count(0),
+    m_mean(0.0),
+    m_m2(0.0),
+    m_min(0.0),
+    m_max(0.0)
+{
+}
+
+
+void RunningStatistic::add(double x)
+{
+    if (m_count == 0)
+    {
+        m_min = x;
+        m_max = x;
+    }
+    else
+    {
+        m_min = qMin(m_min, x);
+        m_max = qMax(m_max, x);
+    }
+
+    // Welford's update, stable for long runs
+    m_count++;
+    double delta = x - m_mean;
+    m_mean += delta / m_count;
+    m_m2 += delta * (x - m_mean);
+}
+
+
+double RunningStatistic::variance() const
+{
+    return m_count > 1 ? m_m2 / (m_count - 1) : 0.0;
+}
+
+
+double RunningStatistic::standardDeviation() const
+{
+    return sqrt(variance());
+}
+
+
+//------------------------------------------------------------------------------------------------------------
+EntryDispersionStatistics::EntryDispersionStatistics() :
+    m_runCount(0),
+    m_failedCount(0),
+    m_landedCount(0),
+    m_referenceLongitude(0.0),
+    m_referenceLatitude(0.0),
+    m_meanEast(0.0),
+    m_meanNorth(0.0),
+    m_m2East(0.0),
+    m_m2North(0.0),
+    m_coMoment(0.0)
+{
+    for (int i = 0; i < 5; i++)
+    {
+        m_statusCount[i] = 0;
+    }
+}
+
+
+void EntryDispersionStatistics::add(const EntryDispersionSample& sample)
+{
+    m_runCount++;
+    if (!sample.completed)
+    {
+        m_failedCount++;
+        return;
+    }
+
+    m_statusCount[sample.status]++;
+    m_peakHeatRate.add(sample.maxTotalHeatRate);
+    m_peakLoadFactor.add(sample.maxLoadFactor);
+    m_heatLoad.add(sample.totalHeatLoad);
+    m_timeOfFlight.add(sample.timeOfFlight);
+
+    if (sample.status != landed)
+    {
+        return;
+    }
+
+    double longitude = sta::degToRad(sample.longitude);
+    double latitude = sta::degToRad(sample.latitude);
+    if (m_landedCount == 0)
+    {
+        m_referenceLongitude = longitude;
+        m_referenceLatitude = latitude;
+    }
+
+    // Local East/North offsets from the first landing point; the longitude
+    // difference is wrapped so that footprints across the date line work
+    double dlon = wrapAngle(longitude - m_referenceLongitude);
+    double east = dlon * cos(m_referenceLatitude);
+    double north = latitude - m_referenceLatitude;
+
+    m_landedCount++;
+    double deltaEast = east - m_meanEast;
+    double deltaNorth = north - m_meanNorth;
+    m_meanEast += deltaEast / m_landedCount;
+    m_meanNorth += deltaNorth / m_landedCount;
+    m_m2East += deltaEast * (east - m_meanEast);
+    m_m2North += deltaNorth * (north - m_meanNorth);
+    m_coMoment += deltaEast * (north - m_meanNorth);
+}
+
+
+int EntryDispersionStatistics::statusCount(_status status) const
+{
+    return m_statusCount[status];
+}
+
+
+double EntryDispersionStatistics::meanLandingLongitude() const
+{
+    double longitude = m_referenceLongitude + m_meanEast / cos(m_referenceLatitude);
+    return sta::radToDeg(wrapAngle(longitude));
+}
+
+
+double EntryDispersionStatistics::meanLandingLatitude() const
+{
+    return sta::radToDeg(m_referenceLatitude + m_meanNorth);
+}
+
+
+bool EntryDispersionStatistics::landingEllipse(double bodyRadius, double sigmaScale,
+                                               double& semiMajorAxis, double& semiMinorAxis, double& azimuth) const
+{
+    if (m_landedCount < 2)
+    {
+        return false;
+    }
+
+    // Eigen decomposition of the 2x2 covariance matrix of the landing points
+    double cee = m_m2East / (m_landedCount - 1);
+    double cnn = m_m2North / (m_landedCount - 1);
+    double cen = m_coMoment / (m_landedCount - 1);
+
+    double halfTrace = 0.5 * (cee + cnn);
+    double root = sqrt(0.25 * (cee - cnn) * (cee - cnn) + cen * cen);
+    double lambda1 = halfTrace + root;
+    double lambda2 = qMax(0.0, halfTrace - root);
+
+    semiMajorAxis = sigmaScale * sqrt(lambda1) * bodyRadius;
+    semiMinorAxis = sigmaScale * sqrt(lambda2) * bodyRadius;
+
+    // angle of the major axis from East, converted to an azimuth from North
+    double theta = 0.5 * atan2(2.0 * cen, cee - cnn);
+    azimuth = 90.0 - sta::radToDeg(theta);
+
+    return true;
+}
+
+
+//------------------------------------------------------------------------------------------------------------
+/**
+ * @param settings entry settings shared by all the runs
+ * @param nominal nominal entry parameters, the deviations are applied to them
+ * @param startTime start time of the entry, as passed to EntryTrajectory::initialise
+ */
+EntryDispersionAnalysis::EntryDispersionAnalysis(const EntrySettings& settings, const EntryParameters& nominal, double startTime) :
+    m_settings(settings),
+    m_tables(new EntryModelTables(settings)),
+    m_nominal(nominal),
+    m_startTime(startTime),
+    m_sigma(Uncertainties_struct()),
+    m_seed(1),
+    m_maxSteps(1000000)
+{
+}
+
+
+/**
+ * Draw the entry parameters of a run. The deviations are drawn in a fixed
+ * order from the random stream of the run, and stored in the uncertainties
+ * of the returned parameters for the atmosphere and aerodynamic terms.
+ * Temperature and pressure don't enter the equations of motion, so they are
+ * left at their nominal values.
+ */
+EntryParameters EntryDispersionAnalysis::sampleParameters(int run) const
+{
+    DispersionRandomStream random(m_seed, run);
+    EntryParameters parameters = m_nominal;
+    Uncertainties_struct& deviation = parameters.uncertainties;
+
+    deviation.mass = m_sigma.mass * random.gaussian();
+    deviation.altitude = m_sigma.altitude * random.gaussian();
+    deviation.tau = m_sigma.tau * random.gaussian();
+    deviation.delta = m_sigma.delta * random.gaussian();
+    deviation.velocity = m_sigma.velocity * random.gaussian();
+    deviation.gamma = m_sigma.gamma * random.gaussian();
+    deviation.chi = m_sigma.chi * random.gaussian();
+    deviation.density = m_sigma.density * random.gaussian();
+    deviation.temperature = 0.0;
+    deviation.pressure = 0.0;
+    deviation.speedofsound = m_sigma.speedofsound * random.gaussian();
+    deviation.cdcapsule = m_sigma.cdcapsule * random.gaussian();
+    deviation.cdparachute = m_sigma.cdparachute * random.gaussian();
+
+    parameters.m *= 1 + deviation.mass;
+    parameters.inputstate[0] += deviation.altitude;
+    parameters.inputstate[1] += deviation.tau;
+    parameters.inputstate[2] += deviation.delta;
+    parameters.inputstate[3] += deviation.velocity;
+    parameters.inputstate[4] += deviation.gamma;
+    parameters.inputstate[5] += deviation.chi;
+
+    return parameters;
+}
+
+
+/**
+ * Integrate the trajectory of one run until the capsule lands, burns, is
+ * crushed or leaves the atmosphere. The function only reads the analysis
+ * settings and may be called from several threads at the same time.
+ */
+EntryDispersionSample EntryDispersionAnalysis::runCase(int run) const
+{
+    EntryDispersionSample sample;
+    sample.run = run;
+    sample.completed = false;
+    sample.status = OK;
+    sample.longitude = 0.0;
+    sample.latitude = 0.0;
+    sample.maxTotalHeatRate = 0.0;
+    sample.maxLoadFactor = 0.0;
+    sample.totalHeatLoad = 0.0;
+    sample.timeOfFlight = 0.0;
+
+    EntryParameters parameters = sampleParameters(run);
+
+    // Only spherical entry states are supported, as in PropagateEntryTrajectory
+    if (parameters.coordselector != 1)
+    {
+        return sample;
+    }
+
+    EntryTrajectory trajectory(m_settings, m_tables);
+    if (trajectory.capsule.flag != 0)
+    {
+        return sample;
+    }
+
+    sta::StateVector stateVector = trajectory.initialise(parameters, sphericalTOcartesian(parameters.inputstate), m_startTime);
+    QList<Perturbations*> perturbationsList;
+
+    int steps = 0;
+    while (trajectory.status == OK && steps < m_maxSteps)
+    {
+        stateVector = trajectory.integrate(stateVector, perturbationsList);
+        steps++;
+    }
+
+    Endstate endstate = trajectory.getEndstate();
+    sample.completed = trajectory.status != OK;
+    sample.status = trajectory.status;
+    sample.longitude = endstate.longitude;
+    sample.latitude = endstate.latitude;
+    sample.maxTotalHeatRate = endstate.maxtotalheatrate.value;
+    sample.maxLoadFactor = endstate.maxloadfactor.value;
+    sample.totalHeatLoad = endstate.totalheatload;
+    sample.timeOfFlight = endstate.timeofflight;
+
+    return sample;
+}
+
+
+// Number of a Monte Carlo run and the analysis it belongs to
+struct EntryDispersionRun
+{
+    const EntryDispersionAnalysis* analysis;
+    int run;
+};
+
+static EntryDispersionSample runDispersionCase(const EntryDispersionRun& run)
+{
+    return run.analysis->runCase(run.run);
+}
+
+static void addDispersionSample(EntryDispersionStatistics& statistics, const EntryDispersionSample& sample)
+{
+    statistics.add(sample);
+}
+
+
+/**
+ * Start executing the runs 0 to numberOfRuns-1 on the global thread pool. The
+ * samples are added to the statistics in run order as they complete, so the
+ * result doesn't depend on the number of threads. The progress of the future
+ * counts the completed runs; the analysis must not be destroyed before the
+ * future has finished.
+ */
+QFuture<EntryDispersionStatistics> EntryDispersionAnalysis::start(int numberOfRuns) const
+{
+    QList<EntryDispersionRun> runs;
+    for (int i = 0; i < numberOfRuns; i++)
+    {
+        EntryDispersionRun run;
+        run.analysis = this;
+        run.run = i;
+        runs.append(run);
+    }
+
+    return QtConcurrent::mappedReduced(runs, runDispersionCase, addDispersionSample,
+                                       QtConcurrent::OrderedReduce);
+}
+
+
+/**
+ * Execute the runs 0 to numberOfRuns-1 on the global thread pool and wait
+ * for their statistics.
+ */
+EntryDispersionStatistics EntryDispersionAnalysis::run(int numberOfRuns) const
+{
+    return start(numberOfRuns).result();
+}
@@ -0,0 +1,193 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef ENTRYDISPERSION_H_INCLUDED
+#define ENTRYDISPERSION_H_INCLUDED
+
+#include "reentrystructures.h"
+#include "entrytables.h"
+#include <QFuture>
+#include <QSharedPointer>
+#include <QtGlobal>
+
+
+/**
+ * Reproducible stream of random numbers for one Monte Carlo run. The stream
+ * only depends on the seed of the analysis and on the run number, so a run
+ * gives the same trajectory whatever thread executes it and in whatever order.
+ */
+class DispersionRandomStream
+{
+public:
+    DispersionRandomStream(quint64 seed, quint64 stream);
+
+    /**
+     * Return a uniformly distributed number in (0, 1)
+     */
+    double uniform();
+    /**
+     * Return a normally distributed number with zero mean and unit variance
+     */
+    double gaussian();
+
+private:
+    quint64 next();
+
+    quint64 m_state;
+    bool m_hasSpare;
+    double m_spare;
+};
+
+
+/**
+ * Outcome of a single Monte Carlo entry run.
+ */
+struct EntryDispersionSample
+{
+    int run;
+    bool completed;             // false if the run could not be set up or never ended
+    _status status;
+    double longitude, latitude; // landing point (deg), only meaningful if landed
+    double maxTotalHeatRate;    // W/cm^2
+    double maxLoadFactor;       // g
+    double totalHeatLoad;
+    double timeOfFlight;        // s
+};
+
+
+/**
+ * Mean, variance and extremes of a quantity, updated one value at a time.
+ */
+class RunningStatistic
+{
+public:
+    RunningStatistic();
+
+    void add(double x);
+
+    int count() const { return m_count; }
+    double mean() const { return m_mean; }
+    double variance() const;
+    double standardDeviation() const;
+    double minimum() const { return m_min; }
+    double maximum() const { return m_max; }
+
+private:
+    int m_count;
+    double m_mean;
+    double m_m2;
+    double m_min;
+    double m_max;
+};
+
+
+/**
+ * Statistics of a Monte Carlo entry analysis, accumulated incrementally as
+ * the runs complete, so the individual trajectories don't have to be kept.
+ */
+class EntryDispersionStatistics
+{
+public:
+    EntryDispersionStatistics();
+
+    void add(const EntryDispersionSample& sample);
+
+    int runCount() const { return m_runCount; }
+    int statusCount(_status status) const;
+    int failedCount() const { return m_failedCount; }
+
+    const RunningStatistic& peakHeatRate() const { return m_peakHeatRate; }
+    const RunningStatistic& peakLoadFactor() const { return m_peakLoadFactor; }
+    const RunningStatistic& heatLoad() const { return m_heatLoad; }
+    const RunningStatistic& timeOfFlight() const { return m_timeOfFlight; }
+
+    /**
+     * Mean landing point (deg) of the landed runs
+     */
+    double meanLandingLongitude() const;
+    double meanLandingLatitude() const;
+    /**
+     * Footprint ellipse of the landing points: semi-axes in the units of
+     * bodyRadius, scaled by sigmaScale, and azimuth of the major axis in deg
+     * from North. Return false if fewer than two runs landed.
+     */
+    bool landingEllipse(double bodyRadius, double sigmaScale,
+                        double& semiMajorAxis, double& semiMinorAxis, double& azimuth) const;
+
+private:
+    int m_runCount;
+    int m_failedCount;
+    int m_statusCount[5];
+
+    RunningStatistic m_peakHeatRate;
+    RunningStatistic m_peakLoadFactor;
+    RunningStatistic m_heatLoad;
+    RunningStatistic m_timeOfFlight;
+
+    // landing points as East/North angular offsets (rad) from the first landing
+    int m_landedCount;
+    double m_referenceLongitude;
+    double m_referenceLatitude;
+    double m_meanEast;
+    double m_meanNorth;
+    double m_m2East;
+    double m_m2North;
+    double m_coMoment;
+};
+
+
+/**
+ * Monte Carlo entry dispersion analysis. Each run perturbs the nominal entry
+ * parameters (mass, entry state) and the density, speed of sound and drag
+ * coefficients by normally distributed deviations with the standard deviations
+ * given in setDeviations(), integrates an EntryTrajectory until it ends and
+ * adds its endstate to the statistics. The runs are executed concurrently on
+ * the global thread pool and share one copy of the body, heat rate,
+ * atmosphere and aerodynamic tables, read when the analysis is created.
+ */
+class EntryDispersionAnalysis
+{
+public:
+    EntryDispersionAnalysis(const EntrySettings& settings, const EntryParameters& nominal, double startTime);
+
+    void setDeviations(const Uncertainties_struct& sigma) { m_sigma = sigma; }
+    void setSeed(quint64 seed) { m_seed = seed; }
+    void setMaximumSteps(int steps) { m_maxSteps = steps; }
+
+    const EntrySettings& settings() const { return m_settings; }
+
+    EntryParameters sampleParameters(int run) const;
+    EntryDispersionSample runCase(int run) const;
+    EntryDispersionStatistics run(int numberOfRuns) const;
+    QFuture<EntryDispersionStatistics> start(int numberOfRuns) const;
+
+private:
+    EntrySettings m_settings;
+    QSharedPointer<const EntryModelTables> m_tables;
+    EntryParameters m_nominal;
+    double m_startTime;
+    Uncertainties_struct m_sigma;
+    quint64 m_seed;
+    int m_maxSteps;
+};
+
+#endif // ENTRYDISPERSION_H_INCLUDED
@@ -0,0 +1,349 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "entrytables.h"
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <QRegExp>
+#include <QDebug>
+#include <math.h>
+
+
+//------------------------------------------------------------------------------------------------------------
+EntryLookupTable::EntryLookupTable() :
+    m_columns(0),
+    m_uniform(false),
+    m_inverseStep(0.0)
+{
+}
+
+
+EntryLookupTable::EntryLookupTable(const QVector<double>& abscissae, const QVector<double>& values, int columns) :
+    m_x(abscissae),
+    m_values(values),
+    m_columns(columns),
+    m_uniform(false),
+    m_inverseStep(0.0)
+{
+    Q_ASSERT(values.size() == abscissae.size() * columns);
+
+    int n = m_x.size();
+    if (n < 2)
+    {
+        return;
+    }
+
+    // Tables sampled at a constant step are indexed directly
+    double range = m_x[n - 1] - m_x[0];
+    double step = range / (n - 1);
+    double tolerance = 1.0e-9 * fabs(range);
+    m_uniform = step > 0.0;
+    for (int i = 1; i < n && m_uniform; i++)
+    {
+        m_uniform = fabs(m_x[i] - (m_x[0] + i * step)) <= tolerance;
+    }
+
+    if (m_uniform)
+    {
+        m_inverseStep = 1.0 / step;
+    }
+}
+
+
+/** Return the index i of the interval [x_i, x_i+1] containing x, with x
+  * inside the range of the table.
+  */
+int EntryLookupTable::bracket(double x, int& hint) const
+{
+    int last = m_x.size() - 2;
+
+    if (m_uniform)
+    {
+        hint = qBound(0, int((x - m_x[0]) * m_inverseStep), last);
+        return hint;
+    }
+
+    int i = qBound(0, hint, last);
+    while (i > 0 && x < m_x[i])
+    {
+        i--;
+    }
+    while (i < last && x >= m_x[i + 1])
+    {
+        i++;
+    }
+
+    hint = i;
+    return i;
+}
+
+
+double EntryLookupTable::value(int column, double x, int& hint) const
+{
+    int n = m_x.size();
+    if (n == 0)
+    {
+        return 0.0;
+    }
+    if (x <= m_x[0] || n == 1)
+    {
+        return m_values[column];
+    }
+    if (x >= m_x[n - 1])
+    {
+        return m_values[(n - 1) * m_columns + column];
+    }
+
+    int i = bracket(x, hint);
+    double t = (x - m_x[i]) / (m_x[i + 1] - m_x[i]);
+    double y0 = m_values[i * m_columns + column];
+    double y1 = m_values[(i + 1) * m_columns + column];
+
+    return y0 + t * (y1 - y0);
+}
+
+
+void EntryLookupTable::values(double x, int& hint, double* out) const
+{
+    int n = m_x.size();
+    if (n == 0)
+    {
+        for (int c = 0; c < m_columns; c++)
+            out[c] = 0.0;
+        return;
+    }
+
+    const double* row0;
+    const double* row1;
+    double t;
+    if (x <= m_x[0] || n == 1)
+    {
+        row0 = row1 = m_values.constData();
+        t = 0.0;
+    }
+    else if (x >= m_x[n - 1])
+    {
+        row0 = row1 = m_values.constData() + (n - 1) * m_columns;
+        t = 0.0;
+    }
+    else
+    {
+        int i = bracket(x, hint);
+        row0 = m_values.constData() + i * m_columns;
+        row1 = row0 + m_columns;
+        t = (x - m_x[i]) / (m_x[i + 1] - m_x[i]);
+    }
+
+    for (int c = 0; c < m_columns; c++)
+    {
+        out[c] = row0[c] + t * (row1[c] - row0[c]);
+    }
+}
+
+
+//------------------------------------------------------------------------------------------------------------
+// Read all the numbers of a text file
+static bool readNumbers(const QString& path, QVector<double>& numbers)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QTextStream stream(&file);
+    QRegExp separator("\\s+");
+    while (!stream.atEnd())
+    {
+        QStringList tokens = stream.readLine().split(separator, QString::SkipEmptyParts);
+        foreach (QString token, tokens)
+        {
+            numbers.append(token.toDouble());
+        }
+    }
+
+    return true;
+}
+
+
+EntryModelTables::EntryModelTables(const EntrySettings& settings) :
+    m_flag(0)
+{
+    m_body.selectBody(settings.bodyname);
+    m_heatRate.selectBody(settings.bodyname);
+
+    if (!readCoefficientProfile(settings.CdCprofilename, AeroDatabase::CD, m_capsuleDrag) ||
+        !readCoefficientProfile(settings.ClCprofilename, AeroDatabase::CL, m_capsuleLift) ||
+        !readCoefficientProfile(settings.CsCprofilename, AeroDatabase::CS, m_capsuleSide))
+    {
+        m_flag = 1;
+    }
+    else if (!readAtmosphere(settings.modelname))
+    {
+        m_flag = 3;
+    }
+
+    // The parachute is optional, but its profile must be readable when the
+    // vehicle has one
+    bool hasParachute = !settings.CdPprofilename.isEmpty() || settings.parachuteDeployMach > 0.0;
+    if (!readParachuteProfile(settings.CdPprofilename) && hasParachute && m_flag == 0)
+    {
+        qDebug() << "Entry: unable to read the parachute profile" << settings.CdPprofilename;
+        m_flag = 2;
+    }
+}
+
+
+/** Atmosphere files have one row per altitude: altitude (km), density,
+  * pressure, speed of sound and temperature. Altitudes are stored in m.
+  */
+bool EntryModelTables::readAtmosphere(const QString& name)
+{
+    QVector<double> numbers;
+    if (name.isEmpty() || !readNumbers(QString("data/atmospheres/") + name, numbers))
+    {
+        qDebug() << "Entry: unable to read the atmosphere model" << name;
+        return false;
+    }
+
+    int n = numbers.size() / 5;
+    QVector<double> altitudes(n);
+    QVector<double> values(n * 4);
+    for (int i = 0; i < n; i++)
+    {
+        altitudes[i] = numbers[i * 5] * 1000.0;
+        values[i * 4 + Density] = numbers[i * 5 + 1];
+        values[i * 4 + Pressure] = numbers[i * 5 + 2];
+        values[i * 4 + SpeedOfSound] = numbers[i * 5 + 3];
+        values[i * 4 + Temperature] = numbers[i * 5 + 4];
+    }
+
+    m_atmosphere = EntryLookupTable(altitudes, values, 4);
+    return !m_atmosphere.isEmpty();
+}
+
+
+/** Capsule coefficient profiles are in ASTOS format: all the Mach numbers
+  * followed by all the coefficients, or binary aerodynamic databases. The
+  * entry is simulated without attitude, so databases are used at zero angle
+  * of attack and sideslip.
+  */
+bool EntryModelTables::readCoefficientProfile(const QString& name, AeroDatabase::Coefficient coefficient, EntryLookupTable& table)
+{
+    if (AeroDatabase::isDatabaseFile(name))
+    {
+        AeroDatabase database;
+        QVector<double> mach;
+        QVector<double> coefficients;
+        if (!database.load(QString("data/aerodynamics/") + name) ||
+            !database.machProfile(coefficient, 0.0, 0.0, mach, coefficients))
+        {
+            qDebug() << "Entry: the aerodynamic database" << name << "has no coefficient" << int(coefficient);
+            return false;
+        }
+
+        table = EntryLookupTable(mach, coefficients, 1);
+        return !table.isEmpty();
+    }
+
+    QVector<double> numbers;
+    if (name.isEmpty() || !readNumbers(QString("data/aerodynamics/") + name, numbers))
+    {
+        qDebug() << "Entry: unable to read the aerodynamic profile" << name;
+        return false;
+    }
+
+    int n = numbers.size() / 2;
+    QVector<double> mach(n);
+    QVector<double> coefficients(n);
+    for (int i = 0; i < n; i++)
+    {
+        mach[i] = numbers[i];
+        coefficients[i] = numbers[n + i];
+    }
+
+    table = EntryLookupTable(mach, coefficients, 1);
+    return !table.isEmpty();
+}
+
+
+/** Parachute profiles have one row per Mach number: Mach and drag coefficient.
+  */
+bool EntryModelTables::readParachuteProfile(const QString& name)
+{
+    QVector<double> numbers;
+    if (name.isEmpty() || !readNumbers(QString("data/aerodynamics/") + name, numbers))
+    {
+        return false;
+    }
+
+    int n = numbers.size() / 2;
+    QVector<double> mach(n);
+    QVector<double> cd(n);
+    for (int i = 0; i < n; i++)
+    {
+        mach[i] = numbers[i * 2];
+        cd[i] = numbers[i * 2 + 1];
+    }
+
+    m_parachuteDrag = EntryLookupTable(mach, cd, 1);
+    return !m_parachuteDrag.isEmpty();
+}
+
+
+//------------------------------------------------------------------------------------------------------------
+EntryForceContext::EntryForceContext() :
+    tables(NULL),
+    capsuleArea(0.0),
+    mass(0.0),
+    densityFactor(1.0),
+    speedOfSoundFactor(1.0),
+    capsuleDragFactor(1.0),
+    parachuteDragFactor(1.0),
+    atmosphereHint(0),
+    dragHint(0),
+    liftHint(0),
+    sideHint(0),
+    parachuteHint(0)
+{
+}
+
+
+void EntryForceContext::reset(const EntryModelTables* modelTables, double Sc, double m,
+                              const Uncertainties_struct& uncertainties)
+{
+    tables = modelTables;
+    capsuleArea = Sc;
+    mass = m;
+
+    densityFactor = 1 + uncertainties.density;
+    speedOfSoundFactor = 1 + uncertainties.speedofsound;
+    capsuleDragFactor = 1 + uncertainties.cdcapsule;
+    parachuteDragFactor = 1 + uncertainties.cdparachute;
+
+    atmosphereHint = 0;
+    dragHint = 0;
+    liftHint = 0;
+    sideHint = 0;
+    parachuteHint = 0;
+}
@@ -0,0 +1,158 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef ENTRYTABLES_H_INCLUDED
+#define ENTRYTABLES_H_INCLUDED
+
+#include "reentrystructures.h"
+#include "CelestialBody.h"
+#include "HeatRateClass.h"
+#include "RAM/aerodatabase.h"
+#include <QString>
+#include <QVector>
+
+
+/**
+ * Immutable piecewise linear table of one or more columns sampled at the same
+ * increasing abscissae. Outside the table range the first or last row is
+ * returned.
+ *
+ * Uniformly spaced tables are indexed directly. Otherwise the search starts
+ * from a bracket hint owned by the caller; since successive evaluations along
+ * a trajectory are close to each other the bracket is found in a step or two.
+ * The table itself is never modified by a lookup, so it can be shared by
+ * several threads.
+ */
+class EntryLookupTable
+{
+public:
+    EntryLookupTable();
+    /**
+     * @param abscissae increasing abscissae
+     * @param values row-major values, columns values per abscissa
+     */
+    EntryLookupTable(const QVector<double>& abscissae, const QVector<double>& values, int columns);
+
+    bool isEmpty() const { return m_x.size() < 2; }
+    int columnCount() const { return m_columns; }
+    double minimum() const { return m_x.first(); }
+    double maximum() const { return m_x.last(); }
+
+    /**
+     * Return the interpolated value of a column at x, updating hint
+     */
+    double value(int column, double x, int& hint) const;
+    /**
+     * Write the interpolated values of all the columns at x in out
+     */
+    void values(double x, int& hint, double* out) const;
+
+private:
+    int bracket(double x, int& hint) const;
+
+    QVector<double> m_x;
+    QVector<double> m_values;
+    int m_columns;
+    bool m_uniform;
+    double m_inverseStep;
+};
+
+
+/**
+ * Body, heat rate, atmosphere and aerodynamic tables of an entry simulation.
+ * They are read once from the data directory and can then be shared by any
+ * number of trajectories, e.g. the runs of a dispersion analysis.
+ */
+class EntryModelTables
+{
+public:
+    enum AtmosphereColumn
+    {
+        Density = 0,
+        Pressure = 1,
+        SpeedOfSound = 2,
+        Temperature = 3
+    };
+
+    EntryModelTables(const EntrySettings& settings);
+
+    const EntryLookupTable& atmosphere() const { return m_atmosphere; }
+    const EntryLookupTable& capsuleDrag() const { return m_capsuleDrag; }
+    const EntryLookupTable& capsuleLift() const { return m_capsuleLift; }
+    const EntryLookupTable& capsuleSide() const { return m_capsuleSide; }
+    const EntryLookupTable& parachuteDrag() const { return m_parachuteDrag; }
+    const CelestialBody& body() const { return m_body; }
+    const HeatRateClass& heatRate() const { return m_heatRate; }
+
+    /**
+     * Error flag, with the same meaning as capsule_class::flag:
+     * 0 = OK, 1 = missing capsule coefficient profile, 2 = missing parachute
+     * profile of a vehicle with a parachute, 3 = missing atmosphere model
+     */
+    int flag() const { return m_flag; }
+
+private:
+    bool readAtmosphere(const QString& name);
+    bool readCoefficientProfile(const QString& name, AeroDatabase::Coefficient coefficient, EntryLookupTable& table);
+    bool readParachuteProfile(const QString& name);
+
+    EntryLookupTable m_atmosphere;
+    EntryLookupTable m_capsuleDrag;
+    EntryLookupTable m_capsuleLift;
+    EntryLookupTable m_capsuleSide;
+    EntryLookupTable m_parachuteDrag;
+    CelestialBody m_body;
+    HeatRateClass m_heatRate;
+    int m_flag;
+};
+
+
+/**
+ * Per-trajectory state needed to evaluate the aerodynamic forces: the shared
+ * tables, the vehicle properties, the dispersion factors and the bracket
+ * hints of the table lookups. It's cheap to copy and holds no heap data.
+ */
+struct EntryForceContext
+{
+    EntryForceContext();
+
+    void reset(const EntryModelTables* modelTables, double Sc, double m,
+               const Uncertainties_struct& uncertainties);
+
+    const EntryModelTables* tables;
+
+    double capsuleArea;            // m^2
+    double mass;                   // kg
+
+    double densityFactor;
+    double speedOfSoundFactor;
+    double capsuleDragFactor;
+    double parachuteDragFactor;
+
+    int atmosphereHint;
+    int dragHint;
+    int liftHint;
+    int sideHint;
+    int parachuteHint;
+};
+
+#endif // ENTRYTABLES_H_INCLUDED
@@ -42,12 +42,18 @@
 #include "Astro-Core/stacoordsys.h"
 #include "Astro-Core/date.h"
 #include "Astro-Core/stabody.h"
+#include "Astro-Core/stamath.h"
 #include "Astro-Core/perturbations.h"
 #include "reentrystructures.h"
 #include "EntryTrajectory.h"
+#include "entrydispersion.h"
 #include "Scenario/missionAspectDialog.h"
 
 #include <QtDebug>
+#include <QMessageBox>
+#include <QProgressDialog>
+#include <QApplication>
+#include <QTextStream>
 
 
 using namespace Eigen;
@@ -73,7 +79,11 @@ double ReEntryDialog::getLocalRadius(ScenarioEnvironmentType* environment, doubl
 }
 
 ReEntryDialog::ReEntryDialog(ScenarioTree* parent) :
-    QDialog(parent)
+    QDialog(parent),
+    m_vehicle(NULL),
+    m_dispersion(NULL),
+    m_dispersionWatcher(NULL),
+    m_dispersionProgress(NULL)
 {
     setupUi(this);
 
@@ -107,6 +117,7 @@ ReEntryDialog::ReEntryDialog(ScenarioTree* parent) :
     //PropagatorComboBox->addItem(tr("Gauss"), "GAUSS");
 
     IntegratorComboBox->addItem(tr("Runge-Kutta 4"), "RK4");
+    IntegratorComboBox->addItem(tr("Dormand-Prince 5(4), adaptive"), "DOPRI54");
     //IntegratorComboBox->addItem(tr("Runge-Kutta Fehlberg"), "RKF");
 
     InitialStateComboBox->addItem(tr("Spherical Coordinates"), "SPHERICAL COORDINATES");
@@ -217,10 +228,31 @@ ReEntryDialog::ReEntryDialog(ScenarioTree* parent) :
     connect(GravityFieldRadioButton, SIGNAL(toggled(bool)), TesseralSpinBox, SLOT(setEnabled(bool)));
     connect(ZonalsSpinBox, SIGNAL(valueChanged(int)), TesseralSpinBox, SLOT(setVariableMaximum(int)));
 
+    QDoubleValidator* deviationValidator = new QDoubleValidator(this);
+    deviationValidator->setBottom(0.0);
+    QList<QLineEdit*> deviationFields;
+    deviationFields << sigmaMassLineEdit << sigmaAltitudeLineEdit << sigmaLongitudeLineEdit << sigmaLatitudeLineEdit
+                    << sigmaVelocityLineEdit << sigmaFlightPathAngleLineEdit << sigmaHeadingLineEdit << sigmaDensityLineEdit
+                    << sigmaSpeedOfSoundLineEdit << sigmaCdCapsuleLineEdit << sigmaCdParachuteLineEdit;
+    foreach (QLineEdit* field, deviationFields)
+    {
+        field->setValidator(deviationValidator);
+    }
+
+    m_dispersionWatcher = new QFutureWatcher<EntryDispersionStatistics>(this);
+    connect(m_dispersionWatcher, SIGNAL(finished()), this, SLOT(dispersionFinished()));
 }
 
 ReEntryDialog::~ReEntryDialog()
 {
+    // The runs still executing refer to the analysis
+    if (m_dispersion)
+    {
+        m_dispersionWatcher->cancel();
+        m_dispersionWatcher->waitForFinished();
+        delete m_dispersion;
+    }
+
     delete TesseralSpinBox;
 }
 
@@ -1072,6 +1104,12 @@ bool PropagateEntryTrajectory(ScenarioREV* vehicle, ScenarioEntryArcType* entry,
     EntryParameters parameters = createEntryParametersSimulation(entry, vehicle);
     QList<Perturbations*> perturbationsList;
 
+    if (trajectory.capsule.flag == 2)
+    {
+        propFeedback.raiseError(QObject::tr("Unable to read the parachute drag profile '%1'").arg(inputSettings.CdPprofilename));
+        return false;
+    }
+
     sta::StateVector InitialState;
     if(parameters.coordselector==1)
         InitialState=sphericalTOcartesian(parameters.inputstate);
@@ -1170,3 +1208,157 @@ void ReEntryDialog::on_pushButtonAspect_clicked()
 }
 
 
+/** Read the one sigma deviations of the Dispersion tab, converting them to
+  * the units of Uncertainties_struct. Return false if any of them isn't a
+  * non-negative number.
+  */
+bool ReEntryDialog::readDeviations(Uncertainties_struct* sigma)
+{
+    QLineEdit* const fields[] =
+    {
+        sigmaMassLineEdit, sigmaAltitudeLineEdit, sigmaLongitudeLineEdit, sigmaLatitudeLineEdit,
+        sigmaVelocityLineEdit, sigmaFlightPathAngleLineEdit, sigmaHeadingLineEdit, sigmaDensityLineEdit,
+        sigmaSpeedOfSoundLineEdit, sigmaCdCapsuleLineEdit, sigmaCdParachuteLineEdit
+    };
+    const int fieldCount = sizeof(fields) / sizeof(fields[0]);
+
+    double values[fieldCount];
+    for (int i = 0; i < fieldCount; i++)
+    {
+        bool ok = false;
+        values[i] = fields[i]->text().toDouble(&ok);
+        if (!ok || values[i] < 0.0)
+        {
+            return false;
+        }
+    }
+
+    sigma->mass = values[0] / 100.0;
+    sigma->altitude = values[1];
+    sigma->tau = sta::degToRad(values[2]);
+    sigma->delta = sta::degToRad(values[3]);
+    sigma->velocity = values[4];
+    sigma->gamma = sta::degToRad(values[5]);
+    sigma->chi = sta::degToRad(values[6]);
+    sigma->density = values[7] / 100.0;
+    sigma->temperature = 0.0;
+    sigma->pressure = 0.0;
+    sigma->speedofsound = values[8] / 100.0;
+    sigma->cdcapsule = values[9] / 100.0;
+    sigma->cdparachute = values[10] / 100.0;
+
+    return true;
+}
+
+
+/** Start a Monte Carlo dispersion analysis of the arc as currently edited in
+  * the dialog, with the number of runs and the one sigma deviations of the
+  * Dispersion tab. The runs are executed in the background;
+  * dispersionFinished() shows their statistics.
+  */
+void ReEntryDialog::on_pushButtonDispersion_clicked()
+{
+    if (!m_vehicle)
+    {
+        QMessageBox::warning(this, tr("Dispersion Analysis"), tr("The entry arc doesn't belong to a re-entry vehicle."));
+        return;
+    }
+
+    ScenarioEntryArcType entry;
+    if (!saveValues(&entry))
+    {
+        QMessageBox::warning(this, tr("Dispersion Analysis"), tr("Invalid entry parameters."));
+        return;
+    }
+    if (InitialStateComboBox->currentIndex() != 0)
+    {
+        QMessageBox::warning(this, tr("Dispersion Analysis"), tr("Dispersion analysis requires a spherical entry state."));
+        return;
+    }
+
+    Uncertainties_struct sigma;
+    if (!readDeviations(&sigma))
+    {
+        QMessageBox::warning(this, tr("Dispersion Analysis"), tr("The deviations of the Dispersion tab must be non-negative numbers."));
+        return;
+    }
+
+    int runs = dispersionRunsSpinBox->value();
+
+    EntrySettings settings = createEntrySettings(&entry, m_vehicle);
+    EntryParameters nominal = createEntryParametersSimulation(&entry, m_vehicle);
+    double startTime = sta::JdToMjd(sta::CalendarToJd(entry.TimeLine()->StartTime()));
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    m_dispersion = new EntryDispersionAnalysis(settings, nominal, startTime);
+    QApplication::restoreOverrideCursor();
+    m_dispersion->setDeviations(sigma);
+
+    pushButtonDispersion->setEnabled(false);
+
+    m_dispersionProgress = new QProgressDialog(tr("Running the entry dispersion analysis..."), tr("Cancel"), 0, runs, this);
+    m_dispersionProgress->setWindowModality(Qt::WindowModal);
+    m_dispersionProgress->setMinimumDuration(0);
+
+    connect(m_dispersionWatcher, SIGNAL(progressRangeChanged(int,int)), m_dispersionProgress, SLOT(setRange(int,int)));
+    connect(m_dispersionWatcher, SIGNAL(progressValueChanged(int)), m_dispersionProgress, SLOT(setValue(int)));
+    connect(m_dispersionProgress, SIGNAL(canceled()), m_dispersionWatcher, SLOT(cancel()));
+
+    m_dispersionWatcher->setFuture(m_dispersion->start(runs));
+}
+
+
+/** Show the statistics of the finished dispersion analysis.
+  */
+void ReEntryDialog::dispersionFinished()
+{
+    bool canceled = m_dispersionWatcher->isCanceled();
+    EntrySettings settings = m_dispersion->settings();
+
+    EntryDispersionStatistics statistics;
+    if (!canceled)
+    {
+        statistics = m_dispersionWatcher->result();
+    }
+
+    delete m_dispersionProgress;
+    m_dispersionProgress = NULL;
+    m_dispersionWatcher->setFuture(QFuture<EntryDispersionStatistics>());
+    delete m_dispersion;
+    m_dispersion = NULL;
+    pushButtonDispersion->setEnabled(true);
+
+    if (canceled)
+    {
+        return;
+    }
+
+    QString report;
+    QTextStream out(&report);
+    out << tr("Runs: %1 (%2 failed)").arg(statistics.runCount()).arg(statistics.failedCount()) << "\n";
+    out << tr("Landed: %1, burnt: %2, crushed: %3, skipped out: %4")
+           .arg(statistics.statusCount(landed)).arg(statistics.statusCount(burnt))
+           .arg(statistics.statusCount(crushed)).arg(statistics.statusCount(gone)) << "\n\n";
+    out << tr("Peak heat rate: %1 +/- %2 W/cm2 (max %3)")
+           .arg(statistics.peakHeatRate().mean()).arg(statistics.peakHeatRate().standardDeviation())
+           .arg(statistics.peakHeatRate().maximum()) << "\n";
+    out << tr("Peak load factor: %1 +/- %2 g (max %3)")
+           .arg(statistics.peakLoadFactor().mean()).arg(statistics.peakLoadFactor().standardDeviation())
+           .arg(statistics.peakLoadFactor().maximum()) << "\n";
+    out << tr("Time of flight: %1 +/- %2 s")
+           .arg(statistics.timeOfFlight().mean()).arg(statistics.timeOfFlight().standardDeviation()) << "\n";
+
+    StaBody* body = STA_SOLAR_SYSTEM->lookup(settings.bodyname);
+    double semiMajorAxis, semiMinorAxis, azimuth;
+    if (body && statistics.landingEllipse(body->meanRadius(), 3.0, semiMajorAxis, semiMinorAxis, azimuth))
+    {
+        out << "\n" << tr("Mean landing point: %1 deg lon, %2 deg lat")
+               .arg(statistics.meanLandingLongitude()).arg(statistics.meanLandingLatitude()) << "\n";
+        out << tr("3-sigma footprint: %1 x %2 km, azimuth %3 deg")
+               .arg(semiMajorAxis).arg(semiMinorAxis).arg(azimuth) << "\n";
+    }
+
+    QMessageBox::information(this, tr("Dispersion Analysis"), report);
+}
+
+
@@ -31,7 +31,9 @@
 #define _REENTRY_H_
 
 #include <QDialog>
+#include <QFutureWatcher>
 #include "Loitering/loitering.h"
+#include "entrydispersion.h"
 #include "ui_reentry.h"
 
 #include "Scenario/missionAspectDialog.h"
@@ -43,6 +45,7 @@ class ScenarioProperties;
 class ScenarioSimulationMode;
 class ScenarioWindowMode;
 class ScenarioTrajectoryPropagation;
+class QProgressDialog;
 
 class ReEntryDialog : public QDialog, private Ui_ReEntryDialogClass
 {
@@ -85,6 +88,11 @@ public:
 
     double getLocalRadius(ScenarioEnvironmentType* environment, double latitude);
 
+    /**
+     * Set the vehicle flying the arc, needed for the dispersion analysis
+     */
+    void setVehicle(ScenarioREV* vehicle) { m_vehicle = vehicle; }
+
     TesseralBox* TesseralSpinBox;
     int m_tesserals;
 
@@ -93,6 +101,18 @@ public:
 
 protected slots:
         void on_pushButtonAspect_clicked();
+        void on_pushButtonDispersion_clicked();
+
+private slots:
+        void dispersionFinished();
+
+private:
+    bool readDeviations(Uncertainties_struct* sigma);
+
+    ScenarioREV* m_vehicle;
+    EntryDispersionAnalysis* m_dispersion;
+    QFutureWatcher<EntryDispersionStatistics>* m_dispersionWatcher;
+    QProgressDialog* m_dispersionProgress;
 
 };
 extern bool PropagateEntryTrajectory(ScenarioREV* vehicle, ScenarioEntryArcType* entry, QList<double>& sampleTimes,
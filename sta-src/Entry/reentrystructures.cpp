@@ -78,6 +78,7 @@ EntryParameters createEntryParametersSimulation(ScenarioEntryArcType* entry, Sce
     parameters.cref= vehicle->REVSystem()->AeroThermodynamics()->referenceLength();
     parameters.m = vehicle->REVSystem()->Weights()->totalDryMass();
     parameters.Rn = vehicle->REVSystem()->Geometry()->noseRadius();
+    parameters.uncertainties = Uncertainties_struct();   // nominal trajectory: no deviations
 
     QString coordinatesystem = entry->InitialPosition()->CoordinateSystem();
     if (dynamic_cast<ScenarioSphericalCoordinatesType*>(entry->InitialPosition()->Abstract6DOFPosition().data()))
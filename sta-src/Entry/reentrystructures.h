@@ -60,13 +60,35 @@ struct EntrySettings
     double parachuteDeployMach;
 };
 
+/**
+ * Uncertainties_struct structure: deviations from the nominal entry. Mass,
+ * atmosphere and aerodynamic coefficients are relative deviations, the entry
+ * state deviations are absolute (altitude in m, tau/delta/gamma/chi in rad,
+ * velocity in m/s).
+ */
+struct Uncertainties_struct {
+    double mass;
+    double altitude;
+    double tau;
+    double delta;
+    double velocity;
+    double gamma;
+    double chi;
+    double density;
+    double temperature;     // not dispersed, the dynamics only depend on density and speed of sound
+    double pressure;        // not dispersed, as temperature
+    double speedofsound;
+    double cdcapsule;
+    double cdparachute;
+};
+
 /**
  * EntryParameters structure.
  */
 struct EntryParameters
 {
     int coordselector;  //1 for spherical, 2 for cartesian coordinates
-    //Uncertainties_struct uncertainties;
+    Uncertainties_struct uncertainties;
     double Sref;
     double cref;
     double m;
@@ -82,6 +104,13 @@ enum _status
     landed, OK, crushed, burnt, gone
 };
 
+/**
+ * Extra information along an entry trajectory: 0 = density, 1 = mach number, 2 = load factor,
+ * 3 = qdot_c, 4 = qdot_r, 5 = altitude, 6 = velocity, 7 = parachuteDeploy (0 = entry, 1 = descent),
+ * 8 = total heat rate, 9 = total heat load
+ */
+typedef Eigen::Matrix<double, 10, 1> EntryState2;
+
 /**
  * Peak structure.
  */
@@ -124,25 +153,6 @@ struct angle
 };
 
 
-///**
-// * Uncertainties_struct structure.
-// */
-//struct Uncertainties_struct {
-//    double mass;
-//    double altitude;
-//    double tau;
-//    double delta;
-//    double velocity;
-//    double gamma;
-//    double chi;
-//    double density;
-//    double temperature;
-//    double pressure;
-//    double speedofsound;
-//    double cdcapsule;
-//    double cdparachute;
-//};
-
 //struct interval
 //{
 //    double low;
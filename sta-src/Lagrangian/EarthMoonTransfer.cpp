@@ -65,16 +65,12 @@ void EarthMoonPatch()
 
         halo_Leg1.manifolds.error=halo_Leg2.manifolds.error=1;
 
-        double paramv[1]={0}; double deriv[5]; double timein=0;
-        double relerr, abserr, accuracy; abserr=relerr=accuracy=1E-10;
+        double relerr=1E-10;
         double initial_condition_perturbed[6],initial_condition_perturbed_0[6], initial_condition_0[5];
 
         int totalPosition=50;
         for (int i=1;i<totalPosition+1;i++)
         {
-        for (int p=0; p<6; p++)
-            deriv[p]=0;
-        int flag=1;
         timefinTransfer0=halo_Leg1.trajectory.final_data.period*(1.0/4.0+i/(2*totalPosition));
         initial_condition_0[3]=halo_Leg1.trajectory.init_data.State.position.x();
         initial_condition_0[4]=halo_Leg1.trajectory.init_data.State.position.y();
@@ -85,13 +81,7 @@ void EarthMoonPatch()
         //qDebug()<<"Debug| 1"<<initial_condition_0[0]<<initial_condition_0[1]<<initial_condition_0[2]<<initial_condition_0[3]<<initial_condition_0[4]<<initial_condition_0[5];
         //qDebug()<<timein;
 
-        while (flag!=2)
-        {
-            flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_0, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-            if (flag==4)
-                flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_0, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-  //      qDebug()<<timein;
-        }
+        threebody_propagate(Grav_Param, initial_condition_0, timefinTransfer0, relerr);
 
         //qDebug()<<"Debug| 2"<<initial_condition_0[0]<<initial_condition_0[1]<<initial_condition_0[2]<<initial_condition_0[3]<<initial_condition_0[4]<<initial_condition_0[5];
         double finalHaloRotX_actual,finalHaloRotY_actual,finalHaloRotZ_actual,finalHaloRotVX_actual,finalHaloRotVY_actual,finalHaloRotVZ_actual;
@@ -120,7 +110,6 @@ void EarthMoonPatch()
         }
 
         }
-        timein=0;
         double step=0.2;
         double initial_condition_memory[6], initial_interval[6],initial[6];
         for (int p=0; p<6; p++)
@@ -143,17 +132,8 @@ void EarthMoonPatch()
     {
         for (int p=0; p<6; p++)
             initial_condition_perturbed[p]=initial[p];
-        timein=0;
-        flag=1;
-        for (int p=0; p<6; p++)
-            deriv[p]=0;
         timefinTransfer0=timefinTransfer0+step;
-        while (flag!=2)
-        {
-            flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_perturbed, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-            if (flag==4)
-                flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_perturbed, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-        }
+        threebody_propagate(Grav_Param, initial_condition_perturbed, timefinTransfer0, relerr);
 
 //        qDebug()<<timein;
         if (initial_condition_perturbed[3]<(1-Grav_Param))
@@ -69,13 +69,9 @@ Eigen::VectorXd GlobalOptimizers::EvaluateModel(Eigen::VectorXd x,int)
 //qDebug()<<"Debug| pre1!"<<haloTransfer.trajectory.final_data.State.velocity.x()<<haloTransfer.trajectory.final_data.State.velocity.y()<<haloTransfer.trajectory.final_data.State.velocity.z()<<haloTransfer.trajectory.final_data.State.position.x()<<haloTransfer.trajectory.final_data.State.position.y()<<haloTransfer.trajectory.final_data.State.position.z();
 
         extern double timefinTransfer;
-        double paramv[1]={0}; double deriv[6]; double timein=0;
-        double relerr, abserr, accuracy; abserr=relerr=accuracy=1E-8;
+        double relerr=1E-8;
         double initial_condition_perturbed[6],initial_condition_perturbed_0[6], initial_condition_0[6];
 
-        for (int p=0; p<6; p++)
-            deriv[p]=0;
-        int flag=1;
 
         timefinTransfer0=haloTransfer.trajectory.final_data.period*fractionOrbit;
         initial_condition_0[3]=haloTransfer.trajectory.init_data.State.position.x();
@@ -88,13 +84,7 @@ Eigen::VectorXd GlobalOptimizers::EvaluateModel(Eigen::VectorXd x,int)
 //qDebug()<<"Debug| 1"<<initial_condition_0[0]<<initial_condition_0[1]<<initial_condition_0[2]<<initial_condition_0[3]<<initial_condition_0[4]<<initial_condition_0[5];
 //qDebug()<<timein;
 
-        while (flag!=2)
-        {
-            flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_0, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-            if (flag==4)
-                flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_0, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-  //      qDebug()<<timein;
-        }
+        threebody_propagate(Grav_Param, initial_condition_0, timefinTransfer0, relerr);
 
 //qDebug()<<"Debug| 2"<<initial_condition_0[0]<<initial_condition_0[1]<<initial_condition_0[2]<<initial_condition_0[3]<<initial_condition_0[4]<<initial_condition_0[5];
 double finalHaloRotX_actual,finalHaloRotY_actual,finalHaloRotZ_actual,finalHaloRotVX_actual,finalHaloRotVY_actual,finalHaloRotVZ_actual;
@@ -126,7 +116,6 @@ finalHaloRotVZ_actual=initial_condition_0[2];
 
     //    qDebug()<<"Debug| final"<<initial_condition_perturbed[0]<<initial_condition_perturbed[1]<<initial_condition_perturbed[2]<<initial_condition_perturbed[3]<<initial_condition_perturbed[4]<<initial_condition_perturbed[5]<<haloTransfer.manifolds.error<<haloTransfer.trajectory.Lpoint_Xposition<<haloTransfer.manifolds.kind;
 
-    timein=0;
     double step=0.2;
     double initial_condition_memory[6], initial_interval[6],initial[6];
     double secondBorderTime,firstBorderTime=0;
@@ -172,17 +161,8 @@ finalHaloRotVZ_actual=initial_condition_0[2];
     {
         for (int p=0; p<6; p++)
             initial_condition_perturbed[p]=initial[p];
-        timein=0;
-        flag=1;
-        for (int p=0; p<6; p++)
-            deriv[p]=0;
         timefinTransfer0=timefinTransfer0+step;
-        while (flag!=2)
-        {
-            flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_perturbed, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-            if (flag==4)
-                flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_perturbed, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-        }
+        threebody_propagate(Grav_Param, initial_condition_perturbed, timefinTransfer0, relerr);
         if (eigen>1)
             radius(Grav_Param,initial_condition_perturbed[3],initial_condition_perturbed[4], initial_condition_perturbed[5], R1,R2);
         else
@@ -234,18 +214,9 @@ finalHaloRotVZ_actual=initial_condition_0[2];
         }
         for (int p=0; p<6; p++)
             initial_condition_perturbed[p]=initial[p];
-        timein=0;
-        flag=1;
-        for (int p=0; p<6; p++)
-            deriv[p]=0;
         timefinTransfer0=timefinTransfer0+step;
         //qDebug()<<41<<step;
-        while (flag!=2)
-        {
-            flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_perturbed, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-            if (flag==4)
-                flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, initial_condition_perturbed, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-        }
+        threebody_propagate(Grav_Param, initial_condition_perturbed, timefinTransfer0, relerr);
         //qDebug()<<42;
         if (eigen>1)
             radius(Grav_Param,initial_condition_perturbed[3],initial_condition_perturbed[4], initial_condition_perturbed[5], R1,R2);
@@ -317,7 +288,6 @@ finalHaloRotVZ_actual=initial_condition_0[2];
     {
     for (int l=0;l<101;l++)
     {
-    flag=1; timein=0;
     timefinTransfer0=firstBorderTime+l*(secondBorderTime-firstBorderTime)/100;
     double newInitial_condition[6];
     for (int p=0;p<6;p++)
@@ -331,14 +301,7 @@ finalHaloRotVZ_actual=initial_condition_0[2];
         newInitial_condition[5]=-initial_condition_perturbed_0[5];
     }
 
-        for (int p=0; p<6; p++)
-            deriv[p]=0;
-        while (flag!=2)
-        {
-            flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, newInitial_condition, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-            if (flag==4)
-                flag=Runge_Kutta_Fehlberg(threebody_EOM, 6, newInitial_condition, paramv, deriv, &timein, timefinTransfer0, &relerr, abserr, flag );
-        }
+        threebody_propagate(Grav_Param, newInitial_condition, timefinTransfer0, relerr);
         if (eigen<1)
             radius(Grav_Param,newInitial_condition[3],-newInitial_condition[4], -newInitial_condition[5], R1,R2);
         else
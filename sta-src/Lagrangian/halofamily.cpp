@@ -0,0 +1,404 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "halofamily.h"
+#include "Astro-Core/stamath.h"
+#include <Eigen/LU>
+#include <QFile>
+#include <QTextStream>
+#include <QThread>
+#include <QDebug>
+#include <QtConcurrentMap>
+#include <cmath>
+
+using namespace Eigen;
+
+static const int MaximumIterations = 20;
+// The step isn't halved below this fraction of the requested step
+static const double MinimumStepFraction = 1.0e-3;
+// Below this cosine between the tangent and the amplitude axis, the amplitude
+// no longer parametrizes the family
+static const double MinimumAmplitudeSlope = 1.0e-6;
+
+
+// A corrector run: the guess and the family member it was predicted from,
+// along the direction of continuation at the given arc length step
+struct HaloFamilyContinuation::CorrectionCase
+{
+    const HaloFamilyContinuation* engine;
+    VectorXd guess;
+    VectorXd base;
+    VectorXd direction;
+    double arc;
+};
+
+
+HaloFamilyContinuation::HaloFamilyContinuation(double massParameter) :
+    m_propagator(massParameter),
+    m_parameter(ArcLength),
+    m_step(1.0e-3),
+    m_batchSize(QThread::idealThreadCount()),
+    m_tolerance(1.0e-10),
+    m_planar(false)
+{
+    m_propagator.setTolerance(1.0e-12, 1.0e-12);
+}
+
+
+void HaloFamilyContinuation::setBatchSize(int batchSize)
+{
+    m_batchSize = qMax(1, batchSize);
+}
+
+
+/**
+ * Propagate the orbit of the unknowns over its half period. The constraints
+ * are y, vx and vz (y and vx for planar orbits) at the half period, and
+ * jacobian their derivatives with respect to the unknowns.
+ */
+bool HaloFamilyContinuation::evaluate(const VectorXd& unknowns, VectorXd& constraints, MatrixXd& jacobian) const
+{
+    int n = unknownCount();
+    double halfPeriod = unknowns(n - 1);
+    if (halfPeriod <= 0.0)
+    {
+        return false;
+    }
+
+    ThreeBodyPropagator::State state;
+    state << unknowns(0), 0.0, m_planar ? 0.0 : unknowns(1), 0.0, unknowns(n - 2), 0.0;
+    ThreeBodyPropagator::Matrix6 stm = ThreeBodyPropagator::Matrix6::Identity();
+    if (!m_propagator.propagate(state, stm, halfPeriod))
+    {
+        return false;
+    }
+    ThreeBodyPropagator::State derivatives = m_propagator.derivatives(state);
+
+    // Rows and columns of the state transition matrix for the constraints and the unknowns
+    const int spatialRows[3] = { 1, 3, 5 };
+    const int spatialColumns[3] = { 0, 2, 4 };
+    const int planarColumns[2] = { 0, 4 };
+    const int* columns = m_planar ? planarColumns : spatialColumns;
+
+    constraints.resize(n - 1);
+    jacobian.resize(n - 1, n);
+    for (int i = 0; i < n - 1; i++)
+    {
+        int row = spatialRows[i];
+        constraints(i) = state(row);
+        for (int j = 0; j < n - 1; j++)
+        {
+            jacobian(i, j) = stm(row, columns[j]);
+        }
+        jacobian(i, n - 1) = derivatives(row);
+    }
+
+    return true;
+}
+
+
+/**
+ * Newton iterations on the constraints of the member, completed by the
+ * continuation equation direction . (unknowns - base) = arc.
+ */
+bool HaloFamilyContinuation::correct(Member& member, const VectorXd& base, const VectorXd& direction, double arc) const
+{
+    int n = unknownCount();
+    member.converged = false;
+
+    for (int iteration = 0; iteration < MaximumIterations; iteration++)
+    {
+        VectorXd constraints;
+        if (!evaluate(member.unknowns, constraints, member.jacobian))
+        {
+            return false;
+        }
+
+        VectorXd residual(n);
+        for (int i = 0; i < n - 1; i++)
+        {
+            residual(i) = constraints(i);
+        }
+        residual(n - 1) = direction.dot(member.unknowns - base) - arc;
+
+        if (residual.cwise().abs().maxCoeff() < m_tolerance)
+        {
+            member.converged = true;
+            return true;
+        }
+
+        MatrixXd system(n, n);
+        system.block(0, 0, n - 1, n) = member.jacobian;
+        system.row(n - 1) = direction.transpose();
+        VectorXd correction;
+        if (!system.lu().solve(-residual, &correction))
+        {
+            return false;
+        }
+        member.unknowns += correction;
+    }
+
+    return false;
+}
+
+
+/**
+ * Unit tangent of the family at the member: the null vector of the Jacobian of
+ * its constraints, on the side of reference.
+ */
+bool HaloFamilyContinuation::tangent(Member& member, const VectorXd& reference) const
+{
+    int n = unknownCount();
+    MatrixXd system(n, n);
+    system.block(0, 0, n - 1, n) = member.jacobian;
+    system.row(n - 1) = reference.transpose();
+
+    VectorXd direction;
+    if (!system.lu().solve(VectorXd::Unit(n, n - 1), &direction) || direction.norm() == 0.0)
+    {
+        return false;
+    }
+
+    member.tangent = direction / direction.norm();
+    return true;
+}
+
+
+HaloFamilyMember HaloFamilyContinuation::familyMember(const Member& member) const
+{
+    int n = unknownCount();
+    const VectorXd& unknowns = member.unknowns;
+    double z = m_planar ? 0.0 : unknowns(1);
+
+    HaloFamilyMember familyMember;
+    familyMember.state.position = Vector3d(unknowns(0), 0.0, z);
+    familyMember.state.velocity = Vector3d(0.0, unknowns(n - 2), 0.0);
+    familyMember.period = 2.0 * unknowns(n - 1);
+
+    ThreeBodyPropagator::State state;
+    state << unknowns(0), 0.0, z, 0.0, unknowns(n - 2), 0.0;
+    familyMember.jacobiConstant = m_propagator.jacobiConstant(state);
+
+    return familyMember;
+}
+
+
+bool HaloFamilyContinuation::setSeed(const sta::StateVector& state, double period)
+{
+    m_members.clear();
+    m_family.clear();
+    m_planar = state.position.z() == 0.0 && state.velocity.z() == 0.0;
+
+    int n = unknownCount();
+    Member seed;
+    seed.unknowns.resize(n);
+    seed.unknowns(0) = state.position.x();
+    if (!m_planar)
+    {
+        seed.unknowns(1) = state.position.z();
+    }
+    seed.unknowns(n - 2) = state.velocity.y();
+    seed.unknowns(n - 1) = period / 2.0;
+
+    // The amplitude of the seed is kept; the tangent is oriented by the sign of the step
+    int amplitude = m_planar ? 0 : 1;
+    VectorXd amplitudeAxis = VectorXd::Unit(n, amplitude);
+    VectorXd reference = VectorXd::Unit(n, m_parameter == Amplitude ? amplitude : n - 1);
+    if (m_step < 0.0)
+    {
+        reference = -reference;
+    }
+
+    VectorXd base = seed.unknowns;
+    if (!correct(seed, base, amplitudeAxis, 0.0) || !tangent(seed, reference))
+    {
+        qDebug() << "HaloFamilyContinuation: the seed orbit can't be corrected";
+        return false;
+    }
+
+    m_members.append(seed);
+    m_family.append(familyMember(seed));
+    return true;
+}
+
+
+bool HaloFamilyContinuation::lyapunovSeed(double massParameter, int librationPoint, double ax,
+                                          sta::StateVector& state, double& period)
+{
+    if (librationPoint != 1 && librationPoint != 2)
+    {
+        return false;
+    }
+
+    // Abscissa of the libration point by Newton iterations on the x equation,
+    // starting from the Hill sphere approximation
+    double mu = massParameter;
+    double hill = pow(mu / 3.0, 1.0 / 3.0);
+    double x = librationPoint == 1 ? 1.0 - mu - hill : 1.0 - mu + hill;
+    double c2 = 0.0;
+    for (int i = 0; i < MaximumIterations; i++)
+    {
+        double r1 = fabs(x + mu);
+        double r2 = fabs(x - 1.0 + mu);
+        double k1 = (1.0 - mu) / (r1 * r1 * r1);
+        double k2 = mu / (r2 * r2 * r2);
+        double f = x - k1 * (x + mu) - k2 * (x - 1.0 + mu);
+        c2 = k1 + k2;
+        double dx = -f / (1.0 + 2.0 * c2);
+        x += dx;
+        if (fabs(dx) < 1.0e-14)
+        {
+            break;
+        }
+    }
+
+    // Planar oscillation x = -ax cos(wt), y = k ax sin(wt) of the linearized motion
+    double w = sqrt((2.0 - c2 + sqrt(9.0 * c2 * c2 - 8.0 * c2)) / 2.0);
+    double k = (w * w + 1.0 + 2.0 * c2) / (2.0 * w);
+
+    state.position = Vector3d(x - ax, 0.0, 0.0);
+    state.velocity = Vector3d(0.0, k * ax * w, 0.0);
+    period = 2.0 * sta::Pi() / w;
+
+    return true;
+}
+
+
+HaloFamilyContinuation::Member HaloFamilyContinuation::correctMember(const CorrectionCase& correctionCase)
+{
+    Member member;
+    member.unknowns = correctionCase.guess;
+    correctionCase.engine->correct(member, correctionCase.base, correctionCase.direction, correctionCase.arc);
+    return member;
+}
+
+
+bool HaloFamilyContinuation::compute(int count)
+{
+    if (m_members.isEmpty())
+    {
+        qDebug() << "HaloFamilyContinuation: no seed orbit";
+        return false;
+    }
+
+    int n = unknownCount();
+    int amplitude = m_planar ? 0 : 1;
+    double requestedStep = fabs(m_step);
+    double step = requestedStep;
+    int target = m_family.size() + count;
+
+    while (m_family.size() < target)
+    {
+        Member base = m_members.last();
+
+        // Continuation equation: fixed amplitude, or fixed length along the tangent
+        VectorXd direction;
+        if (m_parameter == Amplitude)
+        {
+            direction = VectorXd::Unit(n, amplitude);
+            if (base.tangent(amplitude) < 0.0)
+            {
+                direction = -direction;
+            }
+        }
+        else
+        {
+            direction = base.tangent;
+        }
+
+        double slope = direction.dot(base.tangent);
+        if (slope < MinimumAmplitudeSlope)
+        {
+            qDebug() << "HaloFamilyContinuation: turning point of the amplitude, use the arclength parameter";
+            return false;
+        }
+
+        // Members predicted along the tangent, corrected independently of each other
+        QList<CorrectionCase> cases;
+        int batchSize = qMin(m_batchSize, target - m_family.size());
+        for (int k = 1; k <= batchSize; k++)
+        {
+            CorrectionCase correctionCase;
+            correctionCase.engine = this;
+            correctionCase.base = base.unknowns;
+            correctionCase.direction = direction;
+            correctionCase.arc = k * step;
+            correctionCase.guess = base.unknowns + (k * step / slope) * base.tangent;
+            cases.append(correctionCase);
+        }
+
+        QList<Member> members = QtConcurrent::blockingMapped<QList<Member> >(cases, correctMember);
+
+        // Members are accepted in order, up to the first failure
+        bool failed = false;
+        for (int k = 0; k < members.size() && !failed; k++)
+        {
+            Member member = members.at(k);
+            failed = !member.converged || !tangent(member, m_members.last().tangent);
+            if (!failed)
+            {
+                m_members.append(member);
+                m_family.append(familyMember(member));
+            }
+        }
+
+        if (failed)
+        {
+            step /= 2.0;
+            if (step < MinimumStepFraction * requestedStep)
+            {
+                qDebug() << "HaloFamilyContinuation: continuation stopped after" << m_family.size() << "members";
+                return false;
+            }
+        }
+        else
+        {
+            step = qMin(2.0 * step, requestedStep);
+        }
+    }
+
+    return true;
+}
+
+
+bool HaloFamilyContinuation::writeFamily(const QString& fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "HaloFamilyContinuation: unable to write" << fileName;
+        return false;
+    }
+
+    QTextStream out(&file);
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setRealNumberPrecision(16);
+    foreach (const HaloFamilyMember& member, m_family)
+    {
+        const sta::StateVector& s = member.state;
+        out << s.position.x() << " " << s.position.y() << " " << s.position.z() << " "
+            << s.velocity.x() << " " << s.velocity.y() << " " << s.velocity.z() << " "
+            << member.period << " " << member.jacobiConstant << "\n";
+    }
+
+    return file.error() == QFile::NoError;
+}
@@ -0,0 +1,147 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef HALOFAMILY_H
+#define HALOFAMILY_H
+
+#include "Astro-Core/statevector.h"
+#include "Astro-Core/threebodypropagator.h"
+#include <QList>
+#include <QString>
+
+
+/**
+ * Member of a family of periodic orbits symmetric about the xz plane, in the
+ * normalized rotating frame of the circular restricted three body problem.
+ */
+struct HaloFamilyMember
+{
+    sta::StateVector state;   // initial state, on the xz plane with vx = vz = 0
+    double period;
+    double jacobiConstant;
+};
+
+typedef QList<HaloFamilyMember> HaloFamily;
+
+
+/**
+ * Continuation of a family of halo orbits, or of planar Lyapunov orbits when
+ * the seed has no z component, from one corrected member.
+ *
+ * The unknowns of a member are its initial x, z, vy and its half period; they
+ * are corrected with the state transition matrix until the orbit crosses the
+ * xz plane perpendicularly after half a period. The family is followed either
+ * with a fixed step of amplitude (z for halo orbits, x for Lyapunov orbits) or
+ * with a pseudo-arclength step, which also follows the family through the
+ * turning points of the amplitude and of the Jacobi constant.
+ *
+ * Members are predicted in batches along the tangent of the family at the last
+ * converged member, and the members of a batch are corrected concurrently on
+ * the global thread pool. The whole family is kept in memory.
+ */
+class HaloFamilyContinuation
+{
+public:
+    enum Parameter
+    {
+        Amplitude,
+        ArcLength
+    };
+
+    explicit HaloFamilyContinuation(double massParameter);
+
+    void setParameter(Parameter parameter) { m_parameter = parameter; }
+    /**
+     * Step between two members, in normalized units. Its sign selects the
+     * direction along the family: with Amplitude, a positive step increases z
+     * (x for Lyapunov orbits); with ArcLength, it increases the half period.
+     */
+    void setStep(double step) { m_step = step; }
+    /**
+     * Number of members corrected concurrently. The default is the number of
+     * threads of the global thread pool.
+     */
+    void setBatchSize(int batchSize);
+    void setTolerance(double tolerance) { m_tolerance = tolerance; }
+
+    /**
+     * Correct the seed orbit, keeping its amplitude, and start the family with
+     * it. state and period are an approximation of a member, e.g. from
+     * HaloOrbit::getNumericalApprox. Return false if the correction fails.
+     */
+    bool setSeed(const sta::StateVector& state, double period);
+
+    /**
+     * Approximation of the planar Lyapunov orbit of x amplitude ax (normalized)
+     * about the collinear point L1 or L2 (librationPoint 1 or 2), from the
+     * linearized equations of motion. It's close enough to seed the family for
+     * small amplitudes. Return false for other libration points.
+     */
+    static bool lyapunovSeed(double massParameter, int librationPoint, double ax,
+                             sta::StateVector& state, double& period);
+
+    /**
+     * Add up to count members to the family. The step is halved where the
+     * correction fails. Return false if the continuation stopped before.
+     */
+    bool compute(int count);
+
+    const HaloFamily& family() const { return m_family; }
+
+    /**
+     * Write the family, one member "x y z vx vy vz period C" per line. Return
+     * false if the file can't be written.
+     */
+    bool writeFamily(const QString& fileName) const;
+
+private:
+    // Unknowns (x, z, vy, half period) of a member, without z for planar orbits,
+    // the Jacobian of the constraints (y, vx, vz at the half period) and the
+    // unit tangent of the family
+    struct Member
+    {
+        Eigen::VectorXd unknowns;
+        Eigen::MatrixXd jacobian;
+        Eigen::VectorXd tangent;
+        bool converged;
+    };
+
+    struct CorrectionCase;
+    static Member correctMember(const CorrectionCase& correctionCase);
+
+    int unknownCount() const { return m_planar ? 3 : 4; }
+    bool evaluate(const Eigen::VectorXd& unknowns, Eigen::VectorXd& constraints, Eigen::MatrixXd& jacobian) const;
+    bool correct(Member& member, const Eigen::VectorXd& base, const Eigen::VectorXd& direction, double arc) const;
+    bool tangent(Member& member, const Eigen::VectorXd& reference) const;
+    HaloFamilyMember familyMember(const Member& member) const;
+
+    ThreeBodyPropagator m_propagator;
+    Parameter m_parameter;
+    double m_step;
+    int m_batchSize;
+    double m_tolerance;
+    bool m_planar;
+    QList<Member> m_members;
+    HaloFamily m_family;
+};
+
+#endif // HALOFAMILY_H
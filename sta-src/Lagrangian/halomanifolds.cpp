@@ -0,0 +1,287 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "halomanifolds.h"
+#include "Astro-Core/threebodypropagator.h"
+#include <QFile>
+#include <QTextStream>
+#include <QDebug>
+#include <QtConcurrentMap>
+#include <cmath>
+
+using namespace Eigen;
+
+// Branches that don't reach the primary within this time (normalized) are given up
+static const double MaximumCrossingTime = 10.0;
+// Sampling of the branches integrated until the crossing of the primary
+static const double CrossingOutputStep = 0.05;
+static const double CrossingTolerance = 1.0e-12;
+static const double MinimumStep = 1.0e-12;
+static const int MaximumSteps = 1000000;
+
+
+typedef ThreeBodyDerivativeCalculator::State ThreeBodyState;
+typedef DormandPrinceDenseOutput<ThreeBodyState> ThreeBodyDenseOutput;
+
+
+// Sample of a branch. The stable branches are integrated forward in time on the
+// image of the orbit by the symmetry (x, -y, -z, -vx, vy, vz) of the problem, and
+// mapped back here.
+static ThreeBodySample branchSample(double t, const ThreeBodyState& s, bool stable)
+{
+    double sign = stable ? -1.0 : 1.0;
+    ThreeBodySample sample;
+    sample.time = t;
+    sample.state.position = Vector3d(s(0), sign * s(1), sign * s(2));
+    sample.state.velocity = Vector3d(sign * s(3), s(4), s(5));
+    return sample;
+}
+
+
+HaloManifoldEngine::HaloManifoldEngine(double massParameter, const ThreeBodyTrajectory& haloOrbit, double librationPointX) :
+    m_massParameter(massParameter),
+    m_haloOrbit(haloOrbit),
+    m_librationPointX(librationPointX),
+    m_epsilon(0.0),
+    m_eigenvalue(0.0),
+    m_duration(0.0),
+    m_points(2),
+    m_tolerance(1.0e-9)
+{
+}
+
+
+void HaloManifoldEngine::setDeviation(double epsilon, double eigenvalue)
+{
+    m_epsilon = epsilon;
+    m_eigenvalue = eigenvalue;
+}
+
+
+void HaloManifoldEngine::setIntegrationTime(double duration, int points)
+{
+    m_duration = duration;
+    m_points = qMax(2, points);
+}
+
+
+ManifoldBranch HaloManifoldEngine::computeBranch(Kind kind, int orbitPoint) const
+{
+    ManifoldBranch branch;
+    branch.orbitPoint = orbitPoint;
+    branch.completed = false;
+
+    bool stable = m_eigenvalue < 1.0;
+    const sta::StateVector& haloState = m_haloOrbit.at(orbitPoint).state;
+    double scale = 1.0 - m_epsilon * m_eigenvalue;
+    double sign = stable ? -1.0 : 1.0;
+
+    ThreeBodyState state;
+    state(0) = scale * haloState.position.x();
+    state(1) = sign * scale * haloState.position.y();
+    state(2) = sign * scale * haloState.position.z();
+    state(3) = sign * scale * haloState.velocity.x();
+    state(4) = scale * haloState.velocity.y();
+    state(5) = scale * haloState.velocity.z();
+
+    // Without an integration time, the branch ends on the plane x = xPrimary of the
+    // primary it goes to; crossing is the sign change of direction * (x - xPrimary).
+    bool toPrimary = m_duration <= 0.0;
+    double xPrimary;
+    double direction;
+    if (m_librationPointX > 1.0)
+    {
+        xPrimary = 1.0 - m_massParameter;
+        direction = 1.0;
+    }
+    else if (kind == RightStable || kind == RightUnstable)
+    {
+        xPrimary = 1.0 - m_massParameter;
+        direction = -1.0;
+    }
+    else
+    {
+        xPrimary = -m_massParameter;
+        direction = 1.0;
+    }
+
+    double endTime = toPrimary ? MaximumCrossingTime : m_duration;
+    double outputStep = toPrimary ? CrossingOutputStep : m_duration / (m_points - 1);
+
+    ThreeBodyDerivativeCalculator calculator(m_massParameter);
+    ThreeBodyState derivative;
+    calculator.compute(state, 0.0, derivative);
+
+    double t = 0.0;
+    double step = 1.0e-3 * outputStep;
+    int nextOutput = 1;
+    branch.samples.append(branchSample(0.0, state, stable));
+
+    for (int steps = 0; steps < MaximumSteps && t < endTime; steps++)
+    {
+        bool lastStep = step >= endTime - t;
+        double h = lastStep ? endTime - t : step;
+        ThreeBodyState newState;
+        ThreeBodyState newDerivative;
+        ThreeBodyDenseOutput dense;
+        double error = dopri54(state, derivative, t, h, m_tolerance, m_tolerance,
+                               &calculator, newState, newDerivative, &dense);
+
+        double factor = qBound(0.2, 0.9 * pow(qMax(error, 1.0e-10), -0.2), 5.0);
+        if (error > 1.0 && h > MinimumStep)
+        {
+            step = qMax(MinimumStep, h * factor);
+            continue;
+        }
+        if (h < step)
+            step = qMax(step, h * factor);    // step shortened to end on the end time
+        else
+            step = h * factor;
+
+        double stepEnd = lastStep ? endTime : t + h;
+        double crossingTime = -1.0;
+        if (toPrimary)
+        {
+            double g0 = direction * (state(0) - xPrimary);
+            double g1 = direction * (newState(0) - xPrimary);
+            if (g0 > 0.0 && g1 <= 0.0)
+            {
+                // Illinois method on the continuous extension of the step
+                double t0 = t;
+                double t1 = stepEnd;
+                int side = 0;
+                for (int i = 0; i < 100 && t1 - t0 > CrossingTolerance; i++)
+                {
+                    double tc = (t0 * g1 - t1 * g0) / (g1 - g0);
+                    double g = direction * (dense.interpolate(tc)(0) - xPrimary);
+                    if (g > 0.0)
+                    {
+                        t0 = tc;
+                        g0 = g;
+                        if (side == -1)
+                            g1 *= 0.5;
+                        side = -1;
+                    }
+                    else
+                    {
+                        t1 = tc;
+                        g1 = g;
+                        if (side == 1)
+                            g0 *= 0.5;
+                        side = 1;
+                    }
+                }
+                crossingTime = t1;
+                stepEnd = t1;
+            }
+        }
+
+        // Output times covered by the step, the last one exactly on the end time
+        for (;;)
+        {
+            double outputTime = (!toPrimary && nextOutput == m_points - 1) ? m_duration : nextOutput * outputStep;
+            if (outputTime > stepEnd || (!toPrimary && nextOutput >= m_points))
+                break;
+            branch.samples.append(branchSample(outputTime, dense.interpolate(outputTime), stable));
+            nextOutput++;
+        }
+
+        if (crossingTime >= 0.0)
+        {
+            branch.samples.append(branchSample(crossingTime, dense.interpolate(crossingTime), stable));
+            branch.completed = true;
+            return branch;
+        }
+
+        t = stepEnd;
+        state = newState;
+        derivative = newDerivative;
+    }
+
+    branch.completed = !toPrimary && nextOutput >= m_points;
+    return branch;
+}
+
+
+// Which manifold branch to integrate, and from which point of the halo orbit
+struct ManifoldBranchCase
+{
+    const HaloManifoldEngine* engine;
+    HaloManifoldEngine::Kind kind;
+    int orbitPoint;
+};
+
+static ManifoldBranch computeManifoldBranch(const ManifoldBranchCase& branchCase)
+{
+    return branchCase.engine->computeBranch(branchCase.kind, branchCase.orbitPoint);
+}
+
+
+bool HaloManifoldEngine::compute(Kind kind)
+{
+    QList<ManifoldBranchCase> cases;
+    for (int i = 0; i < m_haloOrbit.size(); i++)
+    {
+        ManifoldBranchCase branchCase;
+        branchCase.engine = this;
+        branchCase.kind = kind;
+        branchCase.orbitPoint = i;
+        cases.append(branchCase);
+    }
+
+    m_branches = QtConcurrent::blockingMapped<QList<ManifoldBranch> >(cases, computeManifoldBranch);
+
+    bool completed = true;
+    foreach (const ManifoldBranch& branch, m_branches)
+    {
+        completed = completed && branch.completed;
+    }
+
+    return completed;
+}
+
+
+bool HaloManifoldEngine::writeBranches(const QString& fileName) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "HaloManifoldEngine: unable to write" << fileName;
+        return false;
+    }
+
+    QTextStream out(&file);
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setRealNumberPrecision(16);
+    foreach (const ManifoldBranch& branch, m_branches)
+    {
+        foreach (const ThreeBodySample& sample, branch.samples)
+        {
+            const sta::StateVector& s = sample.state;
+            out << sample.time << " "
+                << s.position.x() << " " << s.position.y() << " " << s.position.z() << " "
+                << s.velocity.x() << " " << s.velocity.y() << " " << s.velocity.z() << "\n";
+        }
+    }
+
+    return file.error() == QFile::NoError;
+}
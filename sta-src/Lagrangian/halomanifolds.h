@@ -0,0 +1,129 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef HALOMANIFOLDS_H
+#define HALOMANIFOLDS_H
+
+#include "Astro-Core/statevector.h"
+#include <QList>
+#include <QString>
+
+
+/**
+ * State of a trajectory of the circular restricted three body problem, in the
+ * normalized rotating frame (unit distance between the primaries, unit mean
+ * motion).
+ */
+struct ThreeBodySample
+{
+    double time;
+    sta::StateVector state;
+};
+
+typedef QList<ThreeBodySample> ThreeBodyTrajectory;
+
+
+/**
+ * One branch of an invariant manifold, started from a point of the halo orbit.
+ */
+struct ManifoldBranch
+{
+    int orbitPoint;      // index of the halo sample the branch starts from
+    bool completed;      // false if the branch never reached its stop condition
+    ThreeBodyTrajectory samples;
+};
+
+
+/**
+ * Computes the stable and unstable manifolds of a halo orbit kept in memory.
+ * Every sample of the orbit is perturbed along the manifold direction and
+ * integrated on its own, with its own integrator state, so the branches of a
+ * manifold tube are computed concurrently on the global thread pool. The
+ * branches are kept in memory; writeBranches() is an optional file sink in the
+ * format of the 3BMmanifold_*.stae files.
+ */
+class HaloManifoldEngine
+{
+public:
+    /**
+     * The manifold kinds, numbered as HaloOrbit::manifolds.kind
+     */
+    enum Kind
+    {
+        RightStable = 1,
+        RightUnstable = 2,
+        LeftStable = 3,
+        LeftUnstable = 4
+    };
+
+    /**
+     * @param massParameter mass parameter of the three body system
+     * @param haloOrbit samples of one period of the halo orbit
+     * @param librationPointX normalized x coordinate of the libration point of the orbit
+     */
+    HaloManifoldEngine(double massParameter, const ThreeBodyTrajectory& haloOrbit, double librationPointX);
+
+    /**
+     * Perturbation of the halo states: each state is scaled by (1 - epsilon*eigenvalue).
+     * An eigenvalue smaller than 1 selects a stable manifold.
+     */
+    void setDeviation(double epsilon, double eigenvalue);
+    /**
+     * Integrate the branches over duration (normalized time) and sample them at
+     * points evenly spaced times. A duration of 0 integrates each branch until it
+     * crosses the plane of the primary on its side of the libration point.
+     */
+    void setIntegrationTime(double duration, int points);
+    void setTolerance(double tolerance) { m_tolerance = tolerance; }
+
+    /**
+     * Compute one branch per halo sample. Return false if a branch failed to reach
+     * the primary; the computed branches are kept in either case.
+     */
+    bool compute(Kind kind);
+    const QList<ManifoldBranch>& branches() const { return m_branches; }
+
+    /**
+     * Integrate the branch started from a halo sample. Only reads the settings
+     * of the engine and can be called from several threads at the same time.
+     */
+    ManifoldBranch computeBranch(Kind kind, int orbitPoint) const;
+
+    /**
+     * Write the branches, one sample "t x y z vx vy vz" per line. Return false
+     * if the file can't be written.
+     */
+    bool writeBranches(const QString& fileName) const;
+
+private:
+    double m_massParameter;
+    ThreeBodyTrajectory m_haloOrbit;
+    double m_librationPointX;
+    double m_epsilon;
+    double m_eigenvalue;
+    double m_duration;
+    int m_points;
+    double m_tolerance;
+    QList<ManifoldBranch> m_branches;
+};
+
+#endif // HALOMANIFOLDS_H
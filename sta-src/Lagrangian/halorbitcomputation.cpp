@@ -25,7 +25,7 @@
  */
 
 #include "math.h"
-#include "Astro-Core/propagateTHREEbody.h"
+#include "Astro-Core/threebodypropagator.h"
 #include "Astro-Core/threebodyParametersComputation.h"
 #include "halorbitcomputation.h"
 #include "trajectoryprinting.h"
@@ -144,172 +144,71 @@ void HaloOrbit::getAnalyticalApprox ()
 
 
 
-MatrixXd STM(6,6);
-
-void HaloOrbit::getNumericalApprox (int system, int &MAX_integration_time)//, const Eigen::MatrixXd STM)
+void HaloOrbit::getNumericalApprox (int system, int &MAX_integration_time)
 
 {
     clock_t start, end;
     start= clock();
-    time_t t0, t1, diff;
     double time_elapsed;
 
-    double paramv[1]={0}; double deriv[42]; double state[42];
+    double state[7];
     trajectory.init_data.State.velocity.x()=trajectory.init_data.State.velocity.z()=trajectory.init_data.State.position.y()=trajectory.init_data.period=0;
     trajectory.final_data.State.velocity.x()=trajectory.final_data.State.velocity.z()=1;
 
-    double timein, timefin, initialtimefin, relerr, abserr, accuracy, count, count2, T, step; int flag, k, q, p, l=0;
-    relerr=abserr=accuracy=1E-9; timefin=0; initialtimefin=0.25; //period   // 0.25!!!!!!!!!!!!!!!!!!!!!!! per velocizzare 1.0
-
-    double correction[6]; double z_correction, x_correction; double deriv_vel[3];
+    double timefin, T=0; int p;
 
-    if (trajectory.init_data.State.velocity.y()<0) //check the initial y-velocity sign
-    {l=1;}
+    //the half period and its state transition matrix are propagated together, by the reentrant propagator
+    ThreeBodyPropagator propagator(Grav_Param);
+    propagator.setTolerance(1E-9, 1E-9);
 
     while (fabs(trajectory.final_data.State.velocity.x())>10e-8 || fabs( trajectory.final_data.State.velocity.z())>10e-8) //stop condition
     {
-        T=0; step=0.01;
-        ////qdebug()<<"before change"<<timefin;
-        //if (timefin>initialtimefin)
-            //timefin=timefin-0.8;
-        //else
-//            timefin=initialtimefin;
-        timefin=0.3;
-        count=1;
-
-       while (count>0)
+       ThreeBodyPropagator::State halfState;
+       halfState << trajectory.init_data.State.position.x(), trajectory.init_data.State.position.y(), trajectory.init_data.State.position.z(),
+                    trajectory.init_data.State.velocity.x(), trajectory.init_data.State.velocity.y(), trajectory.init_data.State.velocity.z();
+       ThreeBodyPropagator::Matrix6 halfSTM = ThreeBodyPropagator::Matrix6::Identity();
+
+       //first crossing of the xz plane after 0.3, i.e. half of the period
+       if (!propagator.propagateToPlaneCrossing(halfState, halfSTM, timefin, 0.3, 10.0))
        {
-           flag=1; timein=0; timefin=timefin+step;
-           for (p=0; p<42; p++)
-           {
-               state[p]=0;
-               deriv[p]=0;
-           }
-               state[1]=trajectory.init_data.State.velocity.y(); state[5]=trajectory.init_data.State.position.z();
-               state[0]=trajectory.init_data.State.velocity.x(); state[2]=trajectory.init_data.State.velocity.z();
-               state[3]=trajectory.init_data.State.position.x(); state[4]=trajectory.init_data.State.position.y();
-
-               state[41]=state[6]=state[13]=state[20]=state[27]=state[34]=1;
-               //qDebug()<<"step0"<<state[0]<<state[1]<<state[2]<<state[3]<<state[4]<<state[5];
-
-               while (flag!=2)
-               {
-                   flag=Runge_Kutta_Fehlberg(halorbit_EOM, 42, state, paramv, deriv, &timein, timefin, &relerr, abserr, flag);
-                   if (flag==4)
-                       flag=Runge_Kutta_Fehlberg(halorbit_EOM, 42, state, paramv, deriv, &timein, timefin, &relerr, abserr, flag);
-               }
-               //qDebug()<<"step1"<<state[0]<<state[1]<<state[2]<<state[3]<<state[4]<<state[5];
-               count=state[4];
-               if (l==1)
-                   count=-state[4];
+           trajectory.error=1;
+           return;
        }
 
-       count2=1;
        end= clock(); time_elapsed=(double(end-start))/CLOCKS_PER_SEC;
-
        if (time_elapsed>MAX_integration_time)
        {
-           ////qdebug()<<"Max time allowed:"<<MAX_integration_time<<"time elapsed"<<time_elapsed;
            trajectory.error=1;
            return;
        }
 
-       while (fabs(count2)>10e-12)
-       {
-           timefin=timefin-step;
-           step=step/10.0;
-           count2=1;
-           while (count2>0)
-           {
-               for (p=0; p<42; p++)
-               {
-                   state[p]=0;
-                   deriv[p]=0;
-               }
-                   flag=1; timein=0; timefin=timefin+step;
-                   state[1]=trajectory.init_data.State.velocity.y(); state[5]=trajectory.init_data.State.position.z();
-                   state[0]=trajectory.init_data.State.velocity.x(); state[2]=trajectory.init_data.State.velocity.z();
-                   state[3]=trajectory.init_data.State.position.x(); state[4]=trajectory.init_data.State.position.y();
-                   state[41]=state[6]=state[13]=state[20]=state[27]=state[34]=1;
-                   //qDebug()<<"step2"<<state[0]<<state[1]<<state[2]<<state[3]<<state[4]<<state[5];
-
-
-                   while (flag!=2)
-                   {
-                       flag=Runge_Kutta_Fehlberg(halorbit_EOM, 42, state, paramv, deriv, &timein, timefin, &relerr, abserr, flag);
-                       if (flag==4)
-                           flag=Runge_Kutta_Fehlberg(halorbit_EOM, 42, state, paramv, deriv, &timein, timefin, &relerr, abserr, flag);
-                   }
-                   //qDebug()<<"step3"<<state[0]<<state[1]<<state[2]<<state[3]<<state[4]<<state[5];
-
-                   count2=state[4];
-                   if (l==1)
-                       count2=-state[4];
-
-                   end=clock(); time_elapsed=(double(end-start))/CLOCKS_PER_SEC;
-
-                   if (time_elapsed>MAX_integration_time)
-                   {
-                       ////qdebug()<<"Max time allowed:"<<MAX_integration_time<<"time elapsed"<<time_elapsed;
-                       trajectory.error=1;
-                       return;
-                   }
-            }
-
-           trajectory.final_data.State.velocity.x()=state[0]; trajectory.final_data.State.velocity.y()=state[1]; trajectory.final_data.State.velocity.z()=state[2];
-           trajectory.final_data.State.position.x()=state[3]; trajectory.final_data.State.position.y()=state[4]; trajectory.final_data.State.position.z()=state[5];
-           trajectory.final_data.period=T=2*timefin;
-           correction[0]=state[12]; correction[1]=state[14]; correction[2]=state[24]; correction[3]=state[26]; correction[4]=state[36]; correction[5]=state[38];
-       }
+       trajectory.final_data.State.position=Vector3d(halfState(0), halfState(1), halfState(2));
+       trajectory.final_data.State.velocity=Vector3d(halfState(3), halfState(4), halfState(5));
+       trajectory.final_data.period=T=2*timefin;
 
-       ////qdebug()<<"initial state"<<trajectory.init_data.State.position.x()<<trajectory.init_data.State.position.z()<<trajectory.init_data.State.velocity.y();
-       ////qdebug()<<"final state"<<trajectory.final_data.State.position.y()<<trajectory.final_data.State.velocity.x()<<trajectory.final_data.State.velocity.z()<<timefin;
-       double C;
-       Jacobi (Grav_Param, trajectory.final_data.State.position.x(), trajectory.final_data.State.position.y(), trajectory.final_data.State.position.z(), trajectory.final_data.State.velocity.x(), trajectory.final_data.State.velocity.y(), trajectory.final_data.State.velocity.z(),C);
-       ////qdebug()<<"C"<<C;
        if (fabs(trajectory.final_data.State.velocity.x())<10e-8 && fabs(trajectory.final_data.State.velocity.z())<10e-8)
        {
-           for (k=0;k<6;k++)
-           {
-               for (p=0;p<6;p++)
-               {
-                   STM(k,p)=state[6*(k+1)+p];
-               }
-           }
+           STM=halfSTM;
        }
        else
        {
-           double r1, r2;
-           r1=sqrt(pow(trajectory.final_data.State.position.x()+Grav_Param,2)+pow(trajectory.final_data.State.position.y(),2)+pow(trajectory.final_data.State.position.z(),2));
-           r2=sqrt(pow(trajectory.final_data.State.position.x()-1+Grav_Param,2)+pow(trajectory.final_data.State.position.y(),2)+pow(trajectory.final_data.State.position.z(),2));
-           deriv_vel[0]=2*trajectory.final_data.State.velocity.y()+trajectory.final_data.State.position.x()-(1-Grav_Param)*(trajectory.final_data.State.position.x()+Grav_Param)/(pow(r1,3))+ Grav_Param*(1-Grav_Param-trajectory.final_data.State.position.x())/(pow(r2,3));
-           deriv_vel[2]=-(1-Grav_Param)*trajectory.final_data.State.position.z()/(pow(r1,3))-Grav_Param*trajectory.final_data.State.position.z()/(pow(r2,3));
-
-           MatrixXd correction_matrix(2,2);
-           for (k=0; k<4; k++)
-           {
-               q=(k+2)/2;
-               int col = (k+1)/2-(q-1);
-               correction_matrix(q-1,col)=correction[k+2]-deriv_vel[2*(q-1)]*correction[k-2*(q-1)]/trajectory.final_data.State.velocity.y();
-               //correction_matrix[k]=correction[k+2]-deriv_vel[2*(q-1)]*correction[k-2*(q-1)]/trajectory.final_data.State.velocity.y();
-           }
-           //correction_matrix.inverse();
-           ////qdebug()<<"inverse!"<<correction_matrix.inverse()(0,0)<<correction_matrix.inverse()(0,1)<<correction_matrix.inverse()(1,0)<<correction_matrix.inverse()(1,1);
-           //determinant= correction_matrix[0]*correction_matrix[3]-correction_matrix[2]*correction_matrix[1];
-           //inverse_correction_matrix[0]=correction_matrix[3]/determinant;
-           //inverse_correction_matrix[1]=-correction_matrix[1]/determinant;
-           //inverse_correction_matrix[2]=-correction_matrix[2]/determinant;
-           //inverse_correction_matrix[3]=correction_matrix[0]/determinant;
-
-               //x_correction=-inverse_correction_matrix[0]*trajectory.final_data.State.velocity.x()-inverse_correction_matrix[1]*trajectory.final_data.State.velocity.z();
-               //z_correction=-inverse_correction_matrix[2]*trajectory.final_data.State.velocity.x()-inverse_correction_matrix[3]*trajectory.final_data.State.velocity.z();
-           x_correction=-correction_matrix.inverse()(0,0)*trajectory.final_data.State.velocity.x()-correction_matrix.inverse()(0,1)*trajectory.final_data.State.velocity.z();
-           z_correction=-correction_matrix.inverse()(1,0)*trajectory.final_data.State.velocity.x()-correction_matrix.inverse()(1,1)*trajectory.final_data.State.velocity.z();
-               trajectory.init_data.State.position.x()=trajectory.init_data.State.position.x()+x_correction;
-               trajectory.init_data.State.position.z()=trajectory.init_data.State.position.z()+z_correction;
-       }
-
+           //correction of x0 and z0 cancelling vx and vz at the crossing, the crossing time moving with y
+           ThreeBodyPropagator::State halfDeriv=propagator.derivatives(halfState);
+           double vy=halfState(4);
+
+           Matrix2d correction_matrix;
+           correction_matrix(0,0)=halfSTM(3,0)-halfDeriv(3)*halfSTM(1,0)/vy;
+           correction_matrix(0,1)=halfSTM(3,2)-halfDeriv(3)*halfSTM(1,2)/vy;
+           correction_matrix(1,0)=halfSTM(5,0)-halfDeriv(5)*halfSTM(1,0)/vy;
+           correction_matrix(1,1)=halfSTM(5,2)-halfDeriv(5)*halfSTM(1,2)/vy;
+
+           Matrix2d inverse=correction_matrix.inverse();
+           double x_correction=-inverse(0,0)*halfState(3)-inverse(0,1)*halfState(5);
+           double z_correction=-inverse(1,0)*halfState(3)-inverse(1,1)*halfState(5);
+           trajectory.init_data.State.position.x()=trajectory.init_data.State.position.x()+x_correction;
+           trajectory.init_data.State.position.z()=trajectory.init_data.State.position.z()+z_correction;
        }
+    }
 
 //qdebug()<<"here|";
         int trajectory_error=0;
@@ -318,7 +217,8 @@ void HaloOrbit::getNumericalApprox (int system, int &MAX_integration_time)//, co
         QString save_path = "3BMhalorbit";
         halo_input_data=save_path=save_path+QString::number(trajectory.init_data.Ax_amplitude,'f',0)+QString::number(trajectory.init_data.Az_amplitude,'f',0)+".stae";
         halo_num_positions=trajectory.Num_positions;
-        trajectory_integration(state, trajectory.Num_positions, save_path, trajectory_error);
+        haloSamples.clear();
+        trajectory_integration(state, trajectory.Num_positions, save_path, trajectory_error, &haloSamples);
         ////qdebug() << "halo file: " << save_path;
 
         if (trajectory_error==2) //if the halo trajectory.txt has been not opened a message error must be given
@@ -346,19 +246,17 @@ void HaloOrbit::getNumericalApprox (int system, int &MAX_integration_time)//, co
         threeBMsystemFile.close();
         ////qdebug()<<file;
 
-        //computation of the real amplitudes obtained for the halo orbit
-        QFile haloFile1(save_path);
-        if (!haloFile1.open(QIODevice::ReadOnly | QIODevice::Text))
+        //computation of the real amplitudes obtained for the halo orbit, from the samples kept in memory
+        if (haloSamples.size()!=trajectory.Num_positions)
             {trajectory.error=3;
                 return;
             }
 
-        QTextStream in(&haloFile1);
-        double t,Vx,Vy,Vz,x,y,z,X_max=0, X_min=10,Z_max=0, Z_min=10;
+        double x,z,X_max=0, X_min=10,Z_max=0, Z_min=10;
         for (p=0;p<trajectory.Num_positions;p++) //search for the maximum and minimum values of x and z coordinates
                 {
-                in>>t>>x>>y>>z>>Vx>>Vy>>Vz;
-                //qDebug()<<x<<z;
+                x=haloSamples.at(p).state.position.x();
+                z=haloSamples.at(p).state.position.z();
                 if (x<X_min)
                         X_min=x;
                 if (x>X_max)
@@ -368,7 +266,6 @@ void HaloOrbit::getNumericalApprox (int system, int &MAX_integration_time)//, co
                 if (z>Z_max)
                         Z_max=z;
                 }
-        haloFile1.close();
 
         trajectory.final_data.Ax_amplitude=(fabs(X_max)-fabs(X_min))/2;	trajectory.final_data.Az_amplitude=(fabs(Z_max)+fabs(Z_min))/2; //computation of the amplitudes obtained
         if (trajectory.init_data.Az_amplitude<0)
@@ -385,8 +282,7 @@ void HaloOrbit::getNumericalApprox (int system, int &MAX_integration_time)//, co
 void HaloOrbit::getManifolds (double eigen, int points_number, double period_manifolds, int &first)
 
 {
-        double initial_condition_perturbed[7], initial_condition_0[7]; const char * manifolds_save_path;
-        initial_condition_perturbed[6]=period_manifolds;
+        const char * manifolds_save_path;
 
         QFile file_manifolds_settings ("3BMmanifolds_settings.stam");
         if (first==1)
@@ -420,42 +316,40 @@ void HaloOrbit::getManifolds (double eigen, int points_number, double period_man
                 settings<<points_number<<"\n";	//the number of positions per orbit is printed in case a time of integration has been specified
         file_manifolds_settings.close();
 
-        int i;
-       /////// if(trajectory.Num_positions>0) //normal manifolds computation
-
-
-             QString halo_data = "3BMhalorbit";
-        halo_data=halo_data+QString::number(trajectory.init_data.Ax_amplitude,'f',0)+QString::number(trajectory.init_data.Az_amplitude,'f',0)+".stae";
-        QFile file_halo2(halo_data);
-        if (!file_halo2.open(QIODevice::ReadOnly | QIODevice::Text))
+        //the manifold branches are integrated concurrently from the halo samples kept in memory
+        if (haloSamples.isEmpty())
         {
             manifolds.error=1;
             return;
         }
-        QTextStream in(&file_halo2);
-        for (i=1;i<trajectory.Num_positions+1;i++)
-                {
-                in>>initial_condition_0[6]>>initial_condition_0[3]>>initial_condition_0[4]>>initial_condition_0[5]>>initial_condition_0[0]>>initial_condition_0[1]>>initial_condition_0[2];
 
-                for (int j=0;j<6;j++)
-                        {initial_condition_perturbed[j]=initial_condition_0[j]-manifolds.epsilon*eigen*initial_condition_0[j];}
-                if (eigen<1) //condition in case of stable manifolds
-                {
-                    initial_condition_perturbed[0]=-initial_condition_perturbed[0];
-                    initial_condition_perturbed[4]=-initial_condition_perturbed[4];
-                    initial_condition_perturbed[5]=-initial_condition_perturbed[5];
-                    i=-i;
-                }
-                ////qdebug()<<"Debug| Bon"<<initial_condition_perturbed[0]<<initial_condition_perturbed[1]<<initial_condition_perturbed[2]<<initial_condition_perturbed[3]<<initial_condition_perturbed[4]<<initial_condition_perturbed[5]<<initial_condition_perturbed[6]<<points_number<<manifolds_save_path<<manifolds.error<<i<<trajectory.Lpoint_Xposition<<manifolds.kind;
-                manifolds_integration(initial_condition_perturbed, points_number, manifolds_save_path, manifolds.error, i, trajectory.Lpoint_Xposition, manifolds.kind);
-                i=abs(i);
-                if (manifolds.error!=0)
-                    return;
-                }
+        HaloManifoldEngine engine(Grav_Param, haloSamples, trajectory.Lpoint_Xposition/bodies_distance);
+        engine.setDeviation(manifolds.epsilon, eigen);
+        engine.setIntegrationTime(period_manifolds, points_number);
+        if (!engine.compute((HaloManifoldEngine::Kind)manifolds.kind))
+        {
+            manifolds.error=6; //a branch never reached the main body
+            return;
+        }
+
+        if (!engine.writeBranches(manifolds_save_path))
+        {
+            manifolds.error=2;
+            return;
+        }
 
-                file_halo2.close();
-                if (i!=trajectory.Num_positions+1)
-                manifolds.error=5;
+        if (period_manifolds==0) //the number of positions of each branch is printed, since they end at the intersection with a main body
+        {
+            if (!file_manifolds_settings.open(QIODevice::Append | QIODevice::Text))
+            {
+                manifolds.error=4;
+                return;
+            }
+            QTextStream branchSettings(&file_manifolds_settings);
+            foreach (const ManifoldBranch& branch, engine.branches())
+                branchSettings<<branch.samples.size()<<"\n";
+            file_manifolds_settings.close();
+        }
 
         /* manifolds computation in case of transfer optimization
            in this case only on trajectory is randomly computed
@@ -26,6 +26,7 @@
 
 
 #include "Astro-Core/statevector.h"
+#include "halomanifolds.h"
 #include <Eigen/LU>
 
 using namespace Eigen;
@@ -73,10 +74,8 @@ void getEigenvalues ();
 
     trajectory trajectory;
     manifolds  manifolds;
-
-public:
-    //MatrixXd STM;
-    //Eigen::MatrixXd STM();
+    ThreeBodyTrajectory haloSamples;   //samples of one period of the halo orbit, computed by getNumericalApprox
+    MatrixXd STM;                      //state transition matrix over half of the period, used by getEigenvalues
 
 };
 
@@ -37,10 +37,19 @@
 #include "Loitering/loitering.h"
 
 #include "Astro-Core/stamath.h"
+#include "Astro-Core/stabody.h"
+#include "Astro-Core/threebodyParametersComputation.h"
+#include "Lagrangian/halofamily.h"
 
 #include "Main/mainwindow.h"
 #include "Main/scenariotree.h"
 
+#include <QFileDialog>
+#include <QMessageBox>
+#include <QApplication>
+
+#include <cmath>
+
 
 
 
@@ -119,3 +128,84 @@ void lagrangianDialog::on_buttonBox_rejected()
 	qWarning("TODO: %s	%d",__FILE__,__LINE__);
 }
 
+
+/** Continue the planar Lyapunov family of the selected libration point from
+  * a small linearized orbit, and write it to a file chosen by the user.
+  */
+void lagrangianDialog::on_computeFamilyButton_clicked()
+{
+    const StaBody* primary;
+    const StaBody* secondary;
+    if (systemComboBox->currentIndex() == 0)
+    {
+        primary = STA_SOLAR_SYSTEM->lookup(STA_EARTH);
+        secondary = STA_SOLAR_SYSTEM->lookup(STA_MOON);
+    }
+    else
+    {
+        primary = STA_SOLAR_SYSTEM->lookup(STA_SUN);
+        secondary = STA_SOLAR_SYSTEM->lookup(STA_EARTH);
+    }
+
+    // Distance between the primaries, in km
+    double distance = secondary->distance();
+    double massParameter = getGravParam_user(primary->mu(), secondary->mu());
+
+    // The linearized seed only holds well inside the region around the
+    // secondary bounded by L1 and L2, roughly its Hill radius
+    double hillRadius = distance * pow(massParameter / 3.0, 1.0 / 3.0);
+
+    bool amplitudeOk = false;
+    bool stepOk = false;
+    double amplitude = seedAmplitudeLineEdit->text().toDouble(&amplitudeOk);
+    double step = stepLineEdit->text().toDouble(&stepOk);
+    if (!amplitudeOk || amplitude <= 0.0 || amplitude >= hillRadius)
+    {
+        QMessageBox::warning(this, tr("Lyapunov orbit family"),
+                             tr("The seed amplitude must be a positive number of km below %1.").arg(hillRadius, 0, 'f', 0));
+        return;
+    }
+    if (!stepOk || step == 0.0)
+    {
+        QMessageBox::warning(this, tr("Lyapunov orbit family"), tr("The step must be a non-zero number."));
+        return;
+    }
+    amplitude /= distance;
+
+    sta::StateVector seed;
+    double period;
+    HaloFamilyContinuation::lyapunovSeed(massParameter, librationPointComboBox->currentIndex() + 1, amplitude, seed, period);
+
+    HaloFamilyContinuation continuation(massParameter);
+    continuation.setParameter(HaloFamilyContinuation::ArcLength);
+    continuation.setStep(step);
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    bool seeded = continuation.setSeed(seed, period);
+    bool completed = seeded && continuation.compute(membersSpinBox->value());
+    QApplication::restoreOverrideCursor();
+
+    if (!seeded)
+    {
+        QMessageBox::warning(this, tr("Lyapunov orbit family"), tr("The seed orbit can't be corrected, try a smaller amplitude."));
+        return;
+    }
+
+    const HaloFamily& family = continuation.family();
+    QString result = tr("%1 members, Jacobi constant from %2 to %3, period from %4 to %5 (normalized units).")
+                     .arg(family.size())
+                     .arg(family.first().jacobiConstant).arg(family.last().jacobiConstant)
+                     .arg(family.first().period).arg(family.last().period);
+    if (!completed)
+    {
+        result += " " + tr("The continuation stopped early.");
+    }
+    familyResultLabel->setText(result);
+
+    QString fileName = QFileDialog::getSaveFileName(this, tr("Save Lyapunov orbit family"), QString(), tr("Text files (*.txt)"));
+    if (!fileName.isEmpty() && !continuation.writeFamily(fileName))
+    {
+        QMessageBox::warning(this, tr("Lyapunov orbit family"), tr("Unable to write %1").arg(fileName));
+    }
+}
+
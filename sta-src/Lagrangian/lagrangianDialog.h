@@ -48,6 +48,7 @@ public:
 protected slots:
 	void on_buttonBox_accepted();
 	void on_buttonBox_rejected();
+	void on_computeFamilyButton_clicked();
 
 private:
     MainWindow* mainwindow;
@@ -28,9 +28,8 @@
 #define TRAJECTORYPRINTING_H
 
 #include <QString>
+#include "halomanifolds.h"
 
-void trajectory_integration (double state[], int &points, QString &file, int &trajectory_error);
-
-void manifolds_integration (const double state[], int &points, const char * file, int &trajectory_error, int &i, double Lpoint_Xposition, int manifold_kind);
+void trajectory_integration (double state[], int &points, QString &file, int &trajectory_error, ThreeBodyTrajectory* samples = NULL);
 
 #endif // TRAJECTORYPRINTING_H
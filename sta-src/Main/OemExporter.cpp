@@ -0,0 +1,296 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "OemExporter.h"
+#include "propagatedscenario.h"
+#include <QDateTime>
+#include <QDebug>
+#include <cmath>
+#include <cstring>
+
+static const int BufferSize = 256 * 1024;
+
+// MJD of 1970-01-01
+static const int MjdUnixEpoch = 40587;
+
+static const double DecimalScale[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
+};
+
+
+// Format an unsigned number right aligned in the width characters before end,
+// padded with zeros, and return the position of its first character.
+static char* FormatDigits(char* end, quint64 value, int width)
+{
+    char* p = end;
+    do
+    {
+        *--p = char('0' + value % 10);
+        value /= 10;
+    } while (value != 0 || end - p < width);
+
+    return p;
+}
+
+
+EphemerisWriter::EphemerisWriter(QIODevice* device) :
+    m_device(device),
+    m_buffer(BufferSize, '\0'),
+    m_used(0),
+    m_error(false)
+{
+}
+
+
+EphemerisWriter::~EphemerisWriter()
+{
+    flush();
+}
+
+
+void
+EphemerisWriter::reserve(int size)
+{
+    if (m_used + size > m_buffer.size())
+    {
+        flush();
+    }
+}
+
+
+bool
+EphemerisWriter::flush()
+{
+    if (m_used > 0 && !m_error)
+    {
+        m_error = m_device->write(m_buffer.constData(), m_used) != m_used;
+    }
+    m_used = 0;
+
+    return !m_error;
+}
+
+
+void
+EphemerisWriter::write(char c)
+{
+    reserve(1);
+    m_buffer.data()[m_used++] = c;
+}
+
+
+void
+EphemerisWriter::write(const char* text)
+{
+    int length = int(strlen(text));
+    if (length > m_buffer.size())
+    {
+        flush();
+        m_error = m_error || m_device->write(text, length) != length;
+        return;
+    }
+
+    reserve(length);
+    memcpy(m_buffer.data() + m_used, text, length);
+    m_used += length;
+}
+
+
+void
+EphemerisWriter::write(const QString& text)
+{
+    write(text.toLatin1().constData());
+}
+
+
+/** The value is scaled to an integer count of units of the last decimal and
+  * formatted with integer arithmetic. Because of the rounding of the scaling,
+  * a value very close to halfway between two decimals may end one unit of
+  * the last decimal away from the printf result. The values too large for a
+  * 64-bit count are formatted by Qt.
+  */
+void
+EphemerisWriter::writeFixed(double value, int decimals)
+{
+    decimals = qBound(0, decimals, 9);
+    double scaled = value * DecimalScale[decimals];
+    if (!(fabs(scaled) < 1.0e18))
+    {
+        write(QString::number(value, 'f', decimals));
+        return;
+    }
+
+    qint64 units = qRound64(scaled);
+    quint64 magnitude = units < 0 ? quint64(-units) : quint64(units);
+
+    char text[32];
+    char* end = text + sizeof(text);
+    quint64 scale = quint64(DecimalScale[decimals]);
+    char* p = end;
+    if (decimals > 0)
+    {
+        p = FormatDigits(end, magnitude % scale, decimals);
+        *--p = '.';
+    }
+    p = FormatDigits(p, magnitude / scale, 1);
+    if (units < 0)
+    {
+        *--p = '-';
+    }
+
+    int length = int(end - p);
+    reserve(length);
+    memcpy(m_buffer.data() + m_used, p, length);
+    m_used += length;
+}
+
+
+void
+EphemerisWriter::writeCalendarDate(double mjd)
+{
+    // Split the date in days and microseconds of the day before converting it
+    double day = floor(mjd);
+    qint64 microseconds = qRound64((mjd - day) * 86400.0e6);
+    if (microseconds >= Q_INT64_C(86400000000))
+    {
+        day += 1.0;
+        microseconds -= Q_INT64_C(86400000000);
+    }
+
+    // Civil date of a day count from 1970-01-01 (proleptic Gregorian calendar)
+    qint64 z = qint64(day) - MjdUnixEpoch + 719468;
+    qint64 era = (z >= 0 ? z : z - 146096) / 146097;
+    qint64 dayOfEra = z - era * 146097;
+    qint64 yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    qint64 dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    qint64 mp = (5 * dayOfYear + 2) / 153;
+    int dayOfMonth = int(dayOfYear - (153 * mp + 2) / 5 + 1);
+    int month = int(mp < 10 ? mp + 3 : mp - 9);
+    int year = int(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+
+    qint64 seconds = microseconds / 1000000;
+
+    char text[32];
+    char* end = text + sizeof(text);
+    char* p = FormatDigits(end, quint64(microseconds % 1000000), 6);
+    *--p = '.';
+    p = FormatDigits(p, quint64(seconds % 60), 2);
+    *--p = ':';
+    p = FormatDigits(p, quint64(seconds / 60 % 60), 2);
+    *--p = ':';
+    p = FormatDigits(p, quint64(seconds / 3600), 2);
+    *--p = 'T';
+    p = FormatDigits(p, quint64(dayOfMonth), 2);
+    *--p = '-';
+    p = FormatDigits(p, quint64(month), 2);
+    *--p = '-';
+    p = FormatDigits(p, quint64(qMax(0, year)), 4);
+
+    int length = int(end - p);
+    reserve(length);
+    memcpy(m_buffer.data() + m_used, p, length);
+    m_used += length;
+}
+
+
+OemExporter::OemExporter(QIODevice* device) :
+    m_device(device)
+{
+}
+
+
+/** Write the mission arcs of a space object, one OEM segment per arc.
+  *
+  * \return false if the trajectory couldn't be written; details of the
+  * problem are available via the errorMessage() method.
+  */
+bool
+OemExporter::exportSpaceObject(const SpaceObject* spaceObject)
+{
+    m_errorMessage.clear();
+
+    EphemerisWriter out(m_device);
+
+    out.write("CCSDS_OEM_VERS = 2.0\n");
+    out.write("CREATION_DATE = ");
+    out.write(QDateTime::currentDateTime().toUTC().toString("yyyy-MM-ddThh:mm:ss"));
+    out.write("\nORIGINATOR = STA\n");
+
+    foreach (MissionArc* arc, spaceObject->mission())
+    {
+        int sampleCount = arc->trajectorySampleCount();
+        if (sampleCount == 0 || !arc->centralBody())
+        {
+            continue;
+        }
+
+        sta::CoordinateSystemType frame = arc->coordinateSystem().type();
+        bool convert = frame != sta::COORDSYS_EME_J2000 && frame != sta::COORDSYS_ECLIPTIC_J2000;
+
+        out.write("\nMETA_START\nOBJECT_NAME = ");
+        out.write(spaceObject->name());
+        out.write("\nOBJECT_ID = ");
+        out.write(spaceObject->name());
+        out.write("\nCENTER_NAME = ");
+        out.write(arc->centralBody()->name().toUpper());
+        out.write("\nREF_FRAME = ");
+        out.write(frame == sta::COORDSYS_ECLIPTIC_J2000 ? "ECLIP2000" : "EME2000");
+        out.write("\nTIME_SYSTEM = TDB\nSTART_TIME = ");
+        out.writeCalendarDate(arc->trajectorySampleTime(0));
+        out.write("\nSTOP_TIME = ");
+        out.writeCalendarDate(arc->trajectorySampleTime(sampleCount - 1));
+        out.write("\nMETA_STOP\n\n");
+
+        for (int i = 0; i < sampleCount; ++i)
+        {
+            double mjd = arc->trajectorySampleTime(i);
+            sta::StateVector state = arc->trajectorySample(i);
+            if (convert)
+            {
+                state = arc->coordinateSystem().toEmeJ2000(state, arc->centralBody(), mjd);
+            }
+
+            out.writeCalendarDate(mjd);
+            for (int j = 0; j < 3; ++j)
+            {
+                out.write(' ');
+                out.writeFixed(state.position[j], 6);
+            }
+            for (int j = 0; j < 3; ++j)
+            {
+                out.write(' ');
+                out.writeFixed(state.velocity[j], 9);
+            }
+            out.write('\n');
+        }
+    }
+
+    if (!out.flush())
+    {
+        m_errorMessage = m_device->errorString();
+        qDebug() << "Error while exporting OEM file: " << m_errorMessage;
+        return false;
+    }
+
+    return true;
+}
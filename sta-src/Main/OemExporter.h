@@ -0,0 +1,101 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef _STA_OEM_EXPORTER_H_
+#define _STA_OEM_EXPORTER_H_
+
+#include <QIODevice>
+#include <QByteArray>
+#include <QString>
+
+class SpaceObject;
+
+
+/** EphemerisWriter is a buffered text output for ephemeris files. Numbers
+  * and dates are formatted directly in the buffer, which is written to the
+  * device when it is full.
+  */
+class EphemerisWriter
+{
+public:
+    EphemerisWriter(QIODevice* device);
+    ~EphemerisWriter();
+
+    void write(char c);
+    void write(const char* text);
+    void write(const QString& text);
+
+    /** Write a number with a fixed number of decimals (at most 9).
+      */
+    void writeFixed(double value, int decimals);
+
+    /** Write an MJD as an ISO 8601 calendar date with microseconds:
+      * YYYY-MM-DDThh:mm:ss.ssssss
+      */
+    void writeCalendarDate(double mjd);
+
+    /** Write the buffered text to the device. Return false if there was
+      * an error writing to the device.
+      */
+    bool flush();
+
+    bool hasError() const
+    {
+        return m_error;
+    }
+
+private:
+    void reserve(int size);
+
+private:
+    QIODevice* m_device;
+    QByteArray m_buffer;
+    int m_used;
+    bool m_error;
+};
+
+
+/** OemExporter writes the trajectory of a space object as an OEM (Orbit
+  * Ephemeris Message), CCSDS 502.0-B-2, with one segment per mission arc.
+  *
+  * Times are TDB. The states are written in the EME2000 or ECLIP2000 frame
+  * of the arc; arcs in another frame are converted to EME2000. Positions
+  * are written in km with 6 decimals and velocities in km/s with 9 decimals.
+  */
+class OemExporter
+{
+public:
+    OemExporter(QIODevice* device);
+
+    bool exportSpaceObject(const SpaceObject* spaceObject);
+
+    QString errorMessage() const
+    {
+        return m_errorMessage;
+    }
+
+private:
+    QIODevice* m_device;
+    QString m_errorMessage;
+};
+
+#endif // _STA_OEM_EXPORTER_H_
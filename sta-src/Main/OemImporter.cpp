@@ -24,8 +24,9 @@
 #include "Astro-Core/date.h"
 
 #include <QStringList>
-#include <QRegExp>
+#include <QFile>
 #include <QDebug>
+#include <cstring>
 
 
 struct OemKeyValue
@@ -49,9 +50,249 @@ static OemKeyValue ParseKeyValue(const QString& line)
 }
 
 
-OemImporter::OemImporter(QTextStream* stream) :
-    m_stream(stream),
-    m_lineNumber(1),
+// Powers of ten that are exact doubles
+static const double ExactPowersOfTen[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+static inline bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+
+static inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+
+/** Parse the decimal number in [begin, end). Numbers with at most 15
+  * significant digits and an exponent no larger than 22 (those written in
+  * ephemeris files) are converted exactly: the digits and the power of ten
+  * are exact doubles, so that a single multiplication or division gives the
+  * correctly rounded value. Other numbers are converted by Qt.
+  *
+  * \return false if the text isn't a number
+  */
+static bool ParseDouble(const char* begin, const char* end, double* value)
+{
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    quint64 mantissa = 0;
+    int significantDigits = 0;
+    int exponent = 0;
+    bool digitFound = false;
+    bool exact = true;
+
+    for (; p < end && IsDigit(*p); ++p)
+    {
+        digitFound = true;
+        if (significantDigits < 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa != 0)
+            {
+                significantDigits++;
+            }
+        }
+        else
+        {
+            exponent++;
+            exact = exact && *p == '0';
+        }
+    }
+
+    if (p < end && *p == '.')
+    {
+        for (++p; p < end && IsDigit(*p); ++p)
+        {
+            digitFound = true;
+            if (significantDigits < 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa != 0)
+                {
+                    significantDigits++;
+                }
+                exponent--;
+            }
+            else
+            {
+                exact = exact && *p == '0';
+            }
+        }
+    }
+
+    if (!digitFound)
+    {
+        return false;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        ++p;
+        bool negativeExponent = false;
+        if (p < end && (*p == '-' || *p == '+'))
+        {
+            negativeExponent = *p == '-';
+            ++p;
+        }
+
+        if (p == end || !IsDigit(*p))
+        {
+            return false;
+        }
+
+        int e = 0;
+        for (; p < end && IsDigit(*p); ++p)
+        {
+            e = qMin(e * 10 + (*p - '0'), 100000);
+        }
+        exponent += negativeExponent ? -e : e;
+    }
+
+    if (p != end)
+    {
+        return false;
+    }
+
+    if (exact && mantissa <= (Q_UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double x = double(mantissa);
+        x = exponent < 0 ? x / ExactPowersOfTen[-exponent] : x * ExactPowersOfTen[exponent];
+        *value = negative ? -x : x;
+        return true;
+    }
+
+    bool ok = false;
+    *value = QByteArray::fromRawData(begin, int(end - begin)).toDouble(&ok);
+    return ok;
+}
+
+
+// Parse digitCount digits at p
+static bool ParseInteger(const char* p, const char* end, int digitCount, int* value)
+{
+    if (end - p < digitCount)
+    {
+        return false;
+    }
+
+    int n = 0;
+    for (int i = 0; i < digitCount; ++i)
+    {
+        if (!IsDigit(p[i]))
+        {
+            return false;
+        }
+        n = n * 10 + (p[i] - '0');
+    }
+
+    *value = n;
+    return true;
+}
+
+
+/** Parse an OEM epoch in [begin, end): YYYY-MM-DDThh:mm:ss[.d...][Z] or
+  * YYYY-DDDThh:mm:ss[.d...][Z]. The fraction of second is rounded to
+  * milliseconds, the resolution of QDateTime.
+  */
+static QDateTime ParseEpoch(const char* begin, const char* end)
+{
+    if (end > begin && end[-1] == 'Z')
+    {
+        --end;
+    }
+
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    if (!ParseInteger(begin, end, 4, &year) || end - begin < 5 || begin[4] != '-')
+    {
+        return QDateTime();
+    }
+
+    QDate date;
+    const char* p = begin + 5;
+    if (end - p > 3 && p[3] == 'T' && ParseInteger(p, end, 3, &day))
+    {
+        // Day of year
+        date = QDate(year, 1, 1).addDays(day - 1);
+        if (day < 1 || date.year() != year)
+        {
+            return QDateTime();
+        }
+        p += 3;
+    }
+    else if (ParseInteger(p, end, 2, &month) && end - p > 5 && p[2] == '-' && ParseInteger(p + 3, end, 2, &day))
+    {
+        date = QDate(year, month, day);
+        p += 5;
+    }
+
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    if (!date.isValid() ||
+        end - p < 9 || p[0] != 'T' || p[3] != ':' || p[6] != ':' ||
+        !ParseInteger(p + 1, end, 2, &hour) || !ParseInteger(p + 4, end, 2, &minute) || !ParseInteger(p + 7, end, 2, &second))
+    {
+        return QDateTime();
+    }
+    p += 9;
+
+    int msec = 0;
+    if (p < end)
+    {
+        if (*p != '.')
+        {
+            return QDateTime();
+        }
+
+        // Milliseconds, rounded with the fourth decimal
+        static const int DecimalScale[] = { 100, 10, 1 };
+        for (int decimal = 0; ++p < end; ++decimal)
+        {
+            if (!IsDigit(*p))
+            {
+                return QDateTime();
+            }
+            if (decimal < 3)
+            {
+                msec += (*p - '0') * DecimalScale[decimal];
+            }
+            else if (decimal == 3 && *p >= '5')
+            {
+                msec++;
+            }
+        }
+    }
+
+    QTime time(hour, minute, second);
+    if (!time.isValid())
+    {
+        return QDateTime();
+    }
+
+    return QDateTime(date, time, Qt::UTC).addMSecs(msec);
+}
+
+
+OemImporter::OemImporter(QIODevice* device) :
+    m_device(device),
+    m_position(NULL),
+    m_end(NULL),
+    m_lineNumber(0),
     m_parserState(Oem_Begin)
 {
 }
@@ -74,6 +315,26 @@ OemImporter::OemImporter(QTextStream* stream) :
 SpaceScenario*
 OemImporter::loadScenario()
 {
+    // Files are mapped in memory; other devices are read at once
+    QFile* file = qobject_cast<QFile*>(m_device);
+    uchar* mappedData = NULL;
+    if (file && file->size() > 0)
+    {
+        mappedData = file->map(0, file->size());
+    }
+
+    if (mappedData)
+    {
+        m_position = reinterpret_cast<const char*>(mappedData);
+        m_end = m_position + file->size();
+    }
+    else
+    {
+        m_buffer = m_device->readAll();
+        m_position = m_buffer.constData();
+        m_end = m_position + m_buffer.size();
+    }
+
     readHeader();
     SpaceScenario* scenario = new SpaceScenario();
     scenario->setName("New scenario");
@@ -84,14 +345,14 @@ OemImporter::loadScenario()
     ScenarioExternalType* trajectory;
 
     bool skip = false;
+    const char* lineBegin = NULL;
+    const char* lineEnd = NULL;
     QString line;
 
     QString objectName;
     StaBody* center = NULL;
     sta::CoordinateSystemType coordSys = sta::COORDSYS_INVALID;
 
-    QRegExp whiteSpaceRegExp("\\s+");
-
 
     // This is the state machine for parsing OEM files. Roughly, the structure
     // of an OEM file is:
@@ -112,22 +373,31 @@ OemImporter::loadScenario()
         {
             skip = false;
         }
-        else
+        else if (!readLine(&lineBegin, &lineEnd))
         {
-            line = m_stream->readLine().trimmed();
-            m_lineNumber++;
+            m_parserState = Oem_End;
+            break;
         }
 
-        if (m_stream->atEnd())
+        if (lineBegin == lineEnd)
         {
-            m_parserState = Oem_End;
+            // Nothing to do
         }
-        else if (line.isEmpty())
+        else if (m_parserState == Oem_EphemerisData)
         {
-            // Nothing to do
+            if (lineEnd - lineBegin == 10 && strncmp(lineBegin, "META_START", 10) == 0)
+            {
+                m_parserState = Oem_MetaStart;
+            }
+            else
+            {
+                readEphemerisRecord(lineBegin, lineEnd, trajectory);
+            }
         }
         else
         {
+            line = QString::fromLatin1(lineBegin, int(lineEnd - lineBegin));
+
             switch (m_parserState)
             {
             case Oem_Begin:
@@ -415,75 +685,6 @@ OemImporter::loadScenario()
                 }
                 break;
 
-            case Oem_EphemerisData:
-                if (line == "META_START")
-                {
-                    m_parserState = Oem_MetaStart;
-                }
-                else
-                {
-                    // Parse the ephemeris line
-                    QStringList values = line.split(whiteSpaceRegExp);
-                    if (values.size() != 7)
-                    {
-                        raiseError("Bad or unsupported ephemeris data record");
-                    }
-                    else
-                    {
-                        QDateTime dateTime;
-                        int secondsDecimal = values[0].lastIndexOf('.');
-                        if (secondsDecimal > 0)
-                        {
-                            bool msecOk = false;
-                            double sec = values[0].right(values[0].length() - secondsDecimal).toDouble(&msecOk);
-                            if (msecOk)
-                            {
-                                dateTime = QDateTime::fromString(values[0].left(secondsDecimal), Qt::ISODate);
-                                dateTime.setTimeSpec(Qt::UTC);
-                                int msec = (int) (sec * 1000.0);
-                                dateTime = dateTime.addMSecs((int) (sec * 1000.0));
-                            }
-                        }
-                        else
-                        {
-                            dateTime = QDateTime::fromString(values[0], Qt::ISODate);
-                        }
-
-                        if (!dateTime.isValid())
-                        {
-                            raiseError(QString("Bad time value in ephemeris data (%1)").arg(values[0]));
-                        }
-                        else
-                        {
-                            bool stateValid = true;
-                            double state[6];
-                            for (int i = 0; i < 6; ++i)
-                            {
-                                bool ok = false;
-                                state[i] = values[i + 1].toDouble(&ok);
-                                if (!ok)
-                                {
-                                    stateValid = false;
-                                }
-                            }
-
-                            if (!stateValid)
-                            {
-                                raiseError("Non-number in ephemeris data");
-                            }
-                            else
-                            {
-                                trajectory->TimeTags().append(dateTime);
-                                for (int i = 0; i < 6; ++i)
-                                {
-                                    trajectory->States() << state[i];
-                                }
-                            }
-                        }
-                    }
-                }
-                break;
-
             default:
                 m_parserState = Oem_Error;
                 break;
@@ -514,6 +715,13 @@ OemImporter::loadScenario()
         }
     }
 
+    if (mappedData)
+    {
+        file->unmap(mappedData);
+    }
+    m_buffer.clear();
+    m_position = m_end = NULL;
+
     if (m_parserState == Oem_Error)
     {
         qDebug() << "Error while importing OEM file: " << errorMessage();
@@ -537,6 +745,102 @@ OemImporter::readHeader()
 }
 
 
+/** Read the next line, without its leading and trailing white space.
+  *
+  * \return false at the end of the data
+  */
+bool
+OemImporter::readLine(const char** begin, const char** end)
+{
+    if (m_position == m_end)
+    {
+        return false;
+    }
+
+    const char* lineEnd = static_cast<const char*>(memchr(m_position, '\n', m_end - m_position));
+    if (!lineEnd)
+    {
+        lineEnd = m_end;
+    }
+
+    const char* b = m_position;
+    const char* e = lineEnd;
+    while (b < e && IsSpace(*b))
+    {
+        ++b;
+    }
+    while (e > b && IsSpace(e[-1]))
+    {
+        --e;
+    }
+
+    *begin = b;
+    *end = e;
+    m_position = lineEnd == m_end ? m_end : lineEnd + 1;
+    m_lineNumber++;
+
+    return true;
+}
+
+
+/** Parse an ephemeris data record (epoch, position and velocity) and append
+  * it to the trajectory.
+  */
+void
+OemImporter::readEphemerisRecord(const char* begin, const char* end, ScenarioExternalType* trajectory)
+{
+    // Split the record at white space
+    const char* tokenBegin[8];
+    const char* tokenEnd[8];
+    int tokenCount = 0;
+    const char* p = begin;
+    while (p < end && tokenCount < 8)
+    {
+        tokenBegin[tokenCount] = p;
+        while (p < end && *p != ' ' && *p != '\t')
+        {
+            ++p;
+        }
+        tokenEnd[tokenCount] = p;
+        tokenCount++;
+
+        while (p < end && (*p == ' ' || *p == '\t'))
+        {
+            ++p;
+        }
+    }
+
+    if (tokenCount != 7 || p != end)
+    {
+        raiseError("Bad or unsupported ephemeris data record");
+        return;
+    }
+
+    QDateTime dateTime = ParseEpoch(tokenBegin[0], tokenEnd[0]);
+    if (!dateTime.isValid())
+    {
+        raiseError(QString("Bad time value in ephemeris data (%1)").arg(QString::fromLatin1(tokenBegin[0], int(tokenEnd[0] - tokenBegin[0]))));
+        return;
+    }
+
+    double state[6];
+    for (int i = 0; i < 6; ++i)
+    {
+        if (!ParseDouble(tokenBegin[i + 1], tokenEnd[i + 1], &state[i]))
+        {
+            raiseError("Non-number in ephemeris data");
+            return;
+        }
+    }
+
+    trajectory->TimeTags().append(dateTime);
+    for (int i = 0; i < 6; ++i)
+    {
+        trajectory->States().append(state[i]);
+    }
+}
+
+
 void
 OemImporter::raiseError(const QString& errorMessage)
 {
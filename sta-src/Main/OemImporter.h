@@ -24,16 +24,20 @@
 #define _STA_OEM_IMPORTER_H_
 
 #include "Scenario/scenario.h"
-#include <QTextStream>
+#include <QIODevice>
 
-/** OemImporter loads an OEM (Orbit Ephemeris Message) from a stream. The syntax
+/** OemImporter loads an OEM (Orbit Ephemeris Message) from a device. The syntax
   * of an OEM file is given in the document "CCSDS Recommended Standard for Orbit
   * Data Messages", CCSDS 502.0-B-2.
+  *
+  * Files are memory mapped and their lines are tokenized in place: the
+  * ephemeris records are converted straight into the time tags and states of
+  * the external trajectories, without intermediate strings.
   */
 class OemImporter
 {
 public:
-    OemImporter(QTextStream* stream);
+    OemImporter(QIODevice* device);
 
     /** Get the human-readable error message. The error message is available
       * after calling loadScenario(). If the scenario was loaded successfully,
@@ -82,10 +86,15 @@ private:
     };
 
     void readHeader();
+    bool readLine(const char** begin, const char** end);
+    void readEphemerisRecord(const char* begin, const char* end, ScenarioExternalType* trajectory);
     void raiseError(const QString& errorMessage);
 
 private:
-    QTextStream* m_stream;
+    QIODevice* m_device;
+    QByteArray m_buffer;
+    const char* m_position;
+    const char* m_end;
     unsigned int m_lineNumber;
     QString m_errorMessage;
     OemParserState m_parserState;
@@ -0,0 +1,247 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "binaryephemeris.h"
+#include "propagatedscenario.h"
+#include <QtEndian>
+#include <QDebug>
+#include <climits>
+#include <cstring>
+
+static const char Magic[8] = { 'S', 'T', 'A', 'E', 'P', 'H', 'E', 'M' };
+static const quint32 FormatVersion = 1;
+static const int HeaderSize = 128;
+static const int NameSize = 32;
+static const int BlockAlignment = 64;
+
+
+static qint64 AlignBlock(qint64 offset)
+{
+    return (offset + BlockAlignment - 1) / BlockAlignment * BlockAlignment;
+}
+
+
+static void PutDouble(char* p, double value)
+{
+    quint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    qToLittleEndian(bits, reinterpret_cast<uchar*>(p));
+}
+
+
+static double GetDouble(const uchar* p)
+{
+    quint64 bits = qFromLittleEndian<quint64>(p);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+static void PutName(char* p, const QString& name)
+{
+    QByteArray text = name.toLatin1().left(NameSize - 1);
+    memcpy(p, text.constData(), text.size());
+}
+
+
+static QString GetName(const uchar* p)
+{
+    const char* text = reinterpret_cast<const char*>(p);
+    return QString::fromLatin1(text, int(qstrnlen(text, NameSize)));
+}
+
+
+BinaryEphemeris::BinaryEphemeris() :
+    m_mappedData(NULL),
+    m_sampleCount(0),
+    m_startTime(0.0),
+    m_endTime(0.0),
+    m_interpolation(CubicHermite),
+    m_interpolationDegree(3),
+    m_times(NULL),
+    m_states(NULL)
+{
+}
+
+
+BinaryEphemeris::~BinaryEphemeris()
+{
+    close();
+}
+
+
+/** Write the samples of a mission arc to a device. The file is built in
+  * memory and written with a single call.
+  *
+  * \return true if the file was written successfully
+  */
+bool
+BinaryEphemeris::write(QIODevice* device, const MissionArc* arc)
+{
+    qint64 sampleCount = arc->trajectorySampleCount();
+    qint64 timesOffset = HeaderSize;
+    qint64 statesOffset = AlignBlock(timesOffset + sampleCount * 8);
+    qint64 size = statesOffset + sampleCount * 6 * 8;
+    if (size > INT_MAX)
+    {
+        qDebug() << "BinaryEphemeris: too many samples";
+        return false;
+    }
+
+    QByteArray data(int(size), '\0');
+    char* p = data.data();
+
+    memcpy(p, Magic, sizeof(Magic));
+    qToLittleEndian(FormatVersion, reinterpret_cast<uchar*>(p + 8));
+    qToLittleEndian(quint32(HeaderSize), reinterpret_cast<uchar*>(p + 12));
+    qToLittleEndian(sampleCount, reinterpret_cast<uchar*>(p + 16));
+    PutDouble(p + 24, sampleCount > 0 ? arc->trajectorySampleTime(0) : 0.0);
+    PutDouble(p + 32, sampleCount > 0 ? arc->trajectorySampleTime(int(sampleCount) - 1) : 0.0);
+    qToLittleEndian(timesOffset, reinterpret_cast<uchar*>(p + 40));
+    qToLittleEndian(statesOffset, reinterpret_cast<uchar*>(p + 48));
+    qToLittleEndian(quint32(CubicHermite), reinterpret_cast<uchar*>(p + 56));
+    qToLittleEndian(quint32(3), reinterpret_cast<uchar*>(p + 60));
+    PutName(p + 64, arc->centralBody() ? arc->centralBody()->name() : QString());
+    PutName(p + 96, arc->coordinateSystem().name());
+
+    char* times = p + timesOffset;
+    char* states = p + statesOffset;
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        sta::StateVector state = arc->trajectorySample(i);
+        PutDouble(times + i * 8, arc->trajectorySampleTime(i));
+        for (int j = 0; j < 3; ++j)
+        {
+            PutDouble(states + (i * 6 + j) * 8, state.position[j]);
+            PutDouble(states + (i * 6 + 3 + j) * 8, state.velocity[j]);
+        }
+    }
+
+    if (device->write(data) != data.size())
+    {
+        qDebug() << "BinaryEphemeris: error writing ephemeris file:" << device->errorString();
+        return false;
+    }
+
+    return true;
+}
+
+
+/** Open a binary ephemeris file and map it in memory.
+  *
+  * \return false if the file can't be read or isn't a valid binary ephemeris
+  */
+bool
+BinaryEphemeris::open(const QString& fileName)
+{
+    close();
+
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        qDebug() << "BinaryEphemeris: unable to open" << fileName;
+        return false;
+    }
+
+    qint64 size = m_file.size();
+    if (size >= HeaderSize)
+    {
+        m_mappedData = m_file.map(0, size);
+    }
+
+    const uchar* p = m_mappedData;
+    if (!p || memcmp(p, Magic, sizeof(Magic)) != 0 ||
+        qFromLittleEndian<quint32>(p + 8) != FormatVersion ||
+        qFromLittleEndian<quint32>(p + 12) != quint32(HeaderSize))
+    {
+        qDebug() << "BinaryEphemeris:" << fileName << "is not a binary ephemeris file";
+        close();
+        return false;
+    }
+
+    qint64 sampleCount = qFromLittleEndian<qint64>(p + 16);
+    qint64 timesOffset = qFromLittleEndian<qint64>(p + 40);
+    qint64 statesOffset = qFromLittleEndian<qint64>(p + 48);
+    if (sampleCount < 0 || sampleCount > INT_MAX / 6 ||
+        timesOffset < HeaderSize || timesOffset % 8 != 0 || timesOffset + sampleCount * 8 > size ||
+        statesOffset < HeaderSize || statesOffset % 8 != 0 || statesOffset + sampleCount * 6 * 8 > size)
+    {
+        qDebug() << "BinaryEphemeris: bad sample blocks in" << fileName;
+        close();
+        return false;
+    }
+
+    m_sampleCount = int(sampleCount);
+    m_startTime = GetDouble(p + 24);
+    m_endTime = GetDouble(p + 32);
+    m_interpolation = Interpolation(qFromLittleEndian<quint32>(p + 56));
+    m_interpolationDegree = int(qFromLittleEndian<quint32>(p + 60));
+    m_centralBodyName = GetName(p + 64);
+    m_coordinateSystemName = GetName(p + 96);
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    m_times = reinterpret_cast<const double*>(p + timesOffset);
+    m_states = reinterpret_cast<const double*>(p + statesOffset);
+#else
+    // The samples have to be swapped on big-endian machines
+    m_swappedData.resize(m_sampleCount * 7);
+    for (int i = 0; i < m_sampleCount; ++i)
+    {
+        m_swappedData[i] = GetDouble(p + timesOffset + i * 8);
+    }
+    for (int i = 0; i < m_sampleCount * 6; ++i)
+    {
+        m_swappedData[m_sampleCount + i] = GetDouble(p + statesOffset + i * 8);
+    }
+    m_times = m_swappedData.constData();
+    m_states = m_swappedData.constData() + m_sampleCount;
+#endif
+
+    return true;
+}
+
+
+void
+BinaryEphemeris::close()
+{
+    if (m_mappedData)
+    {
+        m_file.unmap(m_mappedData);
+        m_mappedData = NULL;
+    }
+    m_file.close();
+    m_swappedData.clear();
+
+    m_sampleCount = 0;
+    m_times = NULL;
+    m_states = NULL;
+}
+
+
+sta::StateVector
+BinaryEphemeris::sample(int index) const
+{
+    Q_ASSERT(index >= 0 && index < m_sampleCount);
+    const double* s = m_states + index * 6;
+    return sta::StateVector(Eigen::Vector3d(s[0], s[1], s[2]), Eigen::Vector3d(s[3], s[4], s[5]));
+}
@@ -0,0 +1,151 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef _STA_BINARY_EPHEMERIS_H_
+#define _STA_BINARY_EPHEMERIS_H_
+
+#include <Astro-Core/statevector.h>
+#include <QFile>
+#include <QVector>
+#include <QString>
+
+class MissionArc;
+
+
+/** BinaryEphemeris reads and writes the binary ephemeris file of a mission
+  * arc. The file is written in one block and read by mapping it in memory.
+  *
+  * All values are little-endian. The file starts with a 128 byte header:
+  *
+  *   offset  size  content
+  *        0     8  "STAEPHEM"
+  *        8     4  format version (1)
+  *       12     4  header size (128)
+  *       16     8  sample count
+  *       24     8  time of the first sample (MJD, TDB)
+  *       32     8  time of the last sample (MJD, TDB)
+  *       40     8  offset of the sample times
+  *       48     8  offset of the states
+  *       56     4  interpolation (1: cubic Hermite between the samples)
+  *       60     4  interpolation degree (3)
+  *       64    32  central body name, padded with zeros
+  *       96    32  coordinate system name, padded with zeros
+  *
+  * It is followed by two blocks starting on 64 byte boundaries: the sample
+  * times (one double per sample), then the states (six doubles per sample:
+  * position in km and velocity in km/s).
+  *
+  * Nothing in STA writes or reads these files yet: no code calls
+  * SpaceObject::generateEphemerisFiles(), and open() has no caller.
+  */
+class BinaryEphemeris
+{
+public:
+    enum Interpolation
+    {
+        CubicHermite = 1
+    };
+
+    BinaryEphemeris();
+    ~BinaryEphemeris();
+
+    static bool write(QIODevice* device, const MissionArc* arc);
+
+    bool open(const QString& fileName);
+    void close();
+
+    bool isOpen() const
+    {
+        return m_times != NULL;
+    }
+
+    int sampleCount() const
+    {
+        return m_sampleCount;
+    }
+
+    double startTime() const
+    {
+        return m_startTime;
+    }
+
+    double endTime() const
+    {
+        return m_endTime;
+    }
+
+    QString centralBodyName() const
+    {
+        return m_centralBodyName;
+    }
+
+    QString coordinateSystemName() const
+    {
+        return m_coordinateSystemName;
+    }
+
+    Interpolation interpolation() const
+    {
+        return m_interpolation;
+    }
+
+    int interpolationDegree() const
+    {
+        return m_interpolationDegree;
+    }
+
+    /** Sample times, MJD (TDB) */
+    const double* sampleTimes() const
+    {
+        return m_times;
+    }
+
+    /** States, six values per sample */
+    const double* states() const
+    {
+        return m_states;
+    }
+
+    double sampleTime(int index) const
+    {
+        return m_times[index];
+    }
+
+    sta::StateVector sample(int index) const;
+
+private:
+    QFile m_file;
+    uchar* m_mappedData;
+    QVector<double> m_swappedData;
+
+    int m_sampleCount;
+    double m_startTime;
+    double m_endTime;
+    QString m_centralBodyName;
+    QString m_coordinateSystemName;
+    Interpolation m_interpolation;
+    int m_interpolationDegree;
+    const double* m_times;
+    const double* m_states;
+};
+
+#endif // _STA_BINARY_EPHEMERIS_H_
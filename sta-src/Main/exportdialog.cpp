@@ -26,9 +26,8 @@
 
 #include "exportdialog.h"
 #include "propagatedscenario.h"
+#include "OemExporter.h"
 #include "Astro-Core/date.h"
-#include <QTextStream>
-
 
 ExportDialog::ExportDialog(PropagatedScenario* scenario, QWidget* parent) :
     QDialog(parent),
@@ -59,7 +58,7 @@ ExportDialog::~ExportDialog()
 bool
 ExportDialog::exportTrajectory(QIODevice* out)
 {
-    QTextStream outStream(out);
+    EphemerisWriter writer(out);
 
     int selectedIndex = vehicleCombo->itemData(vehicleCombo->currentIndex()).toInt();
     if (selectedIndex >= 0 && selectedIndex < m_scenario->spaceObjects().size())
@@ -72,15 +71,37 @@ ExportDialog::exportTrajectory(QIODevice* out)
             {
                 double mjd = arc->trajectorySampleTime(i);
                 sta::StateVector state = arc->trajectorySample(i);
-                outStream.setRealNumberPrecision(14);
-                outStream << sta::MjdToJd(mjd) << ", ";
-                outStream.setRealNumberPrecision(12);
-                outStream << state.position.x() << ", " << state.position.y() << ", " << state.position.z() << ", ";
-                outStream << state.velocity.x() << ", " << state.velocity.y() << ", " << state.velocity.z() << "\n";
+                writer.writeFixed(sta::MjdToJd(mjd), 8);
+                for (int j = 0; j < 3; ++j)
+                {
+                    writer.write(", ");
+                    writer.writeFixed(state.position[j], 6);
+                }
+                for (int j = 0; j < 3; ++j)
+                {
+                    writer.write(", ");
+                    writer.writeFixed(state.velocity[j], 9);
+                }
+                writer.write('\n');
             }
         }
     }
 
-    return true;
+    return writer.flush();
 }
 
+
+/** Write the trajectory of the selected vehicle as an OEM (Orbit Ephemeris Message).
+  */
+bool
+ExportDialog::exportOem(QIODevice* out)
+{
+    int selectedIndex = vehicleCombo->itemData(vehicleCombo->currentIndex()).toInt();
+    if (selectedIndex < 0 || selectedIndex >= m_scenario->spaceObjects().size())
+    {
+        return false;
+    }
+
+    OemExporter exporter(out);
+    return exporter.exportSpaceObject(m_scenario->spaceObjects().at(selectedIndex));
+}
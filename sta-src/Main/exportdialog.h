@@ -43,6 +43,7 @@ public:
     ~ExportDialog();
 
     bool exportTrajectory(QIODevice* out);
+    bool exportOem(QIODevice* out);
 
 private:
     PropagatedScenario* m_scenario;
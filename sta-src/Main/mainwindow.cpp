@@ -30,6 +30,8 @@
 #include <QUrl> // Added by Guillermo to work with URLs
 #include <QXmlSchema>
 #include <QXmlSchemaValidator>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 #include <time.h>
 
@@ -51,6 +53,7 @@
 #include "Astro-Core/date.h"
 
 #include "Scenario/scenarioPropagator.h"
+#include "Scenario/propagationcache.h"
 
 //****************** /OZGUN
 #include "Astro-Core/EclipseDuration.h"
@@ -58,6 +61,7 @@
 //***************** OZGUN/
 
 #include "propagatedscenario.h"
+#include "scenariosnapshot.h"
 #include "RendezVous/rendezVousDialog.h"
 #include "Lagrangian/lagrangianDialog.h"
 #include "Interplanetary/interplanetaryDialog.h"
@@ -103,11 +107,55 @@ static const int STA_MAIN_WINDOW_VERSION = 15;
 static const int SCENARIO_FILE_INDENT_LEVEL = 2;
 
 
+// Load a space scenario in a single pass over the file. Return NULL and set the
+// error message when the file isn't a well-formed space scenario.
+static SpaceScenario*
+ReadSpaceScenario(QIODevice* device, QString* errorMessage)
+{
+    QXmlStreamReader reader(device);
+    if (!reader.readNextStartElement() || !atStartElement(reader, "tns:SpaceScenario"))
+    {
+        *errorMessage = QObject::tr("the file is not a space scenario");
+        return NULL;
+    }
+
+    SpaceScenario* scenario = SpaceScenario::create(reader);
+    if (reader.hasError())
+    {
+        *errorMessage = QObject::tr("%1 (line %2)").arg(reader.errorString()).arg(reader.lineNumber());
+        delete scenario;
+        return NULL;
+    }
+
+    return scenario;
+}
+
+
+// Write a space scenario to an XML file
+static bool
+WriteSpaceScenario(QIODevice* device, const SpaceScenario* scenario)
+{
+    QXmlStreamWriter writer(device);
+    writer.setAutoFormatting(true);
+    writer.setAutoFormattingIndent(SCENARIO_FILE_INDENT_LEVEL);
+
+    writer.writeStartDocument();
+    writer.writeStartElement("tns:SpaceScenario");
+    WriteScenarioNamespaceAttributes(writer);
+    scenario->writeContents(writer);
+    writer.writeEndElement();
+    writer.writeEndDocument();
+
+    return !writer.hasError();
+}
+
+
 
 //MainWindow::MainWindow() :
 MainWindow::MainWindow(QWidget *parent)	:
         m_scenario(NULL),
         m_propagatedScenario(NULL),
+        m_propagationCache(new PropagationCache()),
         m_scenarioView(NULL),
         m_timelineWidget(NULL),
         m_orbitPropagationDialog(NULL),
@@ -312,6 +360,7 @@ MainWindow::MainWindow(QWidget *parent)	:
 MainWindow::~MainWindow()
 {
     delete m_propagatedScenario;
+    delete m_propagationCache;
     delete m_viewActions;
 }
 
@@ -433,6 +482,42 @@ bool CheckScenarioCentralBodies(const SpaceScenario* scenario)
     return true;
 }
 
+// Check a scenario file against the space scenario schema, loading the schema
+// the first time. Report errors to the user and return false if the file
+// isn't valid. The file is rewound for the loader.
+bool MainWindow::validateScenarioFile(QFile* scenarioFile)
+{
+    if (!m_spaceScenarioSchema)
+    {
+        QFile schemaFile(SCHEMA_FILE);
+        if (!schemaFile.open(QIODevice::ReadOnly))
+        {
+            QMessageBox::critical(this, tr("Critical Error"), tr("Error opening space scenario schema file. Unable to load scenario."));
+            return false;
+        }
+
+        m_spaceScenarioSchema = new QXmlSchema;
+        if (!m_spaceScenarioSchema->load(&schemaFile, QUrl::fromLocalFile(schemaFile.fileName())))
+        {
+            QMessageBox::critical(this, tr("Critical Error"), tr("Error in space scenario schema file. Unable to load scenario."));
+            delete m_spaceScenarioSchema;
+            m_spaceScenarioSchema = NULL;
+            return false;
+        }
+    }
+
+    QXmlSchemaValidator validator(*m_spaceScenarioSchema);
+    if (!validator.validate(scenarioFile))
+    {
+        QMessageBox::critical(this, tr("Scenario Load Error"), tr("Scenario is not a valid space scenario."));
+        return false;
+    }
+
+    scenarioFile->reset();
+    return true;
+}
+
+
 //////////////////////////////////////////////////  Action to open an existing scenario ///////////////////////////////////
 void MainWindow::on_actionOpenScenario_triggered()
 {
@@ -446,6 +531,7 @@ void MainWindow::on_actionOpenScenario_triggered()
     }
 
     SpaceScenario* scenario = NULL;
+    PropagatedScenario* snapshot = NULL;
 
     QString fileName = QFileDialog::getOpenFileName(this,
                                                     tr("Open Scenario"),
@@ -474,8 +560,7 @@ void MainWindow::on_actionOpenScenario_triggered()
                     return;
                 }
 
-                QTextStream oemStream(&oemFile);
-                OemImporter importer(&oemStream);
+                OemImporter importer(&oemFile);
 
                 scenario = importer.loadScenario();
 
@@ -487,51 +572,20 @@ void MainWindow::on_actionOpenScenario_triggered()
             }
             else
             {
-                if (!m_spaceScenarioSchema)
-                {
-                    QFile schemaFile(SCHEMA_FILE);
-                    if (!schemaFile.open(QIODevice::ReadOnly))
-                    {
-                        QMessageBox::critical(this, tr("Critical Error"), tr("Error opening space scenario schema file. Unable to load scenario."));
-                        return;
-                    }
-
-                    m_spaceScenarioSchema = new QXmlSchema;
-                    if (!m_spaceScenarioSchema->load(&schemaFile, QUrl::fromLocalFile(schemaFile.fileName())))
-                    {
-                        QMessageBox::critical(this, tr("Critical Error"), tr("Error in space scenario schema file. Unable to load scenario."));
-                        delete m_spaceScenarioSchema;
-                        m_spaceScenarioSchema = NULL;
-                        return;
-                    }
-                }
-
-                QXmlSchemaValidator validator(*m_spaceScenarioSchema);
-                if (!validator.validate(&scenarioFile))
-                {
-
-                    QMessageBox::critical(this, tr("Scenario Load Error"), tr("Scenario is not a valid space scenario."));
-                    return;
-                }
-
-                scenarioFile.reset();
-                QDomDocument scenarioDoc;
-                if (!scenarioDoc.setContent(&scenarioFile))
+                // The stream loader parses values leniently, so the schema is what
+                // catches malformed numbers, dates and enumerations. Validation can
+                // be turned off to load large trusted files in a single pass.
+                if (settings.value("ValidateScenarioFiles", true).toBool() && !validateScenarioFile(&scenarioFile))
                 {
-                    // This should not fail, since we just got done validating the xml file against the space
-                    // scenario schema.
-                    scenarioFile.close();
-                    QMessageBox::critical(this, tr("Scenario Load Error"), tr("Internal error occurred when loading space scenario."));
                     return;
                 }
 
+                QString errorMessage;
+                scenario = ReadSpaceScenario(&scenarioFile, &errorMessage);
                 scenarioFile.close();
-
-                QDomElement rootElement = scenarioDoc.firstChildElement("tns:SpaceScenario");
-                scenario = SpaceScenario::create(rootElement);
                 if (!scenario)
                 {
-                    QMessageBox::critical(this, tr("Scenario Load Error"), tr("Internal error (parser problem) occurred when loading space scenario."));
+                    QMessageBox::critical(this, tr("Scenario Load Error"), tr("Error loading space scenario: %1").arg(errorMessage));
                     return;
                 }
             }
@@ -566,6 +620,10 @@ void MainWindow::on_actionOpenScenario_triggered()
             if (fileName.endsWith(".stas", Qt::CaseInsensitive))
             {
                 replaceCurrentScenario(scenario, fileName);
+
+                // Reuse the results of the last propagation if the scenario hasn't
+                // changed since then.
+                snapshot = ScenarioSnapshot::load(ScenarioSnapshot::snapshotFileName(fileName), scenario);
             }
             else
             {
@@ -591,6 +649,10 @@ void MainWindow::on_actionOpenScenario_triggered()
     //actionAnalyse->setEnabled(m_scenario = NULL);
     actionAnalyse->setDisabled(m_scenario != NULL);  // Do not enable analysis here. Do it after propagation
 
+    if (snapshot)
+    {
+        setPropagatedScenario(snapshot);
+    }
 }
 
 
@@ -610,12 +672,10 @@ void MainWindow::on_actionSaveScenario_triggered()
         }
         else
         {
-            QDomDocument newDoc;
-            QDomElement scenarioElement = CreateSpaceScenarioElement(m_scenario, newDoc);
-            AddScenarioNamespaceAttributes(scenarioElement);
-            newDoc.appendChild(scenarioElement);
-            QTextStream out(&scenarioFile);
-            newDoc.save(out, SCENARIO_FILE_INDENT_LEVEL);
+            if (!WriteSpaceScenario(&scenarioFile, m_scenario))
+            {
+                QMessageBox::critical(this, tr("Error"), tr("Error writing file %1").arg(m_scenarioFileName));
+            }
             scenarioFile.close();
         }
     }
@@ -646,13 +706,10 @@ void MainWindow::on_actionSaveScenarioAs_triggered()
                 replaceCurrentScenario(scenario(), fileName);
             }
 
-            QDomDocument saveDoc;
-            QDomElement scenarioElement = CreateSpaceScenarioElement(m_scenario, saveDoc);
-            AddScenarioNamespaceAttributes(scenarioElement);
-            saveDoc.appendChild(scenarioElement);
-
-            QTextStream stream(&scenarioFile);
-            saveDoc.save(stream, 1);
+            if (!WriteSpaceScenario(&scenarioFile, m_scenario))
+            {
+                QMessageBox::critical(this, tr("Error"), tr("Error writing file %1").arg(fileName));
+            }
         }
     }
 }
@@ -673,13 +730,26 @@ void MainWindow::on_actionExport_triggered()
     {
         QString fileName = QFileDialog::getSaveFileName(this, tr("Export File"),
                                                         "",
-                                                        tr("CSV Files (*.csv)"));
+                                                        tr("CSV Files (*.csv);;Orbit Ephemeris Messages (*.oem)"));
         if (!fileName.isEmpty())
         {
             QFile outFile(fileName);
             if (outFile.open(QIODevice::WriteOnly))
             {
-                exportDialog.exportTrajectory(&outFile);
+                bool ok = false;
+                if (fileName.endsWith(".oem", Qt::CaseInsensitive))
+                {
+                    ok = exportDialog.exportOem(&outFile);
+                }
+                else
+                {
+                    ok = exportDialog.exportTrajectory(&outFile);
+                }
+
+                if (!ok)
+                {
+                    QMessageBox::warning(this, tr("Export Error"), tr("Error writing file %1").arg(fileName));
+                }
             }
         }
     }
@@ -830,6 +900,9 @@ void MainWindow::on_actionPropagate_Scenario_triggered()
     PropagationFeedback feedback;
     PropagatedScenario* propScenario = new PropagatedScenario();
 
+    // Arcs that didn't change since the last propagation are taken from the cache
+    m_propagationCache->beginPropagation();
+
     // Process each participant
     foreach (QSharedPointer<ScenarioParticipantType> participant, scenario()->AbstractParticipant())
     {
@@ -837,7 +910,7 @@ void MainWindow::on_actionPropagate_Scenario_triggered()
         if (dynamic_cast<ScenarioSC*>(participant.data()))
         {
             ScenarioSC* vehicle = dynamic_cast<ScenarioSC*>(participant.data());
-            scenarioPropagatorSatellite(vehicle, feedback, propScenario, this);
+            scenarioPropagatorSatellite(vehicle, feedback, propScenario, this, m_propagationCache);
         }
         else if (dynamic_cast<ScenarioREV*>(participant.data()))
         {
@@ -869,7 +942,20 @@ void MainWindow::on_actionPropagate_Scenario_triggered()
     }
     else
     {
+        m_propagationCache->endPropagation();
         setPropagatedScenario(propScenario);
+
+        // Save the propagated scenario next to the scenario file, so that it can
+        // be reopened without propagating again
+        if (!m_scenarioFileName.isEmpty())
+        {
+            QFile snapshotFile(ScenarioSnapshot::snapshotFileName(m_scenarioFileName));
+            if (!snapshotFile.open(QIODevice::WriteOnly) ||
+                !ScenarioSnapshot::write(&snapshotFile, propScenario, scenario()))
+            {
+                snapshotFile.remove();
+            }
+        }
     }
 
 }   ////////////////////////// End of action PROPAGATE /////////////////////////////
@@ -1689,6 +1775,8 @@ void MainWindow::openFileFromAEvent(const QString& fileName)
         dir = settings.value("OpenScenarioDir").toString();
     }
 
+    PropagatedScenario* snapshot = NULL;
+
     if (!fileName.isEmpty())
     {
         QFile scenarioFile(fileName);
@@ -1702,51 +1790,20 @@ void MainWindow::openFileFromAEvent(const QString& fileName)
             QFileInfo scenarioFileInfo(fileName);
             settings.setValue("OpenScenarioDir", scenarioFileInfo.absolutePath());
 
-            if (!m_spaceScenarioSchema)
-            {
-                QFile schemaFile(SCHEMA_FILE);
-                if (!schemaFile.open(QIODevice::ReadOnly))
-                {
-                    QMessageBox::critical(this, tr("Critical Error"), tr("Error opening space scenario schema file. Unable to load scenario."));
-                    return;
-                }
-
-                m_spaceScenarioSchema = new QXmlSchema;
-                if (!m_spaceScenarioSchema->load(&schemaFile, QUrl::fromLocalFile(schemaFile.fileName())))
-                {
-                    QMessageBox::critical(this, tr("Critical Error"), tr("Error in space scenario schema file. Unable to load scenario."));
-                    delete m_spaceScenarioSchema;
-                    m_spaceScenarioSchema = NULL;
-                    return;
-                }
-            }
-
-            QXmlSchemaValidator validator(*m_spaceScenarioSchema);
-            if (!validator.validate(&scenarioFile))
-            {
-
-                QMessageBox::critical(this, tr("Scenario Load Error"), tr("Scenario is not a valid space scenario."));
-                return;
-            }
-
-            scenarioFile.reset();
-            QDomDocument scenarioDoc;
-            if (!scenarioDoc.setContent(&scenarioFile))
+            // The stream loader parses values leniently, so the schema is what
+            // catches malformed numbers, dates and enumerations. Validation can
+            // be turned off to load large trusted files in a single pass.
+            if (settings.value("ValidateScenarioFiles", true).toBool() && !validateScenarioFile(&scenarioFile))
             {
-                // This should not fail, since we just got done validating the xml file against the space
-                // scenario schema.
-                scenarioFile.close();
-                QMessageBox::critical(this, tr("Scenario Load Error"), tr("Internal error occurred when loading space scenario."));
                 return;
             }
 
+            QString errorMessage;
+            SpaceScenario* scenario = ReadSpaceScenario(&scenarioFile, &errorMessage);
             scenarioFile.close();
-
-            QDomElement rootElement = scenarioDoc.firstChildElement("tns:SpaceScenario");
-            SpaceScenario* scenario = SpaceScenario::create(rootElement);
             if (!scenario)
             {
-                QMessageBox::critical(this, tr("Scenario Load Error"), tr("Internal error (parser problem) occurred when loading space scenario."));
+                QMessageBox::critical(this, tr("Scenario Load Error"), tr("Error loading space scenario: %1").arg(errorMessage));
                 return;
             }
 
@@ -1773,6 +1830,15 @@ void MainWindow::openFileFromAEvent(const QString& fileName)
             m_scenarioView->m_scenarioTree->setFocus();
 
             setScenario(scenario);
+
+            if (fileName.endsWith(".stas", Qt::CaseInsensitive))
+            {
+                replaceCurrentScenario(scenario, fileName);
+
+                // Reuse the results of the last propagation if the scenario hasn't
+                // changed since then.
+                snapshot = ScenarioSnapshot::load(ScenarioSnapshot::snapshotFileName(fileName), scenario);
+            }
         }
     }
 
@@ -1789,6 +1855,10 @@ void MainWindow::openFileFromAEvent(const QString& fileName)
     actionSystem_Engineering->setEnabled(m_scenario != NULL);
     actionAnalyse->setDisabled(m_scenario != NULL);  // Do not enable analysis here. Do it after propagation
 
+    if (snapshot)
+    {
+        setPropagatedScenario(snapshot);
+    }
 }
 
 ///////////////////////////////////  Create a new scenario ////////////////////////////////////////////
@@ -41,6 +41,7 @@ class QCloseEvent;
 class QTimer;
 class QTabWidget;
 class QStackedWidget;
+class QFile;
 
 class OrbitPropagationDialog;
 class GroundTrackPlotTool;
@@ -50,6 +51,7 @@ class SpaceScenario;
 class ScenarioElementBox;
 class TimelineWidget;
 class PropagatedScenario;
+class PropagationCache;
 class ConstellationStudy;
 
 class RendezvousDialog;
@@ -147,6 +149,7 @@ private slots:
 private:
     void showGroundTrackPlotTool();
     void replaceCurrentScenario(SpaceScenario* scenario, QString filename);
+    bool validateScenarioFile(QFile* scenarioFile);
     void configureTimeline(PropagatedScenario* scenario);
 
 
@@ -158,6 +161,7 @@ private:
 
     SpaceScenario* m_scenario;
     PropagatedScenario* m_propagatedScenario;
+    PropagationCache* m_propagationCache;
 
     QString m_scenarioFileName;
     ScenarioView* m_scenarioView;
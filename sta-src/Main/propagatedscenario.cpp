@@ -33,6 +33,7 @@
 #include <QtDebug>
 
 #include "propagatedscenario.h"
+#include "binaryephemeris.h"
 #include <Astro-Core/RotationState.h>
 #include <Astro-Core/Interpolators.h>
 #include <Astro-Core/stamath.h>
@@ -305,25 +306,23 @@ MissionArc::getAttitude(double mjd, AttitudeVector* result) const
 }
 
 
-/** Write an ASCII ephemeris file for this mission arc. One record
- *  is written for each sample. The format of each record is:
- *
- * <mjd> <x> <y> <z> <vx> <vy> <vz>
- *
- * mjd is a modified Julian date
- * x, y, and z are the position
- * vx, vy, and vz are the velocity
+/** Write a binary ephemeris file for this mission arc; the format is
+ *  described in BinaryEphemeris. The samples of an arc don't change after
+ *  it is created, so the file is only written the first time.
  *
  * Return true if the file was successfully created and written.
  */
 bool
 MissionArc::generateEphemerisFile()
 {
+    if (m_ephemerisTempFile != NULL && m_ephemerisTempFile->exists())
+        return true;
+
     // Create a new temporary file for the ephemeris
     if (m_ephemerisTempFile != NULL)
         delete m_ephemerisTempFile;
 
-    m_ephemerisTempFile = new QTemporaryFile("ephem-XXXXXX.stae");
+    m_ephemerisTempFile = new QTemporaryFile("ephem-XXXXXX.stab");
     if (!m_ephemerisTempFile->open())
     {
         delete m_ephemerisTempFile;
@@ -334,26 +333,17 @@ MissionArc::generateEphemerisFile()
 
     m_ephemerisFile = m_ephemerisTempFile->fileName();
 
-    QTextStream ephemerisStream(m_ephemerisTempFile);
-
-    // Output values at full double precision
-    ephemerisStream.setRealNumberPrecision(16);
+    bool ok = BinaryEphemeris::write(m_ephemerisTempFile, this);
+    m_ephemerisTempFile->close();
 
-    // Write all samples
-    for (int i = 0; i < m_sampleTimes.size(); ++i)
+    if (!ok)
     {
-        ephemerisStream << m_sampleTimes[i] << " "
-                        << m_samples[i].position.x() << " "
-                        << m_samples[i].position.y() << " "
-                        << m_samples[i].position.z() << " "
-                        << m_samples[i].velocity.x() << " "
-                        << m_samples[i].velocity.y() << " "
-                        << m_samples[i].velocity.z() << endl;
+        delete m_ephemerisTempFile;
+        m_ephemerisTempFile = NULL;
+        m_ephemerisFile = "";
     }
 
-    m_ephemerisTempFile->close();
-
-    return true;
+    return ok;
 }
 
 /****** PSAntennaObject    ******/
@@ -522,6 +512,8 @@ SpaceObject::getStateVector(double mjd,
 /*! Generate ephemeris file for all mission arcs. Return true if all segments
  *  were written succesfully. This method aborts and return false immediately
  *  after the first unsuccessful attempt to write an ephemeris.
+ *
+ *  Not called anywhere in STA at present.
  */
 bool
 SpaceObject::generateEphemerisFiles()
@@ -0,0 +1,605 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "scenariosnapshot.h"
+#include "propagatedscenario.h"
+#include "Scenario/staschema.h"
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QHash>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+#include <QtEndian>
+#include <QDebug>
+#include <climits>
+#include <cstring>
+
+static const char Magic[8] = { 'S', 'T', 'A', 'S', 'N', 'A', 'P', 'S' };
+static const quint32 FormatVersion = 1;
+static const int HeaderSize = 64;
+static const int HashSize = 20;
+
+// Revision of the propagators, included in the scenario hash. Increment it
+// whenever a change to the propagation code alters the results for the same
+// scenario, so that existing snapshots are discarded.
+static const quint32 PropagatorRevision = 1;
+
+// Directory of the aerodynamic databases read during propagation
+static const char AerodynamicsDirectory[] = "data/aerodynamics";
+
+
+static void PutDouble(char* p, double value)
+{
+    quint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    qToLittleEndian(bits, reinterpret_cast<uchar*>(p));
+}
+
+
+static double GetDouble(const uchar* p)
+{
+    quint64 bits = qFromLittleEndian<quint64>(p);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+static qint64 ArcBlockSize(qint64 sampleCount, qint64 attitudeSampleCount)
+{
+    return (sampleCount * 7 + attitudeSampleCount * 8) * 8;
+}
+
+
+// Build the sample block of a mission arc
+static QByteArray ArcSampleBlock(const MissionArc* arc)
+{
+    int sampleCount = arc->trajectorySampleCount();
+    int attitudeSampleCount = arc->attitudeSampleCount();
+
+    QByteArray block(int(ArcBlockSize(sampleCount, attitudeSampleCount)), '\0');
+    char* p = block.data();
+
+    for (int i = 0; i < sampleCount; ++i, p += 8)
+    {
+        PutDouble(p, arc->trajectorySampleTime(i));
+    }
+
+    for (int i = 0; i < sampleCount; ++i)
+    {
+        sta::StateVector state = arc->trajectorySample(i);
+        for (int j = 0; j < 3; ++j, p += 8)
+        {
+            PutDouble(p, state.position[j]);
+        }
+        for (int j = 0; j < 3; ++j, p += 8)
+        {
+            PutDouble(p, state.velocity[j]);
+        }
+    }
+
+    for (int i = 0; i < attitudeSampleCount; ++i, p += 8)
+    {
+        PutDouble(p, arc->attitudeSampleTime(i));
+    }
+
+    for (int i = 0; i < attitudeSampleCount; ++i)
+    {
+        staAttitude::AttitudeVector attitude = arc->attitudeSample(i);
+        const double values[7] = { attitude.myQuaternion.w(), attitude.myQuaternion.x(),
+                                   attitude.myQuaternion.y(), attitude.myQuaternion.z(),
+                                   attitude.myBodyRates.x(), attitude.myBodyRates.y(), attitude.myBodyRates.z() };
+        for (int j = 0; j < 7; ++j, p += 8)
+        {
+            PutDouble(p, values[j]);
+        }
+    }
+
+    return block;
+}
+
+
+static void WriteAntennas(QDataStream& out, const QList<PSAntennaObject*>& antennas)
+{
+    out << qint32(antennas.size());
+    foreach (PSAntennaObject* antenna, antennas)
+    {
+        out << antenna->getAzimuth() << antenna->getElevation()
+            << qint32(antenna->getConeShape()) << antenna->getConeAngle()
+            << antenna->getObservationChecked();
+    }
+}
+
+
+static bool ReadAntennas(QDataStream& in, QList<PSAntennaObject*>* antennas)
+{
+    qint32 count = 0;
+    in >> count;
+    for (int i = 0; i < count && in.status() == QDataStream::Ok; ++i)
+    {
+        double azimuth = 0.0;
+        double elevation = 0.0;
+        qint32 coneShape = 0;
+        double coneAngle = 0.0;
+        bool observationChecked = false;
+        in >> azimuth >> elevation >> coneShape >> coneAngle >> observationChecked;
+
+        PSAntennaObject* antenna = new PSAntennaObject();
+        antenna->setAzimuth(azimuth);
+        antenna->setElevation(elevation);
+        antenna->setConeShape(coneShape);
+        antenna->setConeAngle(coneAngle);
+        antenna->setObservationChecked(observationChecked);
+        *antennas << antenna;
+    }
+
+    return in.status() == QDataStream::Ok;
+}
+
+
+static const StaBody* LookupBody(qint32 id)
+{
+    return id < 0 ? NULL : STA_SOLAR_SYSTEM->lookup(StaBodyId(id));
+}
+
+
+/** Name of the snapshot file saved next to a scenario file.
+  */
+QString
+ScenarioSnapshot::snapshotFileName(const QString& scenarioFileName)
+{
+    return scenarioFileName + ".snapshot";
+}
+
+
+// Add the XML serialization of a scenario to a hash. The initial positions of
+// the loitering and rendezvous arcs after the first one of a trajectory plan
+// are left out: the propagator replaces them with the final state of the
+// previous arc, so they aren't inputs of the propagation.
+static void HashScenarioXml(QCryptographicHash& hash, const QByteArray& xml)
+{
+    QXmlStreamReader reader(xml);
+    reader.setNamespaceProcessing(false);
+
+    // Names of the open elements, and the number of child elements of each
+    // read so far
+    QStringList openElements;
+    QList<int> childCounts;
+
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+        if (reader.isStartElement())
+        {
+            QString name = reader.qualifiedName().toString();
+            int depth = openElements.size();
+            if (name == "tns:InitialPosition" && depth >= 2 &&
+                openElements.at(depth - 2) == "tns:TrajectoryPlan" && childCounts.at(depth - 2) > 1 &&
+                (openElements.at(depth - 1) == "tns:Loitering" || openElements.at(depth - 1) == "tns:RendezVousManoeuvre"))
+            {
+                reader.skipCurrentElement();
+                continue;
+            }
+
+            if (!childCounts.isEmpty())
+            {
+                ++childCounts.last();
+            }
+            openElements << name;
+            childCounts << 0;
+
+            hash.addData("<" + name.toUtf8());
+            foreach (QXmlStreamAttribute attribute, reader.attributes())
+            {
+                hash.addData(" " + attribute.qualifiedName().toString().toUtf8() + "=" + attribute.value().toString().toUtf8());
+            }
+            hash.addData(">");
+        }
+        else if (reader.isEndElement())
+        {
+            openElements.removeLast();
+            childCounts.removeLast();
+            hash.addData("</" + reader.qualifiedName().toString().toUtf8() + ">");
+        }
+        else if (reader.isCharacters())
+        {
+            hash.addData(reader.text().toString().toUtf8());
+        }
+    }
+}
+
+
+/** Compute the hash of all the inputs of a propagation: the XML serialization
+  * of the scenario, the aerodynamic databases and the propagator revision.
+  * The initial states that the propagator derives from the previous arc are
+  * not part of the hash, so propagating doesn't change it.
+  *
+  * The scenario refers to the aerodynamic databases only by name, so all the
+  * databases are hashed: editing any of them invalidates the snapshots.
+  */
+QByteArray
+ScenarioSnapshot::scenarioHash(const SpaceScenario* scenario)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    QByteArray revision(4, '\0');
+    qToLittleEndian(PropagatorRevision, reinterpret_cast<uchar*>(revision.data()));
+    hash.addData(revision);
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QXmlStreamWriter writer(&buffer);
+    scenario->writeElement(writer, "SpaceScenario");
+    HashScenarioXml(hash, buffer.data());
+
+    QDir aerodynamicsDir(AerodynamicsDirectory);
+    QStringList databases = aerodynamicsDir.entryList(QStringList() << "*.stad" << "*.stadb", QDir::Files, QDir::Name);
+    foreach (QString databaseName, databases)
+    {
+        QFile database(aerodynamicsDir.filePath(databaseName));
+        if (database.open(QIODevice::ReadOnly))
+        {
+            hash.addData(databaseName.toUtf8());
+            hash.addData(database.readAll());
+        }
+    }
+
+    return hash.result();
+}
+
+
+/** Write a snapshot of a propagated scenario. The sample blocks are written
+  * one arc at a time, the directory and the header at the end.
+  *
+  * \return true if the snapshot was written successfully
+  */
+bool
+ScenarioSnapshot::write(QIODevice* device, const PropagatedScenario* propScenario, const SpaceScenario* scenario)
+{
+    QHash<ScenarioParticipantType*, int> participantIndex;
+    for (int i = 0; i < scenario->AbstractParticipant().size(); ++i)
+    {
+        participantIndex.insert(scenario->AbstractParticipant().at(i).data(), i);
+    }
+
+    // The header is filled in once the directory has been written
+    QByteArray header(HeaderSize, '\0');
+    if (device->write(header) != header.size())
+    {
+        qDebug() << "ScenarioSnapshot: error writing snapshot:" << device->errorString();
+        return false;
+    }
+
+    qint64 offset = HeaderSize;
+    QByteArray directory;
+    QDataStream out(&directory, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_4_6);
+
+    out << qint32(propScenario->spaceObjects().size());
+    foreach (const SpaceObject* spaceObject, propScenario->spaceObjects())
+    {
+        out << qint32(participantIndex.value(spaceObject->participant(), -1));
+        out << spaceObject->name() << spaceObject->modelFile() << spaceObject->trajectoryColor();
+        WriteAntennas(out, spaceObject->receiver());
+        WriteAntennas(out, spaceObject->transmitter());
+
+        out << qint32(spaceObject->mission().size());
+        foreach (const MissionArc* arc, spaceObject->mission())
+        {
+            if (ArcBlockSize(arc->trajectorySampleCount(), arc->attitudeSampleCount()) > INT_MAX)
+            {
+                qDebug() << "ScenarioSnapshot: too many samples in arc" << arc->arcName();
+                return false;
+            }
+
+            QByteArray block = ArcSampleBlock(arc);
+            if (device->write(block) != block.size())
+            {
+                qDebug() << "ScenarioSnapshot: error writing snapshot:" << device->errorString();
+                return false;
+            }
+
+            out << qint32(arc->centralBody() ? arc->centralBody()->id() : -1);
+            out << qint32(arc->coordinateSystem().type());
+            out << arc->arcName() << arc->modelName() << arc->arcTrajectoryColor();
+            out << qint32(arc->trajectorySampleCount()) << qint32(arc->attitudeSampleCount()) << offset;
+            offset += block.size();
+        }
+    }
+
+    out << qint32(propScenario->groundObjects().size());
+    foreach (const GroundObject* groundObject, propScenario->groundObjects())
+    {
+        out << groundObject->name;
+        out << qint32(groundObject->centralBody ? groundObject->centralBody->id() : -1);
+        out << groundObject->longitude << groundObject->latitude << groundObject->altitude;
+        WriteAntennas(out, groundObject->receiver());
+        WriteAntennas(out, groundObject->transmitter());
+    }
+
+    out << qint32(propScenario->regionObjects().size());
+    foreach (const RegionObject* region, propScenario->regionObjects())
+    {
+        out << region->name();
+        out << qint32(region->centralBody() ? region->centralBody()->id() : -1);
+        out << qint32(region->boundary().size());
+        foreach (Eigen::Vector2d point, region->boundary())
+        {
+            out << point.x() << point.y();
+        }
+        out << region->color();
+    }
+
+    if (device->write(directory) != directory.size())
+    {
+        qDebug() << "ScenarioSnapshot: error writing snapshot:" << device->errorString();
+        return false;
+    }
+
+    char* p = header.data();
+    memcpy(p, Magic, sizeof(Magic));
+    qToLittleEndian(FormatVersion, reinterpret_cast<uchar*>(p + 8));
+    qToLittleEndian(quint32(HeaderSize), reinterpret_cast<uchar*>(p + 12));
+    memcpy(p + 16, scenarioHash(scenario).constData(), HashSize);
+    qToLittleEndian(offset, reinterpret_cast<uchar*>(p + 40));
+    qToLittleEndian(qint64(directory.size()), reinterpret_cast<uchar*>(p + 48));
+
+    if (!device->seek(0) || device->write(header) != header.size())
+    {
+        qDebug() << "ScenarioSnapshot: error writing snapshot:" << device->errorString();
+        return false;
+    }
+
+    return true;
+}
+
+
+// Rebuild the propagated scenario from a mapped snapshot file
+static PropagatedScenario*
+LoadSnapshot(const uchar* data, qint64 size, SpaceScenario* scenario)
+{
+    qint64 directoryOffset = qFromLittleEndian<qint64>(data + 40);
+    qint64 directorySize = qFromLittleEndian<qint64>(data + 48);
+    if (directoryOffset < HeaderSize || directorySize < 0 || directorySize > INT_MAX ||
+        directoryOffset + directorySize > size)
+    {
+        qDebug() << "ScenarioSnapshot: bad directory";
+        return NULL;
+    }
+
+    QByteArray directory = QByteArray::fromRawData(reinterpret_cast<const char*>(data + directoryOffset), int(directorySize));
+    QDataStream in(directory);
+    in.setVersion(QDataStream::Qt_4_6);
+
+    const QList<QSharedPointer<ScenarioParticipantType> >& participants = scenario->AbstractParticipant();
+    PropagatedScenario* propScenario = new PropagatedScenario();
+
+    qint32 spaceObjectCount = 0;
+    in >> spaceObjectCount;
+    for (int i = 0; i < spaceObjectCount && in.status() == QDataStream::Ok; ++i)
+    {
+        qint32 participant = -1;
+        QString name;
+        QString modelFile;
+        QColor trajectoryColor;
+        in >> participant >> name >> modelFile >> trajectoryColor;
+
+        SpaceObject* spaceObject = new SpaceObject(participant >= 0 && participant < participants.size() ? participants.at(participant).data() : NULL);
+        spaceObject->setName(name);
+        spaceObject->setModelFile(modelFile);
+        spaceObject->setTrajectoryColor(trajectoryColor);
+
+        QList<PSAntennaObject*> receivers;
+        QList<PSAntennaObject*> transmitters;
+        ReadAntennas(in, &receivers);
+        ReadAntennas(in, &transmitters);
+        foreach (PSAntennaObject* receiver, receivers)
+        {
+            spaceObject->addReceiver(receiver);
+        }
+        foreach (PSAntennaObject* transmitter, transmitters)
+        {
+            spaceObject->addTransmitter(transmitter);
+        }
+
+        qint32 arcCount = 0;
+        in >> arcCount;
+        for (int j = 0; j < arcCount && in.status() == QDataStream::Ok; ++j)
+        {
+            qint32 centralBodyId = -1;
+            qint32 coordSys = 0;
+            QString arcName;
+            QString modelName;
+            QColor arcColor;
+            qint32 sampleCount = 0;
+            qint32 attitudeSampleCount = 0;
+            qint64 offset = 0;
+            in >> centralBodyId >> coordSys >> arcName >> modelName >> arcColor >> sampleCount >> attitudeSampleCount >> offset;
+
+            const StaBody* centralBody = LookupBody(centralBodyId);
+            if (in.status() != QDataStream::Ok || !centralBody || sampleCount <= 0 || attitudeSampleCount < 0 ||
+                offset < HeaderSize || offset + ArcBlockSize(sampleCount, attitudeSampleCount) > directoryOffset)
+            {
+                qDebug() << "ScenarioSnapshot: bad mission arc" << arcName;
+                delete spaceObject;
+                delete propScenario;
+                return NULL;
+            }
+
+            const uchar* p = data + offset;
+            QList<double> sampleTimes;
+            QList<sta::StateVector> samples;
+            QList<double> attitudeSampleTimes;
+            QList<staAttitude::AttitudeVector> attitudeSamples;
+            sampleTimes.reserve(sampleCount);
+            samples.reserve(sampleCount);
+            attitudeSampleTimes.reserve(attitudeSampleCount);
+            attitudeSamples.reserve(attitudeSampleCount);
+
+            for (int k = 0; k < sampleCount; ++k, p += 8)
+            {
+                sampleTimes << GetDouble(p);
+            }
+            for (int k = 0; k < sampleCount; ++k, p += 48)
+            {
+                samples << sta::StateVector(Eigen::Vector3d(GetDouble(p), GetDouble(p + 8), GetDouble(p + 16)),
+                                            Eigen::Vector3d(GetDouble(p + 24), GetDouble(p + 32), GetDouble(p + 40)));
+            }
+            for (int k = 0; k < attitudeSampleCount; ++k, p += 8)
+            {
+                attitudeSampleTimes << GetDouble(p);
+            }
+            for (int k = 0; k < attitudeSampleCount; ++k, p += 56)
+            {
+                Eigen::Quaterniond q(GetDouble(p), GetDouble(p + 8), GetDouble(p + 16), GetDouble(p + 24));
+                Eigen::Vector3d bodyRates(GetDouble(p + 32), GetDouble(p + 40), GetDouble(p + 48));
+                attitudeSamples << staAttitude::AttitudeVector(q, bodyRates);
+            }
+
+            MissionArc* arc = new MissionArc(centralBody,
+                                             sta::CoordinateSystem(sta::CoordinateSystemType(coordSys)),
+                                             sampleTimes, samples,
+                                             attitudeSampleTimes, attitudeSamples);
+            arc->setArcName(arcName);
+            arc->setModelName(modelName);
+            arc->setArcTrajectoryColor(arcColor);
+            spaceObject->addMissionArc(arc);
+        }
+
+        propScenario->addSpaceObject(spaceObject);
+    }
+
+    qint32 groundObjectCount = 0;
+    in >> groundObjectCount;
+    for (int i = 0; i < groundObjectCount && in.status() == QDataStream::Ok; ++i)
+    {
+        GroundObject* groundObject = new GroundObject();
+        qint32 centralBodyId = -1;
+        in >> groundObject->name >> centralBodyId;
+        in >> groundObject->longitude >> groundObject->latitude >> groundObject->altitude;
+        groundObject->centralBody = LookupBody(centralBodyId);
+
+        QList<PSAntennaObject*> receivers;
+        QList<PSAntennaObject*> transmitters;
+        ReadAntennas(in, &receivers);
+        ReadAntennas(in, &transmitters);
+        foreach (PSAntennaObject* receiver, receivers)
+        {
+            groundObject->addReceiver(receiver);
+        }
+        foreach (PSAntennaObject* transmitter, transmitters)
+        {
+            groundObject->addTransmitter(transmitter);
+        }
+
+        propScenario->addGroundObject(groundObject);
+    }
+
+    qint32 regionCount = 0;
+    in >> regionCount;
+    for (int i = 0; i < regionCount && in.status() == QDataStream::Ok; ++i)
+    {
+        QString name;
+        qint32 centralBodyId = -1;
+        qint32 pointCount = 0;
+        in >> name >> centralBodyId >> pointCount;
+
+        QList<Eigen::Vector2d> boundary;
+        for (int j = 0; j < pointCount && in.status() == QDataStream::Ok; ++j)
+        {
+            double x = 0.0;
+            double y = 0.0;
+            in >> x >> y;
+            boundary << Eigen::Vector2d(x, y);
+        }
+
+        QColor color;
+        in >> color;
+
+        RegionObject* region = new RegionObject(name, LookupBody(centralBodyId));
+        region->setBoundary(boundary);
+        region->setColor(color);
+        propScenario->addRegionObject(region);
+    }
+
+    if (in.status() != QDataStream::Ok)
+    {
+        qDebug() << "ScenarioSnapshot: truncated directory";
+        delete propScenario;
+        return NULL;
+    }
+
+    return propScenario;
+}
+
+
+/** Load the snapshot of a propagated scenario. The file is mapped in memory
+  * and the samples are read directly from the mapping.
+  *
+  * \return NULL if there's no valid snapshot for the current state of the
+  * scenario; the scenario must be propagated again in this case.
+  */
+PropagatedScenario*
+ScenarioSnapshot::load(const QString& fileName, SpaceScenario* scenario)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return NULL;
+    }
+
+    qint64 size = file.size();
+    uchar* data = NULL;
+    if (size >= HeaderSize)
+    {
+        data = file.map(0, size);
+    }
+
+    if (!data || memcmp(data, Magic, sizeof(Magic)) != 0 ||
+        qFromLittleEndian<quint32>(data + 8) != FormatVersion ||
+        qFromLittleEndian<quint32>(data + 12) != quint32(HeaderSize))
+    {
+        qDebug() << "ScenarioSnapshot:" << fileName << "is not a scenario snapshot";
+        if (data)
+        {
+            file.unmap(data);
+        }
+        return NULL;
+    }
+
+    PropagatedScenario* propScenario = NULL;
+    if (QByteArray::fromRawData(reinterpret_cast<const char*>(data + 16), HashSize) != scenarioHash(scenario))
+    {
+        qDebug() << "ScenarioSnapshot:" << fileName << "is out of date";
+    }
+    else
+    {
+        propScenario = LoadSnapshot(data, size, scenario);
+    }
+
+    file.unmap(data);
+
+    return propScenario;
+}
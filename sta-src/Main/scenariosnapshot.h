@@ -0,0 +1,72 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef _STA_SCENARIO_SNAPSHOT_H_
+#define _STA_SCENARIO_SNAPSHOT_H_
+
+#include <QByteArray>
+#include <QString>
+
+class QIODevice;
+class SpaceScenario;
+class PropagatedScenario;
+
+
+/** ScenarioSnapshot saves a propagated scenario next to its scenario file,
+  * so that it can be reopened without propagating the scenario again.
+  *
+  * The snapshot is tagged with a hash of the scenario and of the other inputs
+  * of the propagation: it is only loaded when none of them has changed since
+  * the scenario was propagated.
+  *
+  * All values in the header and in the sample blocks are little-endian. The
+  * file starts with a 64 byte header:
+  *
+  *   offset  size  content
+  *        0     8  "STASNAPS"
+  *        8     4  format version (1)
+  *       12     4  header size (64)
+  *       16    20  SHA-1 hash of the propagation inputs
+  *       40     8  offset of the directory
+  *       48     8  size of the directory
+  *
+  * The header is followed by the sample blocks of all the mission arcs: the
+  * sample times, then the states (position and velocity, six doubles per
+  * sample), then the attitude sample times and the attitude samples
+  * (quaternion w, x, y, z and body rates, seven doubles per sample).
+  *
+  * The directory at the end of the file is written with QDataStream. It
+  * describes the space objects, ground objects and regions, and gives the
+  * offsets of the sample blocks of each arc. Space objects refer to their
+  * participant by its index in the scenario.
+  */
+class ScenarioSnapshot
+{
+public:
+    static QString snapshotFileName(const QString& scenarioFileName);
+    static QByteArray scenarioHash(const SpaceScenario* scenario);
+
+    static bool write(QIODevice* device, const PropagatedScenario* propScenario, const SpaceScenario* scenario);
+    static PropagatedScenario* load(const QString& fileName, SpaceScenario* scenario);
+};
+
+#endif // _STA_SCENARIO_SNAPSHOT_H_
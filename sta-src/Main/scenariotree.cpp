@@ -928,6 +928,16 @@ void ScenarioTree::editScenarioObject(ScenarioObject* scenarioObject,
         ScenarioEntryArcType* entry = dynamic_cast<ScenarioEntryArcType*>(scenarioObject);
         ReEntryDialog editDialog(this);
 
+        // The vehicle is needed by the dispersion analysis of the arc
+        for (QTreeWidgetItem* item = editItem->parent(); item; item = item->parent())
+        {
+            if (dynamic_cast<ScenarioREV*>(objectForItem(item)))
+            {
+                editDialog.setVehicle(dynamic_cast<ScenarioREV*>(objectForItem(item)));
+                break;
+            }
+        }
+
         if (!editDialog.loadValues(entry))
         {
             QMessageBox::information(this, tr("Bad Entry element"), tr("Error in Entry element"));
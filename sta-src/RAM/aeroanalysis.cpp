@@ -24,10 +24,16 @@
  ------------------ E-mail: (d.dirkxATstudent.tudelft.nl) ----------------------------
 */
 #include "aeroanalysis.h"
+#include "aerodatabase.h"
 #include "Astro-Core/stamath.h"
 #include "Astro-Core/bodyTOwind.h"
 #include <QDebug>
 #include <QTextStream>
+#include <QThread>
+#include <QtConcurrentMap>
+
+//Number of attitudes whose panel inclinations are determined together by a database worker
+static const int AttitudeBatch=8;
 
 AeroAnalysis::AeroAnalysis(VehicleGeometry *_Vehicle, double _cref, double _Sref, Vector3d _MomentRef,int** _SelectedMethods, QList<double> _writeAeroList, bool _writeGeom)
 {
@@ -38,6 +44,12 @@ AeroAnalysis::AeroAnalysis(VehicleGeometry *_Vehicle, double _cref, double _Sref
     MomentRef=_MomentRef;
     writeAeroList=_writeAeroList;
     writeGeom=_writeGeom;
+    alphas=NULL;
+    betas=NULL;
+    Machs=NULL;
+    nCases=0;
+    VehicleCoefs=NULL;
+    Shadowing=true;
 
     SelectedMethods=new int* [Vehicle->nParts];
 
@@ -52,6 +64,10 @@ AeroAnalysis::AeroAnalysis(VehicleGeometry *_Vehicle, double _cref, double _Sref
             SelectedMethods[j][i]=_SelectedMethods[j][i];
         }
     }
+    for(int i=0;i<Vehicle->nParts;i++)
+    {
+        Panels.append(PanelStore(Vehicle->PartsOut[i]));
+    }
 
 }
 
@@ -76,6 +92,8 @@ AeroAnalysis::AeroAnalysis(AeroAnalysis* Low, AeroAnalysis* High, double Mlow, d
     Sref=Low->Sref;
     MomentRef=Low->MomentRef;
     Vehicle=new VehicleGeometry(*Low->Vehicle);
+    Panels=Low->Panels;
+    Shadowing=Low->Shadowing;
     nAlpha=Low->nAlpha;
     nBeta=Low->nBeta;
     //nMach=Low->nMach+High->nMach-4;//Four points overlap
@@ -93,12 +111,8 @@ AeroAnalysis::AeroAnalysis(AeroAnalysis* Low, AeroAnalysis* High, double Mlow, d
         betas[i]=Low->betas[i];
 
     nCases=nMach*nAlpha*nBeta;
-    VehicleCoefs=new double*[nCases];
+    VehicleCoefs=new double[nCases*CoefsOut];
 
-    for(i=0;i<nCases;i++)
-    {
-       VehicleCoefs[i]=new double[High->CoefsOut];
-    }
     int klow;
     int khigh;
     int l=0;
@@ -115,7 +129,7 @@ AeroAnalysis::AeroAnalysis(AeroAnalysis* Low, AeroAnalysis* High, double Mlow, d
                 {
                     for(m=0;m<CoefsOut;m++)
                     {
-                        VehicleCoefs[l][m]=Low->VehicleCoefs[i*Low->nMach*nAlpha+j*Low->nMach+klow][m];
+                        VehicleCoefs[l*CoefsOut+m]=Low->VehicleCoef(Low->CaseIndex(i,j,klow),m);
                     }
                     klow++;
 
@@ -125,7 +139,7 @@ AeroAnalysis::AeroAnalysis(AeroAnalysis* Low, AeroAnalysis* High, double Mlow, d
                 {
                     for(m=0;m<CoefsOut;m++)
                     {
-                        VehicleCoefs[l][m]=High->VehicleCoefs[i*High->nMach*nAlpha+j*High->nMach+khigh][m];
+                        VehicleCoefs[l*CoefsOut+m]=High->VehicleCoef(High->CaseIndex(i,j,khigh),m);
                     }
                     khigh++;
 
@@ -134,7 +148,7 @@ AeroAnalysis::AeroAnalysis(AeroAnalysis* Low, AeroAnalysis* High, double Mlow, d
                 {
                     for(m=0;m<CoefsOut;m++)
                     {
-                        VehicleCoefs[l][m]=BridgeCoefs(Low->VehicleCoefs[i*Low->nMach*nAlpha+j*Low->nMach+klow][m],High->VehicleCoefs[i*High->nMach*nAlpha+j*High->nMach+khigh][m],Machs[k],Mlow,Mhigh);
+                        VehicleCoefs[l*CoefsOut+m]=BridgeCoefs(Low->VehicleCoef(Low->CaseIndex(i,j,klow),m),High->VehicleCoef(High->CaseIndex(i,j,khigh),m),Machs[k],Mlow,Mhigh);
 
                     }
                     khigh++;
@@ -148,12 +162,7 @@ AeroAnalysis::AeroAnalysis(AeroAnalysis* Low, AeroAnalysis* High, double Mlow, d
 
 AeroAnalysis::~AeroAnalysis()
 {
-    int i;
     delete Vehicle;
-    for(i=0;i<nCases;i++)
-    {
-        delete [] VehicleCoefs[i];
-    }
     delete[] VehicleCoefs;
     delete[] alphas;
     delete[] Machs;
@@ -161,34 +170,107 @@ AeroAnalysis::~AeroAnalysis()
 }
 
 void AeroAnalysis::GenerateDatabase(int ForceCoord,int MomentCoord)
+        //in: force and moment coordinate systems
+        //out: -
+        //Global variables changed: VehicleCoefs filled for all Mach/alpha/beta cases
+        //note: the attitudes are split in contiguous blocks evaluated concurrently, each block with its own inclination and pressure buffers.
+        //Every case is written at its own place in VehicleCoefs, so the result doesn't depend on the number of threads.
+        //The shadowed panels only depend on the attitude, they are determined first for all attitudes and shared by all Mach numbers
 {
     nCases=nMach*nBeta*nAlpha;
-    Cps=2;
-    VehicleCoefs=new double* [nCases];
-    double* tempCoefs= new double[CoefsOut];
-    int m;
-    for(int i=0;i<nCases;i++)
+    delete[] VehicleCoefs;
+    VehicleCoefs=new double[nCases*CoefsOut];
+
+    int nAttitudes=nBeta*nAlpha;
+    QVector<unsigned char> Shadows;
+    if(Shadowing)
     {
-       VehicleCoefs[i]=new double[CoefsOut];
+        PanelShadowing Shadower(*Vehicle,Panels);
+        int nPanels=Shadower.nPanels();
+        Shadows.resize(nAttitudes*nPanels);
+        for(int i=0;i<nAttitudes;i++)
+        {
+            Shadower.DetermineShadows(alphas[i%nAlpha],betas[i/nAlpha],Shadows.data()+i*nPanels);
+        }
     }
-    int l=0;
-    for(int i=0;i<nBeta;i++)
+
+    int nBlocks=qBound(1,QThread::idealThreadCount(),nAttitudes);
+    QList<DatabaseBlock> Blocks;
+    for(int i=0;i<nBlocks;i++)
     {
-        for(int j=0;j<nAlpha;j++)
+        DatabaseBlock Block;
+        Block.Parent=this;
+        Block.FirstAttitude=i*nAttitudes/nBlocks;
+        Block.LastAttitude=(i+1)*nAttitudes/nBlocks;
+        Block.ForceCoord=ForceCoord;
+        Block.MomentCoord=MomentCoord;
+        Block.Shadows=Shadowing ? Shadows.constData() : NULL;
+        Blocks.append(Block);
+    }
+
+    QtConcurrent::blockingMap(Blocks,EvaluateDatabaseBlock);
+}
+
+void AeroAnalysis::EvaluateDatabaseBlock(DatabaseBlock& Block)
+        //in: range of attitudes to evaluate
+        //out: -
+        //Global variables changed: coefficients of all Mach numbers of the attitudes in VehicleCoefs of the parent analysis
+{
+    const AeroAnalysis* Parent=Block.Parent;
+    int nParts=Parent->Panels.size();
+    int i,j,k,p,q;
+
+    //Scratch buffers: inclinations of a batch of attitudes and pressure coefficients of one case, per part
+    QVector<QVector<double> > Theta(nParts);
+    QVector<QVector<double> > Cp(nParts);
+    QVector<const double*> CaseTheta(nParts);
+    QVector<double*> CaseCp(nParts);
+    QVector<const unsigned char*> CaseShadowed(nParts);
+    QVector<int> PartOffsets(nParts);
+    int nVehiclePanels=0;
+    for(p=0;p<nParts;p++)
+    {
+        Theta[p].resize(AttitudeBatch*Parent->Panels[p].nPanels());
+        Cp[p].resize(Parent->Panels[p].nPanels());
+        CaseCp[p]=Cp[p].data();
+        CaseShadowed[p]=NULL;
+        PartOffsets[p]=nVehiclePanels;
+        nVehiclePanels+=Parent->Panels[p].nPanels();
+    }
+
+    double BatchAlphas[AttitudeBatch];
+    double BatchBetas[AttitudeBatch];
+    for(int First=Block.FirstAttitude;First<Block.LastAttitude;First+=AttitudeBatch)
+    {
+        int nBatch=qMin(AttitudeBatch,Block.LastAttitude-First);
+        for(q=0;q<nBatch;q++)
         {
-            for(int k=0;k<nMach;k++)
-            {
-                setStagnationPressure(Machs[k]);
-                tempCoefs=DetermineVehicleCoefs(Machs[k],alphas[j],betas[i],ForceCoord,MomentCoord);
-                for(m=0;m<CoefsOut;m++)
-                {
-                    VehicleCoefs[l][m]=tempCoefs[m];
+            BatchAlphas[q]=Parent->alphas[(First+q)%Parent->nAlpha];
+            BatchBetas[q]=Parent->betas[(First+q)/Parent->nAlpha];
+        }
+        //Inclinations only depend on the attitude, they are shared by all Mach numbers
+        for(p=0;p<nParts;p++)
+        {
+            Parent->Panels[p].DetermineInclinations(BatchAlphas,BatchBetas,nBatch,Theta[p].data());
+        }
 
-                }
-                l++;
-                if(fromPressureWriteList(Machs[k]))
+        for(q=0;q<nBatch;q++)
+        {
+            i=(First+q)/Parent->nAlpha;
+            j=(First+q)%Parent->nAlpha;
+            for(p=0;p<nParts;p++)
+            {
+                CaseTheta[p]=Theta[p].constData()+q*Parent->Panels[p].nPanels();
+                if(Block.Shadows)
+                    CaseShadowed[p]=Block.Shadows+(First+q)*nVehiclePanels+PartOffsets[p];
+            }
+            for(k=0;k<Parent->nMach;k++)
+            {
+                Parent->DetermineVehicleCoefs(Parent->Machs[k],Parent->alphas[j],Parent->betas[i],Block.ForceCoord,Block.MomentCoord,
+                                              CaseTheta.constData(),CaseCp.constData(),CaseShadowed.constData(),Parent->VehicleCoefs+Parent->CaseIndex(i,j,k)*Parent->CoefsOut);
+                if(Parent->fromPressureWriteList(Parent->Machs[k]))
                 {
-                    writePressures(Machs[k],alphas[j],betas[i]);
+                    Parent->writePressures(Parent->Machs[k],Parent->alphas[j],Parent->betas[i],CaseTheta.constData(),CaseCp.constData());
                 }
             }
         }
@@ -255,6 +337,7 @@ QList<QString> AeroAnalysis::writeAeroDatabase(int ForceCoord, int MomentCoord)
         }
 
     }
+    writeBinaryDatabase(ForceCoord,MomentCoord);
     if (writeGeom==1)
     {
         writeDetailGeomInfo();
@@ -262,6 +345,45 @@ QList<QString> AeroAnalysis::writeAeroDatabase(int ForceCoord, int MomentCoord)
     return fileList;
 }
 
+QString AeroAnalysis::writeBinaryDatabase(int ForceCoord, int MomentCoord)
+        //in: force and moment coordinate systems of the coefficients
+        //out: name of the binary database written in data/aerodynamics, with all the coefficients of VehicleCoefs
+{
+    QString vehicleName=((Vehicle->Filename).c_str());
+    vehicleName.remove(0,16);
+    vehicleName.remove(vehicleName.length()-4,4);
+    QString file=vehicleName+".stadb";
+
+    int ids[6];
+    if(ForceCoord==0)
+    {
+        ids[0]=AeroDatabase::CA;
+        ids[1]=AeroDatabase::CY;
+        ids[2]=AeroDatabase::CN;
+    }
+    else
+    {
+        ids[0]=AeroDatabase::CD;
+        ids[1]=AeroDatabase::CS;
+        ids[2]=AeroDatabase::CL;
+    }
+    if(MomentCoord==0)
+    {
+        ids[3]=AeroDatabase::Cl;
+        ids[4]=AeroDatabase::Cm;
+        ids[5]=AeroDatabase::Cn;
+    }
+    else
+    {
+        ids[3]=AeroDatabase::Clpr;
+        ids[4]=AeroDatabase::Cmpr;
+        ids[5]=AeroDatabase::Cnpr;
+    }
+
+    AeroDatabase::write("data/aerodynamics/"+file,nMach,Machs,nAlpha,alphas,nBeta,betas,CoefsOut,ids,VehicleCoefs);
+    return file;
+}
+
 void AeroAnalysis::writeCoefFile(QString filename, int coef)
 {
     QFile aeroFile(filename);
@@ -294,7 +416,7 @@ void AeroAnalysis::writeCoefFile(QString filename, int coef)
         {
             for(j=0;j<nMach;j++)
             {
-                aeroStream << VehicleCoefs[l][coef]<< " ";
+                aeroStream << VehicleCoef(l,coef)<< " ";
                 l++;
             }
             aeroStream << endl;
@@ -313,9 +435,11 @@ void AeroAnalysis::writeDetailGeomInfo()
     geomFile.open(QIODevice::WriteOnly);
     QTextStream geomStream(&geomFile);
     int i,j,k;
+    QVector<double> theta;
     for(i=0; i<Vehicle->nParts;i++)
     {
-        DetermineInclination(i,0.0,0.0);//Also write inclination angles for 0 angle of attack and sideslip
+        theta.resize(Panels[i].nPanels());
+        Panels[i].DetermineInclination(0.0,0.0,theta.data());//Also write inclination angles for 0 angle of attack and sideslip
         for(j=0; j<Vehicle->PartsOut[i].Nlines-1;j++)
         {
             for(k=0; k<Vehicle->PartsOut[i].Npoints-1; k++)
@@ -330,7 +454,7 @@ void AeroAnalysis::writeDetailGeomInfo()
                 geomStream << Vehicle->PartsOut[i].Normal[j][k].y() << " ";
                 geomStream << Vehicle->PartsOut[i].Normal[j][k].z() << " ";
                 geomStream << Vehicle->PartsOut[i].Area[j][k] << " ";
-                geomStream << Vehicle->PartsOut[i].theta[j][k] << " ";
+                geomStream << theta[j*(Vehicle->PartsOut[i].Npoints-1)+k] << " ";
                 geomStream<<endl;
 
             }
@@ -339,7 +463,8 @@ void AeroAnalysis::writeDetailGeomInfo()
     geomFile.close();
 }
 
-void AeroAnalysis::writePressures(double M, double a, double b)
+void AeroAnalysis::writePressures(double M, double a, double b, const double* const* theta, const double* const* Cp) const
+        //in: Mach number, attitude, inclinations and pressure coefficients of the panels of each part
 {
     QString VehicleName=QString(Vehicle->Filename.c_str());
     VehicleName.remove(0,16);
@@ -366,8 +491,8 @@ void AeroAnalysis::writePressures(double M, double a, double b)
 
                 if((j!=Vehicle->PartsOut[i].Nlines-1) && (k!=Vehicle->PartsOut[i].Npoints-1))
                 {
-                    presStream<<Vehicle->PartsOut[i].Cp[j][k]<<" ";
-                    presStream<<Vehicle->PartsOut[i].theta[j][k]<<" ";
+                    presStream<<Cp[i][j*(Vehicle->PartsOut[i].Npoints-1)+k]<<" ";
+                    presStream<<theta[i][j*(Vehicle->PartsOut[i].Npoints-1)+k]<<" ";
 
                 }
                 else
@@ -384,27 +509,19 @@ void AeroAnalysis::writePressures(double M, double a, double b)
 
 
 
-double* AeroAnalysis::DetermineVehicleCoefs(double M, double alpha, double beta, int ForceCoord, int MomentCoord)
+void AeroAnalysis::DetermineVehicleCoefs(double M, double alpha, double beta, int ForceCoord, int MomentCoord, const double* const* theta, double* const* Cp, const unsigned char* const* Shadowed, double* Coefs) const
+        //in: Mach number, attitude, force and moment coordinate systems, inclinations of the panels of each part at alpha and beta,
+        //pressure coefficient buffers of the panels of each part, shadowed panels of each part at alpha and beta (NULL per part without shadowing),
+        //CoefsOut values to fill
+        //out: -
 {
-    double* VehicleCoefs=new double[CoefsOut];
-    double* PartCoefs=new double[CoefsOut];
     int i;
-    int j;
-    for(int i=0;i<CoefsOut;i++)
-        VehicleCoefs[i]=0.0;
+    for(i=0;i<CoefsOut;i++)
+        Coefs[i]=0.0;
     for(i=0;i<Vehicle->nParts;i++)
     {
-        DetermineInclination(i,alpha,beta);
+        DeterminePartCoefs(i,M,alpha,beta,ForceCoord,MomentCoord,theta[i],Cp[i],Shadowed[i],Coefs);
     }
-    //Vehicle->ShadowDetermination(); to be implemented in future expansion
-    for(i=0;i<Vehicle->nParts;i++)
-    {
-        PartCoefs=DeterminePartCoefs(i,M,alpha,beta,ForceCoord,MomentCoord);
-        for(j=0;j<CoefsOut;j++)
-            VehicleCoefs[j]=VehicleCoefs[j]+PartCoefs[j];
-    }
-    delete [] PartCoefs;
-    return VehicleCoefs;
 }
 
 
@@ -493,207 +610,147 @@ void AeroAnalysis::setIndepVariablesFull(int SimType, double* AttitudeBounds, do
 }
 
 
-double* AeroAnalysis::DeterminePartCoefs(int PartNumber, double M, double alpha, double beta, int ForceCoord, int MomentCoord)
+void AeroAnalysis::DeterminePartCoefs(int PartNumber, double M, double alpha, double beta, int ForceCoord, int MomentCoord, const double* theta, double* Cp, const unsigned char* Shadowed, double* Coefs) const
+        //in: Part of the vehicle to analyze, Mach number, attitude, force and moment coordinate systems, inclinations and pressure coefficient buffer of the panels of the part,
+        //shadowed panels of the part or NULL, CoefsOut values to add the part coefficients to
+        //out: -
+        //note: shadowed panels get the free stream pressure (Cp=0), as in the Newtonian shadow
 {
     int i;
-    double* ForceCoefs=new double[3];
-    double* MomentCoefs;
+    double ForceCoefs[3];
+    double MomentCoefs[3];
 
-    double* outCoefs;
-    if (CoefsOut==3)
+    DeterminePressureCoefs(PartNumber,M,theta,Cp);
+    if(Shadowed)
     {
-        outCoefs=new double[3];
+        for(i=0;i<Panels[PartNumber].nPanels();i++)
+        {
+            if(Shadowed[i])
+                Cp[i]=0;
+        }
     }
-    else if (CoefsOut==6)
+    Panels[PartNumber].ForceMoment(Cp,MomentRef,ForceCoefs,MomentCoefs);
+    for(i=0;i<3;i++)
     {
-        MomentCoefs=new double[3];
-        outCoefs=new double[6];
+        ForceCoefs[i]=ForceCoefs[i]/Sref;
+        MomentCoefs[i]=MomentCoefs[i]/(cref*Sref);
     }
-    DeterminePressureCoefs(PartNumber,M);
-    ForceCoefs=getForceCoefs(PartNumber);
     if(ForceCoord==1)
         bodyTOwind(alpha,beta,ForceCoefs);
     for(i=0;i<3;i++)
     {
-        outCoefs[i]=ForceCoefs[i];
+        Coefs[i]+=ForceCoefs[i];
     }
     if (CoefsOut==6)
     {
-        MomentCoefs=getMomentCoefs(PartNumber);
         if(MomentCoord==1)
         {
             bodyTOwind(alpha,beta,MomentCoefs);
         }
         for(i=3;i<6;i++)
         {
-            outCoefs[i]=MomentCoefs[i-3];
-        }
-    }
-
-    delete [] ForceCoefs;
-    if (CoefsOut==6)
-    {
-        delete [] MomentCoefs;
-    }
-    return outCoefs;
-}
-
-void AeroAnalysis::DeterminePressureCoefs(int PartNumber, double M)
-{
-    UpdateCompressionCp(M,PartNumber);
-    UpdateExpansionCp(M,PartNumber);
-}
-
-double* AeroAnalysis::getForceCoefs(int PartNumber)
-{
-    int i;
-    int j;
-    Vector3d ForceCoef=Vector3d(0,0,0);
-    for(i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
-    {
-        for(j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
-        {
-            ForceCoef=ForceCoef-Vehicle->PartsOut[PartNumber].Cp[i][j]*Vehicle->PartsOut[PartNumber].Area[i][j]*Vehicle->PartsOut[PartNumber].Normal[i][j];
-        }
-    }
-    ForceCoef=ForceCoef/Sref;
-    double* ForceCoefDouble=new double[3];
-    for(i=0;i<3;i++)
-    {
-        ForceCoefDouble[i]=ForceCoef(i);
-    }
-    return ForceCoefDouble;
-}
-
-double* AeroAnalysis::getMomentCoefs(int PartNumber)
-{
-    int i;
-    int j;
-    Vector3d MomentCoef=Vector3d(0,0,0);
-    Vector3d r;
-    for(i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
-    {
-        for(j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
-        {
-            r=(Vehicle->PartsOut[PartNumber].Centroid[i][j]-MomentRef);
-            MomentCoef=MomentCoef-Vehicle->PartsOut[PartNumber].Cp[i][j]*Vehicle->PartsOut[PartNumber].Area[i][j]*(r.cross(Vehicle->PartsOut[PartNumber].Normal[i][j]));
-
+            Coefs[i]+=MomentCoefs[i-3];
         }
     }
-    MomentCoef=MomentCoef/(cref*Sref);
-    double* MomentCoefDouble=new double[3];
-    for(i=0;i<3;i++)
-        MomentCoefDouble[i]=MomentCoef(i);
-    return MomentCoefDouble;
 }
 
-void AeroAnalysis::DetermineInclination(int PartNumber, double alpha, double beta)
+void AeroAnalysis::DeterminePressureCoefs(int PartNumber, double M, const double* theta, double* Cp) const
 {
-    Vector3d Vinf;
-    int i,j;
-    double cosdel;
-    double Vinfx=cos(alpha)*cos(beta);
-    double Vinfy=-sin(beta);
-    double Vinfz=sin(alpha)*cos(beta);
-    Vinf=Vector3d(Vinfx,Vinfy,Vinfz);
-    for(i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    //Panels left out by the selected methods get no pressure, whatever case was evaluated before
+    for(int i=0;i<Panels[PartNumber].nPanels();i++)
     {
-        for(j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
-        {
-            cosdel=-1*Vehicle->PartsOut[PartNumber].Normal[i][j].dot(Vinf);
-            Vehicle->PartsOut[PartNumber].theta[i][j]=sta::Pi()/2-acos(cosdel);
-        }
+        Cp[i]=0;
     }
+    UpdateCompressionCp(M,PartNumber,theta,Cp);
+    UpdateExpansionCp(M,PartNumber,theta,Cp);
 }
 
-void AeroAnalysis::UpdateCompressionCp(double M, int PartNumber)
+void AeroAnalysis::UpdateCompressionCp(double M, int PartNumber, const double* theta, double* Cp) const
 {
+    int nPanels=Panels[PartNumber].nPanels();
     switch(SelectedMethods[0][PartNumber])
     {
-    case 0: Newtonian(M,PartNumber);
+    case 0: Newtonian(M,theta,Cp,nPanels);
         break;
-    case 1: ModifiedNewtonian(M,PartNumber,1.0);
+    case 1: ModifiedNewtonian(M,theta,Cp,nPanels,1);
         break;
-    case 2: ModifiedNewtonianPrandtlMeyer(M,PartNumber,1.0);
+    case 2: ModifiedNewtonianPrandtlMeyer(M,theta,Cp,nPanels,1);
         break;
-    case 3: TangentWedge(M,PartNumber);
+    case 3: TangentWedge(M,theta,Cp,nPanels);
         break;
-    case 4: TangentWedgeEmpirical(M,PartNumber);
+    case 4: TangentWedgeEmpirical(M,theta,Cp,nPanels);
         break;
-    case 5: TangentConeEmpirical(M,PartNumber);
+    case 5: TangentConeEmpirical(M,theta,Cp,nPanels);
         break;
-    case 6: ModifiedDahlemBuck(M,PartNumber);
+    case 6: ModifiedDahlemBuck(M,theta,Cp,nPanels);
         break;
-    case 7: VanDykeUnified(M,PartNumber,1.0);
+    case 7: VanDykeUnified(M,theta,Cp,nPanels,1);
         break;
-    case 8: SmythDeltaWing(M,PartNumber);
+    case 8: SmythDeltaWing(M,theta,Cp,nPanels);
         break;
-    case 9: HankeyFlatSurface(M,PartNumber);
+    case 9: HankeyFlatSurface(M,theta,Cp,nPanels);
         break;
     }
 
 }
 
-void AeroAnalysis::UpdateExpansionCp(double M, int PartNumber)
+void AeroAnalysis::UpdateExpansionCp(double M, int PartNumber, const double* theta, double* Cp) const
 {
+    int nPanels=Panels[PartNumber].nPanels();
     switch(SelectedMethods[1][PartNumber])
     {
-    case 0: Vacuum(M,PartNumber);
+    case 0: Vacuum(M,theta,Cp,nPanels);
         break;
-    case 1: ModifiedNewtonian(M,PartNumber,-1);
+    case 1: ModifiedNewtonian(M,theta,Cp,nPanels,-1);
         break;
-    case 2: ModifiedNewtonianPrandtlMeyer(M,PartNumber,-1);
+    case 2: ModifiedNewtonianPrandtlMeyer(M,theta,Cp,nPanels,-1);
         break;
-    case 3: PrandtlMeyerFreestream(M,PartNumber);
+    case 3: PrandtlMeyerFreestream(M,theta,Cp,nPanels);
         break;
-    case 4: HighMachBase(M,PartNumber);
+    case 4: HighMachBase(M,theta,Cp,nPanels);
         break;
-    case 5: VanDykeUnified(M,PartNumber,-1);
+    case 5: VanDykeUnified(M,theta,Cp,nPanels,-1);
         break;
-    case 6: ACMempirical(M,PartNumber);
+    case 6: ACMempirical(M,theta,Cp,nPanels);
         break;
     }
 }
 
-void AeroAnalysis::setStagnationPressure(double M)
+double AeroAnalysis::StagnationPressure(double M) const
 {
-    Cps=2/(gamma*pow(M,2.0))*(pow(pow((gamma+1)*M,2.0)/(4*gamma*pow(M,2.0)-2*(gamma-1)),gamma/(gamma-1))*((1-gamma+2*gamma*pow(M,2.0))/(gamma+1))-1);
+    return 2/(gamma*pow(M,2.0))*(pow(pow((gamma+1)*M,2.0)/(4*gamma*pow(M,2.0)-2*(gamma-1)),gamma/(gamma-1))*((1-gamma+2*gamma*pow(M,2.0))/(gamma+1))-1);
 }
 
-void AeroAnalysis::Newtonian(double M, int PartNumber)
+void AeroAnalysis::Newtonian(double M, const double* theta, double* Cp, int nPanels) const
 {
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0)
-            {
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=2*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-            }
+            Cp[i]=2*pow(sin(theta[i]),2.0);
         }
     }
 }
 
-void AeroAnalysis::ModifiedNewtonian(double M, int PartNumber, int Type)
+void AeroAnalysis::ModifiedNewtonian(double M, const double* theta, double* Cp, int nPanels, int Type) const
 {
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    double Cps=StagnationPressure(M);
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0 && Type==1)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0 && Type==1)
-            {
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=Cps*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-            }
-            else if(Vehicle->PartsOut[PartNumber].theta[i][j]<0 && Type==-1)
-            {
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=0;
-            }
+            Cp[i]=Cps*pow(sin(theta[i]),2.0);
+        }
+        else if(theta[i]<0 && Type==-1)
+        {
+            Cp[i]=0;
         }
     }
 }
 
-void AeroAnalysis::ModifiedNewtonianPrandtlMeyer(double M, int PartNumber, int Type)
+void AeroAnalysis::ModifiedNewtonianPrandtlMeyer(double M, const double* theta, double* Cp, int nPanels, int Type) const
 {
+    double Cps=StagnationPressure(M);
     double Msq=pow(M,2.0);
     double pcap=pow((2/((gamma+1)*Msq)),gamma/(gamma-1))*pow((2*gamma*Msq-gamma+1)/(gamma+1),1/(gamma-1));
     double Mlow=0.91+0.3125*gamma;
@@ -733,37 +790,34 @@ void AeroAnalysis::ModifiedNewtonianPrandtlMeyer(double M, int PartNumber, int T
     q=pow(2/(2+(gamma-1)*pow(Mq,2.0)),gamma/(gamma-1));
     thetalim=asin(pow((q-pcap)/(1-pcap),0.5));
     numq=sqrt((gamma+1)/(gamma-1))*atan(sqrt((gamma-1)/(gamma+1)*(pow(Mq,2.0)-1)))-atan(sqrt(pow(Mq,2.0)-1));
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=-0.01 && Type==1)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=-0.01 && Type==1)
+            if(theta[i]>thetalim)
             {
-                if(Vehicle->PartsOut[PartNumber].theta[i][j]>thetalim)
-                {
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=Cps*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-                }
-                else
-                {
-                    Mloc=InversePrandtlMeyer(numq+(sta::Pi()/2-Vehicle->PartsOut[PartNumber].theta[i][j])-(sta::Pi()/2-thetalim));
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=2/(gamma*Msq)*((1/pcap)*pow(1+(gamma-1)/2*pow(Mloc,2.0),-gamma/(gamma-1))-1);
-                }
+                Cp[i]=Cps*pow(sin(theta[i]),2.0);
             }
-            else if(Vehicle->PartsOut[PartNumber].theta[i][j]<0 && Type==-1)
+            else
             {
-                Mloc=InversePrandtlMeyer(thetalim-Vehicle->PartsOut[PartNumber].theta[i][j]+numq);
-                Cpcheck=(1/pcap)*pow(1+(gamma-1)/2*pow(Mloc,2.0),-gamma/(gamma-1));
-                if (Cpcheck>Cpvac)
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=Cpcheck;
-                else
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=Cpvac;
+                Mloc=InversePrandtlMeyer(numq+(sta::Pi()/2-theta[i])-(sta::Pi()/2-thetalim));
+                Cp[i]=2/(gamma*Msq)*((1/pcap)*pow(1+(gamma-1)/2*pow(Mloc,2.0),-gamma/(gamma-1))-1);
             }
         }
+        else if(theta[i]<0 && Type==-1)
+        {
+            Mloc=InversePrandtlMeyer(thetalim-theta[i]+numq);
+            Cpcheck=(1/pcap)*pow(1+(gamma-1)/2*pow(Mloc,2.0),-gamma/(gamma-1));
+            if (Cpcheck>Cpvac)
+                Cp[i]=Cpcheck;
+            else
+                Cp[i]=Cpvac;
+        }
     }
 }
 
-void AeroAnalysis::TangentWedge(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::TangentWedge(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on windward panels on said part updated with tangent wedge method
 {
@@ -777,85 +831,76 @@ void AeroAnalysis::TangentWedge(double M, int PartNumber)
     double sinth2;
     double Msq=pow(M,2.0);
     double Mns;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0)
+            if(theta[i]>0.7956)
+            {
+                Mns=M*sin(theta[i]);
+                Cp[i]=(pow(1.2*Mns+exp(-0.6*Mns),2.0)-1)/(0.6*pow(M,2.0));
+            }
+            else
             {
-                if(Vehicle->PartsOut[PartNumber].theta[i][j]>0.7956)
+                b=-1*(Msq+2)/Msq-gamma*pow(sin(theta[i]),2.0);
+                c=(2*Msq+1)/pow(Msq,2.0)+(pow(gamma+1,2.0)/4+(gamma-1)/Msq)*pow(sin(theta[i]),2.0);
+                d=-1*pow(cos(theta[i]),2.0)/pow(Msq,2.0);
+                p=(-b*b/3+c);
+                q=2*pow((b/3),3.0)-b*c/3+d;
+                if (pow(p/3,3.0)<-1*pow((q/2),2.0))
                 {
-                    Mns=M*sin(Vehicle->PartsOut[PartNumber].theta[i][j]);
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=(pow(1.2*Mns+exp(-0.6*Mns),2.0)-1)/(0.6*pow(M,2.0));
+                    omega=acos(-1*q/(2*sqrt(-1*pow(p/3,3.0))));
+                    R=-2*sqrt(-p/3)*cos(omega/3+sta::Pi()/3)-b/3;
+                    Cp[i]=4*(Msq*R-1)/((gamma+1)*Msq);
                 }
                 else
                 {
-                    b=-1*(Msq+2)/Msq-gamma*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-                    c=(2*Msq+1)/pow(Msq,2.0)+(pow(gamma+1,2.0)/4+(gamma-1)/Msq)*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-                    d=-1*pow(cos(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0)/pow(Msq,2.0);
-                    p=(-b*b/3+c);
-                    q=2*pow((b/3),3.0)-b*c/3+d;
-                    if (pow(p/3,3.0)<-1*pow((q/2),2.0))
-                    {
-                        omega=acos(-1*q/(2*sqrt(-1*pow(p/3,3.0))));
-                        R=-2*sqrt(-p/3)*cos(omega/3+sta::Pi()/3)-b/3;
-                        Vehicle->PartsOut[PartNumber].Cp[i][j]=4*(Msq*R-1)/((gamma+1)*Msq);
-                    }
-                    else
-                    {
-                        Mns=M*sin(Vehicle->PartsOut[PartNumber].theta[i][j]);
-                        Vehicle->PartsOut[PartNumber].Cp[i][j]=(pow(1.2*Mns+exp(-0.6*Mns),2.0)-1)/(0.6*pow(M,2.0));
-                    }
+                    Mns=M*sin(theta[i]);
+                    Cp[i]=(pow(1.2*Mns+exp(-0.6*Mns),2.0)-1)/(0.6*pow(M,2.0));
                 }
             }
         }
     }
 }
 
-void AeroAnalysis::TangentWedgeEmpirical(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::TangentWedgeEmpirical(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on windward panels on said part updated with empirical tangent wedge method
         //Note: relation is very close for high Mach Numbers, not quite as good for Low hypersonic, see STA-TUD-TN-1001
 {
     double Mns;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0)
-            {
-                Mns=M*sin(Vehicle->PartsOut[PartNumber].theta[i][j]);
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=(pow(1.2*Mns+exp(-0.6*Mns),2.0)-1)/(0.6*pow(M,2.0));
-            }
+            Mns=M*sin(theta[i]);
+            Cp[i]=(pow(1.2*Mns+exp(-0.6*Mns),2.0)-1)/(0.6*pow(M,2.0));
         }
     }
 }
 
-void AeroAnalysis::TangentConeEmpirical(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::TangentConeEmpirical(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on windward panels on said part updated with empirical tangent cone method
         //Note: relation is very close for high Mach Numbers, not quite as good for Low hypersonic, see STA-TUD-TN-1001
 {
     double Mns;
     double temp;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>0)
-            {
-                Mns=M*sin(Vehicle->PartsOut[PartNumber].theta[i][j]);
-                temp=pow((1.090909*Mns+exp(-0.5454545*Mns)),2);
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=(48*temp*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2))/(23*temp-5);
-            }
+            Mns=M*sin(theta[i]);
+            temp=pow((1.090909*Mns+exp(-0.5454545*Mns)),2);
+            Cp[i]=(48*temp*pow(sin(theta[i]),2))/(23*temp-5);
         }
     }
 }
 
-void AeroAnalysis::ModifiedDahlemBuck(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::ModifiedDahlemBuck(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on windward panels on said part updated with Modified Dahlem Buck method
 {
@@ -864,78 +909,69 @@ void AeroAnalysis::ModifiedDahlemBuck(double M, int PartNumber)
     double a;
     double n;
 
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0)
+            if(theta[i]>thCheck)
+                Cp[i]=2*pow(sin(theta[i]),2.0);
+            else
+                Cp[i]=(1+sin(4*pow(theta[i],0.75)))/(pow(4*cos(theta[i])*cos(2*theta[i]),0.75))*pow(sin(theta[i]),1.25);
+            if(M>20)
+                f=1.0;
+            else
             {
-                if(Vehicle->PartsOut[PartNumber].theta[i][j]>thCheck)
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=2*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-                else
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=(1+sin(4*pow(Vehicle->PartsOut[PartNumber].theta[i][j],0.75)))/(pow(4*cos(Vehicle->PartsOut[PartNumber].theta[i][j])*cos(2*Vehicle->PartsOut[PartNumber].theta[i][j]),0.75))*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),1.25);
-                if(M>20)
-                    f=1.0;
-                else
-                {
-                    a=(6-0.3*M)+sin(sta::Pi()*(log(M)-0.588)/1.20);
-                    n=1.15+0.5*sin(sta::Pi()*(log(M)-0.916)/3.29);
-                    f=1+a*pow(Vehicle->PartsOut[PartNumber].theta[i][j]*180/sta::Pi(),-1*n);
-                }
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=Vehicle->PartsOut[PartNumber].Cp[i][j]*f;
+                a=(6-0.3*M)+sin(sta::Pi()*(log(M)-0.588)/1.20);
+                n=1.15+0.5*sin(sta::Pi()*(log(M)-0.916)/3.29);
+                f=1+a*pow(theta[i]*180/sta::Pi(),-1*n);
             }
+            Cp[i]=Cp[i]*f;
         }
     }
 }
 
-void AeroAnalysis::HankeyFlatSurface(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::HankeyFlatSurface(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on windward panels on said part updated with Hankey flat surface method
 {
     double Cps;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0)
-            {
-                if(Vehicle->PartsOut[PartNumber].theta[i][j]<sta::Pi()/18)
-                    Cps=(0.195+0.222594/pow(M,0.3)-0.4)*Vehicle->PartsOut[PartNumber].theta[i][j]*180/sta::Pi()+4;
-                else
-                    Cps=1.95+0.3925/(pow(M,0.3)*tan(Vehicle->PartsOut[PartNumber].theta[i][j]));
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=Cps*pow(sin(Vehicle->PartsOut[PartNumber].theta[i][j]),2.0);
-            }
+            if(theta[i]<sta::Pi()/18)
+                Cps=(0.195+0.222594/pow(M,0.3)-0.4)*theta[i]*180/sta::Pi()+4;
+            else
+                Cps=1.95+0.3925/(pow(M,0.3)*tan(theta[i]));
+            Cp[i]=Cps*pow(sin(theta[i]),2.0);
         }
     }
 }
 
-void AeroAnalysis::SmythDeltaWing(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::SmythDeltaWing(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on windward panels on said part updated with Smyth Delta Wing method
 {
     double Mns;
     double thetac;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0)
-            {
-                if(Vehicle->PartsOut[PartNumber].theta[i][j]<sta::Pi()/180)
-                    thetac=sta::Pi()/180;
-                else
-                    thetac=Vehicle->PartsOut[PartNumber].theta[i][j];
-                Mns=M*sin(thetac);
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=1.66667*(pow(1.09*Mns+exp(-0.49*Mns),2.0)-1)/pow(M,2.0);
-            }
+            if(theta[i]<sta::Pi()/180)
+                thetac=sta::Pi()/180;
+            else
+                thetac=theta[i];
+            Mns=M*sin(thetac);
+            Cp[i]=1.66667*(pow(1.09*Mns+exp(-0.49*Mns),2.0)-1)/pow(M,2.0);
         }
     }
 }
 
-void AeroAnalysis::VanDykeUnified(double M, int PartNumber, int Type)
-        //in: Mach number, Part of the vehicle to analyze, windward/leeward type
+void AeroAnalysis::VanDykeUnified(double M, const double* theta, double* Cp, int nPanels, int Type) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels, windward/leeward type
         //out: -
         //Global variables changed: Pressure coefficients on windward (Type=1) or leeward (Type=-1) panels on said part updated with Van Dyke Unified method
 {
@@ -943,37 +979,34 @@ void AeroAnalysis::VanDykeUnified(double M, int PartNumber, int Type)
     double beta=pow(pow(M,2.0)-1,0.5);
     double CpVac=-2/(gamma*pow(M,2.0));
     double expon=2*gamma/(gamma-1);
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]>=0 && Type==1)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]>=0 && Type==1)
-            {
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=pow(Vehicle->PartsOut[PartNumber].theta[i][j],2.0)*(gammaterm+pow(pow(gammaterm,2.0)+4/(pow(Vehicle->PartsOut[PartNumber].theta[i][j]*beta,2.0)),0.5));
+            Cp[i]=pow(theta[i],2.0)*(gammaterm+pow(pow(gammaterm,2.0)+4/(pow(theta[i]*beta,2.0)),0.5));
 
-            }
-            else if(Vehicle->PartsOut[PartNumber].theta[i][j]<0 && Type==-1)
+        }
+        else if(theta[i]<0 && Type==-1)
+        {
+            if(-1*theta[i]*beta>2/(gamma-1))
+                    Cp[i]=CpVac;
+            else
             {
-                if(-1*Vehicle->PartsOut[PartNumber].theta[i][j]*beta>2/(gamma-1))
-                        Vehicle->PartsOut[PartNumber].Cp[i][j]=CpVac;
-                else
+                Cp[i]=2/(gamma*pow(beta,2.0))*(pow(1-(gamma-1)/2*-1*theta[i]*beta,expon)-1);
+                if ( Cp[i]<CpVac)
                 {
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=2/(gamma*pow(beta,2.0))*(pow(1-(gamma-1)/2*-1*Vehicle->PartsOut[PartNumber].theta[i][j]*beta,expon)-1);
-                    if ( Vehicle->PartsOut[PartNumber].Cp[i][j]<CpVac)
-                    {
-                       Vehicle->PartsOut[PartNumber].Cp[i][j]=CpVac;
-                    }
+                   Cp[i]=CpVac;
                 }
             }
-            //else
-              //  Vehicle->PartsOut[PartNumber].Cp[i][j]=0;
         }
+        //else
+          //  Cp[i]=0;
     }
 }
 
-void AeroAnalysis::PrandtlMeyerFreestream(double M, int PartNumber)
+void AeroAnalysis::PrandtlMeyerFreestream(double M, const double* theta, double* Cp, int nPanels) const
 {
-    //in: Mach number, Part of the vehicle to analyze
+    //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
     //out: -
     //Global variables changed: Pressure coefficients on leeward panels on said part updated with PM method
     //Note: currently the gamma=1.4 PM inversion is called, change if other gammas are used
@@ -982,78 +1015,66 @@ void AeroAnalysis::PrandtlMeyerFreestream(double M, int PartNumber)
     double nu0=sqrt(6)*atan(beta/sqrt(6))-atan(beta);
     double nu;
     double Mloc;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]<0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]<0)
+            nu=nu0-theta[i];
+            if(nu>numax)
             {
-                nu=nu0-Vehicle->PartsOut[PartNumber].theta[i][j];
-                if(nu>numax)
-                {
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=-2/(gamma*pow(M,2.0));
-                }
-                else
-                {
-                    Mloc=InversePrandtlMeyer(nu);
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=2/(gamma*pow(M,2.0))*(pow((1+(gamma-1)/2*pow(Mloc,2.0))/(1+(gamma-1)/2*pow(M,2.0)),-gamma/(gamma-1))-1);
-                }
+                Cp[i]=-2/(gamma*pow(M,2.0));
+            }
+            else
+            {
+                Mloc=InversePrandtlMeyer(nu);
+                Cp[i]=2/(gamma*pow(M,2.0))*(pow((1+(gamma-1)/2*pow(Mloc,2.0))/(1+(gamma-1)/2*pow(M,2.0)),-gamma/(gamma-1))-1);
             }
         }
     }
 }
 
-void AeroAnalysis::Vacuum(double M, int PartNumber)
+void AeroAnalysis::Vacuum(double M, const double* theta, double* Cp, int nPanels) const
 {
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
-        {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]<0)
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=-2/(gamma*pow(M,2.0));
-        }
+        if(theta[i]<0)
+            Cp[i]=-2/(gamma*pow(M,2.0));
     }
 }
 
-void AeroAnalysis::HighMachBase(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::HighMachBase(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on leeward panels on said part updated with High Mach base pressure methods
 {
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
-        {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]<0)
-                Vehicle->PartsOut[PartNumber].Cp[i][j]=-1/pow(M,2.0);
-        }
+        if(theta[i]<0)
+            Cp[i]=-1/pow(M,2.0);
     }
 }
 
-void AeroAnalysis::ACMempirical(double M, int PartNumber)
-        //in: Mach number, Part of the vehicle to analyze
+void AeroAnalysis::ACMempirical(double M, const double* theta, double* Cp, int nPanels) const
+        //in: Mach number, inclinations and pressure coefficients of the panels of a part, number of panels
         //out: -
         //Global variables changed: Pressure coefficients on leeward panels on said part updated with ACM empirical method
 {
     double Cpmin=-1/pow(M,2.0);
     double Cptest;
-    for(int i=0;i<Vehicle->PartsOut[PartNumber].Nlines-1;i++)
+    for(int i=0;i<nPanels;i++)
     {
-        for(int j=0;j<Vehicle->PartsOut[PartNumber].Npoints-1;j++)
+        if(theta[i]<0)
         {
-            if(Vehicle->PartsOut[PartNumber].theta[i][j]<0)
-            {
-                Cptest=180/sta::Pi()*Vehicle->PartsOut[PartNumber].theta[i][j]/(16*pow(M,2.0));
-                if(Cpmin>Cptest)
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=Cpmin;
-                else
-                    Vehicle->PartsOut[PartNumber].Cp[i][j]=Cptest;
-            }
+            Cptest=180/sta::Pi()*theta[i]/(16*pow(M,2.0));
+            if(Cpmin>Cptest)
+                Cp[i]=Cpmin;
+            else
+                Cp[i]=Cptest;
         }
     }
 }
 
-double AeroAnalysis::InversePrandtlMeyer(double nu)
+double AeroAnalysis::InversePrandtlMeyer(double nu) const
         //in: Prandtl Meyer function value
         //out: Corresponding Mach number
         //note: Correlation accurate to 5-6 digits, based on gamma=1.4, should not be used for non-terrestrial atmospheres or reacting gas
@@ -1117,7 +1138,7 @@ double AeroAnalysis::BridgeCoefs(double LowCoef, double HighCoef,double Mach,dou
     return Coef;
 }
 
-bool AeroAnalysis::fromPressureWriteList(double currentMach)
+bool AeroAnalysis::fromPressureWriteList(double currentMach) const
 {
     bool fromList=0;
     int i=0;
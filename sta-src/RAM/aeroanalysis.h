@@ -41,6 +41,9 @@
 #include <sstream>
 #include "vehiclegeometry.h"
 #include "partgeometry.h"
+#include "panelstore.h"
+#include "panelshadowing.h"
+#include <QVector>
 
 
 USING_PART_OF_NAMESPACE_EIGEN
@@ -53,45 +56,58 @@ public:
     ~AeroAnalysis();
     void GenerateDatabase(int ForceCoord, int MomentCoord);
     QList<QString> writeAeroDatabase(int ForceCoord, int MomentCoord);
+    QString writeBinaryDatabase(int ForceCoord, int MomentCoord);
     void writeDetailGeomInfo();
-    void writePressures(double M, double a, double b);
+    void writePressures(double M, double a, double b, const double* const* theta, const double* const* Cp) const;
     void setIndepVariablesTranslation(double* AttitudeRefs, double Mmin, double Mmax, int RegimeType);
     void setIndepVariablesFull(int SimType, double* AttitudeBounds, double Mmin, double Mmax, int RegimeType);
+
+    int CaseIndex(int BetaIndex, int AlphaIndex, int MachIndex) const { return (BetaIndex*nAlpha+AlphaIndex)*nMach+MachIndex; }
+    double VehicleCoef(int Case, int Coef) const { return VehicleCoefs[Case*CoefsOut+Coef]; }
 private:
-    double* DetermineVehicleCoefs(double M, double alpha, double beta, int ForceCoord, int MomentCoord);
-    double* DeterminePartCoefs(int PartNumber, double M, double alpha, double beta, int ForceCoord, int MomentCoord);
-    void DeterminePressureCoefs(int PartNumber,double M);
+    //Range of attitudes (beta*nAlpha+alpha) evaluated by one database worker
+    struct DatabaseBlock
+    {
+        AeroAnalysis* Parent;
+        int FirstAttitude;
+        int LastAttitude;
+        int ForceCoord;
+        int MomentCoord;
+        const unsigned char* Shadows;//shadowed panels of the vehicle per attitude, NULL without shadowing
+    };
+
+    static void EvaluateDatabaseBlock(DatabaseBlock& Block);
+
+    void DetermineVehicleCoefs(double M, double alpha, double beta, int ForceCoord, int MomentCoord, const double* const* theta, double* const* Cp, const unsigned char* const* Shadowed, double* Coefs) const;
+    void DeterminePartCoefs(int PartNumber, double M, double alpha, double beta, int ForceCoord, int MomentCoord, const double* theta, double* Cp, const unsigned char* Shadowed, double* Coefs) const;
+    void DeterminePressureCoefs(int PartNumber, double M, const double* theta, double* Cp) const;
     void PrintCoeffcients(FILE * fid,int coef);
-    bool fromPressureWriteList(double currentMach);
-
-    void DetermineInclination(int PartNumber, double alpha, double beta);
+    bool fromPressureWriteList(double currentMach) const;
 
     void setMachRange(double Mmin, double Mmax);
     double BridgeCoefs(double LowCoef, double HighCoef,double Mach,double Mlow, double Mhigh);
 
-    double* getForceCoefs(int PartNumber);
-    double* getMomentCoefs(int PartNumber);
-
-    void UpdateCompressionCp(double M, int PartNumber);
-    void UpdateExpansionCp(double M, int PartNumber);
-    void setStagnationPressure(double M);
-
-    void Newtonian(double M, int PartNumber);
-    void ModifiedNewtonian(double M, int PartNumber, int Type);
-    void ModifiedNewtonianPrandtlMeyer(double M, int PartNumber,int Type);
-    void TangentWedge(double M, int PartNumber);
-    void TangentWedgeEmpirical(double M, int PartNumber);
-    void TangentConeEmpirical(double M, int PartNumber);
-    void ModifiedDahlemBuck(double M, int PartNumber);
-    void VanDykeUnified(double M, int PartNumber,int Type);
-    void SmythDeltaWing(double M, int PartNumber);
-    void HankeyFlatSurface(double M, int PartNumber);
-    void Vacuum(double M, int PartNumber);
-    void PrandtlMeyerFreestream(double M, int PartNumber);
-    void HighMachBase(double M, int PartNumber);
-    void ACMempirical(double M, int PartNumber);
-
-    double InversePrandtlMeyer(double nu);
+    void UpdateCompressionCp(double M, int PartNumber, const double* theta, double* Cp) const;
+    void UpdateExpansionCp(double M, int PartNumber, const double* theta, double* Cp) const;
+    double StagnationPressure(double M) const;
+
+    //Pressure coefficient methods, updating Cp of the nPanels panels of a part from their inclinations theta
+    void Newtonian(double M, const double* theta, double* Cp, int nPanels) const;
+    void ModifiedNewtonian(double M, const double* theta, double* Cp, int nPanels, int Type) const;
+    void ModifiedNewtonianPrandtlMeyer(double M, const double* theta, double* Cp, int nPanels, int Type) const;
+    void TangentWedge(double M, const double* theta, double* Cp, int nPanels) const;
+    void TangentWedgeEmpirical(double M, const double* theta, double* Cp, int nPanels) const;
+    void TangentConeEmpirical(double M, const double* theta, double* Cp, int nPanels) const;
+    void ModifiedDahlemBuck(double M, const double* theta, double* Cp, int nPanels) const;
+    void VanDykeUnified(double M, const double* theta, double* Cp, int nPanels, int Type) const;
+    void SmythDeltaWing(double M, const double* theta, double* Cp, int nPanels) const;
+    void HankeyFlatSurface(double M, const double* theta, double* Cp, int nPanels) const;
+    void Vacuum(double M, const double* theta, double* Cp, int nPanels) const;
+    void PrandtlMeyerFreestream(double M, const double* theta, double* Cp, int nPanels) const;
+    void HighMachBase(double M, const double* theta, double* Cp, int nPanels) const;
+    void ACMempirical(double M, const double* theta, double* Cp, int nPanels) const;
+
+    double InversePrandtlMeyer(double nu) const;
 
 public:
     double InversePrandtlMeyerPrecise(double Mach);
@@ -107,17 +123,18 @@ public:
     int nCases;
     int AnalysisType; //2: bridged 1: high hypersonic, 0:low hypersonic
     VehicleGeometry* Vehicle;
-    double** VehicleCoefs;
+    double* VehicleCoefs;//nCases x CoefsOut, row CaseIndex(beta,alpha,Mach)
     Vector3d MomentRef;
     double cref;
     double Sref;
     int** SelectedMethods;
+    QVector<PanelStore> Panels;//flattened panels of each part
+    bool Shadowing;//determine the panels shadowed by other panels of the vehicle before the pressures
 
 private:
     void writeCoefFile(QString filename, int coef);
 
     double gamma;
-    double Cps;
     QList<double> writeAeroList;
     bool writeGeom;
     static const double IPM1=1.3604;
@@ -0,0 +1,296 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "aerodatabase.h"
+#include <QDebug>
+#include <algorithm>
+#include <string.h>
+
+static const char Magic[8] = { 'S', 'T', 'A', 'A', 'E', 'R', 'O', '\0' };
+static const quint32 ByteOrderMark = 0x01020304;
+static const int HeaderSize = 32;
+
+// Size of the block of coefficient identifiers, padded to keep the doubles aligned
+static int idBlockSize(int nCoefs)
+{
+    return (nCoefs * 4 + 7) / 8 * 8;
+}
+
+
+// Find the interval [x_i, x_i1] of an increasing axis containing v and the
+// interpolation weight of x_i1. Values outside the axis are clamped.
+static void bracket(const double* x, int n, double v, int& i, int& i1, double& t)
+{
+    if (n == 1 || v <= x[0])
+    {
+        i = i1 = 0;
+        t = 0.0;
+    }
+    else if (v >= x[n - 1])
+    {
+        i = i1 = n - 1;
+        t = 0.0;
+    }
+    else
+    {
+        i = int(std::upper_bound(x, x + n, v) - x) - 1;
+        i1 = i + 1;
+        t = (v - x[i]) / (x[i1] - x[i]);
+    }
+}
+
+
+AeroDatabase::AeroDatabase() :
+    m_nMach(0),
+    m_nAlpha(0),
+    m_nBeta(0),
+    m_nCoefs(0),
+    m_machs(NULL),
+    m_alphas(NULL),
+    m_betas(NULL),
+    m_values(NULL)
+{
+}
+
+
+AeroDatabase::~AeroDatabase()
+{
+}
+
+
+bool AeroDatabase::load(const QString& fileName)
+{
+    m_values = NULL;
+    m_file.close();
+    m_buffer.clear();
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        qDebug() << "AeroDatabase: unable to open" << fileName;
+        return false;
+    }
+
+    qint64 size = m_file.size();
+    const uchar* data = m_file.map(0, size);
+    if (!data)
+    {
+        m_buffer = m_file.readAll();
+        data = reinterpret_cast<const uchar*>(m_buffer.constData());
+    }
+
+    quint32 header[6];
+    if (size < HeaderSize || memcmp(data, Magic, 8) != 0)
+    {
+        qDebug() << "AeroDatabase:" << fileName << "is not an aerodynamic database";
+        return false;
+    }
+    memcpy(header, data + 8, sizeof(header));
+
+    if (header[1] != ByteOrderMark)
+    {
+        qDebug() << "AeroDatabase:" << fileName << "was written with a different byte order";
+        return false;
+    }
+    if (header[0] != Version)
+    {
+        qDebug() << "AeroDatabase:" << fileName << "has unsupported version" << header[0];
+        return false;
+    }
+
+    int nMach = header[2];
+    int nAlpha = header[3];
+    int nBeta = header[4];
+    int nCoefs = header[5];
+    if (nMach < 1 || nAlpha < 1 || nBeta < 1 || nCoefs < 1)
+    {
+        qDebug() << "AeroDatabase:" << fileName << "has an empty dimension";
+        return false;
+    }
+
+    qint64 axesOffset = HeaderSize + idBlockSize(nCoefs);
+    qint64 valuesOffset = axesOffset + qint64(nMach + nAlpha + nBeta) * sizeof(double);
+    qint64 expectedSize = valuesOffset + qint64(nMach) * nAlpha * nBeta * nCoefs * sizeof(double);
+    if (size < expectedSize)
+    {
+        qDebug() << "AeroDatabase:" << fileName << "is truncated";
+        return false;
+    }
+
+    m_ids.resize(nCoefs);
+    for (int c = 0; c < nCoefs; c++)
+    {
+        quint32 id;
+        memcpy(&id, data + HeaderSize + c * 4, 4);
+        m_ids[c] = id;
+    }
+
+    m_nMach = nMach;
+    m_nAlpha = nAlpha;
+    m_nBeta = nBeta;
+    m_nCoefs = nCoefs;
+    m_machs = reinterpret_cast<const double*>(data + axesOffset);
+    m_alphas = m_machs + nMach;
+    m_betas = m_alphas + nAlpha;
+    m_values = reinterpret_cast<const double*>(data + valuesOffset);
+
+    return true;
+}
+
+
+int AeroDatabase::column(Coefficient coefficient) const
+{
+    return m_ids.indexOf(coefficient);
+}
+
+
+void AeroDatabase::interpolate(double mach, double alpha, double beta, int firstColumn, int nColumns, double* out) const
+{
+    int m0, m1, a0, a1, b0, b1;
+    double tm, ta, tb;
+    bracket(m_machs, m_nMach, mach, m0, m1, tm);
+    bracket(m_alphas, m_nAlpha, alpha, a0, a1, ta);
+    bracket(m_betas, m_nBeta, beta, b0, b1, tb);
+
+    // Corners of the cell and their weights
+    const double* node[8];
+    double weight[8];
+    int k = 0;
+    for (int ib = 0; ib < 2; ib++)
+    {
+        int b = ib ? b1 : b0;
+        double wb = ib ? tb : 1.0 - tb;
+        for (int ia = 0; ia < 2; ia++)
+        {
+            int a = ia ? a1 : a0;
+            double wa = ia ? ta : 1.0 - ta;
+            for (int im = 0; im < 2; im++, k++)
+            {
+                int m = im ? m1 : m0;
+                double wm = im ? tm : 1.0 - tm;
+                node[k] = m_values + ((b * m_nAlpha + a) * m_nMach + m) * m_nCoefs + firstColumn;
+                weight[k] = wb * wa * wm;
+            }
+        }
+    }
+
+    for (int c = 0; c < nColumns; c++)
+    {
+        double value = 0.0;
+        for (k = 0; k < 8; k++)
+        {
+            value += weight[k] * node[k][c];
+        }
+        out[c] = value;
+    }
+}
+
+
+double AeroDatabase::coefficient(Coefficient coefficient, double mach, double alpha, double beta) const
+{
+    int c = column(coefficient);
+    if (c < 0 || !isLoaded())
+    {
+        return 0.0;
+    }
+
+    double value;
+    interpolate(mach, alpha, beta, c, 1, &value);
+    return value;
+}
+
+
+void AeroDatabase::coefficients(double mach, double alpha, double beta, double* out) const
+{
+    if (!isLoaded())
+    {
+        for (int c = 0; c < m_nCoefs; c++)
+        {
+            out[c] = 0.0;
+        }
+        return;
+    }
+
+    interpolate(mach, alpha, beta, 0, m_nCoefs, out);
+}
+
+
+bool AeroDatabase::machProfile(Coefficient coefficient, double alpha, double beta,
+                               QVector<double>& mach, QVector<double>& values) const
+{
+    if (!isLoaded() || !hasCoefficient(coefficient))
+    {
+        return false;
+    }
+
+    mach.resize(m_nMach);
+    values.resize(m_nMach);
+    for (int i = 0; i < m_nMach; i++)
+    {
+        mach[i] = m_machs[i];
+        values[i] = this->coefficient(coefficient, m_machs[i], alpha, beta);
+    }
+
+    return true;
+}
+
+
+bool AeroDatabase::write(const QString& fileName,
+                         int nMach, const double* machs,
+                         int nAlpha, const double* alphas,
+                         int nBeta, const double* betas,
+                         int nCoefs, const int* coefficientIds, const double* values)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qDebug() << "AeroDatabase: unable to write" << fileName;
+        return false;
+    }
+
+    quint32 header[6] = { Version, ByteOrderMark, quint32(nMach), quint32(nAlpha), quint32(nBeta), quint32(nCoefs) };
+    QByteArray ids(idBlockSize(nCoefs), '\0');
+    for (int c = 0; c < nCoefs; c++)
+    {
+        quint32 id = coefficientIds[c];
+        memcpy(ids.data() + c * 4, &id, 4);
+    }
+
+    qint64 nValues = qint64(nMach) * nAlpha * nBeta * nCoefs;
+    bool ok = file.write(Magic, 8) == 8 &&
+              file.write(reinterpret_cast<const char*>(header), sizeof(header)) == sizeof(header) &&
+              file.write(ids) == ids.size() &&
+              file.write(reinterpret_cast<const char*>(machs), nMach * sizeof(double)) == qint64(nMach * sizeof(double)) &&
+              file.write(reinterpret_cast<const char*>(alphas), nAlpha * sizeof(double)) == qint64(nAlpha * sizeof(double)) &&
+              file.write(reinterpret_cast<const char*>(betas), nBeta * sizeof(double)) == qint64(nBeta * sizeof(double)) &&
+              file.write(reinterpret_cast<const char*>(values), nValues * sizeof(double)) == qint64(nValues * sizeof(double));
+    if (!ok)
+    {
+        qDebug() << "AeroDatabase: error while writing" << fileName;
+    }
+
+    return ok;
+}
+
+
+bool AeroDatabase::isDatabaseFile(const QString& fileName)
+{
+    return fileName.endsWith(".stadb", Qt::CaseInsensitive);
+}
@@ -0,0 +1,149 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef AERODATABASE_H
+#define AERODATABASE_H
+
+#include <QString>
+#include <QFile>
+#include <QByteArray>
+#include <QVector>
+
+
+/**
+ * Binary aerodynamic database: coefficients tabulated over Mach number, angle
+ * of attack and sideslip angle, as generated by RAM.
+ *
+ * File layout (version 1, native byte order, all blocks 8-byte aligned):
+ *   char[8]  magic "STAAERO"
+ *   quint32  version, byte order mark 0x01020304
+ *   quint32  number of Mach numbers, angles of attack, sideslip angles and coefficients
+ *   quint32  coefficient identifiers (AeroDatabase::Coefficient), padded to 8 bytes
+ *   double   Mach numbers, angles of attack (rad), sideslip angles (rad)
+ *   double   coefficients, all the coefficients of a (Mach, alpha, beta) node
+ *            together, nodes ordered by beta, then alpha, then Mach
+ *
+ * The file is memory mapped when possible, so opening even a large database
+ * costs no parsing. A loaded database is never modified and its lookups can
+ * be called from several threads.
+ */
+class AeroDatabase
+{
+public:
+    enum Coefficient
+    {
+        CA = 0,   // body axes forces
+        CY = 1,
+        CN = 2,
+        CD = 3,   // wind axes forces
+        CS = 4,
+        CL = 5,
+        Cl = 6,   // body axes moments
+        Cm = 7,
+        Cn = 8,
+        Clpr = 9, // wind axes moments
+        Cmpr = 10,
+        Cnpr = 11
+    };
+
+    static const quint32 Version = 1;
+
+    AeroDatabase();
+    ~AeroDatabase();
+
+    /**
+     * Load a database file. Return false, with a debug message, if the file
+     * can't be read or isn't a valid database.
+     */
+    bool load(const QString& fileName);
+    bool isLoaded() const { return m_values != NULL; }
+
+    int machCount() const { return m_nMach; }
+    int alphaCount() const { return m_nAlpha; }
+    int betaCount() const { return m_nBeta; }
+    int coefficientCount() const { return m_nCoefs; }
+    const double* machs() const { return m_machs; }
+    const double* alphas() const { return m_alphas; }
+    const double* betas() const { return m_betas; }
+
+    /**
+     * Column of a coefficient in the database, -1 if it isn't tabulated
+     */
+    int column(Coefficient coefficient) const;
+    bool hasCoefficient(Coefficient coefficient) const { return column(coefficient) >= 0; }
+
+    /**
+     * Multilinear interpolation of a coefficient at (mach, alpha, beta), angles
+     * in rad. Outside the tabulated ranges the nearest value is returned; 0 is
+     * returned for a coefficient that isn't in the database.
+     */
+    double coefficient(Coefficient coefficient, double mach, double alpha, double beta) const;
+    /**
+     * Interpolate all the coefficients at once, in the column order of the
+     * file. The coefficients are 0 if no database is loaded.
+     */
+    void coefficients(double mach, double alpha, double beta, double* out) const;
+
+    /**
+     * Coefficient as a function of the Mach number at a fixed attitude, for the
+     * models that only depend on the Mach number. Return false if the
+     * coefficient isn't in the database.
+     */
+    bool machProfile(Coefficient coefficient, double alpha, double beta,
+                     QVector<double>& mach, QVector<double>& values) const;
+
+    /**
+     * Write a database file. values holds nCoefs coefficients per node, with
+     * the layout described above.
+     */
+    static bool write(const QString& fileName,
+                      int nMach, const double* machs,
+                      int nAlpha, const double* alphas,
+                      int nBeta, const double* betas,
+                      int nCoefs, const int* coefficientIds, const double* values);
+
+    /**
+     * Return true if fileName names a binary database rather than a text coefficient file
+     */
+    static bool isDatabaseFile(const QString& fileName);
+
+private:
+    // Not copyable: the axes and values may point into the mapped file
+    AeroDatabase(const AeroDatabase&);
+    AeroDatabase& operator=(const AeroDatabase&);
+
+    void interpolate(double mach, double alpha, double beta, int firstColumn, int nColumns, double* out) const;
+
+    QFile m_file;
+    QByteArray m_buffer;  // file contents when it can't be mapped
+
+    int m_nMach;
+    int m_nAlpha;
+    int m_nBeta;
+    int m_nCoefs;
+    QVector<int> m_ids;
+    const double* m_machs;
+    const double* m_alphas;
+    const double* m_betas;
+    const double* m_values;
+};
+
+#endif // AERODATABASE_H
@@ -0,0 +1,366 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "panelshadowing.h"
+#include <QList>
+#include <QThread>
+#include <QtConcurrentMap>
+#include <algorithm>
+#include <math.h>
+
+// Maximum number of triangles in a leaf of the hierarchy
+static const int LeafSize = 4;
+// Depth limit of the traversal stack; median splits keep the tree much shallower
+static const int MaxDepth = 64;
+// Number of panel blocks per thread, to balance the unequal cost of the rays
+static const int BlocksPerThread = 4;
+
+
+// Orders triangle indices by the coordinate of their centers along one axis
+struct CenterLess
+{
+    CenterLess(const QVector<double>& _Centers) : Centers(_Centers) {}
+    bool operator()(int a, int b) const { return Centers[a] < Centers[b]; }
+    const QVector<double>& Centers;
+};
+
+
+PanelShadowing::PanelShadowing(const VehicleGeometry& Vehicle, const QVector<PanelStore>& Panels)
+{
+    int p, i, j, c;
+    int nTotal = 0;
+    for (p = 0; p < Panels.size(); p++)
+    {
+        PartOffsets.append(nTotal);
+        nTotal += Panels[p].nPanels();
+    }
+
+    for (c = 0; c < 3; c++)
+    {
+        Normal[c].resize(nTotal);
+        Centroid[c].resize(nTotal);
+    }
+
+    double Min[3] = { 0.0, 0.0, 0.0 };
+    double Max[3] = { 0.0, 0.0, 0.0 };
+    for (p = 0; p < Panels.size(); p++)
+    {
+        const PanelStore& Store = Panels[p];
+        for (i = 0; i < Store.nPanels(); i++)
+        {
+            for (c = 0; c < 3; c++)
+            {
+                Normal[c][PartOffsets[p] + i] = Store.Normal[c][i];
+                Centroid[c][PartOffsets[p] + i] = Store.Centroid[c][i];
+            }
+        }
+
+        // Two triangles per panel, along the diagonals used for the panel normals
+        const PartGeometry& Part = Vehicle.PartsOut[p];
+        int k = PartOffsets[p];
+        for (i = 0; i < Part.Nlines - 1; i++)
+        {
+            for (j = 0; j < Part.Npoints - 1; j++, k++)
+            {
+                AddTriangle(Part.PointsVec[i][j], Part.PointsVec[i + 1][j], Part.PointsVec[i + 1][j + 1], k);
+                AddTriangle(Part.PointsVec[i][j], Part.PointsVec[i + 1][j + 1], Part.PointsVec[i][j + 1], k);
+            }
+        }
+    }
+
+    int nTriangles = Triangles.size();
+    QVector<double> Centers[3];
+    QVector<int> Order(nTriangles);
+    for (c = 0; c < 3; c++)
+    {
+        Centers[c].resize(nTriangles);
+    }
+    for (i = 0; i < nTriangles; i++)
+    {
+        const Triangle& T = Triangles[i];
+        Order[i] = i;
+        for (c = 0; c < 3; c++)
+        {
+            Centers[c][i] = T.Vertex[c] + (T.Edge1[c] + T.Edge2[c]) / 3.0;
+            double v1 = T.Vertex[c] + T.Edge1[c];
+            double v2 = T.Vertex[c] + T.Edge2[c];
+            double lo = qMin(T.Vertex[c], qMin(v1, v2));
+            double hi = qMax(T.Vertex[c], qMax(v1, v2));
+            Min[c] = i == 0 ? lo : qMin(Min[c], lo);
+            Max[c] = i == 0 ? hi : qMax(Max[c], hi);
+        }
+    }
+
+    double Diagonal = sqrt((Max[0] - Min[0]) * (Max[0] - Min[0]) +
+                           (Max[1] - Min[1]) * (Max[1] - Min[1]) +
+                           (Max[2] - Min[2]) * (Max[2] - Min[2]));
+    Offset = 1e-6 * Diagonal;
+
+    if (nTriangles > 0)
+    {
+        BuildNode(Order, Centers, 0, nTriangles);
+    }
+
+    // Store the triangles in the order of the leaves
+    QVector<Triangle> Sorted(nTriangles);
+    for (i = 0; i < nTriangles; i++)
+    {
+        Sorted[i] = Triangles[Order[i]];
+    }
+    Triangles = Sorted;
+}
+
+
+void PanelShadowing::AddTriangle(const MyVector3d& P0, const MyVector3d& P1, const MyVector3d& P2, int Panel)
+{
+    MyVector3d Edge1 = P1 - P0;
+    MyVector3d Edge2 = P2 - P0;
+
+    // Collapsed triangles, e.g. at the nose of a part, can't hide anything
+    if (Edge1.cross(Edge2).norm() == 0.0)
+    {
+        return;
+    }
+
+    Triangle T;
+    for (int c = 0; c < 3; c++)
+    {
+        T.Vertex[c] = P0(c);
+        T.Edge1[c] = Edge1(c);
+        T.Edge2[c] = Edge2(c);
+    }
+    T.Panel = Panel;
+    Triangles.append(T);
+}
+
+
+/**
+ * Build the node of the triangles Order[First..First+Count-1], splitting them
+ * at the median of their centers along the longest axis of their bounding box.
+ * Return the index of the node.
+ */
+int PanelShadowing::BuildNode(QVector<int>& Order, const QVector<double>* Centers, int First, int Count)
+{
+    int c, i, v;
+    Node N;
+    for (c = 0; c < 3; c++)
+    {
+        N.Min[c] = 1e300;
+        N.Max[c] = -1e300;
+    }
+    for (i = First; i < First + Count; i++)
+    {
+        const Triangle& T = Triangles[Order[i]];
+        for (v = 0; v < 3; v++)
+        {
+            for (c = 0; c < 3; c++)
+            {
+                double x = T.Vertex[c] + (v == 1 ? T.Edge1[c] : 0.0) + (v == 2 ? T.Edge2[c] : 0.0);
+                N.Min[c] = qMin(N.Min[c], x);
+                N.Max[c] = qMax(N.Max[c], x);
+            }
+        }
+    }
+    N.First = First;
+    N.Count = Count;
+    N.Right = -1;
+
+    int Index = Nodes.size();
+    Nodes.append(N);
+    if (Count <= LeafSize)
+    {
+        return Index;
+    }
+
+    int Axis = 0;
+    for (c = 1; c < 3; c++)
+    {
+        if (N.Max[c] - N.Min[c] > N.Max[Axis] - N.Min[Axis])
+        {
+            Axis = c;
+        }
+    }
+
+    int Half = Count / 2;
+    int* Begin = Order.data() + First;
+    std::nth_element(Begin, Begin + Half, Begin + Count, CenterLess(Centers[Axis]));
+
+    Nodes[Index].Count = 0;
+    BuildNode(Order, Centers, First, Half);
+    int Right = BuildNode(Order, Centers, First + Half, Count - Half);
+    Nodes[Index].Right = Right;
+
+    return Index;
+}
+
+
+/**
+ * Return true if the ray Origin + t*Direction, t > 0, hits a triangle that
+ * doesn't belong to Panel
+ */
+bool PanelShadowing::Occluded(const double* Origin, const double* Direction, int Panel) const
+{
+    if (Nodes.isEmpty())
+    {
+        return false;
+    }
+
+    int c;
+    double InvDirection[3];
+    for (c = 0; c < 3; c++)
+    {
+        InvDirection[c] = 1.0 / (Direction[c] != 0.0 ? Direction[c] : 1e-300);
+    }
+
+    int Stack[MaxDepth];
+    int nStack = 0;
+    Stack[nStack++] = 0;
+    while (nStack > 0)
+    {
+        int Index = Stack[--nStack];
+        const Node& N = Nodes[Index];
+
+        // Slab test of the bounding box
+        double tNear = 0.0;
+        double tFar = 1e300;
+        for (c = 0; c < 3; c++)
+        {
+            double t1 = (N.Min[c] - Origin[c]) * InvDirection[c];
+            double t2 = (N.Max[c] - Origin[c]) * InvDirection[c];
+            tNear = qMax(tNear, qMin(t1, t2));
+            tFar = qMin(tFar, qMax(t1, t2));
+        }
+        if (tNear > tFar)
+        {
+            continue;
+        }
+
+        if (N.Count == 0)
+        {
+            if (nStack + 2 > MaxDepth)
+            {
+                // Can't happen with median splits; better miss a shadow than overflow
+                continue;
+            }
+            Stack[nStack++] = N.Right;
+            Stack[nStack++] = Index + 1;
+            continue;
+        }
+
+        for (int i = N.First; i < N.First + N.Count; i++)
+        {
+            const Triangle& T = Triangles[i];
+            if (T.Panel == Panel)
+            {
+                continue;
+            }
+
+            // Moller-Trumbore ray/triangle intersection
+            double P[3], Q[3], S[3];
+            P[0] = Direction[1] * T.Edge2[2] - Direction[2] * T.Edge2[1];
+            P[1] = Direction[2] * T.Edge2[0] - Direction[0] * T.Edge2[2];
+            P[2] = Direction[0] * T.Edge2[1] - Direction[1] * T.Edge2[0];
+            double Det = T.Edge1[0] * P[0] + T.Edge1[1] * P[1] + T.Edge1[2] * P[2];
+            if (Det == 0.0)
+            {
+                continue;
+            }
+            double InvDet = 1.0 / Det;
+            for (c = 0; c < 3; c++)
+            {
+                S[c] = Origin[c] - T.Vertex[c];
+            }
+            double u = (S[0] * P[0] + S[1] * P[1] + S[2] * P[2]) * InvDet;
+            if (u < 0.0 || u > 1.0)
+            {
+                continue;
+            }
+            Q[0] = S[1] * T.Edge1[2] - S[2] * T.Edge1[1];
+            Q[1] = S[2] * T.Edge1[0] - S[0] * T.Edge1[2];
+            Q[2] = S[0] * T.Edge1[1] - S[1] * T.Edge1[0];
+            double v = (Direction[0] * Q[0] + Direction[1] * Q[1] + Direction[2] * Q[2]) * InvDet;
+            if (v < 0.0 || u + v > 1.0)
+            {
+                continue;
+            }
+            double t = (T.Edge2[0] * Q[0] + T.Edge2[1] * Q[1] + T.Edge2[2] * Q[2]) * InvDet;
+            if (t > 0.0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+void PanelShadowing::DetermineBlockShadows(ShadowBlock& Block)
+{
+    const PanelShadowing* Parent = Block.Parent;
+    const double* d = Block.Direction;
+    for (int i = Block.FirstPanel; i < Block.LastPanel; i++)
+    {
+        double n[3];
+        double Origin[3];
+        for (int c = 0; c < 3; c++)
+        {
+            n[c] = Parent->Normal[c][i];
+        }
+
+        // Leeward panels are left to the expansion methods
+        if (n[0] * d[0] + n[1] * d[1] + n[2] * d[2] <= 0.0)
+        {
+            Block.Shadowed[i] = 0;
+            continue;
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            Origin[c] = Parent->Centroid[c][i] + Parent->Offset * n[c];
+        }
+        Block.Shadowed[i] = Parent->Occluded(Origin, d, i) ? 1 : 0;
+    }
+}
+
+
+void PanelShadowing::DetermineShadows(double alpha, double beta, unsigned char* Shadowed) const
+{
+    int n = nPanels();
+    int nBlocks = qBound(1, BlocksPerThread * QThread::idealThreadCount(), qMax(1, n));
+
+    QList<ShadowBlock> Blocks;
+    for (int i = 0; i < nBlocks; i++)
+    {
+        ShadowBlock Block;
+        Block.Parent = this;
+        // Towards the free stream, opposite to the velocity in the body frame
+        Block.Direction[0] = -cos(alpha) * cos(beta);
+        Block.Direction[1] = sin(beta);
+        Block.Direction[2] = -sin(alpha) * cos(beta);
+        Block.FirstPanel = int(qint64(i) * n / nBlocks);
+        Block.LastPanel = int(qint64(i + 1) * n / nBlocks);
+        Block.Shadowed = Shadowed;
+        Blocks.append(Block);
+    }
+
+    QtConcurrent::blockingMap(Blocks, DetermineBlockShadows);
+}
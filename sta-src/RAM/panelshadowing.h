@@ -0,0 +1,102 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef PANELSHADOWING_H
+#define PANELSHADOWING_H
+
+#include <QVector>
+#include "vehiclegeometry.h"
+#include "panelstore.h"
+
+
+/**
+ * Self-shadowing of the panels of a vehicle. A windward panel is shadowed
+ * when the ray from its centroid towards the free stream hits another panel
+ * of the vehicle, of any part.
+ *
+ * The panels are split in two triangles each and stored in a bounding volume
+ * hierarchy built once per vehicle, so a shadow ray only visits the few
+ * triangles along its path. The shadows only depend on the attitude: they
+ * are determined once per (alpha, beta) and shared by all Mach numbers.
+ * Panels are numbered over the whole vehicle, part after part, in the order
+ * of the PanelStore of each part.
+ */
+class PanelShadowing
+{
+public:
+    PanelShadowing(const VehicleGeometry& Vehicle, const QVector<PanelStore>& Panels);
+
+    int nPanels() const { return Normal[0].size(); }
+    /**
+     * Index of the first panel of a part in the vehicle numbering
+     */
+    int PartOffset(int PartNumber) const { return PartOffsets[PartNumber]; }
+
+    /**
+     * Shadowed[i] is set to 1 if panel i faces the free stream at attitude
+     * alpha, beta (rad) and is hidden by another panel, to 0 otherwise. The
+     * panels are processed concurrently on the global thread pool.
+     */
+    void DetermineShadows(double alpha, double beta, unsigned char* Shadowed) const;
+
+private:
+    struct Triangle
+    {
+        double Vertex[3];
+        double Edge1[3];
+        double Edge2[3];
+        int Panel;
+    };
+
+    // Bounding box of the triangles First..First+Count-1. Inner nodes have
+    // Count 0, their first child follows them and Right is the second one.
+    struct Node
+    {
+        double Min[3];
+        double Max[3];
+        int First;
+        int Count;
+        int Right;
+    };
+
+    struct ShadowBlock
+    {
+        const PanelShadowing* Parent;
+        double Direction[3];
+        int FirstPanel;
+        int LastPanel;
+        unsigned char* Shadowed;
+    };
+
+    void AddTriangle(const MyVector3d& P0, const MyVector3d& P1, const MyVector3d& P2, int Panel);
+    int BuildNode(QVector<int>& Order, const QVector<double>* Centers, int First, int Count);
+    bool Occluded(const double* Origin, const double* Direction, int Panel) const;
+    static void DetermineBlockShadows(ShadowBlock& Block);
+
+    QVector<Triangle> Triangles;
+    QVector<Node> Nodes;
+    QVector<int> PartOffsets;
+    QVector<double> Normal[3];
+    QVector<double> Centroid[3];
+    double Offset; // distance of the ray origins from the panels
+};
+
+#endif // PANELSHADOWING_H
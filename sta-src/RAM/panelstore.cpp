@@ -0,0 +1,137 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "panelstore.h"
+#include <math.h>
+
+// Number of panels of a tile of the batched inclination kernel
+static const int InclinationTile = 512;
+
+
+PanelStore::PanelStore()
+{
+}
+
+
+PanelStore::PanelStore(const PartGeometry& Part)
+{
+    int n = (Part.Nlines - 1) * (Part.Npoints - 1);
+    if (n <= 0)
+    {
+        return;
+    }
+
+    Area.resize(n);
+    for (int c = 0; c < 3; c++)
+    {
+        Normal[c].resize(n);
+        Centroid[c].resize(n);
+        AreaNormal[c].resize(n);
+        AreaMoment[c].resize(n);
+    }
+
+    int k = 0;
+    for (int i = 0; i < Part.Nlines - 1; i++)
+    {
+        for (int j = 0; j < Part.Npoints - 1; j++, k++)
+        {
+            const MyVector3d& normal = Part.Normal[i][j];
+            const MyVector3d& centroid = Part.Centroid[i][j];
+            double area = Part.Area[i][j];
+            MyVector3d moment = area * centroid.cross(normal);
+
+            Area[k] = area;
+            for (int c = 0; c < 3; c++)
+            {
+                Normal[c][k] = normal(c);
+                Centroid[c][k] = centroid(c);
+                AreaNormal[c][k] = area * normal(c);
+                AreaMoment[c][k] = moment(c);
+            }
+        }
+    }
+}
+
+
+void PanelStore::DetermineInclination(double alpha, double beta, double* theta) const
+{
+    DetermineInclinations(&alpha, &beta, 1, theta);
+}
+
+
+void PanelStore::DetermineInclinations(const double* alphas, const double* betas, int nAttitudes, double* theta) const
+{
+    int n = nPanels();
+    const double* nx = Normal[0].constData();
+    const double* ny = Normal[1].constData();
+    const double* nz = Normal[2].constData();
+
+    for (int start = 0; start < n; start += InclinationTile)
+    {
+        int end = qMin(n, start + InclinationTile);
+        for (int a = 0; a < nAttitudes; a++)
+        {
+            // Free stream direction in the body frame
+            double vx = cos(alphas[a]) * cos(betas[a]);
+            double vy = -sin(betas[a]);
+            double vz = sin(alphas[a]) * cos(betas[a]);
+            double* out = theta + a * n;
+            for (int i = start; i < end; i++)
+            {
+                // pi/2 - acos(cos(delta)), with cos(delta) = -n.Vinf
+                out[i] = asin(-(nx[i] * vx + ny[i] * vy + nz[i] * vz));
+            }
+        }
+    }
+}
+
+
+void PanelStore::ForceMoment(const double* Cp, const Eigen::Vector3d& MomentRef, double* Force, double* Moment) const
+{
+    int n = nPanels();
+    const double* anx = AreaNormal[0].constData();
+    const double* any = AreaNormal[1].constData();
+    const double* anz = AreaNormal[2].constData();
+    const double* amx = AreaMoment[0].constData();
+    const double* amy = AreaMoment[1].constData();
+    const double* amz = AreaMoment[2].constData();
+
+    double fx = 0.0, fy = 0.0, fz = 0.0;
+    double mx = 0.0, my = 0.0, mz = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        fx -= Cp[i] * anx[i];
+        fy -= Cp[i] * any[i];
+        fz -= Cp[i] * anz[i];
+        mx -= Cp[i] * amx[i];
+        my -= Cp[i] * amy[i];
+        mz -= Cp[i] * amz[i];
+    }
+
+    Force[0] = fx;
+    Force[1] = fy;
+    Force[2] = fz;
+
+    // Transfer the moment from the origin to the reference point: M_ref = M_0 - ref x F
+    Moment[0] = mx - (MomentRef(1) * fz - MomentRef(2) * fy);
+    Moment[1] = my - (MomentRef(2) * fx - MomentRef(0) * fz);
+    Moment[2] = mz - (MomentRef(0) * fy - MomentRef(1) * fx);
+}
@@ -0,0 +1,74 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+ */
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef PANELSTORE_H
+#define PANELSTORE_H
+
+#include <QVector>
+#include <Eigen/Core>
+#include "partgeometry.h"
+
+
+/**
+ * Flattened panels of a PartGeometry, stored as one contiguous array per
+ * component. Panel (i,j) of the part grid is panel i*(Npoints-1)+j.
+ *
+ * Besides the unit normals the store keeps the area weighted normals A*n and
+ * moments A*(c x n) of the panels, so the force and moment coefficients of a
+ * pressure distribution are plain dot products with Cp. All the kernels are
+ * branch-free loops over contiguous arrays that the compiler can vectorize.
+ * The store is never modified after construction and can be shared by
+ * several threads.
+ */
+class PanelStore
+{
+public:
+    PanelStore();
+    PanelStore(const PartGeometry& Part);
+
+    int nPanels() const { return Area.size(); }
+
+    /**
+     * Inclinations (rad) of the panels w.r.t. the free stream at attitude alpha, beta (rad)
+     */
+    void DetermineInclination(double alpha, double beta, double* theta) const;
+    /**
+     * Inclinations for nAttitudes attitudes, theta[a*nPanels()+i] for attitude a.
+     * The panels are processed in tiles that stay in cache while all the
+     * attitudes of the batch are evaluated.
+     */
+    void DetermineInclinations(const double* alphas, const double* betas, int nAttitudes, double* theta) const;
+    /**
+     * Force -sum(Cp*A*n) and moment -sum(Cp*A*(c-MomentRef) x n) of the pressure
+     * distribution Cp, not yet divided by the reference area and length
+     */
+    void ForceMoment(const double* Cp, const Eigen::Vector3d& MomentRef, double* Force, double* Moment) const;
+
+    QVector<double> Normal[3];
+    QVector<double> Centroid[3];
+    QVector<double> Area;
+
+private:
+    QVector<double> AreaNormal[3];
+    QVector<double> AreaMoment[3];
+};
+
+#endif // PANELSTORE_H
@@ -732,84 +732,29 @@ double PowerSubsystem::getMaximumPowerConsumptionInEclipse()
     return PowerSubsystem::MaximumPowerConsumptionInEclipse;
 }
 
-void PowerSubsystem::CreatePowerConsumptionFunctionOfSpacecraft()
+void PowerSubsystem::CreatePowerConsumptionFunctionOfSpacecraft(SemTimeSeries& series)
 {
-    qDebug()<<"CreatePowerConsumptionFunctionOfSpacecraft()";
-    //open the EclipseStarLight file for the sample times--------------------
-    QString path2 = QString("data/EclipseStarLight.stad");
-
-    QFile EclipseStarLight(path2);
-    EclipseStarLight.open(QIODevice::ReadOnly);
-//           qDebug()<<EclipseStarLight.fileName();
-//           qDebug()<<EclipseStarLight.isOpen();
-    QTextStream EclipseStarLightStream(&EclipseStarLight);
-
-    //open the file that you get the information of Eclipse Durations--------
-    QString path3 = QString
-                   ("data/EclipseDetailedReport.stad");
-
-    QFile DetailedReport(path3);
-    DetailedReport.open(QIODevice::ReadOnly);
-//           qDebug()<<"DetailedReport.fileName()"<<DetailedReport.fileName();
-//           qDebug()<<"DetailedReport.isOpen()"<<DetailedReport.isOpen();
-    QTextStream DetailedReportStream(&DetailedReport);
-
-    QString header;
-    int i;
-    for (i=0;i<5;i++)
-    {    // read the descriptive header of the file
-        DetailedReportStream >> header;
+    if (!series.hasColumn(SemTimeSeries::StarLight))
+    {
+        qDebug()<<"CreatePowerConsumptionFunctionOfSpacecraft: no star light function";
+        return;
     }
 
-    //open the file you want to write your results-----------------------------
-    QString path = QString
-                   ("data/SystemsEngineeringReports/PowerConsumptionTimeFunction.stad");
-
-    QFile ConsumedPowerTime(path);
-    ConsumedPowerTime.open(QIODevice::ReadWrite);
-//           qDebug()<<"ConsumedPowerTime.fileName()"<<ConsumedPowerTime.fileName();
-//           qDebug()<<"ConsumedPowerTime.isOpen()"<<ConsumedPowerTime.isOpen();
-    QTextStream ConsumedPowerTimeStream(&ConsumedPowerTime);
-    ConsumedPowerTimeStream.setRealNumberPrecision(16);
-
-    double tempEclipse = 0.0;
-    double tempDaylight = 0.0;
-    double endMjd = 0.0;
-    double startMjd = 0.0;
-    double duration = 0.0;
-//    double stepsDuration = 0.0;
-    double eclipseCondition = 0.0;
+    QVector<double> consumedPower(series.size());
     int payloadNumberOfSteps[4] = {0};
-    int numberOfSteps = 0;
+    int i;
     int j;
-    QString State = "";
-
-//    DetailedReportStream >> State;
-//    DetailedReportStream >> endMjd;
-//    DetailedReportStream >> startMjd;
-//    DetailedReportStream >> duration;
-//    DetailedReportStream >> numberOfSteps;
 
     //generation of the function
-    do
+    foreach (const SemLightingInterval& interval, series.lightingIntervals())
     {
-        DetailedReportStream >> State;
-        qDebug()<<"STATE"<<State;
+        int numberOfSteps = interval.count;
 
-        if (State == "Eclipse")
+        if (interval.eclipse)
         {
-//            qDebug()<<"inside Eclipse";
-            //read the details of the state
-            DetailedReportStream >> endMjd;
-            DetailedReportStream >> startMjd;
-            DetailedReportStream >> duration;
-            DetailedReportStream >> numberOfSteps;
-//            stepsDuration = duration / numberOfSteps;
-
             //in eclipse the power dissipation is alligned to
-            //the end of eclipse so read the sampleTimes first
+            //the end of eclipse
             //set the number of steps for each payload
-
             for(i=0;i<4;i++)
             {
                 if (Payloads[i].PowerConsumptionInEclipse > 0.0)
@@ -818,237 +763,188 @@ void PowerSubsystem::CreatePowerConsumptionFunctionOfSpacecraft()
                             = int(numberOfSteps
                                   * Payloads[i].PowerOnPercentageInEclipse
                                   /100);
-                    qDebug()<<"E payloadNumberOfSteps[i]"<<payloadNumberOfSteps[i];
                 }
             }
 
             for(i=0;i<numberOfSteps;i++)
             {
-                EclipseStarLightStream >> startMjd;
-                if (!EclipseStarLightStream.atEnd())
+                double tempEclipse = SCPowerDetails.SubsystemsTotalPower;
+                for(j=0;j<4;j++)//collect the data from every payload
                 {
-                    EclipseStarLightStream >> eclipseCondition;
-                    ConsumedPowerTimeStream << startMjd <<"\t";
-
-                    tempEclipse = SCPowerDetails.SubsystemsTotalPower;
-                    for(j=0;j<4;j++)//collect the data from every payload
+                    if (i >= (numberOfSteps - payloadNumberOfSteps[j]))
                     {
-                        if (i >= (numberOfSteps - payloadNumberOfSteps[j]))
-                        {
-                           tempEclipse += Payloads[j].PowerConsumptionInEclipse;
-                        }
+                       tempEclipse += Payloads[j].PowerConsumptionInEclipse;
                     }
-
-                    ConsumedPowerTimeStream << tempEclipse <<"\n";
                 }
+
+                consumedPower[interval.first + i] = tempEclipse;
             }
         }
         else
         {
-            if (State == "Daylight")
+            //in daylight the power dissipation is alligned to
+            //the beginning of daylight
+            //set the number of steps for each payload
+            for(i=0;i<4;i++)
             {
-                qDebug()<<"inside Daylight";
-                //read the details of the state
-                DetailedReportStream >> endMjd;
-                DetailedReportStream >> startMjd;
-                DetailedReportStream >> duration;
-                DetailedReportStream >> numberOfSteps;
-//                stepsDuration = duration / numberOfSteps;
-
-                //in daylight the power dissipation is alligned to
-                //the beginning of daylight so read the sampleTimes first
-                //set the number of steps for each payload
-
-                for(i=0;i<4;i++)
+                if (Payloads[i].PowerConsumptionInDaylight > 0.0)
                 {
-                    if (Payloads[i].PowerConsumptionInDaylight > 0.0)
-                    {
-                        payloadNumberOfSteps[i]
-                                = int(numberOfSteps
-                                      * Payloads[i].PowerOnPercentageInDaylight
-                                      /100);
-                        qDebug()<<"D payloadNumberOfSteps[i]"<<payloadNumberOfSteps[i];
-                    }
+                    payloadNumberOfSteps[i]
+                            = int(numberOfSteps
+                                  * Payloads[i].PowerOnPercentageInDaylight
+                                  /100);
                 }
+            }
 
-                for(i=0;i<numberOfSteps;i++)
+            for(i=0;i<numberOfSteps;i++)
+            {
+                double tempDaylight = SCPowerDetails.SubsystemsTotalPower;
+                for(j=0;j<4;j++)//collect the data from every payload
                 {
-                    EclipseStarLightStream >> startMjd;
-                    qDebug()<<"Star light time" << startMjd;
-                    EclipseStarLightStream >> eclipseCondition;
-                    ConsumedPowerTimeStream << startMjd <<"\t";
-
-                    tempDaylight = SCPowerDetails.SubsystemsTotalPower;
-                    for(j=0;j<4;j++)//collect the data from every payload
+                    if ((payloadNumberOfSteps[j]) >= i)
                     {
-                        if ((payloadNumberOfSteps[j]) >= i)
-                        {
-                           tempDaylight += Payloads[j].PowerConsumptionInDaylight;
-                        }
+                       tempDaylight += Payloads[j].PowerConsumptionInDaylight;
                     }
-
-                    ConsumedPowerTimeStream << tempDaylight <<"\n";
                 }
+
+                consumedPower[interval.first + i] = tempDaylight;
             }
-            else
-            {
-//                qDebug()<<"inside break";
-                break;
-            }            
         }
-    }while (!DetailedReportStream.atEnd());
+    }
 
-    //close all the files that are opened in the beginning
-    EclipseStarLight.close();
-    DetailedReport.close();
-    ConsumedPowerTime.close();
+    series.setColumn(SemTimeSeries::ConsumedPower, consumedPower);
 }
 
-void PowerSubsystem::CreateGeneratedPowerTimeFunctionOfSpacecraft()
+void PowerSubsystem::CreateGeneratedPowerTimeFunctionOfSpacecraft(SemTimeSeries& series)
 {
-//***************************************************************************
+    if (!series.hasColumn(SemTimeSeries::StarLight))
+    {
+        qDebug()<<"CreateGeneratedPowerTimeFunctionOfSpacecraft: no star light function";
+        return;
+    }
+
     if ((SolarArrays.getSolarCellBOLPower()>0.0)
         &&(SolarArrays.getArea()>0.0)
         &&(SolarArrays.getLifeTimeDegradation()>=0.0))
     {
-        //open the file you want to put the results--------
-        QString path = QString
-                       ("data/SystemsEngineeringReports/GeneratedPowerTimeFunction.stad");
-
-        QFile GeneratedPowerTime(path);
-        GeneratedPowerTime.open(QIODevice::ReadWrite);
-               qDebug()<<"GeneratedPowerTime.fileName()"<<GeneratedPowerTime.fileName();
-               qDebug()<<"GeneratedPowerTime.isOpen()"<<GeneratedPowerTime.isOpen();
-        QTextStream GeneratedPowerTimeStream(&GeneratedPowerTime);
-
-        //reach to the Eclipse information file------------
-        QString path2 = QString("data/EclipseStarLight.stad");
-
-        QFile EclipseStarLight(path2);
-        EclipseStarLight.open(QIODevice::ReadOnly);
-        //       qDebug()<<EclipseStarLight.fileName();
-        //       qDebug()<<EclipseStarLight.isOpen();
-        QTextStream EclipseStarLightStream(&EclipseStarLight);
+        const QVector<double>& sampleTimes = series.mjd();
+        const QVector<double>& starLight = series.column(SemTimeSeries::StarLight);
+        QVector<double> generatedPower(series.size());
 
         //get the beginning of the mission
-        QString sampleTimeString = "";
-        double MissionStart;
-        double StarLightExitance;
-
-        //1 column is for the date and time next one for if it is in umbra or penumbra
-        //       int NumberOfColumns = 2;
+        double MissionStart = sampleTimes.first();
 
-        EclipseStarLightStream >> sampleTimeString;
-        qDebug()<<"sampleTimeString; "<<sampleTimeString;
-//        MissionStart = sta::CalendarToJd
-//                       (QDateTime::fromString(sampleTimeString,Qt::ISODate));
-        MissionStart = sampleTimeString.toDouble();
-        qDebug()<<"MissionStart "<<MissionStart;
-
-        EclipseStarLightStream >> StarLightExitance;
-        qDebug()<<"StarLightExitance;  "<<StarLightExitance;
-
-        double sampleTime = MissionStart;
-
-        while(!EclipseStarLightStream.atEnd())
+        int i;
+        for (i=0;i<series.size();i++)
         {
             //Calculate the short time calculations
             double powerShortTime =
                     SolarArrays.getSolarCellBOLPower()
-                    * StarLightExitance
+                    * starLight.at(i)
                     * SolarArrays.getArea();
 
-            //Calculate and place the generated power function in .stad
-            GeneratedPowerTimeStream << sampleTimeString <<"\t";
-            double powerLongTime =
+            //Calculate the degradation of the solar arrays until the sample time
+            generatedPower[i] =
                     powerShortTime
-                    * pow((1.0 - SolarArrays.getLifeTimeDegradation()),((sampleTime-MissionStart)/365));
-//            qDebug()<<"lifetime dega "<<SolarArrays.getLifeTimeDegradation();
-//            qDebug()<<"(sampleTime-MissionStart) "<<(sampleTime-MissionStart);
-//            qDebug()<<"(sampleTime-MissionStart)/365) "<<(sampleTime-MissionStart)/365;
-//            qDebug()<<"POWER OF "<<pow((1.0 - SolarArrays.getLifeTimeDegradation()),((sampleTime-MissionStart)/365));
-            GeneratedPowerTimeStream << powerLongTime <<"\n";
-
-//            qDebug()<<"EclipseStarLightStream END"<<EclipseStarLightStream.atEnd();
-
-            EclipseStarLightStream >> sampleTimeString;
-//            sampleTime = sta::CalendarToJd
-//                         (QDateTime::fromString(sampleTimeString,Qt::ISODate));
-            sampleTime = sampleTimeString.toDouble();
-            EclipseStarLightStream >> StarLightExitance;
-//            qDebug()<<"SAMPLe"<<sampleTime;
+                    * pow((1.0 - SolarArrays.getLifeTimeDegradation()),((sampleTimes.at(i)-MissionStart)/365));
         }
 
-        GeneratedPowerTimeStream <<endl;
-        GeneratedPowerTime.close();
-        EclipseStarLight.close();
-
+        series.setColumn(SemTimeSeries::GeneratedPower, generatedPower);
     }
 }
 
-void PowerSubsystem::CreateNetPowerTimeFunctionOfSpacecraft()
+void PowerSubsystem::CreateNetPowerTimeFunctionOfSpacecraft(SemTimeSeries& series)
 {
-    //open the generated power file --------------------------
-    QString path = QString
-                   ("data/SystemsEngineeringReports/GeneratedPowerTimeFunction.stad");
+    if (!series.hasColumn(SemTimeSeries::GeneratedPower)
+        || !series.hasColumn(SemTimeSeries::ConsumedPower))
+    {
+        qDebug()<<"CreateNetPowerTimeFunctionOfSpacecraft: no generated or consumed power function";
+        return;
+    }
 
-    QFile GeneratedPowerTime(path);
-    GeneratedPowerTime.open(QIODevice::ReadOnly);
-           qDebug()<<"GeneratedPowerTime.fileName()"<<GeneratedPowerTime.fileName();
-           qDebug()<<"GeneratedPowerTime.isOpen()"<<GeneratedPowerTime.isOpen();
-    QTextStream GeneratedPowerTimeStream(&GeneratedPowerTime);
+    const QVector<double>& generatedPower = series.column(SemTimeSeries::GeneratedPower);
+    const QVector<double>& consumedPower = series.column(SemTimeSeries::ConsumedPower);
+    QVector<double> netPower(series.size());
 
-    //open the consumed power file -----------------------------
-    QString path2 = QString
-                   ("data/SystemsEngineeringReports/PowerConsumptionTimeFunction.stad");
+    int i;
+    for (i=0;i<series.size();i++)
+    {
+        netPower[i] = generatedPower.at(i) - consumedPower.at(i);
+    }
 
-    QFile ConsumedPowerTime(path2);
-    ConsumedPowerTime.open(QIODevice::ReadOnly);
-//           qDebug()<<"ConsumedPowerTime.fileName()"<<ConsumedPowerTime.fileName();
-//           qDebug()<<"ConsumedPowerTime.isOpen()"<<ConsumedPowerTime.isOpen();
-    QTextStream ConsumedPowerTimeStream(&ConsumedPowerTime);
+    series.setColumn(SemTimeSeries::NetPower, netPower);
+}
 
-    //open the file that you would like to write your results
-    QString path3 = QString
-                   ("data/SystemsEngineeringReports/NetPowerTimeFunction.stad");
+BatterySimulationParameters PowerSubsystem::getBatterySimulationParameters()
+{
+    BatterySimulationParameters parameters;
+    parameters.ArrayArea = SolarArrays.getArea();
+    parameters.SolarCellBOLPower = SolarArrays.getSolarCellBOLPower();
+    parameters.ArrayDegradationPerYear = SolarArrays.getSolarCell().DegradationPerYear;
+    parameters.BatteryCapacity = Battery.getBMass()
+                                 * Battery.getBatteryProperties().SpecificEnergyDensity;
+    // The battery is sized to the energy of a whole eclipse, so the sizing
+    // allows it to be fully discharged
+    parameters.MaximumDepthOfDischarge = 1.0;
 
-    QFile NetPowerTime(path3);
-    NetPowerTime.open(QIODevice::ReadWrite);
-//           qDebug()<<"NetPowerTime.fileName()"<<NetPowerTime.fileName();
-//           qDebug()<<"NetPowerTime.isOpen()"<<NetPowerTime.isOpen();
-    QTextStream NetPowerTimeStream(&NetPowerTime);
-    NetPowerTimeStream.setRealNumberPrecision(16);
+    return parameters;
+}
 
-    double mjd;
-    double consumedPower;
-    double generatedPower;
+BatterySimulationResult PowerSubsystem::CreateStateOfChargeTimeFunctionOfSpacecraft(SemTimeSeries& series)
+{
+    BatterySimulationResult result
+            = BatterySimulator::simulate(getBatterySimulationParameters(), series, true);
 
-    GeneratedPowerTimeStream >> mjd;
-    GeneratedPowerTimeStream >> generatedPower;
+    if (result.StateOfCharge.size() == series.size())
+    {
+        series.setColumn(SemTimeSeries::StateOfCharge, result.StateOfCharge);
+    }
 
-    ConsumedPowerTimeStream >> mjd;
-    ConsumedPowerTimeStream >> consumedPower;
+    return result;
+}
 
-    while((!ConsumedPowerTimeStream.atEnd())
-            &&(!GeneratedPowerTimeStream.atEnd()))
-    {
-        NetPowerTimeStream << mjd<<"\t";
-        NetPowerTimeStream << (generatedPower - consumedPower)<<"\n";
+bool PowerSubsystem::WriteBatterySizingReport(const SemTimeSeries& series, const QString& fileName)
+{
+    BatterySimulationParameters base = getBatterySimulationParameters();
 
-        GeneratedPowerTimeStream >> mjd;
-        GeneratedPowerTimeStream >> generatedPower;
+    QVector<double> arrayAreas;
+    QVector<double> batteryCapacities;
+    arrayAreas << 0.75 * base.ArrayArea << base.ArrayArea << 1.25 * base.ArrayArea;
+    batteryCapacities << 0.75 * base.BatteryCapacity << base.BatteryCapacity << 1.25 * base.BatteryCapacity;
 
-        ConsumedPowerTimeStream >> mjd;
-        ConsumedPowerTimeStream >> consumedPower;
+    QList<BatterySimulationParameters> designs
+            = BatterySimulator::designGrid(base, arrayAreas, batteryCapacities);
+    QList<BatterySimulationResult> results = BatterySimulator::sweep(designs, series);
 
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "PowerSubsystem: unable to write" << fileName;
+        return false;
     }
 
+    QTextStream out(&file);
+    out << "ArrayArea(m2)" << "\t" << "Capacity(Wh)" << "\t"
+        << "MinSOC" << "\t" << "MaxDOD" << "\t" << "DODExceeded" << "\t"
+        << "Cycles" << "\t" << "FinalCapacity(Wh)" << "\t"
+        << "Unserved(Wh)" << "\t" << "Spilled(Wh)" << "\n";
 
-        //close the functions you opened
-        GeneratedPowerTime.close();
-        ConsumedPowerTime.close();
-        NetPowerTime.close();
+    int i;
+    for (i=0;i<designs.size();i++)
+    {
+        const BatterySimulationResult& result = results.at(i);
+        out << designs.at(i).ArrayArea << "\t"
+            << designs.at(i).BatteryCapacity << "\t"
+            << result.MinimumStateOfCharge << "\t"
+            << result.MaximumDepthOfDischarge << "\t"
+            << (result.DepthOfDischargeExceeded ? "yes" : "no") << "\t"
+            << result.EquivalentCycles << "\t"
+            << result.FinalCapacity << "\t"
+            << result.UnservedEnergy << "\t"
+            << result.SpilledEnergy << "\n";
+    }
 
+    return file.error() == QFile::NoError;
 }
 
 void PowerSubsystem::CalculateAndSetPowerSubsystemMass()
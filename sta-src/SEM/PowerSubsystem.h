@@ -26,6 +26,8 @@
 #define POWERSUBSYSTEM_H
 
 #include <QString>
+#include "semtimeseries.h"
+#include "batterysimulation.h"
 using namespace std;
 
 #define NumberOfPayloads 4
@@ -322,36 +324,52 @@ public:
       * It produce the Power Consumption Function of SC for an orbit
       * The Details of the Function can be found in STA-OY-TN-1001 1.0
       * Figure 2.4.2
-      * It needs the following files generated before the function call:
-      * "data/EclipseStarLight.stad");
-      * "data/EclipseDetailedReport.stad");
+      * It needs the StarLight column of the series
       * -----------------------------------
-      * It writes the results to:
-      * "data/SystemsEngineeringReports/PowerConsumptionTimeFunction.stad");
+      * It fills the ConsumedPower column of the series
     */
-    void CreatePowerConsumptionFunctionOfSpacecraft();
+    void CreatePowerConsumptionFunctionOfSpacecraft(SemTimeSeries& series);
 
     /**
       * It produce the Generated Power Function of SC by SolarArrays during
       * the mission
-      * It needs the following files generated before the function call:
-      * "data/EclipseStarLight.stad"
+      * It needs the StarLight column of the series
       * -----------------------------------
-      * It writes the results to:
+      * It fills the GeneratedPower column of the series
     */
-    void CreateGeneratedPowerTimeFunctionOfSpacecraft();
+    void CreateGeneratedPowerTimeFunctionOfSpacecraft(SemTimeSeries& series);
 
     /**
       * It produce the Net Power Function of SC during the mission
-      * It needs the following files generated before the function call:
-      * "data/SystemsEngineeringReports/GeneratedPowerTimeFunction.stad"
-      * "data/SystemsEngineeringReports/PowerConsumptionTimeFunction.stad"
-      *
+      * It needs the GeneratedPower and ConsumedPower columns of the series
       * -----------------------------------
-      * It writes the results to:
-      * "data/SystemsEngineeringReports/NetPowerTimeFunction.stad"
+      * It fills the NetPower column of the series
     */
-    void CreateNetPowerTimeFunctionOfSpacecraft();
+    void CreateNetPowerTimeFunctionOfSpacecraft(SemTimeSeries& series);
+
+    /**
+      * Parameters of the solar arrays and the battery for the energy
+      * balance simulation: area, BOL power and degradation of the solar
+      * cells, and the capacity (Wh) of the battery mass
+    */
+    BatterySimulationParameters getBatterySimulationParameters();
+
+    /**
+      * It simulates the state of charge of the battery during the mission
+      * It needs the StarLight and ConsumedPower columns of the series
+      * -----------------------------------
+      * It fills the StateOfCharge column of the series
+    */
+    BatterySimulationResult CreateStateOfChargeTimeFunctionOfSpacecraft(SemTimeSeries& series);
+
+    /**
+      * It simulates the designs with 75%, 100% and 125% of the solar array
+      * area and of the battery capacity concurrently, and writes their
+      * minimum state of charge, maximum depth of discharge, unserved and
+      * spilled energy to fileName
+      * It needs the StarLight and ConsumedPower columns of the series
+    */
+    bool WriteBatterySizingReport(const SemTimeSeries& series, const QString& fileName);
 
     void CalculateAndSetPowerSubsystemMass();
     double getPowersubsystemMass();
@@ -116,6 +116,11 @@ Launcher* SemMain::getNewLauncher()
     return &NewLauncher;
 }
 
+SemTimeSeries* SemMain::getSCTimeSeries()
+{
+    return &SCTimeSeries;
+}
+
 void SemMain::PassPayloadOutputParameters()
 {
     // setting Stucture parameters with payload
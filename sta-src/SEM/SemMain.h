@@ -33,6 +33,7 @@
 #include "OBDHSubsystem.h"
 #include "TTCSubsystem.h"
 #include "Launcher.h"
+#include "semtimeseries.h"
 
 class SemMain
 {
@@ -64,6 +65,12 @@ public:
 
     void setNewLauncher(Launcher* SCLaunch);
     Launcher* getNewLauncher();
+
+    /*
+      *Time functions (star light, power, temperature) of the SC over the
+      *mission, kept in memory between the subsystems
+      */
+    SemTimeSeries* getSCTimeSeries();
     /*
       *It passes the outputs of every subsystem to the necessary subsystem
       */
@@ -84,5 +91,6 @@ private:
         OBDHSubsystem NewSCDataHandling;
         TTCSubsystem NewSCCommunication;
         Launcher    NewLauncher;
+        SemTimeSeries SCTimeSeries;
 };
 #endif // SEMMAIN_H
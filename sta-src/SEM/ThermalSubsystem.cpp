@@ -663,56 +663,27 @@ double ThermalSubsystem::getNeededHeater()
     return NeededHeater;
 }
 
-void ThermalSubsystem::CreateTemperatureTimeFunction()
+void ThermalSubsystem::CreateTemperatureTimeFunction(SemTimeSeries& series)
 {
-    //reach to the Eclipse information file------------
-    QString path = QString("data/EclipseStarLight.stad");
-
-    QFile EclipseStarLight(path);
-    EclipseStarLight.open(QIODevice::ReadOnly);
-    //       qDebug()<<EclipseStarLight.fileName();
-    //       qDebug()<<EclipseStarLight.isOpen();
-    QTextStream EclipseStarLightStream(&EclipseStarLight);
-
-    //open the consumed power file -----------------------------
-    QString path2 = QString
-                   ("data/SystemsEngineeringReports/PowerConsumptionTimeFunction.stad");
-
-    QFile ConsumedPowerTime(path2);
-    ConsumedPowerTime.open(QIODevice::ReadOnly);
-//           qDebug()<<"ConsumedPowerTime.fileName()"<<ConsumedPowerTime.fileName();
-//           qDebug()<<"ConsumedPowerTime.isOpen()"<<ConsumedPowerTime.isOpen();
-    QTextStream ConsumedPowerTimeStream(&ConsumedPowerTime);
-
-    //open the file you want to put your results-----------------------------
-    QString path3 = QString
-                   ("data/SystemsEngineeringReports/SCTemperatureTimeFunction.stad");
-
-    QFile TemperatureTime(path3);
-    TemperatureTime.open(QIODevice::ReadWrite);
-           qDebug()<<"TemperatureTime.fileName()"<<TemperatureTime.fileName();
-           qDebug()<<"TemperatureTime.isOpen()"<<TemperatureTime.isOpen();
-    QTextStream TemperatureTimeStream(&TemperatureTime);
-    TemperatureTimeStream.setRealNumberPrecision(16);
-
-    double mjd = 0.0;
-    double powerConsumption = 0.0;
-    double eclipseState = 0.0;
-    double temp = 0.0;
-
-    ConsumedPowerTimeStream >> mjd;
-    ConsumedPowerTimeStream >> powerConsumption;
+    if (!series.hasColumn(SemTimeSeries::StarLight)
+        || !series.hasColumn(SemTimeSeries::ConsumedPower))
+    {
+        qDebug()<<"CreateTemperatureTimeFunction: no star light or consumed power function";
+        return;
+    }
 
-    EclipseStarLightStream >> mjd;
-    EclipseStarLightStream >> eclipseState;
+    const QVector<double>& starLight = series.column(SemTimeSeries::StarLight);
+    const QVector<double>& consumedPower = series.column(SemTimeSeries::ConsumedPower);
+    QVector<double> temperature(series.size());
 
     //calculate the temperature at a time
-    while((!ConsumedPowerTimeStream.atEnd()&&(!EclipseStarLightStream.atEnd())))
-    {       
-        temp = pow(
+    int i;
+    for (i=0;i<series.size();i++)
+    {
+        temperature[i] = pow(
                 ((ReceivedPlanetIRHeat
-                  + (SolarFluxHeat+ AlbedoHeat)*eclipseState
-                  + powerConsumption)
+                  + (SolarFluxHeat+ AlbedoHeat)*starLight.at(i)
+                  + consumedPower.at(i))
                  /
                  (TotalAreaOfHotFace
                     * STEFAN_BOLTZMANN_CONSTANT
@@ -721,21 +692,119 @@ void ThermalSubsystem::CreateTemperatureTimeFunction()
                     * STEFAN_BOLTZMANN_CONSTANT
                     * ColdFaceCoatingProperties.Emmissivity)
                         ),0.25);
+    }
+
+    series.setColumn(SemTimeSeries::Temperature, temperature);
+}
+
+ThermalNetwork ThermalSubsystem::CreateThermalNetwork(double HeatCapacity)
+{
+    ThermalNode node;
+    node.Name = "Spacecraft";
+    node.HeatCapacity = HeatCapacity;
+    // the emissivity of the node is carried by the area
+    node.RadiatingArea = TotalAreaOfHotFace * HotFaceCoatingProperties.Emmissivity
+                         + TotalAreaOfColdFace * ColdFaceCoatingProperties.Emmissivity;
+    node.Emmissivity = 1.0;
+    node.SolarLoad = SolarFluxHeat;
+    node.AlbedoLoad = AlbedoHeat;
+    node.PlanetIRLoad = ReceivedPlanetIRHeat;
+    node.PowerFraction = 1.0;
+    // start from the middle of the SC temperature range, if it is calculated
+    node.InitialTemperature = (MinimumSCTemperature + MaximumSCTemperature) / 2;
+    if (node.InitialTemperature <= 0.0)
+    {
+        node.InitialTemperature = 293.15;
+    }
+
+    ThermalNetwork network;
+    network.addNode(node);
+    return network;
+}
+
+bool ThermalSubsystem::CreateTransientTemperatureTimeFunction(SemTimeSeries& series,
+                                                              const ThermalNetwork& network)
+{
+    ThermalSolution solution = network.solve(series);
+    if (!solution.Converged)
+    {
+        return false;
+    }
+
+    double totalHeatCapacity = 0.0;
+    int i;
+    foreach (const ThermalNode& node, network.nodes())
+    {
+        totalHeatCapacity += node.HeatCapacity;
+    }
+
+    QVector<double> temperature(series.size(), 0.0);
+    for (i=0;i<network.nodeCount();i++)
+    {
+        double weight = network.nodes().at(i).HeatCapacity / totalHeatCapacity;
+        const QVector<double>& nodeTemperature = solution.NodeTemperatures.at(i);
+
+        int k;
+        for (k=0;k<series.size();k++)
+        {
+            temperature[k] += weight * nodeTemperature.at(k);
+        }
+    }
+
+    series.setColumn(SemTimeSeries::Temperature, temperature);
+    return true;
+}
+
+bool ThermalSubsystem::WriteHeatCapacityVariantsReport(const SemTimeSeries& series,
+                                                       double HeatCapacity,
+                                                       const QString& fileName)
+{
+    const double factors[3] = { 0.5, 1.0, 2.0 };
+
+    QList<ThermalNetwork> variants;
+    int i;
+    for (i=0;i<3;i++)
+    {
+        variants.append(CreateThermalNetwork(factors[i] * HeatCapacity));
+    }
 
-        TemperatureTimeStream << mjd<<"\t";
-        TemperatureTimeStream << temp<<"\n";
+    QList<ThermalSolution> solutions = ThermalNetwork::solveVariants(variants, series);
+    foreach (const ThermalSolution& solution, solutions)
+    {
+        if (!solution.Converged)
+        {
+            return false;
+        }
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "ThermalSubsystem: unable to write" << fileName;
+        return false;
+    }
 
-        ConsumedPowerTimeStream >> mjd;
-        ConsumedPowerTimeStream >> powerConsumption;
+    QTextStream out(&file);
+    out.setRealNumberPrecision(16);
+    out << "mjd";
+    for (i=0;i<3;i++)
+    {
+        out << "\t" << "T(" << factors[i] * HeatCapacity << " J/K)";
+    }
+    out << "\n";
 
-        EclipseStarLightStream >> mjd;
-        EclipseStarLightStream >> eclipseState;
+    int k;
+    for (k=0;k<series.size();k++)
+    {
+        out << series.mjd().at(k);
+        foreach (const ThermalSolution& solution, solutions)
+        {
+            out << "\t" << solution.NodeTemperatures.first().at(k);
+        }
+        out << "\n";
     }
 
-    //close the files you opened
-    EclipseStarLight.close();
-    ConsumedPowerTime.close();
-    TemperatureTime.close();
+    return file.error() == QFile::NoError;
 }
 
 void ThermalSubsystem::CalculateAndSetNeededRadiator()
@@ -26,6 +26,8 @@
 #define THERMALSUBSYSTEM_H
 
 #include <QString>
+#include "semtimeseries.h"
+#include "thermalnetwork.h"
 using namespace std;
 
 
@@ -170,7 +172,38 @@ public:
     void setNeededHeater(double heater);
     double getNeededHeater();
 
-    void CreateTemperatureTimeFunction();
+    /**
+      * Calculates the SC temperature at every sample of the series
+      * It needs the StarLight and ConsumedPower columns of the series
+      * and fills the Temperature column
+     */
+    void CreateTemperatureTimeFunction(SemTimeSeries& series);
+
+    /**
+      * Single node network of the SC with the given heat capacity (J/K),
+      * loaded and radiating like the equilibrium temperature of
+      * CreateTemperatureTimeFunction. More nodes and couplings can be
+      * added to it before it is solved.
+     */
+    ThermalNetwork CreateThermalNetwork(double HeatCapacity);
+
+    /**
+      * Calculates the SC temperature at every sample of the series with
+      * the transient solution of the network, taking the thermal inertia
+      * into account. The Temperature column is filled with the mean
+      * temperature of the nodes weighted by their heat capacities
+     */
+    bool CreateTransientTemperatureTimeFunction(SemTimeSeries& series,
+                                                const ThermalNetwork& network);
+
+    /**
+      * Writes the transient SC temperature for half, once and twice the
+      * given heat capacity (J/K), to show how much the thermal inertia
+      * damps the eclipse cycles. The variants are solved concurrently
+     */
+    bool WriteHeatCapacityVariantsReport(const SemTimeSeries& series,
+                                         double HeatCapacity,
+                                         const QString& fileName);
 
     /**
       * Calculates the needed heater to reach the desired temperature
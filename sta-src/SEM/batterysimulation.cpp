@@ -0,0 +1,262 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "batterysimulation.h"
+#include "Astro-Core/date.h"
+#include <QDebug>
+#include <QtConcurrentMap>
+#include <cmath>
+
+static const double SecondsPerYear = 365.25 * 86400.0;
+
+
+BatterySimulationParameters::BatterySimulationParameters() :
+    ArrayArea(0.0),
+    SolarCellBOLPower(0.0),
+    ArrayDegradationPerYear(0.0),
+    ArrayPathEfficiency(0.85),
+    BatteryCapacity(0.0),
+    InitialStateOfCharge(1.0),
+    ChargeEfficiency(sqrt(0.65 / 0.85)),
+    DischargeEfficiency(sqrt(0.65 / 0.85)),
+    MaximumDepthOfDischarge(0.3),
+    CalendarFadePerYear(0.01),
+    CycleFadeAtEndOfLife(0.2),
+    CycleLife(30000.0),
+    ReferenceDepthOfDischarge(0.3),
+    CycleLifeExponent(1.5)
+{
+}
+
+
+BatterySimulator::BatterySimulator(const BatterySimulationParameters& parameters) :
+    m_parameters(parameters)
+{
+    reset();
+}
+
+
+void BatterySimulator::reset()
+{
+    m_capacity = m_parameters.BatteryCapacity;
+    m_energy = qBound(0.0, m_parameters.InitialStateOfCharge, 1.0) * m_capacity;
+    m_cycleDamage = 0.0;
+    m_dischargeStart = -1.0;
+    m_dischargedEnergy = 0.0;
+
+    m_result.MinimumStateOfCharge = stateOfCharge();
+    m_result.MaximumDepthOfDischarge = 1.0 - stateOfCharge();
+    m_result.DepthOfDischargeExceeded = m_result.MaximumDepthOfDischarge > m_parameters.MaximumDepthOfDischarge;
+    m_result.EquivalentCycles = 0.0;
+    m_result.FinalCapacity = m_capacity;
+    m_result.UnservedEnergy = 0.0;
+    m_result.SpilledEnergy = 0.0;
+    m_result.StateOfCharge.clear();
+}
+
+
+double BatterySimulator::stateOfCharge() const
+{
+    return m_capacity > 0.0 ? m_energy / m_capacity : 0.0;
+}
+
+
+// A discharge ends when the battery is charged again: its depth adds to the cycle fade
+void BatterySimulator::endDischarge()
+{
+    if (m_dischargeStart < 0.0)
+    {
+        return;
+    }
+
+    if (m_capacity > 0.0 && m_parameters.CycleLife > 0.0 && m_parameters.ReferenceDepthOfDischarge > 0.0)
+    {
+        double depth = (m_dischargeStart - m_energy) / m_capacity;
+        if (depth > 0.0)
+        {
+            m_cycleDamage += pow(depth / m_parameters.ReferenceDepthOfDischarge, m_parameters.CycleLifeExponent)
+                             / m_parameters.CycleLife;
+        }
+    }
+    m_dischargeStart = -1.0;
+}
+
+
+void BatterySimulator::step(double elapsed, double duration, double starLight, double consumedPower)
+{
+    if (duration <= 0.0)
+    {
+        return;
+    }
+
+    double years = (elapsed + duration) / SecondsPerYear;
+    double hours = duration / 3600.0;
+
+    // Fade of the battery up to the step
+    double fade = m_parameters.CalendarFadePerYear * years + m_parameters.CycleFadeAtEndOfLife * m_cycleDamage;
+    m_capacity = m_parameters.BatteryCapacity * qMax(0.0, 1.0 - fade);
+    m_energy = qMin(m_energy, m_capacity);
+
+    double generatedPower = m_parameters.ArrayArea
+                            * m_parameters.SolarCellBOLPower
+                            * starLight
+                            * pow(1.0 - m_parameters.ArrayDegradationPerYear, years);
+    double balance = generatedPower * m_parameters.ArrayPathEfficiency - consumedPower;
+
+    if (balance >= 0.0)
+    {
+        endDischarge();
+
+        double charge = balance * hours * m_parameters.ChargeEfficiency;
+        double room = m_capacity - m_energy;
+        if (charge > room)
+        {
+            m_result.SpilledEnergy += (charge - room) / m_parameters.ChargeEfficiency;
+            m_energy = m_capacity;
+        }
+        else
+        {
+            m_energy += charge;
+        }
+    }
+    else
+    {
+        if (m_dischargeStart < 0.0)
+        {
+            m_dischargeStart = m_energy;
+        }
+
+        double demand = -balance * hours / m_parameters.DischargeEfficiency;
+        if (demand > m_energy)
+        {
+            m_result.UnservedEnergy += (demand - m_energy) * m_parameters.DischargeEfficiency;
+            m_dischargedEnergy += m_energy;
+            m_energy = 0.0;
+        }
+        else
+        {
+            m_energy -= demand;
+            m_dischargedEnergy += demand;
+        }
+    }
+
+    double soc = stateOfCharge();
+    m_result.MinimumStateOfCharge = qMin(m_result.MinimumStateOfCharge, soc);
+    m_result.MaximumDepthOfDischarge = qMax(m_result.MaximumDepthOfDischarge, 1.0 - soc);
+    m_result.DepthOfDischargeExceeded = m_result.MaximumDepthOfDischarge > m_parameters.MaximumDepthOfDischarge;
+    if (m_parameters.BatteryCapacity > 0.0)
+    {
+        m_result.EquivalentCycles = m_dischargedEnergy / m_parameters.BatteryCapacity;
+    }
+    m_result.FinalCapacity = m_capacity;
+}
+
+
+BatterySimulationResult BatterySimulator::simulate(const BatterySimulationParameters& parameters,
+                                                   const SemTimeSeries& series,
+                                                   bool keepStateOfCharge)
+{
+    BatterySimulator simulator(parameters);
+    if (!series.hasColumn(SemTimeSeries::StarLight) || !series.hasColumn(SemTimeSeries::ConsumedPower))
+    {
+        qDebug() << "BatterySimulator: no star light or consumed power function";
+        return simulator.result();
+    }
+
+    const QVector<double>& mjd = series.mjd();
+    const QVector<double>& starLight = series.column(SemTimeSeries::StarLight);
+    const QVector<double>& consumedPower = series.column(SemTimeSeries::ConsumedPower);
+
+    QVector<double> stateOfCharge;
+    if (keepStateOfCharge)
+    {
+        stateOfCharge.resize(series.size());
+        stateOfCharge[0] = simulator.stateOfCharge();
+    }
+
+    // The values of a sample hold until the next sample
+    for (int k = 0; k + 1 < series.size(); k++)
+    {
+        simulator.step(sta::daysToSecs(mjd.at(k) - mjd.first()),
+                       sta::daysToSecs(mjd.at(k + 1) - mjd.at(k)),
+                       starLight.at(k),
+                       consumedPower.at(k));
+        if (keepStateOfCharge)
+        {
+            stateOfCharge[k + 1] = simulator.stateOfCharge();
+        }
+    }
+
+    simulator.endDischarge();
+    BatterySimulationResult result = simulator.result();
+    result.StateOfCharge = stateOfCharge;
+    return result;
+}
+
+
+// A battery and array design and the power series to simulate it over
+struct BatteryDesignCase
+{
+    BatterySimulationParameters parameters;
+    const SemTimeSeries* series;
+};
+
+static BatterySimulationResult simulateDesign(const BatteryDesignCase& designCase)
+{
+    return BatterySimulator::simulate(designCase.parameters, *designCase.series);
+}
+
+
+QList<BatterySimulationResult> BatterySimulator::sweep(const QList<BatterySimulationParameters>& designs,
+                                                       const SemTimeSeries& series)
+{
+    QList<BatteryDesignCase> cases;
+    foreach (const BatterySimulationParameters& parameters, designs)
+    {
+        BatteryDesignCase designCase;
+        designCase.parameters = parameters;
+        designCase.series = &series;
+        cases.append(designCase);
+    }
+
+    return QtConcurrent::blockingMapped<QList<BatterySimulationResult> >(cases, simulateDesign);
+}
+
+
+QList<BatterySimulationParameters> BatterySimulator::designGrid(const BatterySimulationParameters& base,
+                                                                const QVector<double>& arrayAreas,
+                                                                const QVector<double>& batteryCapacities)
+{
+    QList<BatterySimulationParameters> designs;
+    foreach (double area, arrayAreas)
+    {
+        foreach (double capacity, batteryCapacities)
+        {
+            BatterySimulationParameters parameters = base;
+            parameters.ArrayArea = area;
+            parameters.BatteryCapacity = capacity;
+            designs.append(parameters);
+        }
+    }
+
+    return designs;
+}
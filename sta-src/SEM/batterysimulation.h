@@ -0,0 +1,143 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef BATTERYSIMULATION_H
+#define BATTERYSIMULATION_H
+
+#include "semtimeseries.h"
+#include <QList>
+#include <QVector>
+
+
+/**
+ * Solar array and battery of a power system design. The defaults split the
+ * path efficiencies of CSolarArray::CalculateSAEOLPower (0.85 from the array
+ * to the loads, 0.65 through the battery) between the array path and the
+ * charge and discharge of the battery.
+ */
+struct BatterySimulationParameters
+{
+    BatterySimulationParameters();
+
+    double ArrayArea;                   // m2
+    double SolarCellBOLPower;           // W/m2
+    double ArrayDegradationPerYear;     // fraction of the power lost per year
+    double ArrayPathEfficiency;         // from the array to the loads
+
+    double BatteryCapacity;             // Wh, at the beginning of life
+    double InitialStateOfCharge;        // 0 to 1
+    double ChargeEfficiency;
+    double DischargeEfficiency;
+    double MaximumDepthOfDischarge;     // allowed depth of discharge, 0 to 1
+
+    // Capacity fade: the calendar fade is a fraction of the capacity lost per
+    // year; the cycle fade reaches CycleFadeAtEndOfLife after CycleLife cycles
+    // of ReferenceDepthOfDischarge, a cycle of depth d counting as
+    // (d / ReferenceDepthOfDischarge)^CycleLifeExponent reference cycles.
+    double CalendarFadePerYear;
+    double CycleFadeAtEndOfLife;
+    double CycleLife;
+    double ReferenceDepthOfDischarge;
+    double CycleLifeExponent;
+};
+
+
+struct BatterySimulationResult
+{
+    double MinimumStateOfCharge;
+    double MaximumDepthOfDischarge;
+    bool   DepthOfDischargeExceeded;
+    double EquivalentCycles;            // discharged energy / capacity
+    double FinalCapacity;               // Wh
+    double UnservedEnergy;              // Wh the loads didn't get, battery empty
+    double SpilledEnergy;               // Wh of array power shunted, battery full
+    QVector<double> StateOfCharge;      // at every sample, if it was asked for
+};
+
+
+/**
+ * Energy balance of the solar array and the battery over the timeline of a
+ * SemTimeSeries, driven by its star light and consumed power columns (see
+ * PowerSubsystem::CreatePowerConsumptionFunctionOfSpacecraft, which aligns
+ * the payload duty cycles on the eclipse intervals).
+ *
+ * The simulation is a single pass over the samples that only keeps the state
+ * of the battery, so multi-year timelines can be simulated sample by sample
+ * with step(). Designs of a parameter sweep are simulated concurrently with
+ * sweep().
+ */
+class BatterySimulator
+{
+public:
+    explicit BatterySimulator(const BatterySimulationParameters& parameters);
+
+    /**
+     * Start the simulation over at the beginning of life
+     */
+    void reset();
+
+    /**
+     * Advance the battery by duration (s) from elapsed (s since the beginning
+     * of the mission), with the star light and the consumed power (W) of the
+     * step.
+     */
+    void step(double elapsed, double duration, double starLight, double consumedPower);
+
+    double stateOfCharge() const;
+    double capacity() const { return m_capacity; }
+    const BatterySimulationResult& result() const { return m_result; }
+
+    /**
+     * Simulate the whole series. With keepStateOfCharge, the state of charge
+     * at every sample is kept in the result.
+     */
+    static BatterySimulationResult simulate(const BatterySimulationParameters& parameters,
+                                            const SemTimeSeries& series,
+                                            bool keepStateOfCharge = false);
+
+    /**
+     * Simulate every design over the same series concurrently
+     */
+    static QList<BatterySimulationResult> sweep(const QList<BatterySimulationParameters>& designs,
+                                                const SemTimeSeries& series);
+
+    /**
+     * Designs of a sweep over the array area and the battery capacity, the
+     * other parameters being those of base
+     */
+    static QList<BatterySimulationParameters> designGrid(const BatterySimulationParameters& base,
+                                                         const QVector<double>& arrayAreas,
+                                                         const QVector<double>& batteryCapacities);
+
+private:
+    void endDischarge();
+
+    BatterySimulationParameters m_parameters;
+    BatterySimulationResult m_result;
+    double m_energy;            // Wh stored
+    double m_capacity;          // Wh, after the fade
+    double m_cycleDamage;       // in reference cycles / CycleLife
+    double m_dischargeStart;    // energy at the beginning of the discharge, or -1
+    double m_dischargedEnergy;  // Wh
+};
+
+#endif // BATTERYSIMULATION_H
@@ -41,6 +41,9 @@
 //#include "Plotting/PlotGraphFromFile.h"
 //#include "Plotting/PlotView.h"
 
+// Specific heat of the SC used for its heat capacity, J/(kg K) (aluminium)
+static const double SCSpecificHeat = 900.0;
+
 SemMainGUI::SemMainGUI(ScenarioSC* SCVehicle,
                        QString missionArc,
                        QWidget * parent,
@@ -816,7 +819,31 @@ void SemMainGUI::on_ThermalSubsystemGraphComboBox_2_activated(const QString&)
 
 void SemMainGUI::on_ThermalGraphPushButton_2_clicked()
 {
-    SC.getNewSCThermal()->CreateTemperatureTimeFunction();
+    SemTimeSeries* timeSeries = SC.getSCTimeSeries();
+    if (!timeSeries->hasColumn(SemTimeSeries::ConsumedPower))
+    {
+        SC.getNewSCPower()->CreatePowerConsumptionFunctionOfSpacecraft(*timeSeries);
+    }
+
+    // The transient solution of the SC thermal network includes its thermal
+    // inertia; the radiative equilibrium is used if it can't be solved
+    double heatCapacity = SC.getNewSCStructure()->getSCMass() * SCSpecificHeat;
+    bool transient = false;
+    if (heatCapacity > 0.0)
+    {
+        ThermalNetwork network = SC.getNewSCThermal()->CreateThermalNetwork(heatCapacity);
+        transient = SC.getNewSCThermal()->CreateTransientTemperatureTimeFunction(*timeSeries, network);
+    }
+    if (transient)
+    {
+        SC.getNewSCThermal()->WriteHeatCapacityVariantsReport
+                (*timeSeries, heatCapacity,
+                 "data/SystemsEngineeringReports/SCTemperatureHeatCapacityVariants.stad");
+    }
+    else
+    {
+        SC.getNewSCThermal()->CreateTemperatureTimeFunction(*timeSeries);
+    }
 
     //plotting process starts
 
@@ -824,6 +851,8 @@ void SemMainGUI::on_ThermalGraphPushButton_2_clicked()
     if (PowerGraphComboBox->currentIndex()!=0)
     {
         FileNameWithExtension = ("SCTemperatureTimeFunction.stad");
+        timeSeries->writeColumn(SemTimeSeries::Temperature,
+                                "data/SystemsEngineeringReports/" + FileNameWithExtension);
         QDialog plotDialog(this);
         QVBoxLayout* layout = new QVBoxLayout(&plotDialog);
         /*
@@ -951,44 +980,64 @@ void SemMainGUI::on_PowerGraphPushButton_clicked()
                 PropagateLoiteringTrajectory(tempLloitering, sampleTimes, samples, feedback);
 
                 //******************************************************************** /OZGUN
-                // Eclipse function is called and the "data/EclipseStarLight.stad" is generated
-                EclipseDuration* Eclipse = new EclipseDuration();
-
-                Eclipse->StarLightTimeFunction(sampleTimes,
-                                               samples,
-                                               STA_SOLAR_SYSTEM->lookup(PlanetNameLineEdit->text()),
-                                               STA_SOLAR_SYSTEM->lookup("Sun"));
+                // Eclipse function is called and the star light of the samples is kept
+                EclipseDuration Eclipse;
+
+                SC.getSCTimeSeries()->setStarLight
+                        (sampleTimes,
+                         Eclipse.StarLightTimeFunction(sampleTimes,
+                                                       samples,
+                                                       STA_SOLAR_SYSTEM->lookup(PlanetNameLineEdit->text()),
+                                                       STA_SOLAR_SYSTEM->lookup("Sun")));
+                SC.getSCTimeSeries()->writeLightingReport
+                        ("data/SystemsEngineeringReports/EclipseDetailedReport.stad");
                 //******************************************************************** OZGUN/
             }
         }
     }
 
 
-    //create the files of the functions
-    SC.getNewSCPower()->CreateGeneratedPowerTimeFunctionOfSpacecraft();
-    SC.getNewSCPower()->CreatePowerConsumptionFunctionOfSpacecraft();
-    SC.getNewSCPower()->CreateNetPowerTimeFunctionOfSpacecraft();
+    //create the functions
+    SemTimeSeries* timeSeries = SC.getSCTimeSeries();
+    SC.getNewSCPower()->CreateGeneratedPowerTimeFunctionOfSpacecraft(*timeSeries);
+    SC.getNewSCPower()->CreatePowerConsumptionFunctionOfSpacecraft(*timeSeries);
+    SC.getNewSCPower()->CreateNetPowerTimeFunctionOfSpacecraft(*timeSeries);
+    SC.getNewSCPower()->CreateStateOfChargeTimeFunctionOfSpacecraft(*timeSeries);
+    // The depth of discharge and the unserved energy of the design are in
+    // the 100% row of the sizing report
+    SC.getNewSCPower()->WriteBatterySizingReport
+            (*timeSeries, "data/SystemsEngineeringReports/BatterySizingReport.stad");
 
     //plotting process starts
 
     QString FileNameWithExtension;
+    SemTimeSeries::Column column = SemTimeSeries::StarLight;
     switch (PowerGraphComboBox->currentIndex())
     {
     case 0://SelectGraph
         break;
     case 1://consumed power - time
         FileNameWithExtension = ("PowerConsumptionTimeFunction.stad");
+        column = SemTimeSeries::ConsumedPower;
         break;
     case 2://generate power - time
         FileNameWithExtension = ("GeneratedPowerTimeFunction.stad");
+        column = SemTimeSeries::GeneratedPower;
         break;
     case 3://net power - time
         FileNameWithExtension = ("NetPowerTimeFunction.stad");
+        column = SemTimeSeries::NetPower;
+        break;
+    case 4://battery state of charge - time
+        FileNameWithExtension = ("BatteryStateOfChargeTimeFunction.stad");
+        column = SemTimeSeries::StateOfCharge;
         break;
     }
 
     if (PowerGraphComboBox->currentIndex() != 0)
     {
+        timeSeries->writeColumn(column,
+                                "data/SystemsEngineeringReports/" + FileNameWithExtension);
         QDialog plotDialog(this);
         QVBoxLayout* layout = new QVBoxLayout(&plotDialog);
         /*
@@ -1730,13 +1779,17 @@ void SemMainGUI::RetrieveScenarioSC()
 
                             SC.PassMissionDetailsOutputParameters();
                             //******************************************************************** /OZGUN
-                            // Eclipse function is called and the "data/EclipseStarLight.stad" is generated
-                            EclipseDuration* Eclipse = new EclipseDuration();
-
-                            Eclipse->StarLightTimeFunction(sampleTimes,
-                                                           samples,
-                                                           STA_SOLAR_SYSTEM->lookup(SC.getSCMissionDetails()->getPlanetProperties()->Planet),
-                                                           STA_SOLAR_SYSTEM->lookup("Sun"));
+                            // Eclipse function is called and the star light of the samples is kept
+                            EclipseDuration Eclipse;
+
+                            SC.getSCTimeSeries()->setStarLight
+                                    (sampleTimes,
+                                     Eclipse.StarLightTimeFunction(sampleTimes,
+                                                                   samples,
+                                                                   STA_SOLAR_SYSTEM->lookup(SC.getSCMissionDetails()->getPlanetProperties()->Planet),
+                                                                   STA_SOLAR_SYSTEM->lookup("Sun")));
+                            SC.getSCTimeSeries()->writeLightingReport
+                                    ("data/SystemsEngineeringReports/EclipseDetailedReport.stad");
                             //******************************************************************** OZGUN/
                             break;
                         }
@@ -0,0 +1,160 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "semtimeseries.h"
+#include "Astro-Core/date.h"
+#include <QFile>
+#include <QTextStream>
+#include <QDebug>
+
+
+SemTimeSeries::SemTimeSeries()
+{
+}
+
+
+void SemTimeSeries::setStarLight(const QList<double>& sampleTimes, const QVector<double>& starLight)
+{
+    clear();
+    if (sampleTimes.size() != starLight.size())
+    {
+        qDebug() << "SemTimeSeries: the star light doesn't match the sample times";
+        return;
+    }
+
+    m_mjd = sampleTimes.toVector();
+    m_columns[StarLight] = starLight;
+}
+
+
+void SemTimeSeries::clear()
+{
+    m_mjd.clear();
+    for (int i = 0; i < ColumnCount; i++)
+    {
+        m_columns[i].clear();
+    }
+}
+
+
+bool SemTimeSeries::hasColumn(Column column) const
+{
+    return !m_mjd.isEmpty() && m_columns[column].size() == m_mjd.size();
+}
+
+
+void SemTimeSeries::setColumn(Column column, const QVector<double>& values)
+{
+    if (values.size() != m_mjd.size())
+    {
+        qDebug() << "SemTimeSeries: column of" << values.size() << "values for" << m_mjd.size() << "samples";
+        return;
+    }
+
+    m_columns[column] = values;
+}
+
+
+QList<SemLightingInterval> SemTimeSeries::lightingIntervals() const
+{
+    QList<SemLightingInterval> intervals;
+    const QVector<double>& starLight = m_columns[StarLight];
+
+    for (int i = 0; i < starLight.size(); i++)
+    {
+        bool eclipse = starLight.at(i) <= 0.5;
+        if (intervals.isEmpty() || intervals.last().eclipse != eclipse)
+        {
+            SemLightingInterval interval;
+            interval.eclipse = eclipse;
+            interval.first = i;
+            interval.count = 0;
+            intervals.append(interval);
+        }
+        intervals.last().count++;
+    }
+
+    return intervals;
+}
+
+
+bool SemTimeSeries::writeColumn(Column column, const QString& fileName) const
+{
+    if (!hasColumn(column))
+    {
+        qDebug() << "SemTimeSeries: no values to write to" << fileName;
+        return false;
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "SemTimeSeries: unable to write" << fileName;
+        return false;
+    }
+
+    QTextStream out(&file);
+    out.setRealNumberPrecision(16);
+    const QVector<double>& values = m_columns[column];
+    for (int i = 0; i < m_mjd.size(); i++)
+    {
+        out << m_mjd.at(i) << "\t" << values.at(i) << "\n";
+    }
+
+    return file.error() == QFile::NoError;
+}
+
+
+bool SemTimeSeries::writeLightingReport(const QString& fileName) const
+{
+    if (!hasColumn(StarLight))
+    {
+        qDebug() << "SemTimeSeries: no star light to write to" << fileName;
+        return false;
+    }
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "SemTimeSeries: unable to write" << fileName;
+        return false;
+    }
+
+    QTextStream out(&file);
+    out.setRealNumberPrecision(16);
+    out << "State" << "\t\t" << "Start(mjd)" << "\t\t" << "End(mjd)" << "\t\t"
+        << "Duration(s)" << "\t" << "#ofSteps" << "\n";
+
+    // An interval ends on the first sample of the next one
+    foreach (const SemLightingInterval& interval, lightingIntervals())
+    {
+        int end = qMin(interval.first + interval.count, m_mjd.size() - 1);
+        double startMjd = m_mjd.at(interval.first);
+        double endMjd = m_mjd.at(end);
+        out << (interval.eclipse ? "Eclipse\t\t" : "Daylight\t")
+            << startMjd << "\t" << endMjd << "\t"
+            << sta::daysToSecs(endMjd - startMjd) << "\t"
+            << interval.count << "\n";
+    }
+
+    return file.error() == QFile::NoError;
+}
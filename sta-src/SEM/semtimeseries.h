@@ -0,0 +1,115 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef SEMTIMESERIES_H
+#define SEMTIMESERIES_H
+
+#include <QList>
+#include <QVector>
+#include <QString>
+
+
+/**
+ * Run of consecutive samples of a time series in eclipse (umbra or penumbra)
+ * or in daylight.
+ */
+struct SemLightingInterval
+{
+    bool eclipse;
+    int first;    // index of the first sample
+    int count;    // number of samples
+};
+
+
+/**
+ * Time functions of a spacecraft computed by the systems engineering module,
+ * one column per quantity over the same sample times:
+ *
+ *   StarLight       0 in umbra, 0.5 in penumbra, 1 in daylight
+ *   ConsumedPower   W
+ *   GeneratedPower  W
+ *   NetPower        W
+ *   Temperature     K
+ *   StateOfCharge   0 to 1, battery
+ *
+ * The eclipse computation fills the sample times and the star light, and each
+ * subsystem adds its own column from the columns of the previous stages. The
+ * columns are only written to .stad files when a report is requested, so
+ * several spacecraft can be analysed at the same time.
+ */
+class SemTimeSeries
+{
+public:
+    enum Column
+    {
+        StarLight,
+        ConsumedPower,
+        GeneratedPower,
+        NetPower,
+        Temperature,
+        StateOfCharge,
+        ColumnCount
+    };
+
+    SemTimeSeries();
+
+    /**
+     * Start a new series with the sample times (mjd) and the star light
+     * computed at them. All the other columns are cleared.
+     */
+    void setStarLight(const QList<double>& sampleTimes, const QVector<double>& starLight);
+    void clear();
+
+    int size() const { return m_mjd.size(); }
+    bool isEmpty() const { return m_mjd.isEmpty(); }
+    /**
+     * Return true if the column has a value for every sample.
+     */
+    bool hasColumn(Column column) const;
+
+    const QVector<double>& mjd() const { return m_mjd; }
+    const QVector<double>& column(Column column) const { return m_columns[column]; }
+    void setColumn(Column column, const QVector<double>& values);
+
+    /**
+     * Split the samples in eclipse and daylight intervals, a sample being in
+     * eclipse when its star light is 0.5 or less.
+     */
+    QList<SemLightingInterval> lightingIntervals() const;
+
+    /**
+     * Write a column as "mjd<tab>value" lines. Return false if the column is
+     * missing or the file can't be written.
+     */
+    bool writeColumn(Column column, const QString& fileName) const;
+    /**
+     * Write the eclipse and daylight intervals with their start, end, duration
+     * (s) and number of samples.
+     */
+    bool writeLightingReport(const QString& fileName) const;
+
+private:
+    QVector<double> m_mjd;
+    QVector<double> m_columns[ColumnCount];
+};
+
+#endif // SEMTIMESERIES_H
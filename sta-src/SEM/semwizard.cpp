@@ -251,13 +251,17 @@ void SEMWizard::wizardIsCompleted()
                     PropagateLoiteringTrajectory(SCLoiteringArc, sampleTimes, samples, feedback);
 
                     //******************************************************************** /OZGUN
-                    // Eclipse function is called and the "data/EclipseStarLight.stad" is generated
-                    EclipseDuration* Eclipse = new EclipseDuration();
-
-                    Eclipse->StarLightTimeFunction(sampleTimes,
-                                                   samples,
-                                                   STA_SOLAR_SYSTEM->lookup("Earth"),
-                                                   STA_SOLAR_SYSTEM->lookup("Sun"));
+                    // Eclipse function is called and the star light of the samples is kept
+                    EclipseDuration Eclipse;
+
+                    SC.getSCTimeSeries()->setStarLight
+                            (sampleTimes,
+                             Eclipse.StarLightTimeFunction(sampleTimes,
+                                                           samples,
+                                                           STA_SOLAR_SYSTEM->lookup("Earth"),
+                                                           STA_SOLAR_SYSTEM->lookup("Sun")));
+                    SC.getSCTimeSeries()->writeLightingReport
+                            ("data/SystemsEngineeringReports/EclipseDetailedReport.stad");
                     //******************************************************************** OZGUN/
                 }
             }
@@ -0,0 +1,385 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "thermalnetwork.h"
+#include "Astro-Core/constants.h"
+#include "Astro-Core/date.h"
+#include <Eigen/Core>
+#include <Eigen/Array>
+#include <Eigen/Sparse>
+#include <QFile>
+#include <QTextStream>
+#include <QDebug>
+#include <QtConcurrentMap>
+#include <cmath>
+
+using namespace Eigen;
+
+static const int MaximumIterations = 50;
+// Temperatures aren't let below this value (K) during the iterations
+static const double MinimumTemperature = 1.0;
+
+
+/**
+ * Matrices and loads of a network, set up once per solution. The iteration
+ * matrix holds the upper triangle of the symmetric matrix, column by column,
+ * and keeps its sparsity pattern between the iterations: only its values are
+ * updated.
+ */
+class ThermalSystem
+{
+public:
+    explicit ThermalSystem(const ThermalNetwork& network);
+
+    bool step(VectorXd& temperature, const VectorXd& previousTemperature, double dt,
+              double starLight, double consumedPower, double tolerance);
+
+    int size() const { return m_capacity.size(); }
+
+private:
+    struct Coupling
+    {
+        int first;
+        int second;
+        double conductance;
+        double radiation;   // Stefan-Boltzmann constant * radiative exchange
+        int entry;          // index of the (first, second) entry in the values of the matrix
+    };
+
+    VectorXd m_capacity;
+    VectorXd m_radiation;   // Stefan-Boltzmann constant * emissivity * area
+    VectorXd m_sunlitLoad;
+    VectorXd m_constantLoad;
+    VectorXd m_powerFraction;
+    QVector<Coupling> m_couplings;
+    QVector<int> m_diagonalEntries;
+    SparseMatrix<double> m_matrix;
+};
+
+
+ThermalSystem::ThermalSystem(const ThermalNetwork& network)
+{
+    int n = network.nodeCount();
+    m_capacity.resize(n);
+    m_radiation.resize(n);
+    m_sunlitLoad.resize(n);
+    m_constantLoad.resize(n);
+    m_powerFraction.resize(n);
+
+    for (int i = 0; i < n; i++)
+    {
+        const ThermalNode& node = network.nodes().at(i);
+        m_capacity(i) = node.HeatCapacity;
+        m_radiation(i) = STEFAN_BOLTZMANN_CONSTANT * node.Emmissivity * node.RadiatingArea;
+        m_sunlitLoad(i) = node.SolarLoad + node.AlbedoLoad;
+        m_constantLoad(i) = node.PlanetIRLoad;
+        m_powerFraction(i) = node.PowerFraction;
+    }
+
+    // Rows of the upper triangle in each column: the diagonal and the coupled nodes above it
+    QVector<QList<int> > columnRows(n);
+    for (int i = 0; i < n; i++)
+    {
+        columnRows[i].append(i);
+    }
+    foreach (const ThermalCoupling& coupling, network.couplings())
+    {
+        int row = qMin(coupling.FirstNode, coupling.SecondNode);
+        int column = qMax(coupling.FirstNode, coupling.SecondNode);
+        if (!columnRows[column].contains(row))
+        {
+            columnRows[column].append(row);
+        }
+    }
+
+    QVector<int> columnStart(n);
+    int nonZeros = 0;
+    for (int i = 0; i < n; i++)
+    {
+        qSort(columnRows[i]);
+        columnStart[i] = nonZeros;
+        nonZeros += columnRows[i].size();
+    }
+
+    m_matrix.resize(n, n);
+    m_matrix.startFill(nonZeros);
+    for (int column = 0; column < n; column++)
+    {
+        foreach (int row, columnRows[column])
+        {
+            m_matrix.fill(row, column) = 0.0;
+        }
+    }
+    m_matrix.endFill();
+
+    m_diagonalEntries.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        m_diagonalEntries[i] = columnStart[i] + columnRows[i].indexOf(i);
+    }
+
+    foreach (const ThermalCoupling& coupling, network.couplings())
+    {
+        Coupling c;
+        c.first = qMin(coupling.FirstNode, coupling.SecondNode);
+        c.second = qMax(coupling.FirstNode, coupling.SecondNode);
+        c.conductance = coupling.Conductance;
+        c.radiation = STEFAN_BOLTZMANN_CONSTANT * coupling.RadiativeExchange;
+        c.entry = columnStart[c.second] + columnRows[c.second].indexOf(c.first);
+        m_couplings.append(c);
+    }
+}
+
+
+/**
+ * Backward Euler step of length dt from previousTemperature, with the loads at
+ * the end of the step. temperature holds the initial guess and the solution.
+ *
+ * The radiative exchange between two nodes is written as the secant
+ * conductance radiation * (Ti^2 + Tj^2) * (Ti + Tj) evaluated at the current
+ * iterate, so the matrix stays symmetric. This is a fixed-point iteration
+ * rather than Newton's method; the residual is exact, which makes the
+ * converged temperatures those of the nonlinear step.
+ */
+bool ThermalSystem::step(VectorXd& temperature, const VectorXd& previousTemperature, double dt,
+                         double starLight, double consumedPower, double tolerance)
+{
+    int n = size();
+    VectorXd capacityRate = m_capacity / dt;
+    VectorXd load = m_sunlitLoad * starLight + m_constantLoad + m_powerFraction * consumedPower;
+    double* values = m_matrix._valuePtr();
+
+    for (int iteration = 0; iteration < MaximumIterations; iteration++)
+    {
+        VectorXd fourthPower = temperature.cwise().square().cwise().square();
+        VectorXd residual = capacityRate.cwise() * (temperature - previousTemperature)
+                            + m_radiation.cwise() * fourthPower - load;
+        VectorXd diagonal = capacityRate + 4.0 * (m_radiation.cwise() * temperature.cwise().cube());
+
+        for (int k = 0; k < m_matrix.nonZeros(); k++)
+        {
+            values[k] = 0.0;
+        }
+
+        foreach (const Coupling& c, m_couplings)
+        {
+            double ti = temperature(c.first);
+            double tj = temperature(c.second);
+            double exchange = c.conductance + c.radiation * (ti * ti + tj * tj) * (ti + tj);
+            double flow = c.conductance * (ti - tj) + c.radiation * (fourthPower(c.first) - fourthPower(c.second));
+            residual(c.first) += flow;
+            residual(c.second) -= flow;
+            diagonal(c.first) += exchange;
+            diagonal(c.second) += exchange;
+            values[c.entry] -= exchange;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            values[m_diagonalEntries[i]] += diagonal(i);
+        }
+
+        SparseLDLT<SparseMatrix<double> > ldlt(m_matrix);
+        VectorXd correction = -residual;
+        if (!ldlt.succeeded() || !ldlt.solveInPlace(correction))
+        {
+            return false;
+        }
+
+        temperature += correction;
+        for (int i = 0; i < n; i++)
+        {
+            temperature(i) = qMax(temperature(i), MinimumTemperature);
+        }
+
+        if (correction.cwise().abs().maxCoeff() < tolerance)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+ThermalNetwork::ThermalNetwork() :
+    m_maximumStep(3600.0),
+    m_tolerance(1.0e-6)
+{
+}
+
+
+int ThermalNetwork::addNode(const ThermalNode& node)
+{
+    m_nodes.append(node);
+    return m_nodes.size() - 1;
+}
+
+
+bool ThermalNetwork::addCoupling(int firstNode, int secondNode, double conductance, double radiativeExchange)
+{
+    if (firstNode < 0 || secondNode < 0 || firstNode >= m_nodes.size() || secondNode >= m_nodes.size() ||
+        firstNode == secondNode)
+    {
+        qDebug() << "ThermalNetwork: invalid coupling between nodes" << firstNode << "and" << secondNode;
+        return false;
+    }
+
+    ThermalCoupling coupling;
+    coupling.FirstNode = firstNode;
+    coupling.SecondNode = secondNode;
+    coupling.Conductance = conductance;
+    coupling.RadiativeExchange = radiativeExchange;
+    m_couplings.append(coupling);
+    return true;
+}
+
+
+ThermalSolution ThermalNetwork::solve(const SemTimeSeries& series) const
+{
+    ThermalSolution solution;
+    solution.Converged = false;
+
+    int n = m_nodes.size();
+    if (n == 0 || !series.hasColumn(SemTimeSeries::StarLight))
+    {
+        qDebug() << "ThermalNetwork: no nodes or no star light function";
+        return solution;
+    }
+
+    const QVector<double>& mjd = series.mjd();
+    const QVector<double>& starLight = series.column(SemTimeSeries::StarLight);
+    bool withPower = series.hasColumn(SemTimeSeries::ConsumedPower);
+    const QVector<double>& consumedPower = series.column(SemTimeSeries::ConsumedPower);
+
+    ThermalSystem system(*this);
+    VectorXd temperature(n);
+    for (int i = 0; i < n; i++)
+    {
+        temperature(i) = m_nodes.at(i).InitialTemperature;
+    }
+
+    solution.NodeTemperatures.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        solution.NodeTemperatures[i].resize(series.size());
+        solution.NodeTemperatures[i][0] = temperature(i);
+    }
+
+    for (int k = 1; k < series.size(); k++)
+    {
+        double interval = sta::daysToSecs(mjd.at(k) - mjd.at(k - 1));
+        int steps = qMax(1, int(ceil(interval / m_maximumStep)));
+        double dt = interval / steps;
+
+        // The loads are interpolated between the two samples
+        for (int s = 1; s <= steps && dt > 0.0; s++)
+        {
+            double f = double(s) / steps;
+            double light = (1.0 - f) * starLight.at(k - 1) + f * starLight.at(k);
+            double power = withPower ? (1.0 - f) * consumedPower.at(k - 1) + f * consumedPower.at(k) : 0.0;
+
+            VectorXd previousTemperature = temperature;
+            if (!system.step(temperature, previousTemperature, dt, light, power, m_tolerance))
+            {
+                qDebug() << "ThermalNetwork: no convergence at mjd" << mjd.at(k);
+                for (int i = 0; i < n; i++)
+                {
+                    solution.NodeTemperatures[i].resize(k);
+                }
+                return solution;
+            }
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            solution.NodeTemperatures[i][k] = temperature(i);
+        }
+    }
+
+    solution.Converged = true;
+    return solution;
+}
+
+
+// A network variant and the heat load series to integrate it over
+struct ThermalVariantCase
+{
+    const ThermalNetwork* network;
+    const SemTimeSeries* series;
+};
+
+static ThermalSolution solveVariant(const ThermalVariantCase& variantCase)
+{
+    return variantCase.network->solve(*variantCase.series);
+}
+
+
+QList<ThermalSolution> ThermalNetwork::solveVariants(const QList<ThermalNetwork>& variants,
+                                                     const SemTimeSeries& series)
+{
+    QList<ThermalVariantCase> cases;
+    for (int i = 0; i < variants.size(); i++)
+    {
+        ThermalVariantCase variantCase;
+        variantCase.network = &variants.at(i);
+        variantCase.series = &series;
+        cases.append(variantCase);
+    }
+
+    return QtConcurrent::blockingMapped<QList<ThermalSolution> >(cases, solveVariant);
+}
+
+
+bool ThermalNetwork::writeTemperatures(const QString& fileName,
+                                       const SemTimeSeries& series,
+                                       const ThermalSolution& solution) const
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        qDebug() << "ThermalNetwork: unable to write" << fileName;
+        return false;
+    }
+
+    QTextStream out(&file);
+    out.setRealNumberPrecision(16);
+    out << "mjd";
+    foreach (const ThermalNode& node, m_nodes)
+    {
+        out << "\t" << node.Name;
+    }
+    out << "\n";
+
+    int samples = solution.NodeTemperatures.isEmpty() ? 0 : solution.NodeTemperatures.first().size();
+    for (int k = 0; k < samples; k++)
+    {
+        out << series.mjd().at(k);
+        for (int i = 0; i < solution.NodeTemperatures.size(); i++)
+        {
+            out << "\t" << solution.NodeTemperatures.at(i).at(k);
+        }
+        out << "\n";
+    }
+
+    return file.error() == QFile::NoError;
+}
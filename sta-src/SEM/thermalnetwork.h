@@ -0,0 +1,147 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef THERMALNETWORK_H
+#define THERMALNETWORK_H
+
+#include "semtimeseries.h"
+#include <QList>
+#include <QVector>
+#include <QString>
+
+
+/**
+ * Lumped node of a thermal network. The external loads are the loads absorbed
+ * by the node in full star light; the solar and albedo loads follow the star
+ * light of the eclipse timeline, the planet IR load is constant.
+ */
+struct ThermalNode
+{
+    QString Name;
+    double HeatCapacity;        // J/K
+    double RadiatingArea;       // m2, area radiating to deep space
+    double Emmissivity;
+    double SolarLoad;           // W
+    double AlbedoLoad;          // W
+    double PlanetIRLoad;        // W
+    double PowerFraction;       // part of the consumed power dissipated in the node
+    double InitialTemperature;  // K
+};
+
+/**
+ * Coupling between two nodes: a conductance (W/K) and a radiative exchange
+ * factor (m2, area times view factor times effective emissivity).
+ */
+struct ThermalCoupling
+{
+    int FirstNode;
+    int SecondNode;
+    double Conductance;
+    double RadiativeExchange;
+};
+
+/**
+ * Temperatures of every node (K) at the samples of a time series, one vector
+ * per node.
+ */
+struct ThermalSolution
+{
+    bool Converged;
+    QVector<QVector<double> > NodeTemperatures;
+};
+
+
+/**
+ * Transient solver of a lumped-parameter thermal network over the timeline of
+ * a SemTimeSeries: the star light column scales the solar and albedo loads and
+ * the consumed power column, when present, is dissipated in the nodes.
+ *
+ * The network is integrated with the backward Euler method, which stays
+ * stable with steps of a sizeable part of an orbit. The nonlinear system of
+ * each step is solved iteratively: the radiation to space is linearized with
+ * its tangent and each radiative coupling is replaced by its secant
+ * conductance R (Ti^2 + Tj^2)(Ti + Tj) at the current iterate. Because of the
+ * secant terms this is a fixed-point iteration, not Newton's method, and it
+ * converges linearly. The matrix of the iterations is symmetric and has the
+ * sparsity of the couplings, so it is factorized with a sparse LDLT
+ * decomposition.
+ *
+ * Several variants of a design can be solved concurrently on the global
+ * thread pool with solveVariants().
+ */
+class ThermalNetwork
+{
+public:
+    ThermalNetwork();
+
+    /**
+     * Add a node and return its index
+     */
+    int addNode(const ThermalNode& node);
+    /**
+     * Couple two nodes. Return false if a node doesn't exist.
+     */
+    bool addCoupling(int firstNode, int secondNode, double conductance, double radiativeExchange);
+
+    int nodeCount() const { return m_nodes.size(); }
+    const QList<ThermalNode>& nodes() const { return m_nodes; }
+    QList<ThermalNode>& nodes() { return m_nodes; }
+    const QList<ThermalCoupling>& couplings() const { return m_couplings; }
+
+    /**
+     * Longest integration step (s). Longer intervals between two samples are
+     * divided in equal steps. The default is one hour.
+     */
+    void setMaximumStep(double step) { m_maximumStep = step; }
+    /**
+     * Largest temperature change (K) between two successive fixed-point
+     * iterations of a step below which the step is converged.
+     */
+    void setTolerance(double tolerance) { m_tolerance = tolerance; }
+
+    /**
+     * Integrate the network over the samples of the series, starting from the
+     * initial temperatures of the nodes at the first sample.
+     */
+    ThermalSolution solve(const SemTimeSeries& series) const;
+
+    /**
+     * Solve every variant over the same series concurrently.
+     */
+    static QList<ThermalSolution> solveVariants(const QList<ThermalNetwork>& variants,
+                                                const SemTimeSeries& series);
+
+    /**
+     * Write the node temperatures, one "mjd<tab>T1<tab>T2..." line per sample.
+     */
+    bool writeTemperatures(const QString& fileName,
+                           const SemTimeSeries& series,
+                           const ThermalSolution& solution) const;
+
+private:
+    QList<ThermalNode> m_nodes;
+    QList<ThermalCoupling> m_couplings;
+    double m_maximumStep;
+    double m_tolerance;
+};
+
+#endif // THERMALNETWORK_H
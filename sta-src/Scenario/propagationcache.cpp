@@ -0,0 +1,112 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#include "propagationcache.h"
+#include "Scenario/staschema.h"
+#include <QCryptographicHash>
+#include <QDomDocument>
+#include <QDataStream>
+
+
+PropagationCache::PropagationCache()
+{
+}
+
+
+QByteArray
+PropagationCache::arcKey(const ScenarioObject* arc, double startTime, const sta::StateVector& startState)
+{
+    QDomDocument doc;
+    doc.appendChild(arc->toDomElement(doc, arc->elementName()));
+
+    // The initial state is hashed at full precision
+    QByteArray start;
+    QDataStream out(&start, QIODevice::WriteOnly);
+    out << startTime;
+    for (int i = 0; i < 3; ++i)
+    {
+        out << startState.position[i] << startState.velocity[i];
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(doc.toByteArray(-1));
+    hash.addData(start);
+
+    return hash.result();
+}
+
+
+bool
+PropagationCache::find(const QByteArray& key, ArcSamples* samples)
+{
+    QHash<QByteArray, ArcSamples>::const_iterator iter = m_arcs.constFind(key);
+    if (iter == m_arcs.constEnd())
+    {
+        return false;
+    }
+
+    *samples = iter.value();
+    m_usedKeys.insert(key);
+
+    return true;
+}
+
+
+void
+PropagationCache::insert(const QByteArray& key, const ArcSamples& samples)
+{
+    m_arcs.insert(key, samples);
+    m_usedKeys.insert(key);
+}
+
+
+void
+PropagationCache::beginPropagation()
+{
+    m_usedKeys.clear();
+}
+
+
+void
+PropagationCache::endPropagation()
+{
+    QHash<QByteArray, ArcSamples>::iterator iter = m_arcs.begin();
+    while (iter != m_arcs.end())
+    {
+        if (m_usedKeys.contains(iter.key()))
+        {
+            ++iter;
+        }
+        else
+        {
+            iter = m_arcs.erase(iter);
+        }
+    }
+}
+
+
+void
+PropagationCache::clear()
+{
+    m_arcs.clear();
+    m_usedKeys.clear();
+}
@@ -0,0 +1,82 @@
+/*
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the European Union Public Licence - EUPL v.1.1 as published by
+ the European Commission.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE. See the European Union Public Licence - EUPL v.1.1
+ for more details.
+
+ You should have received a copy of the European Union Public Licence - EUPL v.1.1
+ along with this program.
+
+ Further information about the European Union Public Licence - EUPL v.1.1 can
+ also be found on the world wide web at http://ec.europa.eu/idabc/eupl
+
+*/
+
+/*
+ ------ Copyright (C) 2011 STA Steering Board (space.trajectory.analysis AT gmail.com) ----
+*/
+
+#ifndef _STA_PROPAGATION_CACHE_H_
+#define _STA_PROPAGATION_CACHE_H_
+
+#include "Astro-Core/statevector.h"
+#include "Astro-Core/attitudevector.h"
+#include <QByteArray>
+#include <QHash>
+#include <QSet>
+#include <QList>
+
+class ScenarioObject;
+
+
+/** PropagationCache keeps the samples of the propagated trajectory arcs from
+  * one propagation of a scenario to the next, so that only the arcs that
+  * changed are propagated again.
+  *
+  * An arc is identified by a hash of its scenario description (its XML
+  * serialization) and of the time and state it starts from, which is the
+  * final state of the previous arc: an edited arc gets a new key, and so do
+  * all the arcs after it whose initial state changed.
+  *
+  * The samples are implicitly shared lists; reusing an arc doesn't copy them.
+  */
+class PropagationCache
+{
+public:
+    struct ArcSamples
+    {
+        QList<double> sampleTimes;
+        QList<sta::StateVector> samples;
+        QList<double> attitudeSampleTimes;
+        QList<staAttitude::AttitudeVector> attitudeSamples;
+    };
+
+    PropagationCache();
+
+    static QByteArray arcKey(const ScenarioObject* arc, double startTime, const sta::StateVector& startState);
+
+    /** Find the samples of an arc. Return false if the arc isn't in the cache.
+      */
+    bool find(const QByteArray& key, ArcSamples* samples);
+    void insert(const QByteArray& key, const ArcSamples& samples);
+
+    /** Start a propagation of the scenario.
+      */
+    void beginPropagation();
+
+    /** Forget the arcs that weren't used by the last propagation.
+      */
+    void endPropagation();
+
+    void clear();
+
+private:
+    QHash<QByteArray, ArcSamples> m_arcs;
+    QSet<QByteArray> m_usedKeys;
+};
+
+#endif // _STA_PROPAGATION_CACHE_H_
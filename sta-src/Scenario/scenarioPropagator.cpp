@@ -32,6 +32,7 @@
 #include "Scenario/scenario.h"
 #include "Scenario/missionsDefaults.h"
 #include "Scenario/scenarioPropagator.h"
+#include "Scenario/propagationcache.h"
 
 #include "Main/scenarioelementbox.h"
 #include "Main/mainwindow.h"
@@ -46,7 +47,6 @@
 #include "Astro-Core/trueAnomalyTOmeanAnomaly.h"
 #include "Astro-Core/stamath.h"
 #include "Astro-Core/date.h"
-#include "Astro-Core/EclipseDuration.h"
 
 #include"Astro-Core/eci2lhlv.h"
 
@@ -73,7 +73,11 @@ USING_PART_OF_NAMESPACE_EIGEN;
 
 
 
-void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedback, PropagatedScenario* propScenario, QWidget* parent)
+/** Propagate the trajectory plan of a satellite. When a cache is given, the
+  * loitering and TLE arcs found in it are reused instead of being propagated
+  * again, and the newly propagated ones are added to it.
+  */
+void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedback, PropagatedScenario* propScenario, QWidget* parent, PropagationCache* cache)
 {
 	const QList<QSharedPointer<ScenarioAbstractTrajectoryType> >& trajectoryList = vehicle->SCMission()->TrajectoryPlan()->AbstractTrajectory();
     int numberOfArcs = trajectoryList.size();
@@ -139,10 +143,37 @@ void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedb
                     }
                 }
 
-                PropagateLoiteringTrajectory(loitering, sampleTimesTrajectory, samplesTrajectory, feedback);
+                // The key is computed after the initial state of the arc was set
+                QByteArray arcKey;
+                PropagationCache::ArcSamples cachedArc;
+                if (cache)
+                {
+                    arcKey = PropagationCache::arcKey(loitering, theLastSampleTime, theLastStateVector);
+                }
+
+                if (cache && cache->find(arcKey, &cachedArc))
+                {
+                    sampleTimesTrajectory = cachedArc.sampleTimes;
+                    samplesTrajectory = cachedArc.samples;
+                    sampleTimesAttitude = cachedArc.attitudeSampleTimes;
+                    samplesAttitude = cachedArc.attitudeSamples;
+                }
+                else
+                {
+                    PropagateLoiteringTrajectory(loitering, sampleTimesTrajectory, samplesTrajectory, feedback);
 
-                PropagationFeedback feedbackAttitude;
-                PropagateLoiteringAttitude(loitering, sampleTimesAttitude, samplesAttitude, feedbackAttitude);
+                    PropagationFeedback feedbackAttitude;
+                    PropagateLoiteringAttitude(loitering, sampleTimesAttitude, samplesAttitude, feedbackAttitude);
+
+                    if (cache && feedback.status() == PropagationFeedback::PropagationOk && !sampleTimesTrajectory.isEmpty())
+                    {
+                        cachedArc.sampleTimes = sampleTimesTrajectory;
+                        cachedArc.samples = samplesTrajectory;
+                        cachedArc.attitudeSampleTimes = sampleTimesAttitude;
+                        cachedArc.attitudeSamples = samplesAttitude;
+                        cache->insert(arcKey, cachedArc);
+                    }
+                }
 
                 // Recovering the last state vector
                 numberOFsamples = sampleTimesTrajectory.size();
@@ -150,17 +181,6 @@ void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedb
                 //theLastAttitudeVector = samplesAttitude.at(numberOFsamples - 1);
                 theLastSampleTime = sampleTimesTrajectory.at(numberOFsamples - 1);
 
-				//******************************************************************** /OZGUN
-				// Eclipse function is called and the "data/EclipseStarLight.stad" is generated
-				EclipseDuration* Eclipse = new EclipseDuration();
-
-                Eclipse->StarLightTimeFunction(sampleTimesTrajectory,
-                                               samplesTrajectory,
-											   STA_SOLAR_SYSTEM->lookup("Earth"),
-											   STA_SOLAR_SYSTEM->lookup("Sun"));
-
-				//******************************************************************** OZGUN/
-
 				if (feedback.status() != PropagationFeedback::PropagationOk)
 				{
 					return;
@@ -205,7 +225,29 @@ void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedb
 			else if (dynamic_cast<ScenarioLoiteringTLEType*>(trajectory.data()))    //// TLEs
 			{
 				ScenarioLoiteringTLEType* loiteringTLE = dynamic_cast<ScenarioLoiteringTLEType*>(trajectory.data());
-                PropagateLoiteringTLETrajectory(loiteringTLE, sampleTimesTrajectory, samplesTrajectory, feedback);
+                QByteArray arcKey;
+                PropagationCache::ArcSamples cachedArc;
+                if (cache)
+                {
+                    arcKey = PropagationCache::arcKey(loiteringTLE, 0.0, sta::StateVector::zero());
+                }
+
+                if (cache && cache->find(arcKey, &cachedArc))
+                {
+                    sampleTimesTrajectory = cachedArc.sampleTimes;
+                    samplesTrajectory = cachedArc.samples;
+                }
+                else
+                {
+                    PropagateLoiteringTLETrajectory(loiteringTLE, sampleTimesTrajectory, samplesTrajectory, feedback);
+
+                    if (cache && feedback.status() == PropagationFeedback::PropagationOk)
+                    {
+                        cachedArc.sampleTimes = sampleTimesTrajectory;
+                        cachedArc.samples = samplesTrajectory;
+                        cache->insert(arcKey, cachedArc);
+                    }
+                }
 
 				if (feedback.status() != PropagationFeedback::PropagationOk)
 				{
@@ -443,17 +485,6 @@ void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedb
                 theLastSampleTime = sampleTimesTrajectory.at(numberOFsamples - 1);
 
 
-                //******************************************************************** /OZGUN
-                // Eclipse function is called and the "data/EclipseStarLight.stad" is generated
-                EclipseDuration* Eclipse = new EclipseDuration();
-
-                Eclipse->StarLightTimeFunction(sampleTimesTrajectory,
-                                               samplesTrajectory,
-                                               STA_SOLAR_SYSTEM->lookup("Earth"),
-                                               STA_SOLAR_SYSTEM->lookup("Sun"));
-
-                //******************************************************************** OZGUN/
-
                 if (feedback.status() != PropagationFeedback::PropagationOk)
                 {
                     return;
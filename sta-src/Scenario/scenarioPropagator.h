@@ -34,8 +34,10 @@
 #include <QWidget>
 #include <QColor>
 
+class PropagationCache;
 
-void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedback, PropagatedScenario* propScenario, QWidget* parent);
+
+void scenarioPropagatorSatellite(ScenarioSC* vehicle, PropagationFeedback& feedback, PropagatedScenario* propScenario, QWidget* parent, PropagationCache* cache = NULL);
 void scenarioPropagatorReEntryVehicle(ScenarioREV* vehicle, PropagationFeedback& feedback, PropagatedScenario* propScenario, QWidget* parent);
 void scenarioPropagatorGroundElement(ScenarioGroundStation* groundElement, PropagationFeedback& feedback, PropagatedScenario* propScenario, QWidget* parent);
 void scenarioPropagatorPoint(ScenarioPoint* aPoint,  PropagationFeedback& feedback, PropagatedScenario* propScenario);
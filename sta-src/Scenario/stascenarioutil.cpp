@@ -188,6 +188,17 @@ QString convertToString(const QList<QDateTime>& l)
     return s;
 }
 
+// Skip the child elements that weren't consumed by a stream loader, leaving
+// the reader at the end of the current element.
+void skipUnknownElements(QXmlStreamReader& reader)
+{
+    while (reader.isStartElement())
+    {
+        reader.skipCurrentElement();
+        reader.readNextStartElement();
+    }
+}
+
 void AddScenarioNamespaceAttributes(QDomElement& scenarioElement)
 {
     // TODO: Update these with the actual location of the space scenario schema once that
@@ -196,3 +207,10 @@ void AddScenarioNamespaceAttributes(QDomElement& scenarioElement)
     scenarioElement.setAttribute("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
     scenarioElement.setAttribute("xsi:schemaLocation", "http://www.example.org/scenario scenario.xsd");
 }
+
+void WriteScenarioNamespaceAttributes(QXmlStreamWriter& writer)
+{
+    writer.writeAttribute("xmlns:tns", "http://www.example.org/scenario");
+    writer.writeAttribute("xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance");
+    writer.writeAttribute("xsi:schemaLocation", "http://www.example.org/scenario scenario.xsd");
+}
@@ -30,6 +30,8 @@
 #include <QDateTime>
 #include <QList>
 #include <QDomElement>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 extern bool parseBoolean(const QString& e);
 extern double parseDouble(const QString& e);
@@ -61,7 +63,24 @@ QDomElement createSimpleElement(QDomDocument& doc, const QString& tagName, T val
     return child;
 }
 
+// Write an element containing the string representation of the value.
+template<typename T>
+void writeSimpleElement(QXmlStreamWriter& writer, const QString& tagName, T value)
+{
+    writer.writeTextElement(tagName, convertToString(value));
+}
+
+// Return true if the reader is at the start of an element with the specified
+// qualified name (e.g. tns:Name)
+inline bool atStartElement(QXmlStreamReader& reader, const char* qualifiedName)
+{
+    return reader.isStartElement() && reader.qualifiedName() == QLatin1String(qualifiedName);
+}
+
+extern void skipUnknownElements(QXmlStreamReader& reader);
+
 /** Add require namespace attributes for the root SpaceScenario element */
 void AddScenarioNamespaceAttributes(QDomElement& scenarioElement);
+void WriteScenarioNamespaceAttributes(QXmlStreamWriter& writer);
 
 #endif // _STA_SCENARIO_UTIL_H_
@@ -47,6 +47,62 @@ QDomElement ScenarioElementIdentifierType::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioElementIdentifierType* ScenarioElementIdentifierType::create(QXmlStreamReader& reader)
+{
+    ScenarioElementIdentifierType* v = new ScenarioElementIdentifierType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioElementIdentifierType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Name"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Name"));
+        return false;
+    }
+    m_Name = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:theOrder"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:theOrder"));
+        return false;
+    }
+    m_theOrder = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:modelName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:modelName"));
+        return false;
+    }
+    m_modelName = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:colorName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:colorName"));
+        return false;
+    }
+    m_colorName = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioElementIdentifierType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Name", m_Name);
+    writeSimpleElement(writer, "tns:theOrder", m_theOrder);
+    writeSimpleElement(writer, "tns:modelName", m_modelName);
+    writeSimpleElement(writer, "tns:colorName", m_colorName);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioElementIdentifierType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -95,6 +151,54 @@ QDomElement ScenarioPropagationPositionType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioPropagationPositionType* ScenarioPropagationPositionType::create(QXmlStreamReader& reader)
+{
+    ScenarioPropagationPositionType* v = new ScenarioPropagationPositionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPropagationPositionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:propagator"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propagator"));
+        return false;
+    }
+    m_propagator = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:integrator"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:integrator"));
+        return false;
+    }
+    m_integrator = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:timeStep"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:timeStep"));
+        return false;
+    }
+    m_timeStep = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPropagationPositionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:propagator", m_propagator);
+    writeSimpleElement(writer, "tns:integrator", m_integrator);
+    writeSimpleElement(writer, "tns:timeStep", m_timeStep);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPropagationPositionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -143,6 +247,54 @@ QDomElement ScenarioPropagationAttitudeType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioPropagationAttitudeType* ScenarioPropagationAttitudeType::create(QXmlStreamReader& reader)
+{
+    ScenarioPropagationAttitudeType* v = new ScenarioPropagationAttitudeType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPropagationAttitudeType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:propagator"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propagator"));
+        return false;
+    }
+    m_propagator = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:integrator"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:integrator"));
+        return false;
+    }
+    m_integrator = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:timeStep"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:timeStep"));
+        return false;
+    }
+    m_timeStep = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPropagationAttitudeType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:propagator", m_propagator);
+    writeSimpleElement(writer, "tns:integrator", m_integrator);
+    writeSimpleElement(writer, "tns:timeStep", m_timeStep);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPropagationAttitudeType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -191,6 +343,44 @@ QDomElement ScenarioAbstractTrajectoryType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioAbstractTrajectoryType* ScenarioAbstractTrajectoryType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstractTrajectoryType* v = new ScenarioAbstractTrajectoryType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstractTrajectoryType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioAbstractTrajectoryType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstractTrajectoryType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -240,6 +430,44 @@ QDomElement ScenarioAbstractPayloadType::toDomElement(QDomDocument& doc, const Q
     return e;
 }
 
+ScenarioAbstractPayloadType* ScenarioAbstractPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstractPayloadType* v = new ScenarioAbstractPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstractPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Budget"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Budget"));
+        return false;
+    }
+    m_Budget = QSharedPointer<ScenarioBudgetType>(ScenarioBudgetType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioAbstractPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Budget.isNull())
+    {
+        QString tagName = "Budget";
+        m_Budget->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstractPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -309,6 +537,61 @@ QDomElement ScenarioPayloadSet::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioPayloadSet* ScenarioPayloadSet::create(QXmlStreamReader& reader)
+{
+    ScenarioPayloadSet* v = new ScenarioPayloadSet;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPayloadSet::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    for (;;)
+    {
+        QSharedPointer<ScenarioAbstractPayloadType> v;
+        if (atStartElement(reader, "tns:TransmitterPayload"))
+            v = QSharedPointer<ScenarioAbstractPayloadType>((ScenarioAbstractPayloadType*)ScenarioTransmitterPayloadType::create(reader));
+        else if (atStartElement(reader, "tns:ReceiverPayload"))
+            v = QSharedPointer<ScenarioAbstractPayloadType>((ScenarioAbstractPayloadType*)ScenarioReceiverPayloadType::create(reader));
+        else if (atStartElement(reader, "tns:OpticalPayload"))
+            v = QSharedPointer<ScenarioAbstractPayloadType>((ScenarioAbstractPayloadType*)ScenarioOpticalPayloadType::create(reader));
+        else if (atStartElement(reader, "tns:RadarPayload"))
+            v = QSharedPointer<ScenarioAbstractPayloadType>((ScenarioAbstractPayloadType*)ScenarioRadarPayloadType::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_AbstractPayload << v;
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioPayloadSet::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    foreach (QSharedPointer<ScenarioAbstractPayloadType> p, m_AbstractPayload)
+    {
+        QString tagName = "AbstractPayload";
+        if (dynamic_cast<ScenarioTransmitterPayloadType*>(p.data()))
+            tagName = "TransmitterPayload";
+        else if (dynamic_cast<ScenarioReceiverPayloadType*>(p.data()))
+            tagName = "ReceiverPayload";
+        else if (dynamic_cast<ScenarioOpticalPayloadType*>(p.data()))
+            tagName = "OpticalPayload";
+        else if (dynamic_cast<ScenarioRadarPayloadType*>(p.data()))
+            tagName = "RadarPayload";
+        p->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPayloadSet::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -370,6 +653,63 @@ QDomElement ScenarioInitialPositionType::toDomElement(QDomDocument& doc, const Q
     return e;
 }
 
+ScenarioInitialPositionType* ScenarioInitialPositionType::create(QXmlStreamReader& reader)
+{
+    ScenarioInitialPositionType* v = new ScenarioInitialPositionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioInitialPositionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:CoordinateSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoordinateSystem"));
+        return false;
+    }
+    m_CoordinateSystem = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:StateVector"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioStateVectorType::create(reader));
+    else if (atStartElement(reader, "tns:KeplerianElements"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioKeplerianElementsType::create(reader));
+    else if (atStartElement(reader, "tns:SphericalCoordinates"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioSphericalCoordinatesType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract6DOFPosition"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioInitialPositionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:CoordinateSystem", m_CoordinateSystem);
+    if (!m_Abstract6DOFPosition.isNull())
+    {
+        QString tagName = "Abstract6DOFPosition";
+        if (dynamic_cast<ScenarioStateVectorType*>(m_Abstract6DOFPosition.data()))
+            tagName = "StateVector";
+        else if (dynamic_cast<ScenarioKeplerianElementsType*>(m_Abstract6DOFPosition.data()))
+            tagName = "KeplerianElements";
+        else if (dynamic_cast<ScenarioSphericalCoordinatesType*>(m_Abstract6DOFPosition.data()))
+            tagName = "SphericalCoordinates";
+        m_Abstract6DOFPosition->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioInitialPositionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -431,6 +771,63 @@ QDomElement ScenarioInitialAttitudeType::toDomElement(QDomDocument& doc, const Q
     return e;
 }
 
+ScenarioInitialAttitudeType* ScenarioInitialAttitudeType::create(QXmlStreamReader& reader)
+{
+    ScenarioInitialAttitudeType* v = new ScenarioInitialAttitudeType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioInitialAttitudeType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:CoordinateSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoordinateSystem"));
+        return false;
+    }
+    m_CoordinateSystem = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:Euler123"))
+        m_Abstract6DOFAttitude = QSharedPointer<ScenarioAbstract6DOFAttitudeType>((ScenarioAbstract6DOFAttitudeType*)ScenarioEulerType::create(reader));
+    else if (atStartElement(reader, "tns:Euler321"))
+        m_Abstract6DOFAttitude = QSharedPointer<ScenarioAbstract6DOFAttitudeType>((ScenarioAbstract6DOFAttitudeType*)ScenarioEulerType::create(reader));
+    else if (atStartElement(reader, "tns:Euler313"))
+        m_Abstract6DOFAttitude = QSharedPointer<ScenarioAbstract6DOFAttitudeType>((ScenarioAbstract6DOFAttitudeType*)ScenarioEulerType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract6DOFAttitude"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioInitialAttitudeType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:CoordinateSystem", m_CoordinateSystem);
+    if (!m_Abstract6DOFAttitude.isNull())
+    {
+        QString tagName = "Abstract6DOFAttitude";
+        if (dynamic_cast<ScenarioEulerType*>(m_Abstract6DOFAttitude.data()))
+            tagName = "Euler123";
+        else if (dynamic_cast<ScenarioEulerType*>(m_Abstract6DOFAttitude.data()))
+            tagName = "Euler321";
+        else if (dynamic_cast<ScenarioEulerType*>(m_Abstract6DOFAttitude.data()))
+            tagName = "Euler313";
+        m_Abstract6DOFAttitude->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioInitialAttitudeType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -488,6 +885,59 @@ QDomElement ScenarioInitialAttitudeUsingQuaternionsType::toDomElement(QDomDocume
     return e;
 }
 
+ScenarioInitialAttitudeUsingQuaternionsType* ScenarioInitialAttitudeUsingQuaternionsType::create(QXmlStreamReader& reader)
+{
+    ScenarioInitialAttitudeUsingQuaternionsType* v = new ScenarioInitialAttitudeUsingQuaternionsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioInitialAttitudeUsingQuaternionsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:CoordinateSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoordinateSystem"));
+        return false;
+    }
+    m_CoordinateSystem = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:QuaternionJPL"))
+        m_Abstract8DOFAttitude = QSharedPointer<ScenarioAbstract8DOFAttitudeType>((ScenarioAbstract8DOFAttitudeType*)ScenarioQuaternionType::create(reader));
+    else if (atStartElement(reader, "tns:QuaternionESA"))
+        m_Abstract8DOFAttitude = QSharedPointer<ScenarioAbstract8DOFAttitudeType>((ScenarioAbstract8DOFAttitudeType*)ScenarioQuaternionType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract8DOFAttitude"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioInitialAttitudeUsingQuaternionsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:CoordinateSystem", m_CoordinateSystem);
+    if (!m_Abstract8DOFAttitude.isNull())
+    {
+        QString tagName = "Abstract8DOFAttitude";
+        if (dynamic_cast<ScenarioQuaternionType*>(m_Abstract8DOFAttitude.data()))
+            tagName = "QuaternionJPL";
+        else if (dynamic_cast<ScenarioQuaternionType*>(m_Abstract8DOFAttitude.data()))
+            tagName = "QuaternionESA";
+        m_Abstract8DOFAttitude->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioInitialAttitudeUsingQuaternionsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -530,6 +980,38 @@ QDomElement ScenarioParticipantType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioParticipantType* ScenarioParticipantType::create(QXmlStreamReader& reader)
+{
+    ScenarioParticipantType* v = new ScenarioParticipantType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioParticipantType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Name"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Name"));
+        return false;
+    }
+    m_Name = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioParticipantType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Name", m_Name);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioParticipantType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -583,6 +1065,52 @@ QDomElement ScenarioTimeLine::toDomElement(QDomDocument& doc, const QString& ele
     return e;
 }
 
+ScenarioTimeLine* ScenarioTimeLine::create(QXmlStreamReader& reader)
+{
+    ScenarioTimeLine* v = new ScenarioTimeLine;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTimeLine::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:StartTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:StartTime"));
+        return false;
+    }
+    m_StartTime = parseDateTime(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:StepTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:StepTime"));
+        return false;
+    }
+    m_StepTime = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:EndTime"))
+    {
+        m_EndTime = parseDateTime(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioTimeLine::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:StartTime", m_StartTime);
+    writeSimpleElement(writer, "tns:StepTime", m_StepTime);
+    writeSimpleElement(writer, "tns:EndTime", m_EndTime);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTimeLine::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -624,6 +1152,38 @@ QDomElement ScenarioPropagation::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioPropagation* ScenarioPropagation::create(QXmlStreamReader& reader)
+{
+    ScenarioPropagation* v = new ScenarioPropagation;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPropagation::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:propagator"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propagator"));
+        return false;
+    }
+    m_propagator = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPropagation::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:propagator", m_propagator);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPropagation::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -682,6 +1242,55 @@ QDomElement ScenarioEnvironmentType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioEnvironmentType* ScenarioEnvironmentType::create(QXmlStreamReader& reader)
+{
+    ScenarioEnvironmentType* v = new ScenarioEnvironmentType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioEnvironmentType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:CentralBody"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CentralBody"));
+        return false;
+    }
+    m_CentralBody = QSharedPointer<ScenarioCentralBodyType>(ScenarioCentralBodyType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:PerturbationsToCentralBody"))
+        m_PerturbationsToCentralBody = QSharedPointer<ScenarioPerturbationsForceType>(ScenarioPerturbationsForceType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_PerturbationsToCentralBody.isNull())
+        reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioEnvironmentType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_CentralBody.isNull())
+    {
+        QString tagName = "CentralBody";
+        m_CentralBody->writeElement(writer, tagName);
+    }
+    if (!m_PerturbationsToCentralBody.isNull())
+    {
+        QString tagName = "PerturbationsToCentralBody";
+        m_PerturbationsToCentralBody->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioEnvironmentType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -753,16 +1362,80 @@ QDomElement ScenarioCentralBodyType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioCentralBodyType::children() const
+ScenarioCentralBodyType* ScenarioCentralBodyType::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    if (!m_GravityModel.isNull()) children << m_GravityModel;
-    return children;
+    ScenarioCentralBodyType* v = new ScenarioCentralBodyType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
 }
 
+bool ScenarioCentralBodyType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Name"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Name"));
+        return false;
+    }
+    m_Name = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:GravityModel"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:GravityModel"));
+        return false;
+    }
+    m_GravityModel = QSharedPointer<ScenarioGravityModel>(ScenarioGravityModel::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:AtmosphereModel"))
+    {
+        m_AtmosphereModel = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:MagneticModel"))
+    {
+        m_MagneticModel = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:Ellipticity"))
+    {
+        m_Ellipticity = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioCentralBodyType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Name", m_Name);
+    if (!m_GravityModel.isNull())
+    {
+        QString tagName = "GravityModel";
+        m_GravityModel->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:AtmosphereModel", m_AtmosphereModel);
+    writeSimpleElement(writer, "tns:MagneticModel", m_MagneticModel);
+    writeSimpleElement(writer, "tns:Ellipticity", m_Ellipticity);
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioCentralBodyType::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    if (!m_GravityModel.isNull()) children << m_GravityModel;
+    return children;
+}
+
+
+
 
-
-
 // ScenarioGravityModel
 ScenarioGravityModel::ScenarioGravityModel() :
     m_numberOfZonals(0),
@@ -803,6 +1476,54 @@ QDomElement ScenarioGravityModel::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioGravityModel* ScenarioGravityModel::create(QXmlStreamReader& reader)
+{
+    ScenarioGravityModel* v = new ScenarioGravityModel;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioGravityModel::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:modelName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:modelName"));
+        return false;
+    }
+    m_modelName = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:numberOfZonals"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:numberOfZonals"));
+        return false;
+    }
+    m_numberOfZonals = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:numberOfTesserals"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:numberOfTesserals"));
+        return false;
+    }
+    m_numberOfTesserals = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioGravityModel::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:modelName", m_modelName);
+    writeSimpleElement(writer, "tns:numberOfZonals", m_numberOfZonals);
+    writeSimpleElement(writer, "tns:numberOfTesserals", m_numberOfTesserals);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioGravityModel::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -908,6 +1629,98 @@ QDomElement ScenarioPerturbationsForceType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioPerturbationsForceType* ScenarioPerturbationsForceType::create(QXmlStreamReader& reader)
+{
+    ScenarioPerturbationsForceType* v = new ScenarioPerturbationsForceType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPerturbationsForceType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:gravityEffets"))
+    {
+        m_gravityEffets = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:atmosphereDrag"))
+    {
+        m_atmosphereDrag = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:solarPressure"))
+    {
+        m_solarPressure = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:albedo"))
+    {
+        m_albedo = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:IR"))
+    {
+        m_IR = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:Cr"))
+    {
+        m_Cr = parseInt(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:thirdBody"))
+    {
+        m_thirdBody = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:perturbingBody"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:perturbingBody"));
+        return false;
+    }
+    m_perturbingBody = parseStringList(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:dailyF10_7"))
+    {
+        m_dailyF10_7 = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:averageF10_7"))
+    {
+        m_averageF10_7 = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:geomagneticIndex"))
+    {
+        m_geomagneticIndex = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioPerturbationsForceType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:gravityEffets", m_gravityEffets);
+    writeSimpleElement(writer, "tns:atmosphereDrag", m_atmosphereDrag);
+    writeSimpleElement(writer, "tns:solarPressure", m_solarPressure);
+    writeSimpleElement(writer, "tns:albedo", m_albedo);
+    writeSimpleElement(writer, "tns:IR", m_IR);
+    writeSimpleElement(writer, "tns:Cr", m_Cr);
+    writeSimpleElement(writer, "tns:thirdBody", m_thirdBody);
+    writeSimpleElement(writer, "tns:perturbingBody", m_perturbingBody);
+    writeSimpleElement(writer, "tns:dailyF10_7", m_dailyF10_7);
+    writeSimpleElement(writer, "tns:averageF10_7", m_averageF10_7);
+    writeSimpleElement(writer, "tns:geomagneticIndex", m_geomagneticIndex);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPerturbationsForceType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -958,6 +1771,42 @@ QDomElement ScenarioPerturbationsTorqueType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioPerturbationsTorqueType* ScenarioPerturbationsTorqueType::create(QXmlStreamReader& reader)
+{
+    ScenarioPerturbationsTorqueType* v = new ScenarioPerturbationsTorqueType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPerturbationsTorqueType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:micrometeoroids"))
+    {
+        m_micrometeoroids = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:microvibrations"))
+    {
+        m_microvibrations = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioPerturbationsTorqueType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:micrometeoroids", m_micrometeoroids);
+    writeSimpleElement(writer, "tns:microvibrations", m_microvibrations);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPerturbationsTorqueType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1026,6 +1875,59 @@ QDomElement ScenarioTrajectoryStoppingConditionType::toDomElement(QDomDocument&
     return e;
 }
 
+ScenarioTrajectoryStoppingConditionType* ScenarioTrajectoryStoppingConditionType::create(QXmlStreamReader& reader)
+{
+    ScenarioTrajectoryStoppingConditionType* v = new ScenarioTrajectoryStoppingConditionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTrajectoryStoppingConditionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:ConditionIdentifier"))
+    {
+        m_ConditionIdentifier = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:ConditionValue"))
+    {
+        m_ConditionValue = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:ConditionBody"))
+        m_ConditionBody = QSharedPointer<ScenarioCentralBodyType>(ScenarioCentralBodyType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_ConditionBody.isNull())
+        reader.readNextStartElement();
+    if (atStartElement(reader, "tns:ConditionTolerance"))
+    {
+        m_ConditionTolerance = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioTrajectoryStoppingConditionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:ConditionIdentifier", m_ConditionIdentifier);
+    writeSimpleElement(writer, "tns:ConditionValue", m_ConditionValue);
+    if (!m_ConditionBody.isNull())
+    {
+        QString tagName = "ConditionBody";
+        m_ConditionBody->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:ConditionTolerance", m_ConditionTolerance);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTrajectoryStoppingConditionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1065,6 +1967,30 @@ QDomElement ScenarioAbstract3DOFPositionType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioAbstract3DOFPositionType* ScenarioAbstract3DOFPositionType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstract3DOFPositionType* v = new ScenarioAbstract3DOFPositionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstract3DOFPositionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioAbstract3DOFPositionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstract3DOFPositionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1103,6 +2029,30 @@ QDomElement ScenarioAbstract6DOFPositionType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioAbstract6DOFPositionType* ScenarioAbstract6DOFPositionType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstract6DOFPositionType* v = new ScenarioAbstract6DOFPositionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstract6DOFPositionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioAbstract6DOFPositionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstract6DOFPositionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1153,6 +2103,54 @@ QDomElement ScenarioGroundPositionType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioGroundPositionType* ScenarioGroundPositionType::create(QXmlStreamReader& reader)
+{
+    ScenarioGroundPositionType* v = new ScenarioGroundPositionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioGroundPositionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract3DOFPositionType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:latitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:latitude"));
+        return false;
+    }
+    m_latitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:longitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:longitude"));
+        return false;
+    }
+    m_longitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:altitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:altitude"));
+        return false;
+    }
+    m_altitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioGroundPositionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract3DOFPositionType::writeContents(writer);
+    writeSimpleElement(writer, "tns:latitude", m_latitude);
+    writeSimpleElement(writer, "tns:longitude", m_longitude);
+    writeSimpleElement(writer, "tns:altitude", m_altitude);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioGroundPositionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1215,6 +2213,78 @@ QDomElement ScenarioStateVectorType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioStateVectorType* ScenarioStateVectorType::create(QXmlStreamReader& reader)
+{
+    ScenarioStateVectorType* v = new ScenarioStateVectorType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioStateVectorType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract6DOFPositionType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:x"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:x"));
+        return false;
+    }
+    m_x = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:y"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:y"));
+        return false;
+    }
+    m_y = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:z"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:z"));
+        return false;
+    }
+    m_z = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:vx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:vx"));
+        return false;
+    }
+    m_vx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:vy"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:vy"));
+        return false;
+    }
+    m_vy = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:vz"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:vz"));
+        return false;
+    }
+    m_vz = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioStateVectorType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract6DOFPositionType::writeContents(writer);
+    writeSimpleElement(writer, "tns:x", m_x);
+    writeSimpleElement(writer, "tns:y", m_y);
+    writeSimpleElement(writer, "tns:z", m_z);
+    writeSimpleElement(writer, "tns:vx", m_vx);
+    writeSimpleElement(writer, "tns:vy", m_vy);
+    writeSimpleElement(writer, "tns:vz", m_vz);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioStateVectorType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1277,6 +2347,78 @@ QDomElement ScenarioKeplerianElementsType::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioKeplerianElementsType* ScenarioKeplerianElementsType::create(QXmlStreamReader& reader)
+{
+    ScenarioKeplerianElementsType* v = new ScenarioKeplerianElementsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioKeplerianElementsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract6DOFPositionType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:semiMajorAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:semiMajorAxis"));
+        return false;
+    }
+    m_semiMajorAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:eccentricity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:eccentricity"));
+        return false;
+    }
+    m_eccentricity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:inclination"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:inclination"));
+        return false;
+    }
+    m_inclination = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RAAN"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RAAN"));
+        return false;
+    }
+    m_RAAN = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:argumentOfPeriapsis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:argumentOfPeriapsis"));
+        return false;
+    }
+    m_argumentOfPeriapsis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:trueAnomaly"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:trueAnomaly"));
+        return false;
+    }
+    m_trueAnomaly = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioKeplerianElementsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract6DOFPositionType::writeContents(writer);
+    writeSimpleElement(writer, "tns:semiMajorAxis", m_semiMajorAxis);
+    writeSimpleElement(writer, "tns:eccentricity", m_eccentricity);
+    writeSimpleElement(writer, "tns:inclination", m_inclination);
+    writeSimpleElement(writer, "tns:RAAN", m_RAAN);
+    writeSimpleElement(writer, "tns:argumentOfPeriapsis", m_argumentOfPeriapsis);
+    writeSimpleElement(writer, "tns:trueAnomaly", m_trueAnomaly);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioKeplerianElementsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1339,6 +2481,78 @@ QDomElement ScenarioSphericalCoordinatesType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioSphericalCoordinatesType* ScenarioSphericalCoordinatesType::create(QXmlStreamReader& reader)
+{
+    ScenarioSphericalCoordinatesType* v = new ScenarioSphericalCoordinatesType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSphericalCoordinatesType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract6DOFPositionType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:radialDistance"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:radialDistance"));
+        return false;
+    }
+    m_radialDistance = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:longitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:longitude"));
+        return false;
+    }
+    m_longitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:latitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:latitude"));
+        return false;
+    }
+    m_latitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:flightPathVelocity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:flightPathVelocity"));
+        return false;
+    }
+    m_flightPathVelocity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:flightPathAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:flightPathAngle"));
+        return false;
+    }
+    m_flightPathAngle = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:headingAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:headingAngle"));
+        return false;
+    }
+    m_headingAngle = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSphericalCoordinatesType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract6DOFPositionType::writeContents(writer);
+    writeSimpleElement(writer, "tns:radialDistance", m_radialDistance);
+    writeSimpleElement(writer, "tns:longitude", m_longitude);
+    writeSimpleElement(writer, "tns:latitude", m_latitude);
+    writeSimpleElement(writer, "tns:flightPathVelocity", m_flightPathVelocity);
+    writeSimpleElement(writer, "tns:flightPathAngle", m_flightPathAngle);
+    writeSimpleElement(writer, "tns:headingAngle", m_headingAngle);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSphericalCoordinatesType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1377,6 +2591,30 @@ QDomElement ScenarioAbstract6DOFAttitudeType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioAbstract6DOFAttitudeType* ScenarioAbstract6DOFAttitudeType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstract6DOFAttitudeType* v = new ScenarioAbstract6DOFAttitudeType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstract6DOFAttitudeType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioAbstract6DOFAttitudeType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstract6DOFAttitudeType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1415,6 +2653,30 @@ QDomElement ScenarioAbstract8DOFAttitudeType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioAbstract8DOFAttitudeType* ScenarioAbstract8DOFAttitudeType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstract8DOFAttitudeType* v = new ScenarioAbstract8DOFAttitudeType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstract8DOFAttitudeType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioAbstract8DOFAttitudeType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstract8DOFAttitudeType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1477,17 +2739,89 @@ QDomElement ScenarioEulerType::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioEulerType::children() const
+ScenarioEulerType* ScenarioEulerType::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    return children;
+    ScenarioEulerType* v = new ScenarioEulerType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
 }
 
-
-
-
-// ScenarioQuaternionType
-ScenarioQuaternionType::ScenarioQuaternionType() :
+bool ScenarioEulerType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract6DOFAttitudeType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:phi"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:phi"));
+        return false;
+    }
+    m_phi = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:theta"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:theta"));
+        return false;
+    }
+    m_theta = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:psi"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:psi"));
+        return false;
+    }
+    m_psi = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:phiDot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:phiDot"));
+        return false;
+    }
+    m_phiDot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:thetaDot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thetaDot"));
+        return false;
+    }
+    m_thetaDot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:psiDot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:psiDot"));
+        return false;
+    }
+    m_psiDot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioEulerType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract6DOFAttitudeType::writeContents(writer);
+    writeSimpleElement(writer, "tns:phi", m_phi);
+    writeSimpleElement(writer, "tns:theta", m_theta);
+    writeSimpleElement(writer, "tns:psi", m_psi);
+    writeSimpleElement(writer, "tns:phiDot", m_phiDot);
+    writeSimpleElement(writer, "tns:thetaDot", m_thetaDot);
+    writeSimpleElement(writer, "tns:psiDot", m_psiDot);
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioEulerType::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    return children;
+}
+
+
+
+
+// ScenarioQuaternionType
+ScenarioQuaternionType::ScenarioQuaternionType() :
     m_q1(0.0),
     m_q2(0.0),
     m_q3(0.0),
@@ -1547,6 +2881,94 @@ QDomElement ScenarioQuaternionType::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioQuaternionType* ScenarioQuaternionType::create(QXmlStreamReader& reader)
+{
+    ScenarioQuaternionType* v = new ScenarioQuaternionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioQuaternionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract8DOFAttitudeType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:q1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q1"));
+        return false;
+    }
+    m_q1 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q2"));
+        return false;
+    }
+    m_q2 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q3"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q3"));
+        return false;
+    }
+    m_q3 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q4"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q4"));
+        return false;
+    }
+    m_q4 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q1Dot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q1Dot"));
+        return false;
+    }
+    m_q1Dot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q2Dot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q2Dot"));
+        return false;
+    }
+    m_q2Dot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q3Dot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q3Dot"));
+        return false;
+    }
+    m_q3Dot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:q4Dot"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:q4Dot"));
+        return false;
+    }
+    m_q4Dot = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioQuaternionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract8DOFAttitudeType::writeContents(writer);
+    writeSimpleElement(writer, "tns:q1", m_q1);
+    writeSimpleElement(writer, "tns:q2", m_q2);
+    writeSimpleElement(writer, "tns:q3", m_q3);
+    writeSimpleElement(writer, "tns:q4", m_q4);
+    writeSimpleElement(writer, "tns:q1Dot", m_q1Dot);
+    writeSimpleElement(writer, "tns:q2Dot", m_q2Dot);
+    writeSimpleElement(writer, "tns:q3Dot", m_q3Dot);
+    writeSimpleElement(writer, "tns:q4Dot", m_q4Dot);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioQuaternionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1585,6 +3007,30 @@ QDomElement ScenarioAbstract12DOFStateType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioAbstract12DOFStateType* ScenarioAbstract12DOFStateType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstract12DOFStateType* v = new ScenarioAbstract12DOFStateType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstract12DOFStateType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioAbstract12DOFStateType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstract12DOFStateType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1661,6 +3107,80 @@ QDomElement ScenarioState12DOF::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioState12DOF* ScenarioState12DOF::create(QXmlStreamReader& reader)
+{
+    ScenarioState12DOF* v = new ScenarioState12DOF;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioState12DOF::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract12DOFStateType::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:StateVector"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioStateVectorType::create(reader));
+    else if (atStartElement(reader, "tns:KeplerianElements"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioKeplerianElementsType::create(reader));
+    else if (atStartElement(reader, "tns:SphericalCoordinates"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioSphericalCoordinatesType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract6DOFPosition"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:Euler123"))
+        m_Abstract6DOFAttitude = QSharedPointer<ScenarioAbstract6DOFAttitudeType>((ScenarioAbstract6DOFAttitudeType*)ScenarioEulerType::create(reader));
+    else if (atStartElement(reader, "tns:Euler321"))
+        m_Abstract6DOFAttitude = QSharedPointer<ScenarioAbstract6DOFAttitudeType>((ScenarioAbstract6DOFAttitudeType*)ScenarioEulerType::create(reader));
+    else if (atStartElement(reader, "tns:Euler313"))
+        m_Abstract6DOFAttitude = QSharedPointer<ScenarioAbstract6DOFAttitudeType>((ScenarioAbstract6DOFAttitudeType*)ScenarioEulerType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract6DOFAttitude"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioState12DOF::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract12DOFStateType::writeContents(writer);
+    if (!m_Abstract6DOFPosition.isNull())
+    {
+        QString tagName = "Abstract6DOFPosition";
+        if (dynamic_cast<ScenarioStateVectorType*>(m_Abstract6DOFPosition.data()))
+            tagName = "StateVector";
+        else if (dynamic_cast<ScenarioKeplerianElementsType*>(m_Abstract6DOFPosition.data()))
+            tagName = "KeplerianElements";
+        else if (dynamic_cast<ScenarioSphericalCoordinatesType*>(m_Abstract6DOFPosition.data()))
+            tagName = "SphericalCoordinates";
+        m_Abstract6DOFPosition->writeElement(writer, tagName);
+    }
+    if (!m_Abstract6DOFAttitude.isNull())
+    {
+        QString tagName = "Abstract6DOFAttitude";
+        if (dynamic_cast<ScenarioEulerType*>(m_Abstract6DOFAttitude.data()))
+            tagName = "Euler123";
+        else if (dynamic_cast<ScenarioEulerType*>(m_Abstract6DOFAttitude.data()))
+            tagName = "Euler321";
+        else if (dynamic_cast<ScenarioEulerType*>(m_Abstract6DOFAttitude.data()))
+            tagName = "Euler313";
+        m_Abstract6DOFAttitude->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioState12DOF::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1701,6 +3221,30 @@ QDomElement ScenarioAbstract14DOFStateType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioAbstract14DOFStateType* ScenarioAbstract14DOFStateType::create(QXmlStreamReader& reader)
+{
+    ScenarioAbstract14DOFStateType* v = new ScenarioAbstract14DOFStateType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAbstract14DOFStateType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioAbstract14DOFStateType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAbstract14DOFStateType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1773,6 +3317,76 @@ QDomElement ScenarioState14DOF::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioState14DOF* ScenarioState14DOF::create(QXmlStreamReader& reader)
+{
+    ScenarioState14DOF* v = new ScenarioState14DOF;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioState14DOF::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstract14DOFStateType::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:StateVector"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioStateVectorType::create(reader));
+    else if (atStartElement(reader, "tns:KeplerianElements"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioKeplerianElementsType::create(reader));
+    else if (atStartElement(reader, "tns:SphericalCoordinates"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioSphericalCoordinatesType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract6DOFPosition"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:QuaternionJPL"))
+        m_Abstract8DOFAttitude = QSharedPointer<ScenarioAbstract8DOFAttitudeType>((ScenarioAbstract8DOFAttitudeType*)ScenarioQuaternionType::create(reader));
+    else if (atStartElement(reader, "tns:QuaternionESA"))
+        m_Abstract8DOFAttitude = QSharedPointer<ScenarioAbstract8DOFAttitudeType>((ScenarioAbstract8DOFAttitudeType*)ScenarioQuaternionType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract8DOFAttitude"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioState14DOF::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstract14DOFStateType::writeContents(writer);
+    if (!m_Abstract6DOFPosition.isNull())
+    {
+        QString tagName = "Abstract6DOFPosition";
+        if (dynamic_cast<ScenarioStateVectorType*>(m_Abstract6DOFPosition.data()))
+            tagName = "StateVector";
+        else if (dynamic_cast<ScenarioKeplerianElementsType*>(m_Abstract6DOFPosition.data()))
+            tagName = "KeplerianElements";
+        else if (dynamic_cast<ScenarioSphericalCoordinatesType*>(m_Abstract6DOFPosition.data()))
+            tagName = "SphericalCoordinates";
+        m_Abstract6DOFPosition->writeElement(writer, tagName);
+    }
+    if (!m_Abstract8DOFAttitude.isNull())
+    {
+        QString tagName = "Abstract8DOFAttitude";
+        if (dynamic_cast<ScenarioQuaternionType*>(m_Abstract8DOFAttitude.data()))
+            tagName = "QuaternionJPL";
+        else if (dynamic_cast<ScenarioQuaternionType*>(m_Abstract8DOFAttitude.data()))
+            tagName = "QuaternionESA";
+        m_Abstract8DOFAttitude->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioState14DOF::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1823,6 +3437,44 @@ QDomElement ScenarioTelescopeType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioTelescopeType* ScenarioTelescopeType::create(QXmlStreamReader& reader)
+{
+    ScenarioTelescopeType* v = new ScenarioTelescopeType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTelescopeType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:OpticalProperties"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OpticalProperties"));
+        return false;
+    }
+    m_OpticalProperties = QSharedPointer<ScenarioOpticalProperties>(ScenarioOpticalProperties::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTelescopeType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_OpticalProperties.isNull())
+    {
+        QString tagName = "OpticalProperties";
+        m_OpticalProperties->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTelescopeType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1870,6 +3522,46 @@ QDomElement ScenarioOpticalProperties::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
+ScenarioOpticalProperties* ScenarioOpticalProperties::create(QXmlStreamReader& reader)
+{
+    ScenarioOpticalProperties* v = new ScenarioOpticalProperties;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOpticalProperties::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Diameter"));
+        return false;
+    }
+    m_Diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Efficiency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Efficiency"));
+        return false;
+    }
+    m_Efficiency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOpticalProperties::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Diameter", m_Diameter);
+    writeSimpleElement(writer, "tns:Efficiency", m_Efficiency);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOpticalProperties::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1918,6 +3610,44 @@ QDomElement ScenarioRadarType::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioRadarType* ScenarioRadarType::create(QXmlStreamReader& reader)
+{
+    ScenarioRadarType* v = new ScenarioRadarType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioRadarType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:RadarProperties"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RadarProperties"));
+        return false;
+    }
+    m_RadarProperties = QSharedPointer<ScenarioRadarProperties>(ScenarioRadarProperties::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioRadarType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_RadarProperties.isNull())
+    {
+        QString tagName = "RadarProperties";
+        m_RadarProperties->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioRadarType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -1984,6 +3714,86 @@ QDomElement ScenarioRadarProperties::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioRadarProperties* ScenarioRadarProperties::create(QXmlStreamReader& reader)
+{
+    ScenarioRadarProperties* v = new ScenarioRadarProperties;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioRadarProperties::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:GainMax"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:GainMax"));
+        return false;
+    }
+    m_GainMax = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Polarisation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Polarisation"));
+        return false;
+    }
+    m_Polarisation = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TiltAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TiltAngle"));
+        return false;
+    }
+    m_TiltAngle = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AreaEff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AreaEff"));
+        return false;
+    }
+    m_AreaEff = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Diameter"));
+        return false;
+    }
+    m_Diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Efficiency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Efficiency"));
+        return false;
+    }
+    m_Efficiency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AngularBeamWidth"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AngularBeamWidth"));
+        return false;
+    }
+    m_AngularBeamWidth = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioRadarProperties::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:GainMax", m_GainMax);
+    writeSimpleElement(writer, "tns:Polarisation", m_Polarisation);
+    writeSimpleElement(writer, "tns:TiltAngle", m_TiltAngle);
+    writeSimpleElement(writer, "tns:AreaEff", m_AreaEff);
+    writeSimpleElement(writer, "tns:Diameter", m_Diameter);
+    writeSimpleElement(writer, "tns:Efficiency", m_Efficiency);
+    writeSimpleElement(writer, "tns:AngularBeamWidth", m_AngularBeamWidth);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioRadarProperties::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2033,6 +3843,54 @@ QDomElement ScenarioCoverageType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioCoverageType* ScenarioCoverageType::create(QXmlStreamReader& reader)
+{
+    ScenarioCoverageType* v = new ScenarioCoverageType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioCoverageType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:FrustumShape"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FrustumShape"));
+        return false;
+    }
+    m_FrustumShape = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:FrustumAngle1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FrustumAngle1"));
+        return false;
+    }
+    m_FrustumAngle1 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:FrustumAngle2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FrustumAngle2"));
+        return false;
+    }
+    m_FrustumAngle2 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioCoverageType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:FrustumShape", m_FrustumShape);
+    writeSimpleElement(writer, "tns:FrustumAngle1", m_FrustumAngle1);
+    writeSimpleElement(writer, "tns:FrustumAngle2", m_FrustumAngle2);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioCoverageType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2101,26 +3959,92 @@ QDomElement ScenarioAntennaType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioAntennaType::children() const
+ScenarioAntennaType* ScenarioAntennaType::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    if (!m_PointingDirection.isNull()) children << m_PointingDirection;
-    if (!m_EMproperties.isNull()) children << m_EMproperties;
-    if (!m_Coverage.isNull()) children << m_Coverage;
-    return children;
+    ScenarioAntennaType* v = new ScenarioAntennaType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
 }
 
-
-
-
-// ScenarioPointingDirection
-ScenarioPointingDirection::ScenarioPointingDirection() :
-    m_azimuth(0.0),
-    m_elevation(0.0),
-    m_azimuthDot(0.0),
-    m_elevationDot(0.0),
-    m_coneAngle(0.0),
-    m_coneShape(0)
+bool ScenarioAntennaType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:PointingDirection"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PointingDirection"));
+        return false;
+    }
+    m_PointingDirection = QSharedPointer<ScenarioPointingDirection>(ScenarioPointingDirection::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:EMproperties"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:EMproperties"));
+        return false;
+    }
+    m_EMproperties = QSharedPointer<ScenarioEMproperties>(ScenarioEMproperties::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Coverage"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Coverage"));
+        return false;
+    }
+    m_Coverage = QSharedPointer<ScenarioCoverageType>(ScenarioCoverageType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioAntennaType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_PointingDirection.isNull())
+    {
+        QString tagName = "PointingDirection";
+        m_PointingDirection->writeElement(writer, tagName);
+    }
+    if (!m_EMproperties.isNull())
+    {
+        QString tagName = "EMproperties";
+        m_EMproperties->writeElement(writer, tagName);
+    }
+    if (!m_Coverage.isNull())
+    {
+        QString tagName = "Coverage";
+        m_Coverage->writeElement(writer, tagName);
+    }
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioAntennaType::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    if (!m_PointingDirection.isNull()) children << m_PointingDirection;
+    if (!m_EMproperties.isNull()) children << m_EMproperties;
+    if (!m_Coverage.isNull()) children << m_Coverage;
+    return children;
+}
+
+
+
+
+// ScenarioPointingDirection
+ScenarioPointingDirection::ScenarioPointingDirection() :
+    m_azimuth(0.0),
+    m_elevation(0.0),
+    m_azimuthDot(0.0),
+    m_elevationDot(0.0),
+    m_coneAngle(0.0),
+    m_coneShape(0)
 {
 }
 
@@ -2184,6 +4108,76 @@ QDomElement ScenarioPointingDirection::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
+ScenarioPointingDirection* ScenarioPointingDirection::create(QXmlStreamReader& reader)
+{
+    ScenarioPointingDirection* v = new ScenarioPointingDirection;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPointingDirection::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:referenceSystem"))
+    {
+        m_referenceSystem = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:azimuth"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:azimuth"));
+        return false;
+    }
+    m_azimuth = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:elevation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:elevation"));
+        return false;
+    }
+    m_elevation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:azimuthDot"))
+    {
+        m_azimuthDot = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:elevationDot"))
+    {
+        m_elevationDot = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:coneAngle"))
+    {
+        m_coneAngle = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:coneShape"))
+    {
+        m_coneShape = parseInt(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioPointingDirection::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:referenceSystem", m_referenceSystem);
+    writeSimpleElement(writer, "tns:azimuth", m_azimuth);
+    writeSimpleElement(writer, "tns:elevation", m_elevation);
+    writeSimpleElement(writer, "tns:azimuthDot", m_azimuthDot);
+    writeSimpleElement(writer, "tns:elevationDot", m_elevationDot);
+    writeSimpleElement(writer, "tns:coneAngle", m_coneAngle);
+    writeSimpleElement(writer, "tns:coneShape", m_coneShape);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPointingDirection::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2256,6 +4250,102 @@ QDomElement ScenarioEMproperties::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioEMproperties* ScenarioEMproperties::create(QXmlStreamReader& reader)
+{
+    ScenarioEMproperties* v = new ScenarioEMproperties;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioEMproperties::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:GainMax"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:GainMax"));
+        return false;
+    }
+    m_GainMax = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Polarisation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Polarisation"));
+        return false;
+    }
+    m_Polarisation = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TiltAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TiltAngle"));
+        return false;
+    }
+    m_TiltAngle = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AreaEff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AreaEff"));
+        return false;
+    }
+    m_AreaEff = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Diameter"));
+        return false;
+    }
+    m_Diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Efficiency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Efficiency"));
+        return false;
+    }
+    m_Efficiency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AngularBeamWidth"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AngularBeamWidth"));
+        return false;
+    }
+    m_AngularBeamWidth = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:BandWidth"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:BandWidth"));
+        return false;
+    }
+    m_BandWidth = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:BeamType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:BeamType"));
+        return false;
+    }
+    m_BeamType = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioEMproperties::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:GainMax", m_GainMax);
+    writeSimpleElement(writer, "tns:Polarisation", m_Polarisation);
+    writeSimpleElement(writer, "tns:TiltAngle", m_TiltAngle);
+    writeSimpleElement(writer, "tns:AreaEff", m_AreaEff);
+    writeSimpleElement(writer, "tns:Diameter", m_Diameter);
+    writeSimpleElement(writer, "tns:Efficiency", m_Efficiency);
+    writeSimpleElement(writer, "tns:AngularBeamWidth", m_AngularBeamWidth);
+    writeSimpleElement(writer, "tns:BandWidth", m_BandWidth);
+    writeSimpleElement(writer, "tns:BeamType", m_BeamType);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioEMproperties::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2336,6 +4426,96 @@ QDomElement ScenarioBudgetType::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioBudgetType* ScenarioBudgetType::create(QXmlStreamReader& reader)
+{
+    ScenarioBudgetType* v = new ScenarioBudgetType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioBudgetType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Mass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Mass"));
+        return false;
+    }
+    m_Mass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Power"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Power"));
+        return false;
+    }
+    m_Power = QSharedPointer<ScenarioPower>(ScenarioPower::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Size"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Size"));
+        return false;
+    }
+    m_Size = QSharedPointer<ScenarioSize>(ScenarioSize::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TemperatureRange"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TemperatureRange"));
+        return false;
+    }
+    m_TemperatureRange = QSharedPointer<ScenarioTemperatureRange>(ScenarioTemperatureRange::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DataRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DataRate"));
+        return false;
+    }
+    m_DataRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:FrequencyBand"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FrequencyBand"));
+        return false;
+    }
+    m_FrequencyBand = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioBudgetType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Mass", m_Mass);
+    if (!m_Power.isNull())
+    {
+        QString tagName = "Power";
+        m_Power->writeElement(writer, tagName);
+    }
+    if (!m_Size.isNull())
+    {
+        QString tagName = "Size";
+        m_Size->writeElement(writer, tagName);
+    }
+    if (!m_TemperatureRange.isNull())
+    {
+        QString tagName = "TemperatureRange";
+        m_TemperatureRange->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:DataRate", m_DataRate);
+    writeSimpleElement(writer, "tns:FrequencyBand", m_FrequencyBand);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioBudgetType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2393,6 +4573,62 @@ QDomElement ScenarioPower::toDomElement(QDomDocument& doc, const QString& elemen
     return e;
 }
 
+ScenarioPower* ScenarioPower::create(QXmlStreamReader& reader)
+{
+    ScenarioPower* v = new ScenarioPower;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPower::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:powerConsumptionInEclipse"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:powerConsumptionInEclipse"));
+        return false;
+    }
+    m_powerConsumptionInEclipse = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:powerConsumptionInDaylight"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:powerConsumptionInDaylight"));
+        return false;
+    }
+    m_powerConsumptionInDaylight = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:powerOnPercentageInEclipse"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:powerOnPercentageInEclipse"));
+        return false;
+    }
+    m_powerOnPercentageInEclipse = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:powerOnPercentageInDaylight"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:powerOnPercentageInDaylight"));
+        return false;
+    }
+    m_powerOnPercentageInDaylight = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPower::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:powerConsumptionInEclipse", m_powerConsumptionInEclipse);
+    writeSimpleElement(writer, "tns:powerConsumptionInDaylight", m_powerConsumptionInDaylight);
+    writeSimpleElement(writer, "tns:powerOnPercentageInEclipse", m_powerOnPercentageInEclipse);
+    writeSimpleElement(writer, "tns:powerOnPercentageInDaylight", m_powerOnPercentageInDaylight);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPower::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2443,6 +4679,54 @@ QDomElement ScenarioSize::toDomElement(QDomDocument& doc, const QString& element
     return e;
 }
 
+ScenarioSize* ScenarioSize::create(QXmlStreamReader& reader)
+{
+    ScenarioSize* v = new ScenarioSize;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSize::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Width"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Width"));
+        return false;
+    }
+    m_Width = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Length"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Length"));
+        return false;
+    }
+    m_Length = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Height"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Height"));
+        return false;
+    }
+    m_Height = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSize::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Width", m_Width);
+    writeSimpleElement(writer, "tns:Length", m_Length);
+    writeSimpleElement(writer, "tns:Height", m_Height);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSize::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2489,6 +4773,46 @@ QDomElement ScenarioTemperatureRange::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioTemperatureRange* ScenarioTemperatureRange::create(QXmlStreamReader& reader)
+{
+    ScenarioTemperatureRange* v = new ScenarioTemperatureRange;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTemperatureRange::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:MinimumTemperature"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:MinimumTemperature"));
+        return false;
+    }
+    m_MinimumTemperature = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:MaximumTemperature"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:MaximumTemperature"));
+        return false;
+    }
+    m_MaximumTemperature = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTemperatureRange::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:MinimumTemperature", m_MinimumTemperature);
+    writeSimpleElement(writer, "tns:MaximumTemperature", m_MaximumTemperature);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTemperatureRange::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2555,6 +4879,74 @@ QDomElement ScenarioTransmitter::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioTransmitter* ScenarioTransmitter::create(QXmlStreamReader& reader)
+{
+    ScenarioTransmitter* v = new ScenarioTransmitter;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTransmitter::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAntennaType::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:ObservationChecked"))
+    {
+        m_ObservationChecked = parseBoolean(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:FedderLossTx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FedderLossTx"));
+        return false;
+    }
+    m_FedderLossTx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DepointingLossTx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DepointingLossTx"));
+        return false;
+    }
+    m_DepointingLossTx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TransmittingPower"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TransmittingPower"));
+        return false;
+    }
+    m_TransmittingPower = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Modulation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Modulation"));
+        return false;
+    }
+    m_Modulation = QSharedPointer<ScenarioModulation>(ScenarioModulation::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTransmitter::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAntennaType::writeContents(writer);
+    writeSimpleElement(writer, "tns:ObservationChecked", m_ObservationChecked);
+    writeSimpleElement(writer, "tns:FedderLossTx", m_FedderLossTx);
+    writeSimpleElement(writer, "tns:DepointingLossTx", m_DepointingLossTx);
+    writeSimpleElement(writer, "tns:TransmittingPower", m_TransmittingPower);
+    if (!m_Modulation.isNull())
+    {
+        QString tagName = "Modulation";
+        m_Modulation->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTransmitter::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2601,6 +4993,46 @@ QDomElement ScenarioModulation::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioModulation* ScenarioModulation::create(QXmlStreamReader& reader)
+{
+    ScenarioModulation* v = new ScenarioModulation;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioModulation::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ModulationType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ModulationType"));
+        return false;
+    }
+    m_ModulationType = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DataRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DataRate"));
+        return false;
+    }
+    m_DataRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioModulation::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:ModulationType", m_ModulationType);
+    writeSimpleElement(writer, "tns:DataRate", m_DataRate);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioModulation::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2661,6 +5093,68 @@ QDomElement ScenarioReceiver::toDomElement(QDomDocument& doc, const QString& ele
     return e;
 }
 
+ScenarioReceiver* ScenarioReceiver::create(QXmlStreamReader& reader)
+{
+    ScenarioReceiver* v = new ScenarioReceiver;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioReceiver::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAntennaType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:GoverT"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:GoverT"));
+        return false;
+    }
+    m_GoverT = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:FeederLossRx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FeederLossRx"));
+        return false;
+    }
+    m_FeederLossRx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DepointingLossRx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DepointingLossRx"));
+        return false;
+    }
+    m_DepointingLossRx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SystemTemperature"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemTemperature"));
+        return false;
+    }
+    m_SystemTemperature = QSharedPointer<ScenarioSystemTemperature>(ScenarioSystemTemperature::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioReceiver::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAntennaType::writeContents(writer);
+    writeSimpleElement(writer, "tns:GoverT", m_GoverT);
+    writeSimpleElement(writer, "tns:FeederLossRx", m_FeederLossRx);
+    writeSimpleElement(writer, "tns:DepointingLossRx", m_DepointingLossRx);
+    if (!m_SystemTemperature.isNull())
+    {
+        QString tagName = "SystemTemperature";
+        m_SystemTemperature->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioReceiver::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2723,16 +5217,88 @@ QDomElement ScenarioSystemTemperature::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioSystemTemperature::children() const
+ScenarioSystemTemperature* ScenarioSystemTemperature::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    return children;
+    ScenarioSystemTemperature* v = new ScenarioSystemTemperature;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
 }
 
-
-
-
-// ScenarioAeroCoefFileType
+bool ScenarioSystemTemperature::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:choiceTantenna"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:choiceTantenna"));
+        return false;
+    }
+    m_choiceTantenna = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Tantenna"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Tantenna"));
+        return false;
+    }
+    m_Tantenna = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RxNoiseFigure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RxNoiseFigure"));
+        return false;
+    }
+    m_RxNoiseFigure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ThermoFeeder"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ThermoFeeder"));
+        return false;
+    }
+    m_ThermoFeeder = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ThermoReveicer"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ThermoReveicer"));
+        return false;
+    }
+    m_ThermoReveicer = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TotalSystemTemp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TotalSystemTemp"));
+        return false;
+    }
+    m_TotalSystemTemp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSystemTemperature::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:choiceTantenna", m_choiceTantenna);
+    writeSimpleElement(writer, "tns:Tantenna", m_Tantenna);
+    writeSimpleElement(writer, "tns:RxNoiseFigure", m_RxNoiseFigure);
+    writeSimpleElement(writer, "tns:ThermoFeeder", m_ThermoFeeder);
+    writeSimpleElement(writer, "tns:ThermoReveicer", m_ThermoReveicer);
+    writeSimpleElement(writer, "tns:TotalSystemTemp", m_TotalSystemTemp);
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioSystemTemperature::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    return children;
+}
+
+
+
+
+// ScenarioAeroCoefFileType
 ScenarioAeroCoefFileType::ScenarioAeroCoefFileType() :
     m_NumberOfIndepVars(0)
 {
@@ -2783,6 +5349,86 @@ QDomElement ScenarioAeroCoefFileType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioAeroCoefFileType* ScenarioAeroCoefFileType::create(QXmlStreamReader& reader)
+{
+    ScenarioAeroCoefFileType* v = new ScenarioAeroCoefFileType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAeroCoefFileType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:FileLocation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FileLocation"));
+        return false;
+    }
+    m_FileLocation = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CoefName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoefName"));
+        return false;
+    }
+    m_CoefName = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:NumberOfIndepVars"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:NumberOfIndepVars"));
+        return false;
+    }
+    m_NumberOfIndepVars = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:IndepVarNames"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:IndepVarNames"));
+        return false;
+    }
+    m_IndepVarNames = parseStringList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:IndepVarDiscretizationPoints"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:IndepVarDiscretizationPoints"));
+        return false;
+    }
+    m_IndepVarDiscretizationPoints = parseIntList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:IndepVarMin"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:IndepVarMin"));
+        return false;
+    }
+    m_IndepVarMin = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:IndepVarMax"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:IndepVarMax"));
+        return false;
+    }
+    m_IndepVarMax = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioAeroCoefFileType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:FileLocation", m_FileLocation);
+    writeSimpleElement(writer, "tns:CoefName", m_CoefName);
+    writeSimpleElement(writer, "tns:NumberOfIndepVars", m_NumberOfIndepVars);
+    writeSimpleElement(writer, "tns:IndepVarNames", m_IndepVarNames);
+    writeSimpleElement(writer, "tns:IndepVarDiscretizationPoints", m_IndepVarDiscretizationPoints);
+    writeSimpleElement(writer, "tns:IndepVarMin", m_IndepVarMin);
+    writeSimpleElement(writer, "tns:IndepVarMax", m_IndepVarMax);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAeroCoefFileType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2839,6 +5485,50 @@ QDomElement ScenarioOptVarDouble::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioOptVarDouble* ScenarioOptVarDouble::create(QXmlStreamReader& reader)
+{
+    ScenarioOptVarDouble* v = new ScenarioOptVarDouble;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOptVarDouble::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:min"))
+    {
+        m_min = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:value"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:value"));
+        return false;
+    }
+    m_value = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:max"))
+    {
+        m_max = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioOptVarDouble::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:min", m_min);
+    writeSimpleElement(writer, "tns:value", m_value);
+    writeSimpleElement(writer, "tns:max", m_max);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOptVarDouble::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2887,6 +5577,44 @@ QDomElement ScenarioOptVarInt::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioOptVarInt* ScenarioOptVarInt::create(QXmlStreamReader& reader)
+{
+    ScenarioOptVarInt* v = new ScenarioOptVarInt;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOptVarInt::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:list"))
+    {
+        m_list = parseIntList(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:value"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:value"));
+        return false;
+    }
+    m_value = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOptVarInt::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:list", m_list);
+    writeSimpleElement(writer, "tns:value", m_value);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOptVarInt::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2928,6 +5656,38 @@ QDomElement ScenarioOptVarBool::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioOptVarBool* ScenarioOptVarBool::create(QXmlStreamReader& reader)
+{
+    ScenarioOptVarBool* v = new ScenarioOptVarBool;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOptVarBool::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:value"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:value"));
+        return false;
+    }
+    m_value = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOptVarBool::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:value", m_value);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOptVarBool::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -2975,6 +5735,44 @@ QDomElement ScenarioOptVarString::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioOptVarString* ScenarioOptVarString::create(QXmlStreamReader& reader)
+{
+    ScenarioOptVarString* v = new ScenarioOptVarString;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOptVarString::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:list"))
+    {
+        m_list = parseStringList(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:value"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:value"));
+        return false;
+    }
+    m_value = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOptVarString::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:list", m_list);
+    writeSimpleElement(writer, "tns:value", m_value);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOptVarString::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3049,6 +5847,118 @@ QDomElement ScenarioOptimization::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioOptimization* ScenarioOptimization::create(QXmlStreamReader& reader)
+{
+    ScenarioOptimization* v = new ScenarioOptimization;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOptimization::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:nVariables"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nVariables"));
+        return false;
+    }
+    m_nVariables = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:variables"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:variables"));
+        return false;
+    }
+    m_variables = parseStringList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:variablesMatrix"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:variablesMatrix"));
+        return false;
+    }
+    m_variablesMatrix = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nObjectives"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nObjectives"));
+        return false;
+    }
+    m_nObjectives = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:objectives"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:objectives"));
+        return false;
+    }
+    m_objectives = parseStringList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:objectivesMatrix"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:objectivesMatrix"));
+        return false;
+    }
+    m_objectivesMatrix = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nConstraints"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nConstraints"));
+        return false;
+    }
+    m_nConstraints = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:constraints"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:constraints"));
+        return false;
+    }
+    m_constraints = parseStringList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:constraintsMatrix"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:constraintsMatrix"));
+        return false;
+    }
+    m_constraintsMatrix = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:algorithm"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:algorithm"));
+        return false;
+    }
+    m_algorithm = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:algorithmParameters"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:algorithmParameters"));
+        return false;
+    }
+    m_algorithmParameters = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOptimization::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:nVariables", m_nVariables);
+    writeSimpleElement(writer, "tns:variables", m_variables);
+    writeSimpleElement(writer, "tns:variablesMatrix", m_variablesMatrix);
+    writeSimpleElement(writer, "tns:nObjectives", m_nObjectives);
+    writeSimpleElement(writer, "tns:objectives", m_objectives);
+    writeSimpleElement(writer, "tns:objectivesMatrix", m_objectivesMatrix);
+    writeSimpleElement(writer, "tns:nConstraints", m_nConstraints);
+    writeSimpleElement(writer, "tns:constraints", m_constraints);
+    writeSimpleElement(writer, "tns:constraintsMatrix", m_constraintsMatrix);
+    writeSimpleElement(writer, "tns:algorithm", m_algorithm);
+    writeSimpleElement(writer, "tns:algorithmParameters", m_algorithmParameters);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOptimization::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3129,6 +6039,82 @@ QDomElement ScenarioOutputFiles::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioOutputFiles* ScenarioOutputFiles::create(QXmlStreamReader& reader)
+{
+    ScenarioOutputFiles* v = new ScenarioOutputFiles;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOutputFiles::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:paretoFrontVarsFileName"))
+    {
+        m_paretoFrontVarsFileName = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:paretoFrontCstrsFileName"))
+    {
+        m_paretoFrontCstrsFileName = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:paretoFrontObjsFileName"))
+    {
+        m_paretoFrontObjsFileName = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:geometryFileName"))
+    {
+        m_geometryFileName = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:trajPostionFileName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:trajPostionFileName"));
+        return false;
+    }
+    m_trajPostionFileName = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:trajAttitudeFileName"))
+    {
+        m_trajAttitudeFileName = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:trajMiscFileName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:trajMiscFileName"));
+        return false;
+    }
+    m_trajMiscFileName = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:successProbabilityFileName"))
+    {
+        m_successProbabilityFileName = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioOutputFiles::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:paretoFrontVarsFileName", m_paretoFrontVarsFileName);
+    writeSimpleElement(writer, "tns:paretoFrontCstrsFileName", m_paretoFrontCstrsFileName);
+    writeSimpleElement(writer, "tns:paretoFrontObjsFileName", m_paretoFrontObjsFileName);
+    writeSimpleElement(writer, "tns:geometryFileName", m_geometryFileName);
+    writeSimpleElement(writer, "tns:trajPostionFileName", m_trajPostionFileName);
+    writeSimpleElement(writer, "tns:trajAttitudeFileName", m_trajAttitudeFileName);
+    writeSimpleElement(writer, "tns:trajMiscFileName", m_trajMiscFileName);
+    writeSimpleElement(writer, "tns:successProbabilityFileName", m_successProbabilityFileName);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOutputFiles::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3207,6 +6193,86 @@ QDomElement ScenarioGroundStation::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioGroundStation* ScenarioGroundStation::create(QXmlStreamReader& reader)
+{
+    ScenarioGroundStation* v = new ScenarioGroundStation;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioGroundStation::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Location"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Location"));
+        return false;
+    }
+    m_Location = QSharedPointer<ScenarioLocationType>(ScenarioLocationType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PayloadSet"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PayloadSet"));
+        return false;
+    }
+    m_PayloadSet = QSharedPointer<ScenarioPayloadSet>(ScenarioPayloadSet::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:GroundStationEnvironment"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:GroundStationEnvironment"));
+        return false;
+    }
+    m_GroundStationEnvironment = QSharedPointer<ScenarioGroundStationEnvironment>(ScenarioGroundStationEnvironment::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioGroundStation::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioParticipantType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Location.isNull())
+    {
+        QString tagName = "Location";
+        m_Location->writeElement(writer, tagName);
+    }
+    if (!m_PayloadSet.isNull())
+    {
+        QString tagName = "PayloadSet";
+        m_PayloadSet->writeElement(writer, tagName);
+    }
+    if (!m_GroundStationEnvironment.isNull())
+    {
+        QString tagName = "GroundStationEnvironment";
+        m_GroundStationEnvironment->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioGroundStation::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3273,6 +6339,76 @@ QDomElement ScenarioGroundStationEnvironment::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioGroundStationEnvironment* ScenarioGroundStationEnvironment::create(QXmlStreamReader& reader)
+{
+    ScenarioGroundStationEnvironment* v = new ScenarioGroundStationEnvironment;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioGroundStationEnvironment::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Rain"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Rain"));
+        return false;
+    }
+    m_Rain = QSharedPointer<ScenarioRain>(ScenarioRain::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OxygenAtt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OxygenAtt"));
+        return false;
+    }
+    m_OxygenAtt = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OxChoice"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OxChoice"));
+        return false;
+    }
+    m_OxChoice = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:WaterVapourAtt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:WaterVapourAtt"));
+        return false;
+    }
+    m_WaterVapourAtt = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:WaterVapourChoice"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:WaterVapourChoice"));
+        return false;
+    }
+    m_WaterVapourChoice = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioGroundStationEnvironment::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Rain.isNull())
+    {
+        QString tagName = "Rain";
+        m_Rain->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:OxygenAtt", m_OxygenAtt);
+    writeSimpleElement(writer, "tns:OxChoice", m_OxChoice);
+    writeSimpleElement(writer, "tns:WaterVapourAtt", m_WaterVapourAtt);
+    writeSimpleElement(writer, "tns:WaterVapourChoice", m_WaterVapourChoice);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioGroundStationEnvironment::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3319,6 +6455,46 @@ QDomElement ScenarioRain::toDomElement(QDomDocument& doc, const QString& element
     return e;
 }
 
+ScenarioRain* ScenarioRain::create(QXmlStreamReader& reader)
+{
+    ScenarioRain* v = new ScenarioRain;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioRain::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:PercentageExceededLimit"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PercentageExceededLimit"));
+        return false;
+    }
+    m_PercentageExceededLimit = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RainChoice"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RainChoice"));
+        return false;
+    }
+    m_RainChoice = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioRain::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:PercentageExceededLimit", m_PercentageExceededLimit);
+    writeSimpleElement(writer, "tns:RainChoice", m_RainChoice);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioRain::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3391,13 +6567,87 @@ QDomElement ScenarioLaunchPad::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioLaunchPad::children() const
+ScenarioLaunchPad* ScenarioLaunchPad::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    if (!m_ElementIdentifier.isNull()) children << m_ElementIdentifier;
-    if (!m_Location.isNull()) children << m_Location;
-    if (!m_PayloadSet.isNull()) children << m_PayloadSet;
-    return children;
+    ScenarioLaunchPad* v = new ScenarioLaunchPad;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLaunchPad::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Location"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Location"));
+        return false;
+    }
+    m_Location = QSharedPointer<ScenarioLocationType>(ScenarioLocationType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PayloadSet"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PayloadSet"));
+        return false;
+    }
+    m_PayloadSet = QSharedPointer<ScenarioPayloadSet>(ScenarioPayloadSet::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:clearingAltitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:clearingAltitude"));
+        return false;
+    }
+    m_clearingAltitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLaunchPad::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioParticipantType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Location.isNull())
+    {
+        QString tagName = "Location";
+        m_Location->writeElement(writer, tagName);
+    }
+    if (!m_PayloadSet.isNull())
+    {
+        QString tagName = "PayloadSet";
+        m_PayloadSet->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:clearingAltitude", m_clearingAltitude);
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioLaunchPad::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    if (!m_ElementIdentifier.isNull()) children << m_ElementIdentifier;
+    if (!m_Location.isNull()) children << m_Location;
+    if (!m_PayloadSet.isNull()) children << m_PayloadSet;
+    return children;
 }
 
 
@@ -3462,6 +6712,72 @@ QDomElement ScenarioPoint::toDomElement(QDomDocument& doc, const QString& elemen
     return e;
 }
 
+ScenarioPoint* ScenarioPoint::create(QXmlStreamReader& reader)
+{
+    ScenarioPoint* v = new ScenarioPoint;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPoint::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Location"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Location"));
+        return false;
+    }
+    m_Location = QSharedPointer<ScenarioLocationType>(ScenarioLocationType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PayloadSet"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PayloadSet"));
+        return false;
+    }
+    m_PayloadSet = QSharedPointer<ScenarioPayloadSet>(ScenarioPayloadSet::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPoint::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioParticipantType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Location.isNull())
+    {
+        QString tagName = "Location";
+        m_Location->writeElement(writer, tagName);
+    }
+    if (!m_PayloadSet.isNull())
+    {
+        QString tagName = "PayloadSet";
+        m_PayloadSet->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPoint::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3519,6 +6835,60 @@ QDomElement ScenarioRegion::toDomElement(QDomDocument& doc, const QString& eleme
     return e;
 }
 
+ScenarioRegion* ScenarioRegion::create(QXmlStreamReader& reader)
+{
+    ScenarioRegion* v = new ScenarioRegion;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioRegion::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CentralBody"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CentralBody"));
+        return false;
+    }
+    m_CentralBody = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Boundary"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Boundary"));
+        return false;
+    }
+    m_Boundary = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioRegion::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioParticipantType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:CentralBody", m_CentralBody);
+    writeSimpleElement(writer, "tns:Boundary", m_Boundary);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioRegion::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3572,6 +6942,55 @@ QDomElement ScenarioLocationType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioLocationType* ScenarioLocationType::create(QXmlStreamReader& reader)
+{
+    ScenarioLocationType* v = new ScenarioLocationType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLocationType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:CentralBody"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CentralBody"));
+        return false;
+    }
+    m_CentralBody = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:GroundPosition"))
+        m_Abstract3DOFPosition = QSharedPointer<ScenarioAbstract3DOFPositionType>((ScenarioAbstract3DOFPositionType*)ScenarioGroundPositionType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract3DOFPosition"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLocationType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:CentralBody", m_CentralBody);
+    if (!m_Abstract3DOFPosition.isNull())
+    {
+        QString tagName = "Abstract3DOFPosition";
+        if (dynamic_cast<ScenarioGroundPositionType*>(m_Abstract3DOFPosition.data()))
+            tagName = "GroundPosition";
+        m_Abstract3DOFPosition->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLocationType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3664,6 +7083,108 @@ QDomElement ScenarioLV::toDomElement(QDomDocument& doc, const QString& elementNa
     return e;
 }
 
+ScenarioLV* ScenarioLV::create(QXmlStreamReader& reader)
+{
+    ScenarioLV* v = new ScenarioLV;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLV::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Program"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Program"));
+        return false;
+    }
+    m_Program = QSharedPointer<ScenarioLVProgramType>(ScenarioLVProgramType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Mission"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Mission"));
+        return false;
+    }
+    m_Mission = QSharedPointer<ScenarioLVMissionType>(ScenarioLVMissionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:System"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:System"));
+        return false;
+    }
+    m_System = QSharedPointer<ScenarioLVSystemType>(ScenarioLVSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Optimization"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Optimization"));
+        return false;
+    }
+    m_Optimization = QSharedPointer<ScenarioOptimization>(ScenarioOptimization::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OutputFiles"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OutputFiles"));
+        return false;
+    }
+    m_OutputFiles = QSharedPointer<ScenarioOutputFiles>(ScenarioOutputFiles::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Appearance"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Appearance"));
+        return false;
+    }
+    m_Appearance = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLV::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioParticipantType::writeContents(writer);
+    if (!m_Program.isNull())
+    {
+        QString tagName = "Program";
+        m_Program->writeElement(writer, tagName);
+    }
+    if (!m_Mission.isNull())
+    {
+        QString tagName = "Mission";
+        m_Mission->writeElement(writer, tagName);
+    }
+    if (!m_System.isNull())
+    {
+        QString tagName = "System";
+        m_System->writeElement(writer, tagName);
+    }
+    if (!m_Optimization.isNull())
+    {
+        QString tagName = "Optimization";
+        m_Optimization->writeElement(writer, tagName);
+    }
+    if (!m_OutputFiles.isNull())
+    {
+        QString tagName = "OutputFiles";
+        m_OutputFiles->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:Appearance", m_Appearance);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLV::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3729,6 +7250,68 @@ QDomElement ScenarioLVProgramType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioLVProgramType* ScenarioLVProgramType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVProgramType* v = new ScenarioLVProgramType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVProgramType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:nLaunches"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nLaunches"));
+        return false;
+    }
+    m_nLaunches = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nYearsOps"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nYearsOps"));
+        return false;
+    }
+    m_nYearsOps = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nLaunchesPerYear"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nLaunchesPerYear"));
+        return false;
+    }
+    m_nLaunchesPerYear = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ProgramCostFactors"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ProgramCostFactors"));
+        return false;
+    }
+    m_ProgramCostFactors = QSharedPointer<ScenarioLVProgramCostFactorsType>(ScenarioLVProgramCostFactorsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVProgramType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:nLaunches", m_nLaunches);
+    writeSimpleElement(writer, "tns:nYearsOps", m_nYearsOps);
+    writeSimpleElement(writer, "tns:nLaunchesPerYear", m_nLaunchesPerYear);
+    if (!m_ProgramCostFactors.isNull())
+    {
+        QString tagName = "ProgramCostFactors";
+        m_ProgramCostFactors->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVProgramType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3818,6 +7401,100 @@ QDomElement ScenarioLVMissionType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioLVMissionType* ScenarioLVMissionType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVMissionType* v = new ScenarioLVMissionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVMissionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Payload"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Payload"));
+        return false;
+    }
+    m_Payload = QSharedPointer<ScenarioLVPayloadType>(ScenarioLVPayloadType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Environment"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Environment"));
+        return false;
+    }
+    m_Environment = QSharedPointer<ScenarioEnvironmentType>(ScenarioEnvironmentType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:LaunchSite"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:LaunchSite"));
+        return false;
+    }
+    m_LaunchSite = QSharedPointer<ScenarioLVLaunchSiteType>(ScenarioLVLaunchSiteType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TargetOrbit"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TargetOrbit"));
+        return false;
+    }
+    m_TargetOrbit = QSharedPointer<ScenarioLVTargetOrbitType>(ScenarioLVTargetOrbitType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Trajectory"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Trajectory"));
+        return false;
+    }
+    m_Trajectory = QSharedPointer<ScenarioLVTrajectoryType>(ScenarioLVTrajectoryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVMissionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Payload.isNull())
+    {
+        QString tagName = "Payload";
+        m_Payload->writeElement(writer, tagName);
+    }
+    if (!m_Environment.isNull())
+    {
+        QString tagName = "Environment";
+        m_Environment->writeElement(writer, tagName);
+    }
+    if (!m_LaunchSite.isNull())
+    {
+        QString tagName = "LaunchSite";
+        m_LaunchSite->writeElement(writer, tagName);
+    }
+    if (!m_TargetOrbit.isNull())
+    {
+        QString tagName = "TargetOrbit";
+        m_TargetOrbit->writeElement(writer, tagName);
+    }
+    if (!m_Trajectory.isNull())
+    {
+        QString tagName = "Trajectory";
+        m_Trajectory->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVMissionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -3973,55 +7650,230 @@ QDomElement ScenarioLVSystemType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioLVSystemType::children() const
-{
-    QList<QSharedPointer<ScenarioObject> > children;
-    if (!m_Architecture.isNull()) children << m_Architecture;
-    if (!m_PlFairing.isNull()) children << m_PlFairing;
-    foreach (QSharedPointer<ScenarioObject> child, m_LowerStage) { children << child; }
-    if (!m_UpperStage.isNull()) children << m_UpperStage;
-    foreach (QSharedPointer<ScenarioObject> child, m_Boosters) { children << child; }
-    if (!m_SystemWeights.isNull()) children << m_SystemWeights;
-    if (!m_SystemCosts.isNull()) children << m_SystemCosts;
-    if (!m_SystemReliability.isNull()) children << m_SystemReliability;
-    if (!m_Aerodynamics.isNull()) children << m_Aerodynamics;
-    if (!m_SystemConstraints.isNull()) children << m_SystemConstraints;
-    return children;
-}
-
-
-
-
-// ScenarioLVPropulsionSystemType
-ScenarioLVPropulsionSystemType::ScenarioLVPropulsionSystemType()
-{
-    m_System = QSharedPointer<ScenarioLVPropulsionSystemSystemType>(new ScenarioLVPropulsionSystemSystemType());
-    m_LiquidTanks = QSharedPointer<ScenarioLVPropulsionSystemLiquidTanksType>(new ScenarioLVPropulsionSystemLiquidTanksType());
-    m_SolidGrain = QSharedPointer<ScenarioLVPropulsionSystemSolidGrainType>(new ScenarioLVPropulsionSystemSolidGrainType());
-    m_FeedSystem = QSharedPointer<ScenarioLVPropulsionSystemFeedSystemType>(new ScenarioLVPropulsionSystemFeedSystemType());
-    m_CombustionChamber = QSharedPointer<ScenarioLVPropulsionSystemCombustionChamberType>(new ScenarioLVPropulsionSystemCombustionChamberType());
-    m_Nozzle = QSharedPointer<ScenarioLVPropulsionSystemNozzleType>(new ScenarioLVPropulsionSystemNozzleType());
-    m_Performance = QSharedPointer<ScenarioLVPropulsionSystemPerformanceType>(new ScenarioLVPropulsionSystemPerformanceType());
-}
-
-ScenarioLVPropulsionSystemType* ScenarioLVPropulsionSystemType::create(const QDomElement& e)
+ScenarioLVSystemType* ScenarioLVSystemType::create(QXmlStreamReader& reader)
 {
-    ScenarioLVPropulsionSystemType* v;
+    ScenarioLVSystemType* v = new ScenarioLVSystemType;
+    if (!v->load(reader))
     {
-        v = new ScenarioLVPropulsionSystemType;
-        QDomElement nextElement = e.firstChildElement();
-        v->load(e, &nextElement);
-        return v;
+        delete v;
+        return NULL;
     }
-    return NULL;
+    skipUnknownElements(reader);
+    return v;
 }
 
-bool ScenarioLVPropulsionSystemType::load(const QDomElement& e, QDomElement* next)
+bool ScenarioLVSystemType::load(QXmlStreamReader& reader)
 {
-    ScenarioObject::load(e, next);
-    if (next->tagName() == "tns:System")
-        m_System = QSharedPointer<ScenarioLVPropulsionSystemSystemType>(ScenarioLVPropulsionSystemSystemType::create(*next));
-    *next = next->nextSiblingElement();
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Architecture"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Architecture"));
+        return false;
+    }
+    m_Architecture = QSharedPointer<ScenarioLVArchitectureType>(ScenarioLVArchitectureType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PlFairing"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PlFairing"));
+        return false;
+    }
+    m_PlFairing = QSharedPointer<ScenarioLVPlFairingType>(ScenarioLVPlFairingType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    for (;;)
+    {
+        QSharedPointer<ScenarioLVLowerStageType> v;
+        if (atStartElement(reader, "tns:LowerStage"))
+            v = QSharedPointer<ScenarioLVLowerStageType>(ScenarioLVLowerStageType::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_LowerStage << v;
+        reader.readNextStartElement();
+    }
+    if (m_LowerStage.isEmpty())
+    {
+        reader.raiseError(QObject::tr("Expected tns:LowerStage"));
+        return false;
+    }
+    if (!atStartElement(reader, "tns:UpperStage"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:UpperStage"));
+        return false;
+    }
+    m_UpperStage = QSharedPointer<ScenarioLVUpperStageType>(ScenarioLVUpperStageType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    for (;;)
+    {
+        QSharedPointer<ScenarioLVBoostersType> v;
+        if (atStartElement(reader, "tns:Boosters"))
+            v = QSharedPointer<ScenarioLVBoostersType>(ScenarioLVBoostersType::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_Boosters << v;
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:SystemWeights"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemWeights"));
+        return false;
+    }
+    m_SystemWeights = QSharedPointer<ScenarioLVSystemWeightsType>(ScenarioLVSystemWeightsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SystemCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemCosts"));
+        return false;
+    }
+    m_SystemCosts = QSharedPointer<ScenarioLVSystemCostsType>(ScenarioLVSystemCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SystemReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemReliability"));
+        return false;
+    }
+    m_SystemReliability = QSharedPointer<ScenarioLVSystemReliabilityType>(ScenarioLVSystemReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Aerodynamics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Aerodynamics"));
+        return false;
+    }
+    m_Aerodynamics = QSharedPointer<ScenarioLVAerodynamicsType>(ScenarioLVAerodynamicsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SystemConstraints"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemConstraints"));
+        return false;
+    }
+    m_SystemConstraints = QSharedPointer<ScenarioLVSystemConstraintsType>(ScenarioLVSystemConstraintsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVSystemType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Architecture.isNull())
+    {
+        QString tagName = "Architecture";
+        m_Architecture->writeElement(writer, tagName);
+    }
+    if (!m_PlFairing.isNull())
+    {
+        QString tagName = "PlFairing";
+        m_PlFairing->writeElement(writer, tagName);
+    }
+    foreach (QSharedPointer<ScenarioLVLowerStageType> p, m_LowerStage)
+    {
+        QString tagName = "LowerStage";
+        p->writeElement(writer, tagName);
+    }
+    if (!m_UpperStage.isNull())
+    {
+        QString tagName = "UpperStage";
+        m_UpperStage->writeElement(writer, tagName);
+    }
+    foreach (QSharedPointer<ScenarioLVBoostersType> p, m_Boosters)
+    {
+        QString tagName = "Boosters";
+        p->writeElement(writer, tagName);
+    }
+    if (!m_SystemWeights.isNull())
+    {
+        QString tagName = "SystemWeights";
+        m_SystemWeights->writeElement(writer, tagName);
+    }
+    if (!m_SystemCosts.isNull())
+    {
+        QString tagName = "SystemCosts";
+        m_SystemCosts->writeElement(writer, tagName);
+    }
+    if (!m_SystemReliability.isNull())
+    {
+        QString tagName = "SystemReliability";
+        m_SystemReliability->writeElement(writer, tagName);
+    }
+    if (!m_Aerodynamics.isNull())
+    {
+        QString tagName = "Aerodynamics";
+        m_Aerodynamics->writeElement(writer, tagName);
+    }
+    if (!m_SystemConstraints.isNull())
+    {
+        QString tagName = "SystemConstraints";
+        m_SystemConstraints->writeElement(writer, tagName);
+    }
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioLVSystemType::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    if (!m_Architecture.isNull()) children << m_Architecture;
+    if (!m_PlFairing.isNull()) children << m_PlFairing;
+    foreach (QSharedPointer<ScenarioObject> child, m_LowerStage) { children << child; }
+    if (!m_UpperStage.isNull()) children << m_UpperStage;
+    foreach (QSharedPointer<ScenarioObject> child, m_Boosters) { children << child; }
+    if (!m_SystemWeights.isNull()) children << m_SystemWeights;
+    if (!m_SystemCosts.isNull()) children << m_SystemCosts;
+    if (!m_SystemReliability.isNull()) children << m_SystemReliability;
+    if (!m_Aerodynamics.isNull()) children << m_Aerodynamics;
+    if (!m_SystemConstraints.isNull()) children << m_SystemConstraints;
+    return children;
+}
+
+
+
+
+// ScenarioLVPropulsionSystemType
+ScenarioLVPropulsionSystemType::ScenarioLVPropulsionSystemType()
+{
+    m_System = QSharedPointer<ScenarioLVPropulsionSystemSystemType>(new ScenarioLVPropulsionSystemSystemType());
+    m_LiquidTanks = QSharedPointer<ScenarioLVPropulsionSystemLiquidTanksType>(new ScenarioLVPropulsionSystemLiquidTanksType());
+    m_SolidGrain = QSharedPointer<ScenarioLVPropulsionSystemSolidGrainType>(new ScenarioLVPropulsionSystemSolidGrainType());
+    m_FeedSystem = QSharedPointer<ScenarioLVPropulsionSystemFeedSystemType>(new ScenarioLVPropulsionSystemFeedSystemType());
+    m_CombustionChamber = QSharedPointer<ScenarioLVPropulsionSystemCombustionChamberType>(new ScenarioLVPropulsionSystemCombustionChamberType());
+    m_Nozzle = QSharedPointer<ScenarioLVPropulsionSystemNozzleType>(new ScenarioLVPropulsionSystemNozzleType());
+    m_Performance = QSharedPointer<ScenarioLVPropulsionSystemPerformanceType>(new ScenarioLVPropulsionSystemPerformanceType());
+}
+
+ScenarioLVPropulsionSystemType* ScenarioLVPropulsionSystemType::create(const QDomElement& e)
+{
+    ScenarioLVPropulsionSystemType* v;
+    {
+        v = new ScenarioLVPropulsionSystemType;
+        QDomElement nextElement = e.firstChildElement();
+        v->load(e, &nextElement);
+        return v;
+    }
+    return NULL;
+}
+
+bool ScenarioLVPropulsionSystemType::load(const QDomElement& e, QDomElement* next)
+{
+    ScenarioObject::load(e, next);
+    if (next->tagName() == "tns:System")
+        m_System = QSharedPointer<ScenarioLVPropulsionSystemSystemType>(ScenarioLVPropulsionSystemSystemType::create(*next));
+    *next = next->nextSiblingElement();
     if (next->tagName() == "tns:LiquidTanks")
         m_LiquidTanks = QSharedPointer<ScenarioLVPropulsionSystemLiquidTanksType>(ScenarioLVPropulsionSystemLiquidTanksType::create(*next));
     *next = next->nextSiblingElement();
@@ -4091,6 +7943,128 @@ QDomElement ScenarioLVPropulsionSystemType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioLVPropulsionSystemType* ScenarioLVPropulsionSystemType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemType* v = new ScenarioLVPropulsionSystemType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:System"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:System"));
+        return false;
+    }
+    m_System = QSharedPointer<ScenarioLVPropulsionSystemSystemType>(ScenarioLVPropulsionSystemSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:LiquidTanks"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:LiquidTanks"));
+        return false;
+    }
+    m_LiquidTanks = QSharedPointer<ScenarioLVPropulsionSystemLiquidTanksType>(ScenarioLVPropulsionSystemLiquidTanksType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SolidGrain"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SolidGrain"));
+        return false;
+    }
+    m_SolidGrain = QSharedPointer<ScenarioLVPropulsionSystemSolidGrainType>(ScenarioLVPropulsionSystemSolidGrainType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:FeedSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FeedSystem"));
+        return false;
+    }
+    m_FeedSystem = QSharedPointer<ScenarioLVPropulsionSystemFeedSystemType>(ScenarioLVPropulsionSystemFeedSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CombustionChamber"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CombustionChamber"));
+        return false;
+    }
+    m_CombustionChamber = QSharedPointer<ScenarioLVPropulsionSystemCombustionChamberType>(ScenarioLVPropulsionSystemCombustionChamberType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Nozzle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Nozzle"));
+        return false;
+    }
+    m_Nozzle = QSharedPointer<ScenarioLVPropulsionSystemNozzleType>(ScenarioLVPropulsionSystemNozzleType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Performance"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Performance"));
+        return false;
+    }
+    m_Performance = QSharedPointer<ScenarioLVPropulsionSystemPerformanceType>(ScenarioLVPropulsionSystemPerformanceType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_System.isNull())
+    {
+        QString tagName = "System";
+        m_System->writeElement(writer, tagName);
+    }
+    if (!m_LiquidTanks.isNull())
+    {
+        QString tagName = "LiquidTanks";
+        m_LiquidTanks->writeElement(writer, tagName);
+    }
+    if (!m_SolidGrain.isNull())
+    {
+        QString tagName = "SolidGrain";
+        m_SolidGrain->writeElement(writer, tagName);
+    }
+    if (!m_FeedSystem.isNull())
+    {
+        QString tagName = "FeedSystem";
+        m_FeedSystem->writeElement(writer, tagName);
+    }
+    if (!m_CombustionChamber.isNull())
+    {
+        QString tagName = "CombustionChamber";
+        m_CombustionChamber->writeElement(writer, tagName);
+    }
+    if (!m_Nozzle.isNull())
+    {
+        QString tagName = "Nozzle";
+        m_Nozzle->writeElement(writer, tagName);
+    }
+    if (!m_Performance.isNull())
+    {
+        QString tagName = "Performance";
+        m_Performance->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4199,6 +8173,146 @@ QDomElement ScenarioLVGeometryType::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioLVGeometryType* ScenarioLVGeometryType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVGeometryType* v = new ScenarioLVGeometryType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVGeometryType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:diameterEqualToUpper"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:diameterEqualToUpper"));
+        return false;
+    }
+    m_diameterEqualToUpper = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:lengthOverDiam"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:lengthOverDiam"));
+        return false;
+    }
+    m_lengthOverDiam = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:length"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:length"));
+        return false;
+    }
+    m_length = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:diameter"));
+        return false;
+    }
+    m_diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:volume"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:volume"));
+        return false;
+    }
+    m_volume = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:baseLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:baseLongPosition"));
+        return false;
+    }
+    m_baseLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:noseShape"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:noseShape"));
+        return false;
+    }
+    m_noseShape = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:noseLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:noseLength"));
+        return false;
+    }
+    m_noseLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:adapterLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:adapterLength"));
+        return false;
+    }
+    m_adapterLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:intertankLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:intertankLength"));
+        return false;
+    }
+    m_intertankLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:interstageLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:interstageLength"));
+        return false;
+    }
+    m_interstageLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:enginesGimbalClearenceCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:enginesGimbalClearenceCstrViolation"));
+        return false;
+    }
+    m_enginesGimbalClearenceCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:geometryInterferenceCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:geometryInterferenceCstrViolation"));
+        return false;
+    }
+    m_geometryInterferenceCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVGeometryType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_diameterEqualToUpper.isNull())
+    {
+        QString tagName = "diameterEqualToUpper";
+        m_diameterEqualToUpper->writeElement(writer, tagName);
+    }
+    if (!m_lengthOverDiam.isNull())
+    {
+        QString tagName = "lengthOverDiam";
+        m_lengthOverDiam->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:length", m_length);
+    writeSimpleElement(writer, "tns:diameter", m_diameter);
+    writeSimpleElement(writer, "tns:volume", m_volume);
+    writeSimpleElement(writer, "tns:baseLongPosition", m_baseLongPosition);
+    writeSimpleElement(writer, "tns:noseShape", m_noseShape);
+    writeSimpleElement(writer, "tns:noseLength", m_noseLength);
+    writeSimpleElement(writer, "tns:adapterLength", m_adapterLength);
+    writeSimpleElement(writer, "tns:intertankLength", m_intertankLength);
+    writeSimpleElement(writer, "tns:interstageLength", m_interstageLength);
+    writeSimpleElement(writer, "tns:enginesGimbalClearenceCstrViolation", m_enginesGimbalClearenceCstrViolation);
+    writeSimpleElement(writer, "tns:geometryInterferenceCstrViolation", m_geometryInterferenceCstrViolation);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVGeometryType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4280,6 +8394,96 @@ QDomElement ScenarioLVAerodynamicsType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioLVAerodynamicsType* ScenarioLVAerodynamicsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVAerodynamicsType* v = new ScenarioLVAerodynamicsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVAerodynamicsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:userDefinedAero"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:userDefinedAero"));
+        return false;
+    }
+    m_userDefinedAero = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:referenceArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:referenceArea"));
+        return false;
+    }
+    m_referenceArea = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:referenceLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:referenceLength"));
+        return false;
+    }
+    m_referenceLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:cl"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:cl"));
+        return false;
+    }
+    m_cl = QSharedPointer<ScenarioAeroCoefFileType>(ScenarioAeroCoefFileType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:cd"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:cd"));
+        return false;
+    }
+    m_cd = QSharedPointer<ScenarioAeroCoefFileType>(ScenarioAeroCoefFileType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:cm"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:cm"));
+        return false;
+    }
+    m_cm = QSharedPointer<ScenarioAeroCoefFileType>(ScenarioAeroCoefFileType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVAerodynamicsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:userDefinedAero", m_userDefinedAero);
+    writeSimpleElement(writer, "tns:referenceArea", m_referenceArea);
+    writeSimpleElement(writer, "tns:referenceLength", m_referenceLength);
+    if (!m_cl.isNull())
+    {
+        QString tagName = "cl";
+        m_cl->writeElement(writer, tagName);
+    }
+    if (!m_cd.isNull())
+    {
+        QString tagName = "cd";
+        m_cd->writeElement(writer, tagName);
+    }
+    if (!m_cm.isNull())
+    {
+        QString tagName = "cm";
+        m_cm->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVAerodynamicsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4407,25 +8611,161 @@ QDomElement ScenarioLVComponentWeightsType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioLVComponentWeightsType::children() const
+ScenarioLVComponentWeightsType* ScenarioLVComponentWeightsType::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    if (!m_tanksArrangement.isNull()) children << m_tanksArrangement;
-    if (!m_tanksType.isNull()) children << m_tanksType;
-    return children;
+    ScenarioLVComponentWeightsType* v = new ScenarioLVComponentWeightsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
 }
 
-
-
-
-// ScenarioLVSystemWeightsType
-ScenarioLVSystemWeightsType::ScenarioLVSystemWeightsType() :
-    m_totalDryMass(0.0),
-    m_totalWetMass(0.0),
-    m_takeoffThrustOverWeight(0.0)
+bool ScenarioLVComponentWeightsType::load(QXmlStreamReader& reader)
 {
-    m_maxAxialAcc = QSharedPointer<ScenarioOptVarDouble>(new ScenarioOptVarDouble());
-    m_maxHeatFlux = QSharedPointer<ScenarioOptVarDouble>(new ScenarioOptVarDouble());
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:tanksArrangement"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tanksArrangement"));
+        return false;
+    }
+    m_tanksArrangement = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tanksType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tanksType"));
+        return false;
+    }
+    m_tanksType = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dryMass"));
+        return false;
+    }
+    m_dryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dryCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dryCoGLongPosition"));
+        return false;
+    }
+    m_dryCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:wetMass"))
+    {
+        m_wetMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:mainStructMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainStructMass"));
+        return false;
+    }
+    m_mainStructMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:oxTankMass"))
+    {
+        m_oxTankMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:fuelTankMass"))
+    {
+        m_fuelTankMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:tpsMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tpsMass"));
+        return false;
+    }
+    m_tpsMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:avionicsMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:avionicsMass"));
+        return false;
+    }
+    m_avionicsMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:epsMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:epsMass"));
+        return false;
+    }
+    m_epsMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:plAdapterMass"))
+    {
+        m_plAdapterMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:padInterfaceMass"))
+    {
+        m_padInterfaceMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:interstageMass"))
+    {
+        m_interstageMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioLVComponentWeightsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_tanksArrangement.isNull())
+    {
+        QString tagName = "tanksArrangement";
+        m_tanksArrangement->writeElement(writer, tagName);
+    }
+    if (!m_tanksType.isNull())
+    {
+        QString tagName = "tanksType";
+        m_tanksType->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:dryMass", m_dryMass);
+    writeSimpleElement(writer, "tns:dryCoGLongPosition", m_dryCoGLongPosition);
+    writeSimpleElement(writer, "tns:wetMass", m_wetMass);
+    writeSimpleElement(writer, "tns:mainStructMass", m_mainStructMass);
+    writeSimpleElement(writer, "tns:oxTankMass", m_oxTankMass);
+    writeSimpleElement(writer, "tns:fuelTankMass", m_fuelTankMass);
+    writeSimpleElement(writer, "tns:tpsMass", m_tpsMass);
+    writeSimpleElement(writer, "tns:avionicsMass", m_avionicsMass);
+    writeSimpleElement(writer, "tns:epsMass", m_epsMass);
+    writeSimpleElement(writer, "tns:plAdapterMass", m_plAdapterMass);
+    writeSimpleElement(writer, "tns:padInterfaceMass", m_padInterfaceMass);
+    writeSimpleElement(writer, "tns:interstageMass", m_interstageMass);
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioLVComponentWeightsType::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    if (!m_tanksArrangement.isNull()) children << m_tanksArrangement;
+    if (!m_tanksType.isNull()) children << m_tanksType;
+    return children;
+}
+
+
+
+
+// ScenarioLVSystemWeightsType
+ScenarioLVSystemWeightsType::ScenarioLVSystemWeightsType() :
+    m_totalDryMass(0.0),
+    m_totalWetMass(0.0),
+    m_takeoffThrustOverWeight(0.0)
+{
+    m_maxAxialAcc = QSharedPointer<ScenarioOptVarDouble>(new ScenarioOptVarDouble());
+    m_maxHeatFlux = QSharedPointer<ScenarioOptVarDouble>(new ScenarioOptVarDouble());
     m_maxDynPressure = QSharedPointer<ScenarioOptVarDouble>(new ScenarioOptVarDouble());
     m_mainStructuralMaterial = QSharedPointer<ScenarioOptVarInt>(new ScenarioOptVarInt());
     m_redundancyLevel = QSharedPointer<ScenarioOptVarInt>(new ScenarioOptVarInt());
@@ -4519,6 +8859,138 @@ QDomElement ScenarioLVSystemWeightsType::toDomElement(QDomDocument& doc, const Q
     return e;
 }
 
+ScenarioLVSystemWeightsType* ScenarioLVSystemWeightsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVSystemWeightsType* v = new ScenarioLVSystemWeightsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVSystemWeightsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalDryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalDryMass"));
+        return false;
+    }
+    m_totalDryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalWetMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalWetMass"));
+        return false;
+    }
+    m_totalWetMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:takeoffThrustOverWeight"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:takeoffThrustOverWeight"));
+        return false;
+    }
+    m_takeoffThrustOverWeight = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxAxialAcc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxAxialAcc"));
+        return false;
+    }
+    m_maxAxialAcc = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxHeatFlux"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxHeatFlux"));
+        return false;
+    }
+    m_maxHeatFlux = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxDynPressure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxDynPressure"));
+        return false;
+    }
+    m_maxDynPressure = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainStructuralMaterial"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainStructuralMaterial"));
+        return false;
+    }
+    m_mainStructuralMaterial = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:redundancyLevel"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:redundancyLevel"));
+        return false;
+    }
+    m_redundancyLevel = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:structuralSafetyMargin"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structuralSafetyMargin"));
+        return false;
+    }
+    m_structuralSafetyMargin = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVSystemWeightsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalDryMass", m_totalDryMass);
+    writeSimpleElement(writer, "tns:totalWetMass", m_totalWetMass);
+    writeSimpleElement(writer, "tns:takeoffThrustOverWeight", m_takeoffThrustOverWeight);
+    if (!m_maxAxialAcc.isNull())
+    {
+        QString tagName = "maxAxialAcc";
+        m_maxAxialAcc->writeElement(writer, tagName);
+    }
+    if (!m_maxHeatFlux.isNull())
+    {
+        QString tagName = "maxHeatFlux";
+        m_maxHeatFlux->writeElement(writer, tagName);
+    }
+    if (!m_maxDynPressure.isNull())
+    {
+        QString tagName = "maxDynPressure";
+        m_maxDynPressure->writeElement(writer, tagName);
+    }
+    if (!m_mainStructuralMaterial.isNull())
+    {
+        QString tagName = "mainStructuralMaterial";
+        m_mainStructuralMaterial->writeElement(writer, tagName);
+    }
+    if (!m_redundancyLevel.isNull())
+    {
+        QString tagName = "redundancyLevel";
+        m_redundancyLevel->writeElement(writer, tagName);
+    }
+    if (!m_structuralSafetyMargin.isNull())
+    {
+        QString tagName = "structuralSafetyMargin";
+        m_structuralSafetyMargin->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVSystemWeightsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4593,6 +9065,72 @@ QDomElement ScenarioLVComponentCostsType::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioLVComponentCostsType* ScenarioLVComponentCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVComponentCostsType* v = new ScenarioLVComponentCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVComponentCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:nEngineTests"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nEngineTests"));
+        return false;
+    }
+    m_nEngineTests = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DevelopmentCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DevelopmentCosts"));
+        return false;
+    }
+    m_DevelopmentCosts = QSharedPointer<ScenarioLVDevelopmentCostsType>(ScenarioLVDevelopmentCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ProductionCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ProductionCosts"));
+        return false;
+    }
+    m_ProductionCosts = QSharedPointer<ScenarioLVProductionCostsType>(ScenarioLVProductionCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVComponentCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_nEngineTests.isNull())
+    {
+        QString tagName = "nEngineTests";
+        m_nEngineTests->writeElement(writer, tagName);
+    }
+    if (!m_DevelopmentCosts.isNull())
+    {
+        QString tagName = "DevelopmentCosts";
+        m_DevelopmentCosts->writeElement(writer, tagName);
+    }
+    if (!m_ProductionCosts.isNull())
+    {
+        QString tagName = "ProductionCosts";
+        m_ProductionCosts->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVComponentCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4668,6 +9206,80 @@ QDomElement ScenarioLVSystemCostsType::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
+ScenarioLVSystemCostsType* ScenarioLVSystemCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVSystemCostsType* v = new ScenarioLVSystemCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVSystemCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:TotalProgramCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TotalProgramCosts"));
+        return false;
+    }
+    m_TotalProgramCosts = QSharedPointer<ScenarioLVTotalProgramCostsType>(ScenarioLVTotalProgramCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:developmentTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:developmentTime"));
+        return false;
+    }
+    m_developmentTime = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DirectOperationsCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DirectOperationsCosts"));
+        return false;
+    }
+    m_DirectOperationsCosts = QSharedPointer<ScenarioLVDirectOperationsCostsType>(ScenarioLVDirectOperationsCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:IndirectOperationsCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:IndirectOperationsCosts"));
+        return false;
+    }
+    m_IndirectOperationsCosts = QSharedPointer<ScenarioLVIndirectOperationsCostsType>(ScenarioLVIndirectOperationsCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVSystemCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_TotalProgramCosts.isNull())
+    {
+        QString tagName = "TotalProgramCosts";
+        m_TotalProgramCosts->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:developmentTime", m_developmentTime);
+    if (!m_DirectOperationsCosts.isNull())
+    {
+        QString tagName = "DirectOperationsCosts";
+        m_DirectOperationsCosts->writeElement(writer, tagName);
+    }
+    if (!m_IndirectOperationsCosts.isNull())
+    {
+        QString tagName = "IndirectOperationsCosts";
+        m_IndirectOperationsCosts->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVSystemCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4745,6 +9357,90 @@ QDomElement ScenarioLVComponentReliabilityType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioLVComponentReliabilityType* ScenarioLVComponentReliabilityType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVComponentReliabilityType* v = new ScenarioLVComponentReliabilityType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVComponentReliabilityType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Separation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Separation"));
+        return false;
+    }
+    m_Separation = QSharedPointer<ScenarioLVSeparationType>(ScenarioLVSeparationType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:avionicsFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:avionicsFailureRate"));
+        return false;
+    }
+    m_avionicsFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:structureFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structureFailureRate"));
+        return false;
+    }
+    m_structureFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tpsFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tpsFailureRate"));
+        return false;
+    }
+    m_tpsFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropulsionReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropulsionReliability"));
+        return false;
+    }
+    m_PropulsionReliability = QSharedPointer<ScenarioLVPropulsionReliabilityType>(ScenarioLVPropulsionReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:overallComponentFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:overallComponentFailureRate"));
+        return false;
+    }
+    m_overallComponentFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVComponentReliabilityType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Separation.isNull())
+    {
+        QString tagName = "Separation";
+        m_Separation->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:avionicsFailureRate", m_avionicsFailureRate);
+    writeSimpleElement(writer, "tns:structureFailureRate", m_structureFailureRate);
+    writeSimpleElement(writer, "tns:tpsFailureRate", m_tpsFailureRate);
+    if (!m_PropulsionReliability.isNull())
+    {
+        QString tagName = "PropulsionReliability";
+        m_PropulsionReliability->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:overallComponentFailureRate", m_overallComponentFailureRate);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVComponentReliabilityType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4821,6 +9517,100 @@ QDomElement ScenarioLVSystemReliabilityType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioLVSystemReliabilityType* ScenarioLVSystemReliabilityType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVSystemReliabilityType* v = new ScenarioLVSystemReliabilityType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVSystemReliabilityType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:globalVehicleReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:globalVehicleReliability"));
+        return false;
+    }
+    m_globalVehicleReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:selfDestructReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:selfDestructReliability"));
+        return false;
+    }
+    m_selfDestructReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:missionSafety"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:missionSafety"));
+        return false;
+    }
+    m_missionSafety = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:preLaunchReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:preLaunchReliability"));
+        return false;
+    }
+    m_preLaunchReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TakeoffReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TakeoffReliability"));
+        return false;
+    }
+    m_TakeoffReliability = QSharedPointer<ScenarioLVTakeoffReliabilityType>(ScenarioLVTakeoffReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:numberOfAscentPhases"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:numberOfAscentPhases"));
+        return false;
+    }
+    m_numberOfAscentPhases = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ascentPhasesDurations"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ascentPhasesDurations"));
+        return false;
+    }
+    m_ascentPhasesDurations = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ascentPhasesFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ascentPhasesFailureRate"));
+        return false;
+    }
+    m_ascentPhasesFailureRate = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVSystemReliabilityType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:globalVehicleReliability", m_globalVehicleReliability);
+    writeSimpleElement(writer, "tns:selfDestructReliability", m_selfDestructReliability);
+    writeSimpleElement(writer, "tns:missionSafety", m_missionSafety);
+    writeSimpleElement(writer, "tns:preLaunchReliability", m_preLaunchReliability);
+    if (!m_TakeoffReliability.isNull())
+    {
+        QString tagName = "TakeoffReliability";
+        m_TakeoffReliability->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:numberOfAscentPhases", m_numberOfAscentPhases);
+    writeSimpleElement(writer, "tns:ascentPhasesDurations", m_ascentPhasesDurations);
+    writeSimpleElement(writer, "tns:ascentPhasesFailureRate", m_ascentPhasesFailureRate);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVSystemReliabilityType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -4910,30 +9700,124 @@ QDomElement ScenarioLVTrajectoryType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
-QList<QSharedPointer<ScenarioObject> >ScenarioLVTrajectoryType::children() const
+ScenarioLVTrajectoryType* ScenarioLVTrajectoryType::create(QXmlStreamReader& reader)
 {
-    QList<QSharedPointer<ScenarioObject> > children;
-    if (!m_TakeOff.isNull()) children << m_TakeOff;
-    if (!m_Ignitions.isNull()) children << m_Ignitions;
-    if (!m_AtmosphericFlight.isNull()) children << m_AtmosphericFlight;
-    if (!m_ExoatmosphericFlight.isNull()) children << m_ExoatmosphericFlight;
-    if (!m_TrajectoryConstraints.isNull()) children << m_TrajectoryConstraints;
-    return children;
+    ScenarioLVTrajectoryType* v = new ScenarioLVTrajectoryType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
 }
 
-
-
-
-// ScenarioLVProgramCostFactorsType
-ScenarioLVProgramCostFactorsType::ScenarioLVProgramCostFactorsType() :
-    m_f0(0.0),
-    m_f1(0.0),
-    m_f3(0.0),
-    m_f7(0.0)
+bool ScenarioLVTrajectoryType::load(QXmlStreamReader& reader)
 {
-}
-
-ScenarioLVProgramCostFactorsType* ScenarioLVProgramCostFactorsType::create(const QDomElement& e)
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:TakeOff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TakeOff"));
+        return false;
+    }
+    m_TakeOff = QSharedPointer<ScenarioLVTakeOffType>(ScenarioLVTakeOffType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Ignitions"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Ignitions"));
+        return false;
+    }
+    m_Ignitions = QSharedPointer<ScenarioLVIgnitionsType>(ScenarioLVIgnitionsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AtmosphericFlight"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AtmosphericFlight"));
+        return false;
+    }
+    m_AtmosphericFlight = QSharedPointer<ScenarioLVAtmosphericFlightType>(ScenarioLVAtmosphericFlightType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ExoatmosphericFlight"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ExoatmosphericFlight"));
+        return false;
+    }
+    m_ExoatmosphericFlight = QSharedPointer<ScenarioLVExoatmosphericFlightType>(ScenarioLVExoatmosphericFlightType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TrajectoryConstraints"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TrajectoryConstraints"));
+        return false;
+    }
+    m_TrajectoryConstraints = QSharedPointer<ScenarioLVTrajectoryConstraintsType>(ScenarioLVTrajectoryConstraintsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVTrajectoryType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_TakeOff.isNull())
+    {
+        QString tagName = "TakeOff";
+        m_TakeOff->writeElement(writer, tagName);
+    }
+    if (!m_Ignitions.isNull())
+    {
+        QString tagName = "Ignitions";
+        m_Ignitions->writeElement(writer, tagName);
+    }
+    if (!m_AtmosphericFlight.isNull())
+    {
+        QString tagName = "AtmosphericFlight";
+        m_AtmosphericFlight->writeElement(writer, tagName);
+    }
+    if (!m_ExoatmosphericFlight.isNull())
+    {
+        QString tagName = "ExoatmosphericFlight";
+        m_ExoatmosphericFlight->writeElement(writer, tagName);
+    }
+    if (!m_TrajectoryConstraints.isNull())
+    {
+        QString tagName = "TrajectoryConstraints";
+        m_TrajectoryConstraints->writeElement(writer, tagName);
+    }
+}
+
+QList<QSharedPointer<ScenarioObject> >ScenarioLVTrajectoryType::children() const
+{
+    QList<QSharedPointer<ScenarioObject> > children;
+    if (!m_TakeOff.isNull()) children << m_TakeOff;
+    if (!m_Ignitions.isNull()) children << m_Ignitions;
+    if (!m_AtmosphericFlight.isNull()) children << m_AtmosphericFlight;
+    if (!m_ExoatmosphericFlight.isNull()) children << m_ExoatmosphericFlight;
+    if (!m_TrajectoryConstraints.isNull()) children << m_TrajectoryConstraints;
+    return children;
+}
+
+
+
+
+// ScenarioLVProgramCostFactorsType
+ScenarioLVProgramCostFactorsType::ScenarioLVProgramCostFactorsType() :
+    m_f0(0.0),
+    m_f1(0.0),
+    m_f3(0.0),
+    m_f7(0.0)
+{
+}
+
+ScenarioLVProgramCostFactorsType* ScenarioLVProgramCostFactorsType::create(const QDomElement& e)
 {
     ScenarioLVProgramCostFactorsType* v;
     {
@@ -4978,6 +9862,86 @@ QDomElement ScenarioLVProgramCostFactorsType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioLVProgramCostFactorsType* ScenarioLVProgramCostFactorsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVProgramCostFactorsType* v = new ScenarioLVProgramCostFactorsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVProgramCostFactorsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:f0"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:f0"));
+        return false;
+    }
+    m_f0 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:launcherDesignComplexity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:launcherDesignComplexity"));
+        return false;
+    }
+    m_launcherDesignComplexity = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:f1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:f1"));
+        return false;
+    }
+    m_f1 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:teamExpertise"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:teamExpertise"));
+        return false;
+    }
+    m_teamExpertise = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:f3"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:f3"));
+        return false;
+    }
+    m_f3 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:contractorsStructure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:contractorsStructure"));
+        return false;
+    }
+    m_contractorsStructure = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:f7"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:f7"));
+        return false;
+    }
+    m_f7 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVProgramCostFactorsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:f0", m_f0);
+    writeSimpleElement(writer, "tns:launcherDesignComplexity", m_launcherDesignComplexity);
+    writeSimpleElement(writer, "tns:f1", m_f1);
+    writeSimpleElement(writer, "tns:teamExpertise", m_teamExpertise);
+    writeSimpleElement(writer, "tns:f3", m_f3);
+    writeSimpleElement(writer, "tns:contractorsStructure", m_contractorsStructure);
+    writeSimpleElement(writer, "tns:f7", m_f7);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVProgramCostFactorsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5040,6 +10004,78 @@ QDomElement ScenarioLVPayloadType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioLVPayloadType* ScenarioLVPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPayloadType* v = new ScenarioLVPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:mass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mass"));
+        return false;
+    }
+    m_mass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:length"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:length"));
+        return false;
+    }
+    m_length = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:diameter"));
+        return false;
+    }
+    m_diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoGLongPosition"));
+        return false;
+    }
+    m_CoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxAxialAcc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxAxialAcc"));
+        return false;
+    }
+    m_maxAxialAcc = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxHeatFlux"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxHeatFlux"));
+        return false;
+    }
+    m_maxHeatFlux = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:mass", m_mass);
+    writeSimpleElement(writer, "tns:length", m_length);
+    writeSimpleElement(writer, "tns:diameter", m_diameter);
+    writeSimpleElement(writer, "tns:CoGLongPosition", m_CoGLongPosition);
+    writeSimpleElement(writer, "tns:maxAxialAcc", m_maxAxialAcc);
+    writeSimpleElement(writer, "tns:maxHeatFlux", m_maxHeatFlux);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5092,6 +10128,55 @@ QDomElement ScenarioLVLaunchSiteType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioLVLaunchSiteType* ScenarioLVLaunchSiteType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVLaunchSiteType* v = new ScenarioLVLaunchSiteType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVLaunchSiteType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:GroundPosition"))
+        m_Abstract3DOFPosition = QSharedPointer<ScenarioAbstract3DOFPositionType>((ScenarioAbstract3DOFPositionType*)ScenarioGroundPositionType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract3DOFPosition"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:allowedAzimuths"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:allowedAzimuths"));
+        return false;
+    }
+    m_allowedAzimuths = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVLaunchSiteType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Abstract3DOFPosition.isNull())
+    {
+        QString tagName = "Abstract3DOFPosition";
+        if (dynamic_cast<ScenarioGroundPositionType*>(m_Abstract3DOFPosition.data()))
+            tagName = "GroundPosition";
+        m_Abstract3DOFPosition->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:allowedAzimuths", m_allowedAzimuths);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVLaunchSiteType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5155,6 +10240,78 @@ QDomElement ScenarioLVTargetOrbitType::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
+ScenarioLVTargetOrbitType* ScenarioLVTargetOrbitType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVTargetOrbitType* v = new ScenarioLVTargetOrbitType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVTargetOrbitType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:semiaxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:semiaxis"));
+        return false;
+    }
+    m_semiaxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:eccentricity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:eccentricity"));
+        return false;
+    }
+    m_eccentricity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:inclination"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:inclination"));
+        return false;
+    }
+    m_inclination = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:semiaxisTol"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:semiaxisTol"));
+        return false;
+    }
+    m_semiaxisTol = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:eccentricityTol"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:eccentricityTol"));
+        return false;
+    }
+    m_eccentricityTol = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:inclinationTol"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:inclinationTol"));
+        return false;
+    }
+    m_inclinationTol = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVTargetOrbitType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:semiaxis", m_semiaxis);
+    writeSimpleElement(writer, "tns:eccentricity", m_eccentricity);
+    writeSimpleElement(writer, "tns:inclination", m_inclination);
+    writeSimpleElement(writer, "tns:semiaxisTol", m_semiaxisTol);
+    writeSimpleElement(writer, "tns:eccentricityTol", m_eccentricityTol);
+    writeSimpleElement(writer, "tns:inclinationTol", m_inclinationTol);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVTargetOrbitType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5233,6 +10390,86 @@ QDomElement ScenarioLVArchitectureType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioLVArchitectureType* ScenarioLVArchitectureType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVArchitectureType* v = new ScenarioLVArchitectureType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVArchitectureType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:boosterConf"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:boosterConf"));
+        return false;
+    }
+    m_boosterConf = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nStages"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nStages"));
+        return false;
+    }
+    m_nStages = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nBoosters"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nBoosters"));
+        return false;
+    }
+    m_nBoosters = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:singleEngineType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:singleEngineType"));
+        return false;
+    }
+    m_singleEngineType = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVArchitectureType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_boosterConf.isNull())
+    {
+        QString tagName = "boosterConf";
+        m_boosterConf->writeElement(writer, tagName);
+    }
+    if (!m_nStages.isNull())
+    {
+        QString tagName = "nStages";
+        m_nStages->writeElement(writer, tagName);
+    }
+    if (!m_nBoosters.isNull())
+    {
+        QString tagName = "nBoosters";
+        m_nBoosters->writeElement(writer, tagName);
+    }
+    if (!m_singleEngineType.isNull())
+    {
+        QString tagName = "singleEngineType";
+        m_singleEngineType->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVArchitectureType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5315,6 +10552,86 @@ QDomElement ScenarioLVPlFairingType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioLVPlFairingType* ScenarioLVPlFairingType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPlFairingType* v = new ScenarioLVPlFairingType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPlFairingType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Geometry"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Geometry"));
+        return false;
+    }
+    m_Geometry = QSharedPointer<ScenarioLVGeometryType>(ScenarioLVGeometryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentWeights"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentWeights"));
+        return false;
+    }
+    m_ComponentWeights = QSharedPointer<ScenarioLVComponentWeightsType>(ScenarioLVComponentWeightsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentCosts"));
+        return false;
+    }
+    m_ComponentCosts = QSharedPointer<ScenarioLVComponentCostsType>(ScenarioLVComponentCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentReliability"));
+        return false;
+    }
+    m_ComponentReliability = QSharedPointer<ScenarioLVComponentReliabilityType>(ScenarioLVComponentReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPlFairingType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Geometry.isNull())
+    {
+        QString tagName = "Geometry";
+        m_Geometry->writeElement(writer, tagName);
+    }
+    if (!m_ComponentWeights.isNull())
+    {
+        QString tagName = "ComponentWeights";
+        m_ComponentWeights->writeElement(writer, tagName);
+    }
+    if (!m_ComponentCosts.isNull())
+    {
+        QString tagName = "ComponentCosts";
+        m_ComponentCosts->writeElement(writer, tagName);
+    }
+    if (!m_ComponentReliability.isNull())
+    {
+        QString tagName = "ComponentReliability";
+        m_ComponentReliability->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPlFairingType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5407,6 +10724,100 @@ QDomElement ScenarioLVLowerStageType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioLVLowerStageType* ScenarioLVLowerStageType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVLowerStageType* v = new ScenarioLVLowerStageType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVLowerStageType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Geometry"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Geometry"));
+        return false;
+    }
+    m_Geometry = QSharedPointer<ScenarioLVGeometryType>(ScenarioLVGeometryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropulsionSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropulsionSystem"));
+        return false;
+    }
+    m_PropulsionSystem = QSharedPointer<ScenarioLVPropulsionSystemType>(ScenarioLVPropulsionSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentWeights"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentWeights"));
+        return false;
+    }
+    m_ComponentWeights = QSharedPointer<ScenarioLVComponentWeightsType>(ScenarioLVComponentWeightsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentCosts"));
+        return false;
+    }
+    m_ComponentCosts = QSharedPointer<ScenarioLVComponentCostsType>(ScenarioLVComponentCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentReliability"));
+        return false;
+    }
+    m_ComponentReliability = QSharedPointer<ScenarioLVComponentReliabilityType>(ScenarioLVComponentReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVLowerStageType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Geometry.isNull())
+    {
+        QString tagName = "Geometry";
+        m_Geometry->writeElement(writer, tagName);
+    }
+    if (!m_PropulsionSystem.isNull())
+    {
+        QString tagName = "PropulsionSystem";
+        m_PropulsionSystem->writeElement(writer, tagName);
+    }
+    if (!m_ComponentWeights.isNull())
+    {
+        QString tagName = "ComponentWeights";
+        m_ComponentWeights->writeElement(writer, tagName);
+    }
+    if (!m_ComponentCosts.isNull())
+    {
+        QString tagName = "ComponentCosts";
+        m_ComponentCosts->writeElement(writer, tagName);
+    }
+    if (!m_ComponentReliability.isNull())
+    {
+        QString tagName = "ComponentReliability";
+        m_ComponentReliability->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVLowerStageType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5500,6 +10911,100 @@ QDomElement ScenarioLVUpperStageType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioLVUpperStageType* ScenarioLVUpperStageType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVUpperStageType* v = new ScenarioLVUpperStageType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVUpperStageType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Geometry"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Geometry"));
+        return false;
+    }
+    m_Geometry = QSharedPointer<ScenarioLVGeometryType>(ScenarioLVGeometryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropulsionSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropulsionSystem"));
+        return false;
+    }
+    m_PropulsionSystem = QSharedPointer<ScenarioLVPropulsionSystemType>(ScenarioLVPropulsionSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentWeights"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentWeights"));
+        return false;
+    }
+    m_ComponentWeights = QSharedPointer<ScenarioLVComponentWeightsType>(ScenarioLVComponentWeightsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentCosts"));
+        return false;
+    }
+    m_ComponentCosts = QSharedPointer<ScenarioLVComponentCostsType>(ScenarioLVComponentCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentReliability"));
+        return false;
+    }
+    m_ComponentReliability = QSharedPointer<ScenarioLVComponentReliabilityType>(ScenarioLVComponentReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVUpperStageType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Geometry.isNull())
+    {
+        QString tagName = "Geometry";
+        m_Geometry->writeElement(writer, tagName);
+    }
+    if (!m_PropulsionSystem.isNull())
+    {
+        QString tagName = "PropulsionSystem";
+        m_PropulsionSystem->writeElement(writer, tagName);
+    }
+    if (!m_ComponentWeights.isNull())
+    {
+        QString tagName = "ComponentWeights";
+        m_ComponentWeights->writeElement(writer, tagName);
+    }
+    if (!m_ComponentCosts.isNull())
+    {
+        QString tagName = "ComponentCosts";
+        m_ComponentCosts->writeElement(writer, tagName);
+    }
+    if (!m_ComponentReliability.isNull())
+    {
+        QString tagName = "ComponentReliability";
+        m_ComponentReliability->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVUpperStageType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5593,6 +11098,100 @@ QDomElement ScenarioLVBoostersType::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioLVBoostersType* ScenarioLVBoostersType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVBoostersType* v = new ScenarioLVBoostersType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVBoostersType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Geometry"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Geometry"));
+        return false;
+    }
+    m_Geometry = QSharedPointer<ScenarioLVGeometryType>(ScenarioLVGeometryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropulsionSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropulsionSystem"));
+        return false;
+    }
+    m_PropulsionSystem = QSharedPointer<ScenarioLVPropulsionSystemType>(ScenarioLVPropulsionSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentWeights"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentWeights"));
+        return false;
+    }
+    m_ComponentWeights = QSharedPointer<ScenarioLVComponentWeightsType>(ScenarioLVComponentWeightsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentCosts"));
+        return false;
+    }
+    m_ComponentCosts = QSharedPointer<ScenarioLVComponentCostsType>(ScenarioLVComponentCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ComponentReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ComponentReliability"));
+        return false;
+    }
+    m_ComponentReliability = QSharedPointer<ScenarioLVComponentReliabilityType>(ScenarioLVComponentReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVBoostersType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Geometry.isNull())
+    {
+        QString tagName = "Geometry";
+        m_Geometry->writeElement(writer, tagName);
+    }
+    if (!m_PropulsionSystem.isNull())
+    {
+        QString tagName = "PropulsionSystem";
+        m_PropulsionSystem->writeElement(writer, tagName);
+    }
+    if (!m_ComponentWeights.isNull())
+    {
+        QString tagName = "ComponentWeights";
+        m_ComponentWeights->writeElement(writer, tagName);
+    }
+    if (!m_ComponentCosts.isNull())
+    {
+        QString tagName = "ComponentCosts";
+        m_ComponentCosts->writeElement(writer, tagName);
+    }
+    if (!m_ComponentReliability.isNull())
+    {
+        QString tagName = "ComponentReliability";
+        m_ComponentReliability->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVBoostersType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5636,6 +11235,30 @@ QDomElement ScenarioLVSystemConstraintsType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioLVSystemConstraintsType* ScenarioLVSystemConstraintsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVSystemConstraintsType* v = new ScenarioLVSystemConstraintsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVSystemConstraintsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioLVSystemConstraintsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVSystemConstraintsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -5751,80 +11374,356 @@ bool ScenarioLVPropulsionSystemSystemType::load(const QDomElement& e, QDomElemen
     return true;
 }
 
-QDomElement ScenarioLVPropulsionSystemSystemType::toDomElement(QDomDocument& doc, const QString& elementName) const
+QDomElement ScenarioLVPropulsionSystemSystemType::toDomElement(QDomDocument& doc, const QString& elementName) const
+{
+    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    if (!m_propType.isNull())
+    {
+        QString tagName = "propType";
+        QDomElement child = m_propType->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:fuelType", m_fuelType));
+    e.appendChild(createSimpleElement(doc, "tns:oxType", m_oxType));
+    if (!m_numberOfEngines.isNull())
+    {
+        QString tagName = "numberOfEngines";
+        QDomElement child = m_numberOfEngines->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_nominalThrust.isNull())
+    {
+        QString tagName = "nominalThrust";
+        QDomElement child = m_nominalThrust->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:nominalThrustPerEngine", m_nominalThrustPerEngine));
+    e.appendChild(createSimpleElement(doc, "tns:engineWerMass", m_engineWerMass));
+    e.appendChild(createSimpleElement(doc, "tns:totalEngineDryMass", m_totalEngineDryMass));
+    e.appendChild(createSimpleElement(doc, "tns:totalPropSysDryMass", m_totalPropSysDryMass));
+    if (!m_propMass.isNull())
+    {
+        QString tagName = "propMass";
+        QDomElement child = m_propMass->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:totalEngineLength", m_totalEngineLength));
+    e.appendChild(createSimpleElement(doc, "tns:engineCoGLongPosition", m_engineCoGLongPosition));
+    if (!m_offTheShelf.isNull())
+    {
+        QString tagName = "offTheShelf";
+        QDomElement child = m_offTheShelf->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_offTheShelfEngineId.isNull())
+    {
+        QString tagName = "offTheShelfEngineId";
+        QDomElement child = m_offTheShelfEngineId->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:offTheShelfEngineName", m_offTheShelfEngineName));
+    if (!m_feedType.isNull())
+    {
+        QString tagName = "feedType";
+        QDomElement child = m_feedType->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:coolingType", m_coolingType));
+    if (!m_mixtureRatio.isNull())
+    {
+        QString tagName = "mixtureRatio";
+        QDomElement child = m_mixtureRatio->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_nozzleOptAlt.isNull())
+    {
+        QString tagName = "nozzleOptAlt";
+        QDomElement child = m_nozzleOptAlt->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:pccOverPa", m_pccOverPa));
+    e.appendChild(createSimpleElement(doc, "tns:paOptAlt", m_paOptAlt));
+    e.appendChild(createSimpleElement(doc, "tns:spFillingFactorCstrViolation", m_spFillingFactorCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:thrustRangeCstrViolation", m_thrustRangeCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:maxNenginesCstrViolation", m_maxNenginesCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:ceaExecutionFailureViolation", m_ceaExecutionFailureViolation));
+    return e;
+}
+
+ScenarioLVPropulsionSystemSystemType* ScenarioLVPropulsionSystemSystemType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemSystemType* v = new ScenarioLVPropulsionSystemSystemType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemSystemType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:propType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propType"));
+        return false;
+    }
+    m_propType = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fuelType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fuelType"));
+        return false;
+    }
+    m_fuelType = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:oxType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:oxType"));
+        return false;
+    }
+    m_oxType = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:numberOfEngines"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:numberOfEngines"));
+        return false;
+    }
+    m_numberOfEngines = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nominalThrust"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nominalThrust"));
+        return false;
+    }
+    m_nominalThrust = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nominalThrustPerEngine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nominalThrustPerEngine"));
+        return false;
+    }
+    m_nominalThrustPerEngine = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:engineWerMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:engineWerMass"));
+        return false;
+    }
+    m_engineWerMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalEngineDryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalEngineDryMass"));
+        return false;
+    }
+    m_totalEngineDryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalPropSysDryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalPropSysDryMass"));
+        return false;
+    }
+    m_totalPropSysDryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:propMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propMass"));
+        return false;
+    }
+    m_propMass = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalEngineLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalEngineLength"));
+        return false;
+    }
+    m_totalEngineLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:engineCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:engineCoGLongPosition"));
+        return false;
+    }
+    m_engineCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:offTheShelf"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:offTheShelf"));
+        return false;
+    }
+    m_offTheShelf = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:offTheShelfEngineId"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:offTheShelfEngineId"));
+        return false;
+    }
+    m_offTheShelfEngineId = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:offTheShelfEngineName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:offTheShelfEngineName"));
+        return false;
+    }
+    m_offTheShelfEngineName = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:feedType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:feedType"));
+        return false;
+    }
+    m_feedType = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:coolingType"))
+    {
+        m_coolingType = reader.readElementText();
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:mixtureRatio"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mixtureRatio"));
+        return false;
+    }
+    m_mixtureRatio = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleOptAlt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleOptAlt"));
+        return false;
+    }
+    m_nozzleOptAlt = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:pccOverPa"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:pccOverPa"));
+        return false;
+    }
+    m_pccOverPa = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:paOptAlt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:paOptAlt"));
+        return false;
+    }
+    m_paOptAlt = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:spFillingFactorCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:spFillingFactorCstrViolation"));
+        return false;
+    }
+    m_spFillingFactorCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:thrustRangeCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thrustRangeCstrViolation"));
+        return false;
+    }
+    m_thrustRangeCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxNenginesCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxNenginesCstrViolation"));
+        return false;
+    }
+    m_maxNenginesCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ceaExecutionFailureViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ceaExecutionFailureViolation"));
+        return false;
+    }
+    m_ceaExecutionFailureViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemSystemType::writeContents(QXmlStreamWriter& writer) const
 {
-    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    ScenarioObject::writeContents(writer);
     if (!m_propType.isNull())
     {
         QString tagName = "propType";
-        QDomElement child = m_propType->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_propType->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:fuelType", m_fuelType));
-    e.appendChild(createSimpleElement(doc, "tns:oxType", m_oxType));
+    writeSimpleElement(writer, "tns:fuelType", m_fuelType);
+    writeSimpleElement(writer, "tns:oxType", m_oxType);
     if (!m_numberOfEngines.isNull())
     {
         QString tagName = "numberOfEngines";
-        QDomElement child = m_numberOfEngines->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_numberOfEngines->writeElement(writer, tagName);
     }
     if (!m_nominalThrust.isNull())
     {
         QString tagName = "nominalThrust";
-        QDomElement child = m_nominalThrust->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_nominalThrust->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:nominalThrustPerEngine", m_nominalThrustPerEngine));
-    e.appendChild(createSimpleElement(doc, "tns:engineWerMass", m_engineWerMass));
-    e.appendChild(createSimpleElement(doc, "tns:totalEngineDryMass", m_totalEngineDryMass));
-    e.appendChild(createSimpleElement(doc, "tns:totalPropSysDryMass", m_totalPropSysDryMass));
+    writeSimpleElement(writer, "tns:nominalThrustPerEngine", m_nominalThrustPerEngine);
+    writeSimpleElement(writer, "tns:engineWerMass", m_engineWerMass);
+    writeSimpleElement(writer, "tns:totalEngineDryMass", m_totalEngineDryMass);
+    writeSimpleElement(writer, "tns:totalPropSysDryMass", m_totalPropSysDryMass);
     if (!m_propMass.isNull())
     {
         QString tagName = "propMass";
-        QDomElement child = m_propMass->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_propMass->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:totalEngineLength", m_totalEngineLength));
-    e.appendChild(createSimpleElement(doc, "tns:engineCoGLongPosition", m_engineCoGLongPosition));
+    writeSimpleElement(writer, "tns:totalEngineLength", m_totalEngineLength);
+    writeSimpleElement(writer, "tns:engineCoGLongPosition", m_engineCoGLongPosition);
     if (!m_offTheShelf.isNull())
     {
         QString tagName = "offTheShelf";
-        QDomElement child = m_offTheShelf->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_offTheShelf->writeElement(writer, tagName);
     }
     if (!m_offTheShelfEngineId.isNull())
     {
         QString tagName = "offTheShelfEngineId";
-        QDomElement child = m_offTheShelfEngineId->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_offTheShelfEngineId->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:offTheShelfEngineName", m_offTheShelfEngineName));
+    writeSimpleElement(writer, "tns:offTheShelfEngineName", m_offTheShelfEngineName);
     if (!m_feedType.isNull())
     {
         QString tagName = "feedType";
-        QDomElement child = m_feedType->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_feedType->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:coolingType", m_coolingType));
+    writeSimpleElement(writer, "tns:coolingType", m_coolingType);
     if (!m_mixtureRatio.isNull())
     {
         QString tagName = "mixtureRatio";
-        QDomElement child = m_mixtureRatio->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_mixtureRatio->writeElement(writer, tagName);
     }
     if (!m_nozzleOptAlt.isNull())
     {
         QString tagName = "nozzleOptAlt";
-        QDomElement child = m_nozzleOptAlt->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_nozzleOptAlt->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:pccOverPa", m_pccOverPa));
-    e.appendChild(createSimpleElement(doc, "tns:paOptAlt", m_paOptAlt));
-    e.appendChild(createSimpleElement(doc, "tns:spFillingFactorCstrViolation", m_spFillingFactorCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:thrustRangeCstrViolation", m_thrustRangeCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:maxNenginesCstrViolation", m_maxNenginesCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:ceaExecutionFailureViolation", m_ceaExecutionFailureViolation));
-    return e;
+    writeSimpleElement(writer, "tns:pccOverPa", m_pccOverPa);
+    writeSimpleElement(writer, "tns:paOptAlt", m_paOptAlt);
+    writeSimpleElement(writer, "tns:spFillingFactorCstrViolation", m_spFillingFactorCstrViolation);
+    writeSimpleElement(writer, "tns:thrustRangeCstrViolation", m_thrustRangeCstrViolation);
+    writeSimpleElement(writer, "tns:maxNenginesCstrViolation", m_maxNenginesCstrViolation);
+    writeSimpleElement(writer, "tns:ceaExecutionFailureViolation", m_ceaExecutionFailureViolation);
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemSystemType::children() const
@@ -5928,6 +11827,132 @@ QDomElement ScenarioLVPropulsionSystemLiquidTanksType::toDomElement(QDomDocument
     return e;
 }
 
+ScenarioLVPropulsionSystemLiquidTanksType* ScenarioLVPropulsionSystemLiquidTanksType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemLiquidTanksType* v = new ScenarioLVPropulsionSystemLiquidTanksType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemLiquidTanksType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:tanksPressureNorm"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tanksPressureNorm"));
+        return false;
+    }
+    m_tanksPressureNorm = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tanksPressure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tanksPressure"));
+        return false;
+    }
+    m_tanksPressure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:oxTankLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:oxTankLength"));
+        return false;
+    }
+    m_oxTankLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:oxTankDiam"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:oxTankDiam"));
+        return false;
+    }
+    m_oxTankDiam = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:oxTankPressure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:oxTankPressure"));
+        return false;
+    }
+    m_oxTankPressure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:oxMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:oxMass"));
+        return false;
+    }
+    m_oxMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:oxTankVolume"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:oxTankVolume"));
+        return false;
+    }
+    m_oxTankVolume = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fuelTankLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fuelTankLength"));
+        return false;
+    }
+    m_fuelTankLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fuelTankDiam"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fuelTankDiam"));
+        return false;
+    }
+    m_fuelTankDiam = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fuelTankPressure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fuelTankPressure"));
+        return false;
+    }
+    m_fuelTankPressure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fuelMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fuelMass"));
+        return false;
+    }
+    m_fuelMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fuelTankVolume"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fuelTankVolume"));
+        return false;
+    }
+    m_fuelTankVolume = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemLiquidTanksType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_tanksPressureNorm.isNull())
+    {
+        QString tagName = "tanksPressureNorm";
+        m_tanksPressureNorm->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:tanksPressure", m_tanksPressure);
+    writeSimpleElement(writer, "tns:oxTankLength", m_oxTankLength);
+    writeSimpleElement(writer, "tns:oxTankDiam", m_oxTankDiam);
+    writeSimpleElement(writer, "tns:oxTankPressure", m_oxTankPressure);
+    writeSimpleElement(writer, "tns:oxMass", m_oxMass);
+    writeSimpleElement(writer, "tns:oxTankVolume", m_oxTankVolume);
+    writeSimpleElement(writer, "tns:fuelTankLength", m_fuelTankLength);
+    writeSimpleElement(writer, "tns:fuelTankDiam", m_fuelTankDiam);
+    writeSimpleElement(writer, "tns:fuelTankPressure", m_fuelTankPressure);
+    writeSimpleElement(writer, "tns:fuelMass", m_fuelMass);
+    writeSimpleElement(writer, "tns:fuelTankVolume", m_fuelTankVolume);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemLiquidTanksType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6012,6 +12037,106 @@ QDomElement ScenarioLVPropulsionSystemSolidGrainType::toDomElement(QDomDocument&
     return e;
 }
 
+ScenarioLVPropulsionSystemSolidGrainType* ScenarioLVPropulsionSystemSolidGrainType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemSolidGrainType* v = new ScenarioLVPropulsionSystemSolidGrainType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemSolidGrainType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:abOverAt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:abOverAt"));
+        return false;
+    }
+    m_abOverAt = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:ab"))
+    {
+        m_ab = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:grainLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:grainLength"));
+        return false;
+    }
+    m_grainLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:grainDiam"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:grainDiam"));
+        return false;
+    }
+    m_grainDiam = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:igniterLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:igniterLength"));
+        return false;
+    }
+    m_igniterLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:igniterDiam"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:igniterDiam"));
+        return false;
+    }
+    m_igniterDiam = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:igniterMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:igniterMass"));
+        return false;
+    }
+    m_igniterMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:sliverMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:sliverMass"));
+        return false;
+    }
+    m_sliverMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:cavityVolume"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:cavityVolume"));
+        return false;
+    }
+    m_cavityVolume = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemSolidGrainType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_abOverAt.isNull())
+    {
+        QString tagName = "abOverAt";
+        m_abOverAt->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:ab", m_ab);
+    writeSimpleElement(writer, "tns:grainLength", m_grainLength);
+    writeSimpleElement(writer, "tns:grainDiam", m_grainDiam);
+    writeSimpleElement(writer, "tns:igniterLength", m_igniterLength);
+    writeSimpleElement(writer, "tns:igniterDiam", m_igniterDiam);
+    writeSimpleElement(writer, "tns:igniterMass", m_igniterMass);
+    writeSimpleElement(writer, "tns:sliverMass", m_sliverMass);
+    writeSimpleElement(writer, "tns:cavityVolume", m_cavityVolume);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemSolidGrainType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6099,6 +12224,94 @@ QDomElement ScenarioLVPropulsionSystemFeedSystemType::toDomElement(QDomDocument&
     return e;
 }
 
+ScenarioLVPropulsionSystemFeedSystemType* ScenarioLVPropulsionSystemFeedSystemType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemFeedSystemType* v = new ScenarioLVPropulsionSystemFeedSystemType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemFeedSystemType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:pressurizerTankPressure"))
+    {
+        m_pressurizerTankPressure = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:pressurizerTankRadius"))
+    {
+        m_pressurizerTankRadius = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:pressurizerTankMass"))
+    {
+        m_pressurizerTankMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:pressurizerGasMass"))
+    {
+        m_pressurizerGasMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:linesValvesMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:linesValvesMass"));
+        return false;
+    }
+    m_linesValvesMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:trappedPropMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:trappedPropMass"));
+        return false;
+    }
+    m_trappedPropMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalFeedSystemMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalFeedSystemMass"));
+        return false;
+    }
+    m_totalFeedSystemMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalFeedSystemLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalFeedSystemLength"));
+        return false;
+    }
+    m_totalFeedSystemLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalFeedSystemDiameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalFeedSystemDiameter"));
+        return false;
+    }
+    m_totalFeedSystemDiameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemFeedSystemType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:pressurizerTankPressure", m_pressurizerTankPressure);
+    writeSimpleElement(writer, "tns:pressurizerTankRadius", m_pressurizerTankRadius);
+    writeSimpleElement(writer, "tns:pressurizerTankMass", m_pressurizerTankMass);
+    writeSimpleElement(writer, "tns:pressurizerGasMass", m_pressurizerGasMass);
+    writeSimpleElement(writer, "tns:linesValvesMass", m_linesValvesMass);
+    writeSimpleElement(writer, "tns:trappedPropMass", m_trappedPropMass);
+    writeSimpleElement(writer, "tns:totalFeedSystemMass", m_totalFeedSystemMass);
+    writeSimpleElement(writer, "tns:totalFeedSystemLength", m_totalFeedSystemLength);
+    writeSimpleElement(writer, "tns:totalFeedSystemDiameter", m_totalFeedSystemDiameter);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemFeedSystemType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6193,6 +12406,98 @@ QDomElement ScenarioLVPropulsionSystemCombustionChamberType::toDomElement(QDomDo
     return e;
 }
 
+ScenarioLVPropulsionSystemCombustionChamberType* ScenarioLVPropulsionSystemCombustionChamberType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemCombustionChamberType* v = new ScenarioLVPropulsionSystemCombustionChamberType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemCombustionChamberType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:accOverAt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:accOverAt"));
+        return false;
+    }
+    m_accOverAt = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:acc"))
+    {
+        m_acc = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:chamberPressureNorm"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:chamberPressureNorm"));
+        return false;
+    }
+    m_chamberPressureNorm = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:chamberPressure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:chamberPressure"));
+        return false;
+    }
+    m_chamberPressure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:chamberCharactLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:chamberCharactLength"));
+        return false;
+    }
+    m_chamberCharactLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:chamberLength"))
+    {
+        m_chamberLength = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:chamberDiameter"))
+    {
+        m_chamberDiameter = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:chamberMass"))
+    {
+        m_chamberMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemCombustionChamberType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_accOverAt.isNull())
+    {
+        QString tagName = "accOverAt";
+        m_accOverAt->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:acc", m_acc);
+    if (!m_chamberPressureNorm.isNull())
+    {
+        QString tagName = "chamberPressureNorm";
+        m_chamberPressureNorm->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:chamberPressure", m_chamberPressure);
+    writeSimpleElement(writer, "tns:chamberCharactLength", m_chamberCharactLength);
+    writeSimpleElement(writer, "tns:chamberLength", m_chamberLength);
+    writeSimpleElement(writer, "tns:chamberDiameter", m_chamberDiameter);
+    writeSimpleElement(writer, "tns:chamberMass", m_chamberMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemCombustionChamberType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6278,46 +12583,222 @@ bool ScenarioLVPropulsionSystemNozzleType::load(const QDomElement& e, QDomElemen
     return true;
 }
 
-QDomElement ScenarioLVPropulsionSystemNozzleType::toDomElement(QDomDocument& doc, const QString& elementName) const
+QDomElement ScenarioLVPropulsionSystemNozzleType::toDomElement(QDomDocument& doc, const QString& elementName) const
+{
+    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    e.appendChild(createSimpleElement(doc, "tns:at", m_at));
+    e.appendChild(createSimpleElement(doc, "tns:ae", m_ae));
+    e.appendChild(createSimpleElement(doc, "tns:aeOverat", m_aeOverat));
+    e.appendChild(createSimpleElement(doc, "tns:throatDiameter", m_throatDiameter));
+    e.appendChild(createSimpleElement(doc, "tns:nozzleDiameter", m_nozzleDiameter));
+    e.appendChild(createSimpleElement(doc, "tns:convLength", m_convLength));
+    e.appendChild(createSimpleElement(doc, "tns:divLength", m_divLength));
+    e.appendChild(createSimpleElement(doc, "tns:nozzleLength", m_nozzleLength));
+    e.appendChild(createSimpleElement(doc, "tns:nozzleMass", m_nozzleMass));
+    if (!m_nozzleType.isNull())
+    {
+        QString tagName = "nozzleType";
+        QDomElement child = m_nozzleType->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_divAngle.isNull())
+    {
+        QString tagName = "divAngle";
+        QDomElement child = m_divAngle->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_tvcType.isNull())
+    {
+        QString tagName = "tvcType";
+        QDomElement child = m_tvcType->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_tvcAngle.isNull())
+    {
+        QString tagName = "tvcAngle";
+        QDomElement child = m_tvcAngle->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:tvcMass", m_tvcMass));
+    e.appendChild(createSimpleElement(doc, "tns:nozzleCantAngle", m_nozzleCantAngle));
+    e.appendChild(createSimpleElement(doc, "tns:nozzleShape", m_nozzleShape));
+    return e;
+}
+
+ScenarioLVPropulsionSystemNozzleType* ScenarioLVPropulsionSystemNozzleType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemNozzleType* v = new ScenarioLVPropulsionSystemNozzleType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemNozzleType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:at"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:at"));
+        return false;
+    }
+    m_at = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ae"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ae"));
+        return false;
+    }
+    m_ae = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:aeOverat"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:aeOverat"));
+        return false;
+    }
+    m_aeOverat = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:throatDiameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:throatDiameter"));
+        return false;
+    }
+    m_throatDiameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleDiameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleDiameter"));
+        return false;
+    }
+    m_nozzleDiameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:convLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:convLength"));
+        return false;
+    }
+    m_convLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:divLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:divLength"));
+        return false;
+    }
+    m_divLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleLength"));
+        return false;
+    }
+    m_nozzleLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleMass"));
+        return false;
+    }
+    m_nozzleMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleType"));
+        return false;
+    }
+    m_nozzleType = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:divAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:divAngle"));
+        return false;
+    }
+    m_divAngle = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tvcType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tvcType"));
+        return false;
+    }
+    m_tvcType = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tvcAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tvcAngle"));
+        return false;
+    }
+    m_tvcAngle = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tvcMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tvcMass"));
+        return false;
+    }
+    m_tvcMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleCantAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleCantAngle"));
+        return false;
+    }
+    m_nozzleCantAngle = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleShape"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleShape"));
+        return false;
+    }
+    m_nozzleShape = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemNozzleType::writeContents(QXmlStreamWriter& writer) const
 {
-    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
-    e.appendChild(createSimpleElement(doc, "tns:at", m_at));
-    e.appendChild(createSimpleElement(doc, "tns:ae", m_ae));
-    e.appendChild(createSimpleElement(doc, "tns:aeOverat", m_aeOverat));
-    e.appendChild(createSimpleElement(doc, "tns:throatDiameter", m_throatDiameter));
-    e.appendChild(createSimpleElement(doc, "tns:nozzleDiameter", m_nozzleDiameter));
-    e.appendChild(createSimpleElement(doc, "tns:convLength", m_convLength));
-    e.appendChild(createSimpleElement(doc, "tns:divLength", m_divLength));
-    e.appendChild(createSimpleElement(doc, "tns:nozzleLength", m_nozzleLength));
-    e.appendChild(createSimpleElement(doc, "tns:nozzleMass", m_nozzleMass));
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:at", m_at);
+    writeSimpleElement(writer, "tns:ae", m_ae);
+    writeSimpleElement(writer, "tns:aeOverat", m_aeOverat);
+    writeSimpleElement(writer, "tns:throatDiameter", m_throatDiameter);
+    writeSimpleElement(writer, "tns:nozzleDiameter", m_nozzleDiameter);
+    writeSimpleElement(writer, "tns:convLength", m_convLength);
+    writeSimpleElement(writer, "tns:divLength", m_divLength);
+    writeSimpleElement(writer, "tns:nozzleLength", m_nozzleLength);
+    writeSimpleElement(writer, "tns:nozzleMass", m_nozzleMass);
     if (!m_nozzleType.isNull())
     {
         QString tagName = "nozzleType";
-        QDomElement child = m_nozzleType->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_nozzleType->writeElement(writer, tagName);
     }
     if (!m_divAngle.isNull())
     {
         QString tagName = "divAngle";
-        QDomElement child = m_divAngle->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_divAngle->writeElement(writer, tagName);
     }
     if (!m_tvcType.isNull())
     {
         QString tagName = "tvcType";
-        QDomElement child = m_tvcType->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_tvcType->writeElement(writer, tagName);
     }
     if (!m_tvcAngle.isNull())
     {
         QString tagName = "tvcAngle";
-        QDomElement child = m_tvcAngle->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_tvcAngle->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:tvcMass", m_tvcMass));
-    e.appendChild(createSimpleElement(doc, "tns:nozzleCantAngle", m_nozzleCantAngle));
-    e.appendChild(createSimpleElement(doc, "tns:nozzleShape", m_nozzleShape));
-    return e;
+    writeSimpleElement(writer, "tns:tvcMass", m_tvcMass);
+    writeSimpleElement(writer, "tns:nozzleCantAngle", m_nozzleCantAngle);
+    writeSimpleElement(writer, "tns:nozzleShape", m_nozzleShape);
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemNozzleType::children() const
@@ -6458,6 +12939,210 @@ QDomElement ScenarioLVPropulsionSystemPerformanceType::toDomElement(QDomDocument
     return e;
 }
 
+ScenarioLVPropulsionSystemPerformanceType* ScenarioLVPropulsionSystemPerformanceType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionSystemPerformanceType* v = new ScenarioLVPropulsionSystemPerformanceType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionSystemPerformanceType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:seaThrust"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:seaThrust"));
+        return false;
+    }
+    m_seaThrust = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:seaThrustPerEngine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:seaThrustPerEngine"));
+        return false;
+    }
+    m_seaThrustPerEngine = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:vacuumThrust"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:vacuumThrust"));
+        return false;
+    }
+    m_vacuumThrust = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:vacuumThrustPerEngine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:vacuumThrustPerEngine"));
+        return false;
+    }
+    m_vacuumThrustPerEngine = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:theoOptIsp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:theoOptIsp"));
+        return false;
+    }
+    m_theoOptIsp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:realOptIsp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:realOptIsp"));
+        return false;
+    }
+    m_realOptIsp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:theoSeaIsp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:theoSeaIsp"));
+        return false;
+    }
+    m_theoSeaIsp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:realSeaIsp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:realSeaIsp"));
+        return false;
+    }
+    m_realSeaIsp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:theoVacuumIsp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:theoVacuumIsp"));
+        return false;
+    }
+    m_theoVacuumIsp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:realVacuumIsp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:realVacuumIsp"));
+        return false;
+    }
+    m_realVacuumIsp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:thrustCoeff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thrustCoeff"));
+        return false;
+    }
+    m_thrustCoeff = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:charactVelocity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:charactVelocity"));
+        return false;
+    }
+    m_charactVelocity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:thrustCoeffEff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thrustCoeffEff"));
+        return false;
+    }
+    m_thrustCoeffEff = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:charactVelocityEff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:charactVelocityEff"));
+        return false;
+    }
+    m_charactVelocityEff = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalIspEff"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalIspEff"));
+        return false;
+    }
+    m_totalIspEff = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nominalMassFlow"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nominalMassFlow"));
+        return false;
+    }
+    m_nominalMassFlow = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nominalMassFlowPerEngine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nominalMassFlowPerEngine"));
+        return false;
+    }
+    m_nominalMassFlowPerEngine = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:gammaExhaust"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:gammaExhaust"));
+        return false;
+    }
+    m_gammaExhaust = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:minOperativeAlt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:minOperativeAlt"));
+        return false;
+    }
+    m_minOperativeAlt = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:throttle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:throttle"));
+        return false;
+    }
+    m_throttle = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:restart"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:restart"));
+        return false;
+    }
+    m_restart = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionSystemPerformanceType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:seaThrust", m_seaThrust);
+    writeSimpleElement(writer, "tns:seaThrustPerEngine", m_seaThrustPerEngine);
+    writeSimpleElement(writer, "tns:vacuumThrust", m_vacuumThrust);
+    writeSimpleElement(writer, "tns:vacuumThrustPerEngine", m_vacuumThrustPerEngine);
+    writeSimpleElement(writer, "tns:theoOptIsp", m_theoOptIsp);
+    writeSimpleElement(writer, "tns:realOptIsp", m_realOptIsp);
+    writeSimpleElement(writer, "tns:theoSeaIsp", m_theoSeaIsp);
+    writeSimpleElement(writer, "tns:realSeaIsp", m_realSeaIsp);
+    writeSimpleElement(writer, "tns:theoVacuumIsp", m_theoVacuumIsp);
+    writeSimpleElement(writer, "tns:realVacuumIsp", m_realVacuumIsp);
+    writeSimpleElement(writer, "tns:thrustCoeff", m_thrustCoeff);
+    writeSimpleElement(writer, "tns:charactVelocity", m_charactVelocity);
+    writeSimpleElement(writer, "tns:thrustCoeffEff", m_thrustCoeffEff);
+    writeSimpleElement(writer, "tns:charactVelocityEff", m_charactVelocityEff);
+    writeSimpleElement(writer, "tns:totalIspEff", m_totalIspEff);
+    writeSimpleElement(writer, "tns:nominalMassFlow", m_nominalMassFlow);
+    writeSimpleElement(writer, "tns:nominalMassFlowPerEngine", m_nominalMassFlowPerEngine);
+    writeSimpleElement(writer, "tns:gammaExhaust", m_gammaExhaust);
+    writeSimpleElement(writer, "tns:minOperativeAlt", m_minOperativeAlt);
+    if (!m_throttle.isNull())
+    {
+        QString tagName = "throttle";
+        m_throttle->writeElement(writer, tagName);
+    }
+    if (!m_restart.isNull())
+    {
+        QString tagName = "restart";
+        m_restart->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionSystemPerformanceType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6518,6 +13203,70 @@ QDomElement ScenarioLVDevelopmentCostsType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioLVDevelopmentCostsType* ScenarioLVDevelopmentCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVDevelopmentCostsType* v = new ScenarioLVDevelopmentCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVDevelopmentCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:enginef2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:enginef2"));
+        return false;
+    }
+    m_enginef2 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:enginef5"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:enginef5"));
+        return false;
+    }
+    m_enginef5 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:engineDevelopmentCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:engineDevelopmentCost"));
+        return false;
+    }
+    m_engineDevelopmentCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:systemf2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:systemf2"));
+        return false;
+    }
+    m_systemf2 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:systemDevelopmentCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:systemDevelopmentCost"));
+        return false;
+    }
+    m_systemDevelopmentCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVDevelopmentCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:enginef2", m_enginef2);
+    writeSimpleElement(writer, "tns:enginef5", m_enginef5);
+    writeSimpleElement(writer, "tns:engineDevelopmentCost", m_engineDevelopmentCost);
+    writeSimpleElement(writer, "tns:systemf2", m_systemf2);
+    writeSimpleElement(writer, "tns:systemDevelopmentCost", m_systemDevelopmentCost);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVDevelopmentCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6580,6 +13329,78 @@ QDomElement ScenarioLVProductionCostsType::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioLVProductionCostsType* ScenarioLVProductionCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVProductionCostsType* v = new ScenarioLVProductionCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVProductionCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalNumberOfEngines"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalNumberOfEngines"));
+        return false;
+    }
+    m_totalNumberOfEngines = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:enginesLearningFactor"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:enginesLearningFactor"));
+        return false;
+    }
+    m_enginesLearningFactor = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalNumberOfSystems"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalNumberOfSystems"));
+        return false;
+    }
+    m_totalNumberOfSystems = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:systemsLearningFactor"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:systemsLearningFactor"));
+        return false;
+    }
+    m_systemsLearningFactor = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalEngineProductionCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalEngineProductionCost"));
+        return false;
+    }
+    m_totalEngineProductionCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalSystemProductionCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalSystemProductionCost"));
+        return false;
+    }
+    m_totalSystemProductionCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVProductionCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalNumberOfEngines", m_totalNumberOfEngines);
+    writeSimpleElement(writer, "tns:enginesLearningFactor", m_enginesLearningFactor);
+    writeSimpleElement(writer, "tns:totalNumberOfSystems", m_totalNumberOfSystems);
+    writeSimpleElement(writer, "tns:systemsLearningFactor", m_systemsLearningFactor);
+    writeSimpleElement(writer, "tns:totalEngineProductionCost", m_totalEngineProductionCost);
+    writeSimpleElement(writer, "tns:totalSystemProductionCost", m_totalSystemProductionCost);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVProductionCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6650,6 +13471,94 @@ QDomElement ScenarioLVTotalProgramCostsType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioLVTotalProgramCostsType* ScenarioLVTotalProgramCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVTotalProgramCostsType* v = new ScenarioLVTotalProgramCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVTotalProgramCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:lifeCycleCostMY"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:lifeCycleCostMY"));
+        return false;
+    }
+    m_lifeCycleCostMY = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:costPerLaunchMY"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:costPerLaunchMY"));
+        return false;
+    }
+    m_costPerLaunchMY = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:costPerKiloMY"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:costPerKiloMY"));
+        return false;
+    }
+    m_costPerKiloMY = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:FYref"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:FYref"));
+        return false;
+    }
+    m_FYref = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:MYtoFYEuros"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:MYtoFYEuros"));
+        return false;
+    }
+    m_MYtoFYEuros = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:lifeCycleCostFYEuros"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:lifeCycleCostFYEuros"));
+        return false;
+    }
+    m_lifeCycleCostFYEuros = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:costPerLaunchFYEuros"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:costPerLaunchFYEuros"));
+        return false;
+    }
+    m_costPerLaunchFYEuros = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:costPerKiloFYEuros"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:costPerKiloFYEuros"));
+        return false;
+    }
+    m_costPerKiloFYEuros = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVTotalProgramCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:lifeCycleCostMY", m_lifeCycleCostMY);
+    writeSimpleElement(writer, "tns:costPerLaunchMY", m_costPerLaunchMY);
+    writeSimpleElement(writer, "tns:costPerKiloMY", m_costPerKiloMY);
+    writeSimpleElement(writer, "tns:FYref", m_FYref);
+    writeSimpleElement(writer, "tns:MYtoFYEuros", m_MYtoFYEuros);
+    writeSimpleElement(writer, "tns:lifeCycleCostFYEuros", m_lifeCycleCostFYEuros);
+    writeSimpleElement(writer, "tns:costPerLaunchFYEuros", m_costPerLaunchFYEuros);
+    writeSimpleElement(writer, "tns:costPerKiloFYEuros", m_costPerKiloFYEuros);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVTotalProgramCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6730,6 +13639,108 @@ QDomElement ScenarioLVDirectOperationsCostsType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioLVDirectOperationsCostsType* ScenarioLVDirectOperationsCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVDirectOperationsCostsType* v = new ScenarioLVDirectOperationsCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVDirectOperationsCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:transportCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:transportCost"));
+        return false;
+    }
+    m_transportCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:processingType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:processingType"));
+        return false;
+    }
+    m_processingType = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fv"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fv"));
+        return false;
+    }
+    m_fv = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fc"));
+        return false;
+    }
+    m_fc = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:groundOperationsCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:groundOperationsCost"));
+        return false;
+    }
+    m_groundOperationsCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Qn"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Qn"));
+        return false;
+    }
+    m_Qn = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:flightOperationsCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:flightOperationsCost"));
+        return false;
+    }
+    m_flightOperationsCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:propellantsCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propellantsCost"));
+        return false;
+    }
+    m_propellantsCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:insuranceFee"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:insuranceFee"));
+        return false;
+    }
+    m_insuranceFee = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVDirectOperationsCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:transportCost", m_transportCost);
+    if (!m_processingType.isNull())
+    {
+        QString tagName = "processingType";
+        m_processingType->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:fv", m_fv);
+    writeSimpleElement(writer, "tns:fc", m_fc);
+    writeSimpleElement(writer, "tns:groundOperationsCost", m_groundOperationsCost);
+    writeSimpleElement(writer, "tns:Qn", m_Qn);
+    writeSimpleElement(writer, "tns:flightOperationsCost", m_flightOperationsCost);
+    writeSimpleElement(writer, "tns:propellantsCost", m_propellantsCost);
+    writeSimpleElement(writer, "tns:insuranceFee", m_insuranceFee);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVDirectOperationsCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6781,6 +13792,54 @@ QDomElement ScenarioLVIndirectOperationsCostsType::toDomElement(QDomDocument& do
     return e;
 }
 
+ScenarioLVIndirectOperationsCostsType* ScenarioLVIndirectOperationsCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVIndirectOperationsCostsType* v = new ScenarioLVIndirectOperationsCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVIndirectOperationsCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:groundFacilitiesBuildingCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:groundFacilitiesBuildingCost"));
+        return false;
+    }
+    m_groundFacilitiesBuildingCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:launchSiteCostPerYear"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:launchSiteCostPerYear"));
+        return false;
+    }
+    m_launchSiteCostPerYear = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:personnelCostPerYear"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:personnelCostPerYear"));
+        return false;
+    }
+    m_personnelCostPerYear = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVIndirectOperationsCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:groundFacilitiesBuildingCost", m_groundFacilitiesBuildingCost);
+    writeSimpleElement(writer, "tns:launchSiteCostPerYear", m_launchSiteCostPerYear);
+    writeSimpleElement(writer, "tns:personnelCostPerYear", m_personnelCostPerYear);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVIndirectOperationsCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6835,6 +13894,62 @@ QDomElement ScenarioLVSeparationType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioLVSeparationType* ScenarioLVSeparationType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVSeparationType* v = new ScenarioLVSeparationType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVSeparationType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:stageSeparationReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:stageSeparationReliability"));
+        return false;
+    }
+    m_stageSeparationReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:boostersSetSeparationReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:boostersSetSeparationReliability"));
+        return false;
+    }
+    m_boostersSetSeparationReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fairingSeparationReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fairingSeparationReliability"));
+        return false;
+    }
+    m_fairingSeparationReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:payloadSeparationReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:payloadSeparationReliability"));
+        return false;
+    }
+    m_payloadSeparationReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVSeparationType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:stageSeparationReliability", m_stageSeparationReliability);
+    writeSimpleElement(writer, "tns:boostersSetSeparationReliability", m_boostersSetSeparationReliability);
+    writeSimpleElement(writer, "tns:fairingSeparationReliability", m_fairingSeparationReliability);
+    writeSimpleElement(writer, "tns:payloadSeparationReliability", m_payloadSeparationReliability);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVSeparationType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6905,6 +14020,94 @@ QDomElement ScenarioLVPropulsionReliabilityType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioLVPropulsionReliabilityType* ScenarioLVPropulsionReliabilityType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVPropulsionReliabilityType* v = new ScenarioLVPropulsionReliabilityType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVPropulsionReliabilityType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:igniterReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:igniterReliability"));
+        return false;
+    }
+    m_igniterReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:feedFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:feedFailureRate"));
+        return false;
+    }
+    m_feedFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:grainFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:grainFailureRate"));
+        return false;
+    }
+    m_grainFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:chamberFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:chamberFailureRate"));
+        return false;
+    }
+    m_chamberFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nozzleFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nozzleFailureRate"));
+        return false;
+    }
+    m_nozzleFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tvcFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tvcFailureRate"));
+        return false;
+    }
+    m_tvcFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:singleEngineOverallFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:singleEngineOverallFailureRate"));
+        return false;
+    }
+    m_singleEngineOverallFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:propulsionOverallFailureRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propulsionOverallFailureRate"));
+        return false;
+    }
+    m_propulsionOverallFailureRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVPropulsionReliabilityType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:igniterReliability", m_igniterReliability);
+    writeSimpleElement(writer, "tns:feedFailureRate", m_feedFailureRate);
+    writeSimpleElement(writer, "tns:grainFailureRate", m_grainFailureRate);
+    writeSimpleElement(writer, "tns:chamberFailureRate", m_chamberFailureRate);
+    writeSimpleElement(writer, "tns:nozzleFailureRate", m_nozzleFailureRate);
+    writeSimpleElement(writer, "tns:tvcFailureRate", m_tvcFailureRate);
+    writeSimpleElement(writer, "tns:singleEngineOverallFailureRate", m_singleEngineOverallFailureRate);
+    writeSimpleElement(writer, "tns:propulsionOverallFailureRate", m_propulsionOverallFailureRate);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVPropulsionReliabilityType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -6959,6 +14162,62 @@ QDomElement ScenarioLVTakeoffReliabilityType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioLVTakeoffReliabilityType* ScenarioLVTakeoffReliabilityType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVTakeoffReliabilityType* v = new ScenarioLVTakeoffReliabilityType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVTakeoffReliabilityType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:launchSiteReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:launchSiteReliability"));
+        return false;
+    }
+    m_launchSiteReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ignitionReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ignitionReliability"));
+        return false;
+    }
+    m_ignitionReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:controlMarginReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:controlMarginReliability"));
+        return false;
+    }
+    m_controlMarginReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:launchOverallReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:launchOverallReliability"));
+        return false;
+    }
+    m_launchOverallReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVTakeoffReliabilityType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:launchSiteReliability", m_launchSiteReliability);
+    writeSimpleElement(writer, "tns:ignitionReliability", m_ignitionReliability);
+    writeSimpleElement(writer, "tns:controlMarginReliability", m_controlMarginReliability);
+    writeSimpleElement(writer, "tns:launchOverallReliability", m_launchOverallReliability);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVTakeoffReliabilityType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7029,6 +14288,82 @@ QDomElement ScenarioLVTakeOffType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioLVTakeOffType* ScenarioLVTakeOffType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVTakeOffType* v = new ScenarioLVTakeOffType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVTakeOffType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:padClearingAlt"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:padClearingAlt"));
+        return false;
+    }
+    m_padClearingAlt = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxPitchOverAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxPitchOverAngle"));
+        return false;
+    }
+    m_maxPitchOverAngle = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:pitchOverDuration"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:pitchOverDuration"));
+        return false;
+    }
+    m_pitchOverDuration = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:pitchOverDecayTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:pitchOverDecayTime"));
+        return false;
+    }
+    m_pitchOverDecayTime = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:pitchOverHeadingAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:pitchOverHeadingAngle"));
+        return false;
+    }
+    m_pitchOverHeadingAngle = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVTakeOffType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:padClearingAlt", m_padClearingAlt);
+    if (!m_maxPitchOverAngle.isNull())
+    {
+        QString tagName = "maxPitchOverAngle";
+        m_maxPitchOverAngle->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:pitchOverDuration", m_pitchOverDuration);
+    writeSimpleElement(writer, "tns:pitchOverDecayTime", m_pitchOverDecayTime);
+    if (!m_pitchOverHeadingAngle.isNull())
+    {
+        QString tagName = "pitchOverHeadingAngle";
+        m_pitchOverHeadingAngle->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVTakeOffType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7112,6 +14447,94 @@ QDomElement ScenarioLVIgnitionsType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioLVIgnitionsType* ScenarioLVIgnitionsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVIgnitionsType* v = new ScenarioLVIgnitionsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVIgnitionsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:coreIgnitionDelayOption"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:coreIgnitionDelayOption"));
+        return false;
+    }
+    m_coreIgnitionDelayOption = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:coreIgnitionDelayTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:coreIgnitionDelayTime"));
+        return false;
+    }
+    m_coreIgnitionDelayTime = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:secondBoostersSetIgnitionDelayOption"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:secondBoostersSetIgnitionDelayOption"));
+        return false;
+    }
+    m_secondBoostersSetIgnitionDelayOption = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:secondBoostersSetIgnitionDelayTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:secondBoostersSetIgnitionDelayTime"));
+        return false;
+    }
+    m_secondBoostersSetIgnitionDelayTime = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nThrustControlNodes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nThrustControlNodes"));
+        return false;
+    }
+    m_nThrustControlNodes = parseIntList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVIgnitionsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_coreIgnitionDelayOption.isNull())
+    {
+        QString tagName = "coreIgnitionDelayOption";
+        m_coreIgnitionDelayOption->writeElement(writer, tagName);
+    }
+    if (!m_coreIgnitionDelayTime.isNull())
+    {
+        QString tagName = "coreIgnitionDelayTime";
+        m_coreIgnitionDelayTime->writeElement(writer, tagName);
+    }
+    if (!m_secondBoostersSetIgnitionDelayOption.isNull())
+    {
+        QString tagName = "secondBoostersSetIgnitionDelayOption";
+        m_secondBoostersSetIgnitionDelayOption->writeElement(writer, tagName);
+    }
+    if (!m_secondBoostersSetIgnitionDelayTime.isNull())
+    {
+        QString tagName = "secondBoostersSetIgnitionDelayTime";
+        m_secondBoostersSetIgnitionDelayTime->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:nThrustControlNodes", m_nThrustControlNodes);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVIgnitionsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7171,6 +14594,70 @@ QDomElement ScenarioLVAtmosphericFlightType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioLVAtmosphericFlightType* ScenarioLVAtmosphericFlightType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVAtmosphericFlightType* v = new ScenarioLVAtmosphericFlightType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVAtmosphericFlightType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:optimizedPitchValues"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:optimizedPitchValues"));
+        return false;
+    }
+    m_optimizedPitchValues = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:optimizedYawValues"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:optimizedYawValues"));
+        return false;
+    }
+    m_optimizedYawValues = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:optimizedThrustValues"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:optimizedThrustValues"));
+        return false;
+    }
+    m_optimizedThrustValues = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nPitchControlNodes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nPitchControlNodes"));
+        return false;
+    }
+    m_nPitchControlNodes = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nYawControlNodes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nYawControlNodes"));
+        return false;
+    }
+    m_nYawControlNodes = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVAtmosphericFlightType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:optimizedPitchValues", m_optimizedPitchValues);
+    writeSimpleElement(writer, "tns:optimizedYawValues", m_optimizedYawValues);
+    writeSimpleElement(writer, "tns:optimizedThrustValues", m_optimizedThrustValues);
+    writeSimpleElement(writer, "tns:nPitchControlNodes", m_nPitchControlNodes);
+    writeSimpleElement(writer, "tns:nYawControlNodes", m_nYawControlNodes);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVAtmosphericFlightType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7256,6 +14743,102 @@ QDomElement ScenarioLVExoatmosphericFlightType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioLVExoatmosphericFlightType* ScenarioLVExoatmosphericFlightType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVExoatmosphericFlightType* v = new ScenarioLVExoatmosphericFlightType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVExoatmosphericFlightType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:bilinearLawInitPitch"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:bilinearLawInitPitch"));
+        return false;
+    }
+    m_bilinearLawInitPitch = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:bilinearLawFinalPitch"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:bilinearLawFinalPitch"));
+        return false;
+    }
+    m_bilinearLawFinalPitch = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:bilinearLawParam"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:bilinearLawParam"));
+        return false;
+    }
+    m_bilinearLawParam = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nYawControlNodes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nYawControlNodes"));
+        return false;
+    }
+    m_nYawControlNodes = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:circBurnOption"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:circBurnOption"));
+        return false;
+    }
+    m_circBurnOption = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:circBurnTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:circBurnTime"));
+        return false;
+    }
+    m_circBurnTime = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVExoatmosphericFlightType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_bilinearLawInitPitch.isNull())
+    {
+        QString tagName = "bilinearLawInitPitch";
+        m_bilinearLawInitPitch->writeElement(writer, tagName);
+    }
+    if (!m_bilinearLawFinalPitch.isNull())
+    {
+        QString tagName = "bilinearLawFinalPitch";
+        m_bilinearLawFinalPitch->writeElement(writer, tagName);
+    }
+    if (!m_bilinearLawParam.isNull())
+    {
+        QString tagName = "bilinearLawParam";
+        m_bilinearLawParam->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:nYawControlNodes", m_nYawControlNodes);
+    writeSimpleElement(writer, "tns:circBurnOption", m_circBurnOption);
+    if (!m_circBurnTime.isNull())
+    {
+        QString tagName = "circBurnTime";
+        m_circBurnTime->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVExoatmosphericFlightType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7326,6 +14909,86 @@ QDomElement ScenarioLVTrajectoryConstraintsType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioLVTrajectoryConstraintsType* ScenarioLVTrajectoryConstraintsType::create(QXmlStreamReader& reader)
+{
+    ScenarioLVTrajectoryConstraintsType* v = new ScenarioLVTrajectoryConstraintsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLVTrajectoryConstraintsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:finalSemiaxisError"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:finalSemiaxisError"));
+        return false;
+    }
+    m_finalSemiaxisError = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:finalEccError"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:finalEccError"));
+        return false;
+    }
+    m_finalEccError = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:finalInclError"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:finalInclError"));
+        return false;
+    }
+    m_finalInclError = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:axialAccCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:axialAccCstrViolation"));
+        return false;
+    }
+    m_axialAccCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:heatFluxCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:heatFluxCstrViolation"));
+        return false;
+    }
+    m_heatFluxCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dynPressCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dynPressCstrViolation"));
+        return false;
+    }
+    m_dynPressCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:controllabilityCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:controllabilityCstrViolation"));
+        return false;
+    }
+    m_controllabilityCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLVTrajectoryConstraintsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:finalSemiaxisError", m_finalSemiaxisError);
+    writeSimpleElement(writer, "tns:finalEccError", m_finalEccError);
+    writeSimpleElement(writer, "tns:finalInclError", m_finalInclError);
+    writeSimpleElement(writer, "tns:axialAccCstrViolation", m_axialAccCstrViolation);
+    writeSimpleElement(writer, "tns:heatFluxCstrViolation", m_heatFluxCstrViolation);
+    writeSimpleElement(writer, "tns:dynPressCstrViolation", m_dynPressCstrViolation);
+    writeSimpleElement(writer, "tns:controllabilityCstrViolation", m_controllabilityCstrViolation);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLVTrajectoryConstraintsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7424,6 +15087,114 @@ QDomElement ScenarioREV::toDomElement(QDomDocument& doc, const QString& elementN
     return e;
 }
 
+ScenarioREV* ScenarioREV::create(QXmlStreamReader& reader)
+{
+    ScenarioREV* v = new ScenarioREV;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREV::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:REVProgram"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVProgram"));
+        return false;
+    }
+    m_REVProgram = QSharedPointer<ScenarioREVProgramType>(ScenarioREVProgramType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:REVMission"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVMission"));
+        return false;
+    }
+    m_REVMission = QSharedPointer<ScenarioREVMissionType>(ScenarioREVMissionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:REVSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVSystem"));
+        return false;
+    }
+    m_REVSystem = QSharedPointer<ScenarioREVSystemType>(ScenarioREVSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Optimization"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Optimization"));
+        return false;
+    }
+    m_Optimization = QSharedPointer<ScenarioOptimization>(ScenarioOptimization::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OutputFiles"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OutputFiles"));
+        return false;
+    }
+    m_OutputFiles = QSharedPointer<ScenarioOutputFiles>(ScenarioOutputFiles::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREV::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioParticipantType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_REVProgram.isNull())
+    {
+        QString tagName = "REVProgram";
+        m_REVProgram->writeElement(writer, tagName);
+    }
+    if (!m_REVMission.isNull())
+    {
+        QString tagName = "REVMission";
+        m_REVMission->writeElement(writer, tagName);
+    }
+    if (!m_REVSystem.isNull())
+    {
+        QString tagName = "REVSystem";
+        m_REVSystem->writeElement(writer, tagName);
+    }
+    if (!m_Optimization.isNull())
+    {
+        QString tagName = "Optimization";
+        m_Optimization->writeElement(writer, tagName);
+    }
+    if (!m_OutputFiles.isNull())
+    {
+        QString tagName = "OutputFiles";
+        m_OutputFiles->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREV::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7476,6 +15247,46 @@ QDomElement ScenarioREVProgramType::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioREVProgramType* ScenarioREVProgramType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVProgramType* v = new ScenarioREVProgramType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVProgramType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:nMissions"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nMissions"));
+        return false;
+    }
+    m_nMissions = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:nYearsOps"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nYearsOps"));
+        return false;
+    }
+    m_nYearsOps = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVProgramType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:nMissions", m_nMissions);
+    writeSimpleElement(writer, "tns:nYearsOps", m_nYearsOps);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVProgramType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7516,22 +15327,74 @@ bool ScenarioREVMissionType::load(const QDomElement& e, QDomElement* next)
     return true;
 }
 
-QDomElement ScenarioREVMissionType::toDomElement(QDomDocument& doc, const QString& elementName) const
+QDomElement ScenarioREVMissionType::toDomElement(QDomDocument& doc, const QString& elementName) const
+{
+    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    if (!m_REVTrajectoryPlan.isNull())
+    {
+        QString tagName = "REVTrajectoryPlan";
+        QDomElement child = m_REVTrajectoryPlan->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_Payload.isNull())
+    {
+        QString tagName = "Payload";
+        QDomElement child = m_Payload->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    return e;
+}
+
+ScenarioREVMissionType* ScenarioREVMissionType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVMissionType* v = new ScenarioREVMissionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVMissionType::load(QXmlStreamReader& reader)
 {
-    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:REVTrajectoryPlan"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVTrajectoryPlan"));
+        return false;
+    }
+    m_REVTrajectoryPlan = QSharedPointer<ScenarioREVTrajectoryPlanType>(ScenarioREVTrajectoryPlanType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Payload"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Payload"));
+        return false;
+    }
+    m_Payload = QSharedPointer<ScenarioREVPayloadType>(ScenarioREVPayloadType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVMissionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
     if (!m_REVTrajectoryPlan.isNull())
     {
         QString tagName = "REVTrajectoryPlan";
-        QDomElement child = m_REVTrajectoryPlan->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_REVTrajectoryPlan->writeElement(writer, tagName);
     }
     if (!m_Payload.isNull())
     {
         QString tagName = "Payload";
-        QDomElement child = m_Payload->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_Payload->writeElement(writer, tagName);
     }
-    return e;
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioREVMissionType::children() const
@@ -7620,6 +15483,77 @@ QDomElement ScenarioREVTrajectoryPlanType::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioREVTrajectoryPlanType* ScenarioREVTrajectoryPlanType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVTrajectoryPlanType* v = new ScenarioREVTrajectoryPlanType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVTrajectoryPlanType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    for (;;)
+    {
+        QSharedPointer<ScenarioAbstractTrajectoryType> v;
+        if (atStartElement(reader, "tns:EntryArc"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioEntryArcType::create(reader));
+        else if (atStartElement(reader, "tns:Loitering"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioLoiteringType::create(reader));
+        else if (atStartElement(reader, "tns:Lagrangian"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioLagrangianType::create(reader));
+        else if (atStartElement(reader, "tns:FlyBy"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioFlyByType::create(reader));
+        else if (atStartElement(reader, "tns:LoiteringTLE"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioLoiteringTLEType::create(reader));
+        else if (atStartElement(reader, "tns:External"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioExternalType::create(reader));
+        else if (atStartElement(reader, "tns:DeltaV"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioDeltaVType::create(reader));
+        else if (atStartElement(reader, "tns:RendezVousManoeuvre"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioRendezVousManoeuvreType::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_AbstractTrajectory << v;
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioREVTrajectoryPlanType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    foreach (QSharedPointer<ScenarioAbstractTrajectoryType> p, m_AbstractTrajectory)
+    {
+        QString tagName = "AbstractTrajectory";
+        if (dynamic_cast<ScenarioEntryArcType*>(p.data()))
+            tagName = "EntryArc";
+        else if (dynamic_cast<ScenarioLoiteringType*>(p.data()))
+            tagName = "Loitering";
+        else if (dynamic_cast<ScenarioLagrangianType*>(p.data()))
+            tagName = "Lagrangian";
+        else if (dynamic_cast<ScenarioFlyByType*>(p.data()))
+            tagName = "FlyBy";
+        else if (dynamic_cast<ScenarioLoiteringTLEType*>(p.data()))
+            tagName = "LoiteringTLE";
+        else if (dynamic_cast<ScenarioExternalType*>(p.data()))
+            tagName = "External";
+        else if (dynamic_cast<ScenarioDeltaVType*>(p.data()))
+            tagName = "DeltaV";
+        else if (dynamic_cast<ScenarioRendezVousManoeuvreType*>(p.data()))
+            tagName = "RendezVousManoeuvre";
+        p->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVTrajectoryPlanType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7769,6 +15703,178 @@ QDomElement ScenarioEntryArcType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioEntryArcType* ScenarioEntryArcType::create(QXmlStreamReader& reader)
+{
+    ScenarioEntryArcType* v = new ScenarioEntryArcType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioEntryArcType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Environment"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Environment"));
+        return false;
+    }
+    m_Environment = QSharedPointer<ScenarioEnvironmentType>(ScenarioEnvironmentType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TimeLine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TimeLine"));
+        return false;
+    }
+    m_TimeLine = QSharedPointer<ScenarioTimeLine>(ScenarioTimeLine::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialPosition"));
+        return false;
+    }
+    m_InitialPosition = QSharedPointer<ScenarioInitialPositionType>(ScenarioInitialPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:InitialAttitude"))
+        m_InitialAttitude = QSharedPointer<ScenarioInitialAttitudeType>(ScenarioInitialAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_InitialAttitude.isNull())
+        reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropagationPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropagationPosition"));
+        return false;
+    }
+    m_PropagationPosition = QSharedPointer<ScenarioPropagationPositionType>(ScenarioPropagationPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:PropagationAttitude"))
+        m_PropagationAttitude = QSharedPointer<ScenarioPropagationAttitudeType>(ScenarioPropagationAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_PropagationAttitude.isNull())
+        reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Constraints"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Constraints"));
+        return false;
+    }
+    m_Constraints = QSharedPointer<ScenarioREVConstraintsType>(ScenarioREVConstraintsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:targetFinalState"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:targetFinalState"));
+        return false;
+    }
+    m_targetFinalState = QSharedPointer<ScenarioREVFinalStateType>(ScenarioREVFinalStateType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ConstraintsViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ConstraintsViolation"));
+        return false;
+    }
+    m_ConstraintsViolation = QSharedPointer<ScenarioREVConstraintsViolationType>(ScenarioREVConstraintsViolationType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:EntryCharacteristics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:EntryCharacteristics"));
+        return false;
+    }
+    m_EntryCharacteristics = QSharedPointer<ScenarioEntryCharacteristicsType>(ScenarioEntryCharacteristicsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioEntryArcType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Environment.isNull())
+    {
+        QString tagName = "Environment";
+        m_Environment->writeElement(writer, tagName);
+    }
+    if (!m_TimeLine.isNull())
+    {
+        QString tagName = "TimeLine";
+        m_TimeLine->writeElement(writer, tagName);
+    }
+    if (!m_InitialPosition.isNull())
+    {
+        QString tagName = "InitialPosition";
+        m_InitialPosition->writeElement(writer, tagName);
+    }
+    if (!m_InitialAttitude.isNull())
+    {
+        QString tagName = "InitialAttitude";
+        m_InitialAttitude->writeElement(writer, tagName);
+    }
+    if (!m_PropagationPosition.isNull())
+    {
+        QString tagName = "PropagationPosition";
+        m_PropagationPosition->writeElement(writer, tagName);
+    }
+    if (!m_PropagationAttitude.isNull())
+    {
+        QString tagName = "PropagationAttitude";
+        m_PropagationAttitude->writeElement(writer, tagName);
+    }
+    if (!m_Constraints.isNull())
+    {
+        QString tagName = "Constraints";
+        m_Constraints->writeElement(writer, tagName);
+    }
+    if (!m_targetFinalState.isNull())
+    {
+        QString tagName = "targetFinalState";
+        m_targetFinalState->writeElement(writer, tagName);
+    }
+    if (!m_ConstraintsViolation.isNull())
+    {
+        QString tagName = "ConstraintsViolation";
+        m_ConstraintsViolation->writeElement(writer, tagName);
+    }
+    if (!m_EntryCharacteristics.isNull())
+    {
+        QString tagName = "EntryCharacteristics";
+        m_EntryCharacteristics->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioEntryArcType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7838,6 +15944,68 @@ QDomElement ScenarioREVFinalStateType::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
+ScenarioREVFinalStateType* ScenarioREVFinalStateType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVFinalStateType* v = new ScenarioREVFinalStateType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVFinalStateType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:entryType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:entryType"));
+        return false;
+    }
+    m_entryType = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:degreesOfFreedom"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:degreesOfFreedom"));
+        return false;
+    }
+    m_degreesOfFreedom = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:attitudeController"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:attitudeController"));
+        return false;
+    }
+    m_attitudeController = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DispersionAnalysis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DispersionAnalysis"));
+        return false;
+    }
+    m_DispersionAnalysis = QSharedPointer<ScenarioREVDispersionAnalysisType>(ScenarioREVDispersionAnalysisType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVFinalStateType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:entryType", m_entryType);
+    writeSimpleElement(writer, "tns:degreesOfFreedom", m_degreesOfFreedom);
+    writeSimpleElement(writer, "tns:attitudeController", m_attitudeController);
+    if (!m_DispersionAnalysis.isNull())
+    {
+        QString tagName = "DispersionAnalysis";
+        m_DispersionAnalysis->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVFinalStateType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7896,6 +16064,55 @@ QDomElement ScenarioREVFinalPositionStateType::toDomElement(QDomDocument& doc, c
     return e;
 }
 
+ScenarioREVFinalPositionStateType* ScenarioREVFinalPositionStateType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVFinalPositionStateType* v = new ScenarioREVFinalPositionStateType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVFinalPositionStateType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:StateVector"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioStateVectorType::create(reader));
+    else if (atStartElement(reader, "tns:KeplerianElements"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioKeplerianElementsType::create(reader));
+    else if (atStartElement(reader, "tns:SphericalCoordinates"))
+        m_Abstract6DOFPosition = QSharedPointer<ScenarioAbstract6DOFPositionType>((ScenarioAbstract6DOFPositionType*)ScenarioSphericalCoordinatesType::create(reader));
+    else
+    {
+        reader.raiseError(QObject::tr("Expected tns:Abstract6DOFPosition"));
+        return false;
+    }
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVFinalPositionStateType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Abstract6DOFPosition.isNull())
+    {
+        QString tagName = "Abstract6DOFPosition";
+        if (dynamic_cast<ScenarioStateVectorType*>(m_Abstract6DOFPosition.data()))
+            tagName = "StateVector";
+        else if (dynamic_cast<ScenarioKeplerianElementsType*>(m_Abstract6DOFPosition.data()))
+            tagName = "KeplerianElements";
+        else if (dynamic_cast<ScenarioSphericalCoordinatesType*>(m_Abstract6DOFPosition.data()))
+            tagName = "SphericalCoordinates";
+        m_Abstract6DOFPosition->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVFinalPositionStateType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -7983,6 +16200,126 @@ QDomElement ScenarioREVDispersionAnalysisType::toDomElement(QDomDocument& doc, c
     return e;
 }
 
+ScenarioREVDispersionAnalysisType* ScenarioREVDispersionAnalysisType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVDispersionAnalysisType* v = new ScenarioREVDispersionAnalysisType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVDispersionAnalysisType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:nrSimulations"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nrSimulations"));
+        return false;
+    }
+    m_nrSimulations = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispCD"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispCD"));
+        return false;
+    }
+    m_dispCD = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispCS"));
+        return false;
+    }
+    m_dispCS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispCL"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispCL"));
+        return false;
+    }
+    m_dispCL = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispCl"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispCl"));
+        return false;
+    }
+    m_dispCl = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispCm"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispCm"));
+        return false;
+    }
+    m_dispCm = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispCn"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispCn"));
+        return false;
+    }
+    m_dispCn = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispDensity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispDensity"));
+        return false;
+    }
+    m_dispDensity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispSpeedOfSound"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispSpeedOfSound"));
+        return false;
+    }
+    m_dispSpeedOfSound = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispMass"));
+        return false;
+    }
+    m_dispMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispInitialPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispInitialPosition"));
+        return false;
+    }
+    m_dispInitialPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dispInitialAttitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dispInitialAttitude"));
+        return false;
+    }
+    m_dispInitialAttitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVDispersionAnalysisType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:nrSimulations", m_nrSimulations);
+    writeSimpleElement(writer, "tns:dispCD", m_dispCD);
+    writeSimpleElement(writer, "tns:dispCS", m_dispCS);
+    writeSimpleElement(writer, "tns:dispCL", m_dispCL);
+    writeSimpleElement(writer, "tns:dispCl", m_dispCl);
+    writeSimpleElement(writer, "tns:dispCm", m_dispCm);
+    writeSimpleElement(writer, "tns:dispCn", m_dispCn);
+    writeSimpleElement(writer, "tns:dispDensity", m_dispDensity);
+    writeSimpleElement(writer, "tns:dispSpeedOfSound", m_dispSpeedOfSound);
+    writeSimpleElement(writer, "tns:dispMass", m_dispMass);
+    writeSimpleElement(writer, "tns:dispInitialPosition", m_dispInitialPosition);
+    writeSimpleElement(writer, "tns:dispInitialAttitude", m_dispInitialAttitude);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVDispersionAnalysisType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8049,6 +16386,84 @@ QDomElement ScenarioEntryCharacteristicsType::toDomElement(QDomDocument& doc, co
     return e;
 }
 
+ScenarioEntryCharacteristicsType* ScenarioEntryCharacteristicsType::create(QXmlStreamReader& reader)
+{
+    ScenarioEntryCharacteristicsType* v = new ScenarioEntryCharacteristicsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioEntryCharacteristicsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:entryWindowAnalysis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:entryWindowAnalysis"));
+        return false;
+    }
+    m_entryWindowAnalysis = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:optimizeDeorbitBurnOption"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:optimizeDeorbitBurnOption"));
+        return false;
+    }
+    m_optimizeDeorbitBurnOption = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:landingSeaOrGround"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:landingSeaOrGround"));
+        return false;
+    }
+    m_landingSeaOrGround = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:landingAltitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:landingAltitude"));
+        return false;
+    }
+    m_landingAltitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxLandingVelAtSea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxLandingVelAtSea"));
+        return false;
+    }
+    m_maxLandingVelAtSea = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxLandingVelAtGround"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxLandingVelAtGround"));
+        return false;
+    }
+    m_maxLandingVelAtGround = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioEntryCharacteristicsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:entryWindowAnalysis", m_entryWindowAnalysis);
+    writeSimpleElement(writer, "tns:optimizeDeorbitBurnOption", m_optimizeDeorbitBurnOption);
+    if (!m_landingSeaOrGround.isNull())
+    {
+        QString tagName = "landingSeaOrGround";
+        m_landingSeaOrGround->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:landingAltitude", m_landingAltitude);
+    writeSimpleElement(writer, "tns:maxLandingVelAtSea", m_maxLandingVelAtSea);
+    writeSimpleElement(writer, "tns:maxLandingVelAtGround", m_maxLandingVelAtGround);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioEntryCharacteristicsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8103,17 +16518,97 @@ bool ScenarioREVConstraintsViolationType::load(const QDomElement& e, QDomElement
     return true;
 }
 
-QDomElement ScenarioREVConstraintsViolationType::toDomElement(QDomDocument& doc, const QString& elementName) const
+QDomElement ScenarioREVConstraintsViolationType::toDomElement(QDomDocument& doc, const QString& elementName) const
+{
+    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    e.appendChild(createSimpleElement(doc, "tns:landingVelCstrViolation", m_landingVelCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:axialAccCstrViolation", m_axialAccCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:latAccCstrViolation", m_latAccCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:heatFluxCstrViolation", m_heatFluxCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:integratedheatLoadCstrViolation", m_integratedheatLoadCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:dynPressCstrViolation", m_dynPressCstrViolation));
+    e.appendChild(createSimpleElement(doc, "tns:controllabilityCstrViolation", m_controllabilityCstrViolation));
+    return e;
+}
+
+ScenarioREVConstraintsViolationType* ScenarioREVConstraintsViolationType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVConstraintsViolationType* v = new ScenarioREVConstraintsViolationType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVConstraintsViolationType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:landingVelCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:landingVelCstrViolation"));
+        return false;
+    }
+    m_landingVelCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:axialAccCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:axialAccCstrViolation"));
+        return false;
+    }
+    m_axialAccCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:latAccCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:latAccCstrViolation"));
+        return false;
+    }
+    m_latAccCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:heatFluxCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:heatFluxCstrViolation"));
+        return false;
+    }
+    m_heatFluxCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:integratedheatLoadCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:integratedheatLoadCstrViolation"));
+        return false;
+    }
+    m_integratedheatLoadCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dynPressCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dynPressCstrViolation"));
+        return false;
+    }
+    m_dynPressCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:controllabilityCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:controllabilityCstrViolation"));
+        return false;
+    }
+    m_controllabilityCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVConstraintsViolationType::writeContents(QXmlStreamWriter& writer) const
 {
-    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
-    e.appendChild(createSimpleElement(doc, "tns:landingVelCstrViolation", m_landingVelCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:axialAccCstrViolation", m_axialAccCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:latAccCstrViolation", m_latAccCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:heatFluxCstrViolation", m_heatFluxCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:integratedheatLoadCstrViolation", m_integratedheatLoadCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:dynPressCstrViolation", m_dynPressCstrViolation));
-    e.appendChild(createSimpleElement(doc, "tns:controllabilityCstrViolation", m_controllabilityCstrViolation));
-    return e;
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:landingVelCstrViolation", m_landingVelCstrViolation);
+    writeSimpleElement(writer, "tns:axialAccCstrViolation", m_axialAccCstrViolation);
+    writeSimpleElement(writer, "tns:latAccCstrViolation", m_latAccCstrViolation);
+    writeSimpleElement(writer, "tns:heatFluxCstrViolation", m_heatFluxCstrViolation);
+    writeSimpleElement(writer, "tns:integratedheatLoadCstrViolation", m_integratedheatLoadCstrViolation);
+    writeSimpleElement(writer, "tns:dynPressCstrViolation", m_dynPressCstrViolation);
+    writeSimpleElement(writer, "tns:controllabilityCstrViolation", m_controllabilityCstrViolation);
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioREVConstraintsViolationType::children() const
@@ -8195,6 +16690,98 @@ QDomElement ScenarioREVPayloadType::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioREVPayloadType* ScenarioREVPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVPayloadType* v = new ScenarioREVPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:mass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mass"));
+        return false;
+    }
+    m_mass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:length"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:length"));
+        return false;
+    }
+    m_length = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:diameter"));
+        return false;
+    }
+    m_diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:COGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:COGLongPosition"));
+        return false;
+    }
+    m_COGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxAxialAcc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxAxialAcc"));
+        return false;
+    }
+    m_maxAxialAcc = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxLatAcc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxLatAcc"));
+        return false;
+    }
+    m_maxLatAcc = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:crewOption"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:crewOption"));
+        return false;
+    }
+    m_crewOption = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:nCrew"))
+    {
+        m_nCrew = parseInt(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:nDaysInOrbit"))
+    {
+        m_nDaysInOrbit = parseInt(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioREVPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:mass", m_mass);
+    writeSimpleElement(writer, "tns:length", m_length);
+    writeSimpleElement(writer, "tns:diameter", m_diameter);
+    writeSimpleElement(writer, "tns:COGLongPosition", m_COGLongPosition);
+    writeSimpleElement(writer, "tns:maxAxialAcc", m_maxAxialAcc);
+    writeSimpleElement(writer, "tns:maxLatAcc", m_maxLatAcc);
+    writeSimpleElement(writer, "tns:crewOption", m_crewOption);
+    writeSimpleElement(writer, "tns:nCrew", m_nCrew);
+    writeSimpleElement(writer, "tns:nDaysInOrbit", m_nDaysInOrbit);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8298,6 +16885,120 @@ QDomElement ScenarioREVGeometryType::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioREVGeometryType* ScenarioREVGeometryType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVGeometryType* v = new ScenarioREVGeometryType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVGeometryType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:REVvolume"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVvolume"));
+        return false;
+    }
+    m_REVvolume = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:REVsurface"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVsurface"));
+        return false;
+    }
+    m_REVsurface = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:noseRadius"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:noseRadius"));
+        return false;
+    }
+    m_noseRadius = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:shapeFamily"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:shapeFamily"));
+        return false;
+    }
+    m_shapeFamily = QSharedPointer<ScenarioOptVarString>(ScenarioOptVarString::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:geometryFile"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:geometryFile"));
+        return false;
+    }
+    m_geometryFile = reader.readElementText();
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:capsuleShape"))
+        m_capsuleShape = QSharedPointer<ScenariocapsuleShape>(ScenariocapsuleShape::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_capsuleShape.isNull())
+        reader.readNextStartElement();
+    if (atStartElement(reader, "tns:probeShape"))
+        m_probeShape = QSharedPointer<ScenarioprobeShape>(ScenarioprobeShape::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_probeShape.isNull())
+        reader.readNextStartElement();
+    if (atStartElement(reader, "tns:biconicShape"))
+        m_biconicShape = QSharedPointer<ScenariobiconicShape>(ScenariobiconicShape::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_biconicShape.isNull())
+        reader.readNextStartElement();
+    if (atStartElement(reader, "tns:sphereconeShape"))
+        m_sphereconeShape = QSharedPointer<ScenariosphereconeShape>(ScenariosphereconeShape::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_sphereconeShape.isNull())
+        reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVGeometryType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:REVvolume", m_REVvolume);
+    writeSimpleElement(writer, "tns:REVsurface", m_REVsurface);
+    writeSimpleElement(writer, "tns:noseRadius", m_noseRadius);
+    if (!m_shapeFamily.isNull())
+    {
+        QString tagName = "shapeFamily";
+        m_shapeFamily->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:geometryFile", m_geometryFile);
+    if (!m_capsuleShape.isNull())
+    {
+        QString tagName = "capsuleShape";
+        m_capsuleShape->writeElement(writer, tagName);
+    }
+    if (!m_probeShape.isNull())
+    {
+        QString tagName = "probeShape";
+        m_probeShape->writeElement(writer, tagName);
+    }
+    if (!m_biconicShape.isNull())
+    {
+        QString tagName = "biconicShape";
+        m_biconicShape->writeElement(writer, tagName);
+    }
+    if (!m_sphereconeShape.isNull())
+    {
+        QString tagName = "sphereconeShape";
+        m_sphereconeShape->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVGeometryType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8381,6 +17082,86 @@ QDomElement ScenariocapsuleShape::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenariocapsuleShape* ScenariocapsuleShape::create(QXmlStreamReader& reader)
+{
+    ScenariocapsuleShape* v = new ScenariocapsuleShape;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenariocapsuleShape::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:param1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param1"));
+        return false;
+    }
+    m_param1 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param2"));
+        return false;
+    }
+    m_param2 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param3"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param3"));
+        return false;
+    }
+    m_param3 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param4"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param4"));
+        return false;
+    }
+    m_param4 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenariocapsuleShape::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_param1.isNull())
+    {
+        QString tagName = "param1";
+        m_param1->writeElement(writer, tagName);
+    }
+    if (!m_param2.isNull())
+    {
+        QString tagName = "param2";
+        m_param2->writeElement(writer, tagName);
+    }
+    if (!m_param3.isNull())
+    {
+        QString tagName = "param3";
+        m_param3->writeElement(writer, tagName);
+    }
+    if (!m_param4.isNull())
+    {
+        QString tagName = "param4";
+        m_param4->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenariocapsuleShape::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8473,6 +17254,100 @@ QDomElement ScenarioprobeShape::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioprobeShape* ScenarioprobeShape::create(QXmlStreamReader& reader)
+{
+    ScenarioprobeShape* v = new ScenarioprobeShape;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioprobeShape::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:param1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param1"));
+        return false;
+    }
+    m_param1 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param2"));
+        return false;
+    }
+    m_param2 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param3"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param3"));
+        return false;
+    }
+    m_param3 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param4"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param4"));
+        return false;
+    }
+    m_param4 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param5"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param5"));
+        return false;
+    }
+    m_param5 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioprobeShape::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_param1.isNull())
+    {
+        QString tagName = "param1";
+        m_param1->writeElement(writer, tagName);
+    }
+    if (!m_param2.isNull())
+    {
+        QString tagName = "param2";
+        m_param2->writeElement(writer, tagName);
+    }
+    if (!m_param3.isNull())
+    {
+        QString tagName = "param3";
+        m_param3->writeElement(writer, tagName);
+    }
+    if (!m_param4.isNull())
+    {
+        QString tagName = "param4";
+        m_param4->writeElement(writer, tagName);
+    }
+    if (!m_param5.isNull())
+    {
+        QString tagName = "param5";
+        m_param5->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioprobeShape::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8566,6 +17441,100 @@ QDomElement ScenariobiconicShape::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenariobiconicShape* ScenariobiconicShape::create(QXmlStreamReader& reader)
+{
+    ScenariobiconicShape* v = new ScenariobiconicShape;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenariobiconicShape::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:param1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param1"));
+        return false;
+    }
+    m_param1 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param2"));
+        return false;
+    }
+    m_param2 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param3"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param3"));
+        return false;
+    }
+    m_param3 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param4"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param4"));
+        return false;
+    }
+    m_param4 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param5"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param5"));
+        return false;
+    }
+    m_param5 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenariobiconicShape::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_param1.isNull())
+    {
+        QString tagName = "param1";
+        m_param1->writeElement(writer, tagName);
+    }
+    if (!m_param2.isNull())
+    {
+        QString tagName = "param2";
+        m_param2->writeElement(writer, tagName);
+    }
+    if (!m_param3.isNull())
+    {
+        QString tagName = "param3";
+        m_param3->writeElement(writer, tagName);
+    }
+    if (!m_param4.isNull())
+    {
+        QString tagName = "param4";
+        m_param4->writeElement(writer, tagName);
+    }
+    if (!m_param5.isNull())
+    {
+        QString tagName = "param5";
+        m_param5->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenariobiconicShape::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8639,6 +17608,72 @@ QDomElement ScenariosphereconeShape::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenariosphereconeShape* ScenariosphereconeShape::create(QXmlStreamReader& reader)
+{
+    ScenariosphereconeShape* v = new ScenariosphereconeShape;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenariosphereconeShape::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:param1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param1"));
+        return false;
+    }
+    m_param1 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param2"));
+        return false;
+    }
+    m_param2 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:param3"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:param3"));
+        return false;
+    }
+    m_param3 = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenariosphereconeShape::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_param1.isNull())
+    {
+        QString tagName = "param1";
+        m_param1->writeElement(writer, tagName);
+    }
+    if (!m_param2.isNull())
+    {
+        QString tagName = "param2";
+        m_param2->writeElement(writer, tagName);
+    }
+    if (!m_param3.isNull())
+    {
+        QString tagName = "param3";
+        m_param3->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenariosphereconeShape::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8708,6 +17743,86 @@ QDomElement ScenarioREVConstraintsType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioREVConstraintsType* ScenarioREVConstraintsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVConstraintsType* v = new ScenarioREVConstraintsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVConstraintsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:maxHeatFlux"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxHeatFlux"));
+        return false;
+    }
+    m_maxHeatFlux = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxHeatInput"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxHeatInput"));
+        return false;
+    }
+    m_maxHeatInput = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxNormalLoad"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxNormalLoad"));
+        return false;
+    }
+    m_maxNormalLoad = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxQalpha"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxQalpha"));
+        return false;
+    }
+    m_maxQalpha = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxAlphaRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxAlphaRate"));
+        return false;
+    }
+    m_maxAlphaRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxBankRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxBankRate"));
+        return false;
+    }
+    m_maxBankRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxAltitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxAltitude"));
+        return false;
+    }
+    m_maxAltitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVConstraintsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:maxHeatFlux", m_maxHeatFlux);
+    writeSimpleElement(writer, "tns:maxHeatInput", m_maxHeatInput);
+    writeSimpleElement(writer, "tns:maxNormalLoad", m_maxNormalLoad);
+    writeSimpleElement(writer, "tns:maxQalpha", m_maxQalpha);
+    writeSimpleElement(writer, "tns:maxAlphaRate", m_maxAlphaRate);
+    writeSimpleElement(writer, "tns:maxBankRate", m_maxBankRate);
+    writeSimpleElement(writer, "tns:maxAltitude", m_maxAltitude);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVConstraintsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8836,6 +17951,156 @@ QDomElement ScenarioREVSystemType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioREVSystemType* ScenarioREVSystemType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSystemType* v = new ScenarioREVSystemType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSystemType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Weights"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Weights"));
+        return false;
+    }
+    m_Weights = QSharedPointer<ScenarioREVWeights>(ScenarioREVWeights::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Geometry"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Geometry"));
+        return false;
+    }
+    m_Geometry = QSharedPointer<ScenarioREVGeometryType>(ScenarioREVGeometryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TPS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TPS"));
+        return false;
+    }
+    m_TPS = QSharedPointer<ScenarioREVTPS>(ScenarioREVTPS::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AeroThermodynamics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AeroThermodynamics"));
+        return false;
+    }
+    m_AeroThermodynamics = QSharedPointer<ScenarioREVAeroThermodynamicsType>(ScenarioREVAeroThermodynamicsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Parachutes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Parachutes"));
+        return false;
+    }
+    m_Parachutes = QSharedPointer<ScenarioParachutes>(ScenarioParachutes::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Structure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Structure"));
+        return false;
+    }
+    m_Structure = QSharedPointer<ScenarioREVStructureType>(ScenarioREVStructureType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SecondaryPropulsion"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SecondaryPropulsion"));
+        return false;
+    }
+    m_SecondaryPropulsion = QSharedPointer<ScenarioREVSecondaryPropulsionType>(ScenarioREVSecondaryPropulsionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Costs"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Costs"));
+        return false;
+    }
+    m_Costs = QSharedPointer<ScenarioREVCostsType>(ScenarioREVCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Reliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Reliability"));
+        return false;
+    }
+    m_Reliability = QSharedPointer<ScenarioREVReliabilityType>(ScenarioREVReliabilityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVSystemType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Weights.isNull())
+    {
+        QString tagName = "Weights";
+        m_Weights->writeElement(writer, tagName);
+    }
+    if (!m_Geometry.isNull())
+    {
+        QString tagName = "Geometry";
+        m_Geometry->writeElement(writer, tagName);
+    }
+    if (!m_TPS.isNull())
+    {
+        QString tagName = "TPS";
+        m_TPS->writeElement(writer, tagName);
+    }
+    if (!m_AeroThermodynamics.isNull())
+    {
+        QString tagName = "AeroThermodynamics";
+        m_AeroThermodynamics->writeElement(writer, tagName);
+    }
+    if (!m_Parachutes.isNull())
+    {
+        QString tagName = "Parachutes";
+        m_Parachutes->writeElement(writer, tagName);
+    }
+    if (!m_Structure.isNull())
+    {
+        QString tagName = "Structure";
+        m_Structure->writeElement(writer, tagName);
+    }
+    if (!m_SecondaryPropulsion.isNull())
+    {
+        QString tagName = "SecondaryPropulsion";
+        m_SecondaryPropulsion->writeElement(writer, tagName);
+    }
+    if (!m_Costs.isNull())
+    {
+        QString tagName = "Costs";
+        m_Costs->writeElement(writer, tagName);
+    }
+    if (!m_Reliability.isNull())
+    {
+        QString tagName = "Reliability";
+        m_Reliability->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSystemType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8909,6 +18174,61 @@ QDomElement ScenarioParachutes::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioParachutes* ScenarioParachutes::create(QXmlStreamReader& reader)
+{
+    ScenarioParachutes* v = new ScenarioParachutes;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioParachutes::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:nChutes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:nChutes"));
+        return false;
+    }
+    m_nChutes = QSharedPointer<ScenarioOptVarInt>(ScenarioOptVarInt::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    for (;;)
+    {
+        QSharedPointer<ScenarioParachute> v;
+        if (atStartElement(reader, "tns:Parachute"))
+            v = QSharedPointer<ScenarioParachute>(ScenarioParachute::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_Parachute << v;
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioParachutes::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_nChutes.isNull())
+    {
+        QString tagName = "nChutes";
+        m_nChutes->writeElement(writer, tagName);
+    }
+    foreach (QSharedPointer<ScenarioParachute> p, m_Parachute)
+    {
+        QString tagName = "Parachute";
+        p->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioParachutes::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -8987,6 +18307,88 @@ QDomElement ScenarioParachute::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioParachute* ScenarioParachute::create(QXmlStreamReader& reader)
+{
+    ScenarioParachute* v = new ScenarioParachute;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioParachute::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:mass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mass"));
+        return false;
+    }
+    m_mass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:coGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:coGLongPosition"));
+        return false;
+    }
+    m_coGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ropeLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ropeLength"));
+        return false;
+    }
+    m_ropeLength = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ParachuteAerodynamics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ParachuteAerodynamics"));
+        return false;
+    }
+    m_ParachuteAerodynamics = QSharedPointer<ScenarioParachuteAerodynamics>(ScenarioParachuteAerodynamics::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:deployMach"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:deployMach"));
+        return false;
+    }
+    m_deployMach = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioParachute::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:mass", m_mass);
+    writeSimpleElement(writer, "tns:coGLongPosition", m_coGLongPosition);
+    if (!m_ropeLength.isNull())
+    {
+        QString tagName = "ropeLength";
+        m_ropeLength->writeElement(writer, tagName);
+    }
+    if (!m_ParachuteAerodynamics.isNull())
+    {
+        QString tagName = "ParachuteAerodynamics";
+        m_ParachuteAerodynamics->writeElement(writer, tagName);
+    }
+    if (!m_deployMach.isNull())
+    {
+        QString tagName = "deployMach";
+        m_deployMach->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioParachute::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9044,6 +18446,60 @@ QDomElement ScenarioParachuteAerodynamics::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioParachuteAerodynamics* ScenarioParachuteAerodynamics::create(QXmlStreamReader& reader)
+{
+    ScenarioParachuteAerodynamics* v = new ScenarioParachuteAerodynamics;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioParachuteAerodynamics::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:userDefinedAero"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:userDefinedAero"));
+        return false;
+    }
+    m_userDefinedAero = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:referenceArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:referenceArea"));
+        return false;
+    }
+    m_referenceArea = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:lowSpeedCdFileName"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:lowSpeedCdFileName"));
+        return false;
+    }
+    m_lowSpeedCdFileName = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioParachuteAerodynamics::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:userDefinedAero", m_userDefinedAero);
+    if (!m_referenceArea.isNull())
+    {
+        QString tagName = "referenceArea";
+        m_referenceArea->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:lowSpeedCdFileName", m_lowSpeedCdFileName);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioParachuteAerodynamics::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9170,6 +18626,157 @@ QDomElement ScenarioREVStructureType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioREVStructureType* ScenarioREVStructureType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVStructureType* v = new ScenarioREVStructureType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVStructureType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:maxAxialAcc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxAxialAcc"));
+        return false;
+    }
+    m_maxAxialAcc = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxLatAcc"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxLatAcc"));
+        return false;
+    }
+    m_maxLatAcc = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainStructMaterial"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainStructMaterial"));
+        return false;
+    }
+    m_mainStructMaterial = QSharedPointer<ScenarioOptVarString>(ScenarioOptVarString::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainStructThickness"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainStructThickness"));
+        return false;
+    }
+    m_mainStructThickness = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainStructMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainStructMass"));
+        return false;
+    }
+    m_mainStructMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalStructMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalStructMass"));
+        return false;
+    }
+    m_totalStructMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalStructCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalStructCoGLongPosition"));
+        return false;
+    }
+    m_totalStructCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:structuralSafetyMargin"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structuralSafetyMargin"));
+        return false;
+    }
+    m_structuralSafetyMargin = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:airbags"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:airbags"));
+        return false;
+    }
+    m_airbags = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:maxLandingVelWithAirbag"))
+        m_maxLandingVelWithAirbag = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_maxLandingVelWithAirbag.isNull())
+        reader.readNextStartElement();
+    if (atStartElement(reader, "tns:airbagsMass"))
+    {
+        m_airbagsMass = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:airbagsCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:airbagsCoGLongPosition"));
+        return false;
+    }
+    m_airbagsCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVStructureType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_maxAxialAcc.isNull())
+    {
+        QString tagName = "maxAxialAcc";
+        m_maxAxialAcc->writeElement(writer, tagName);
+    }
+    if (!m_maxLatAcc.isNull())
+    {
+        QString tagName = "maxLatAcc";
+        m_maxLatAcc->writeElement(writer, tagName);
+    }
+    if (!m_mainStructMaterial.isNull())
+    {
+        QString tagName = "mainStructMaterial";
+        m_mainStructMaterial->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:mainStructThickness", m_mainStructThickness);
+    writeSimpleElement(writer, "tns:mainStructMass", m_mainStructMass);
+    writeSimpleElement(writer, "tns:totalStructMass", m_totalStructMass);
+    writeSimpleElement(writer, "tns:totalStructCoGLongPosition", m_totalStructCoGLongPosition);
+    if (!m_structuralSafetyMargin.isNull())
+    {
+        QString tagName = "structuralSafetyMargin";
+        m_structuralSafetyMargin->writeElement(writer, tagName);
+    }
+    if (!m_airbags.isNull())
+    {
+        QString tagName = "airbags";
+        m_airbags->writeElement(writer, tagName);
+    }
+    if (!m_maxLandingVelWithAirbag.isNull())
+    {
+        QString tagName = "maxLandingVelWithAirbag";
+        m_maxLandingVelWithAirbag->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:airbagsMass", m_airbagsMass);
+    writeSimpleElement(writer, "tns:airbagsCoGLongPosition", m_airbagsCoGLongPosition);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVStructureType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9240,26 +18847,129 @@ bool ScenarioREVAeroThermodynamicsType::load(const QDomElement& e, QDomElement*
 
 QDomElement ScenarioREVAeroThermodynamicsType::toDomElement(QDomDocument& doc, const QString& elementName) const
 {
-    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    QDomElement e = ScenarioObject::toDomElement(doc, elementName);
+    if (!m_hypersonicTrimAngle.isNull())
+    {
+        QString tagName = "hypersonicTrimAngle";
+        QDomElement child = m_hypersonicTrimAngle->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:REVuserDefinedAero", m_REVuserDefinedAero));
+    e.appendChild(createSimpleElement(doc, "tns:referenceArea", m_referenceArea));
+    e.appendChild(createSimpleElement(doc, "tns:referenceLength", m_referenceLength));
+    foreach (QSharedPointer<ScenarioAeroCoefFileType> p, m_AeroCoefFile)
+    {
+        QString tagName = "AeroCoefFile";
+        QDomElement child = p->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:CoefficientType", m_CoefficientType));
+    e.appendChild(createSimpleElement(doc, "tns:emissivity", m_emissivity));
+    e.appendChild(createSimpleElement(doc, "tns:momentReferencePoint", m_momentReferencePoint));
+    return e;
+}
+
+ScenarioREVAeroThermodynamicsType* ScenarioREVAeroThermodynamicsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVAeroThermodynamicsType* v = new ScenarioREVAeroThermodynamicsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVAeroThermodynamicsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:hypersonicTrimAngle"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:hypersonicTrimAngle"));
+        return false;
+    }
+    m_hypersonicTrimAngle = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:REVuserDefinedAero"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:REVuserDefinedAero"));
+        return false;
+    }
+    m_REVuserDefinedAero = parseBoolean(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:referenceArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:referenceArea"));
+        return false;
+    }
+    m_referenceArea = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:referenceLength"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:referenceLength"));
+        return false;
+    }
+    m_referenceLength = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    for (;;)
+    {
+        QSharedPointer<ScenarioAeroCoefFileType> v;
+        if (atStartElement(reader, "tns:AeroCoefFile"))
+            v = QSharedPointer<ScenarioAeroCoefFileType>(ScenarioAeroCoefFileType::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_AeroCoefFile << v;
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:CoefficientType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoefficientType"));
+        return false;
+    }
+    m_CoefficientType = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:emissivity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:emissivity"));
+        return false;
+    }
+    m_emissivity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:momentReferencePoint"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:momentReferencePoint"));
+        return false;
+    }
+    m_momentReferencePoint = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVAeroThermodynamicsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
     if (!m_hypersonicTrimAngle.isNull())
     {
         QString tagName = "hypersonicTrimAngle";
-        QDomElement child = m_hypersonicTrimAngle->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_hypersonicTrimAngle->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:REVuserDefinedAero", m_REVuserDefinedAero));
-    e.appendChild(createSimpleElement(doc, "tns:referenceArea", m_referenceArea));
-    e.appendChild(createSimpleElement(doc, "tns:referenceLength", m_referenceLength));
+    writeSimpleElement(writer, "tns:REVuserDefinedAero", m_REVuserDefinedAero);
+    writeSimpleElement(writer, "tns:referenceArea", m_referenceArea);
+    writeSimpleElement(writer, "tns:referenceLength", m_referenceLength);
     foreach (QSharedPointer<ScenarioAeroCoefFileType> p, m_AeroCoefFile)
     {
         QString tagName = "AeroCoefFile";
-        QDomElement child = p->toDomElement(doc, tagName);
-        e.appendChild(child);
+        p->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:CoefficientType", m_CoefficientType));
-    e.appendChild(createSimpleElement(doc, "tns:emissivity", m_emissivity));
-    e.appendChild(createSimpleElement(doc, "tns:momentReferencePoint", m_momentReferencePoint));
-    return e;
+    writeSimpleElement(writer, "tns:CoefficientType", m_CoefficientType);
+    writeSimpleElement(writer, "tns:emissivity", m_emissivity);
+    writeSimpleElement(writer, "tns:momentReferencePoint", m_momentReferencePoint);
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioREVAeroThermodynamicsType::children() const
@@ -9358,6 +19068,118 @@ QDomElement ScenarioREVTPS::toDomElement(QDomDocument& doc, const QString& eleme
     return e;
 }
 
+ScenarioREVTPS* ScenarioREVTPS::create(QXmlStreamReader& reader)
+{
+    ScenarioREVTPS* v = new ScenarioREVTPS;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVTPS::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:maxHeatFlux"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxHeatFlux"));
+        return false;
+    }
+    m_maxHeatFlux = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:maxIntegratedHeatLoad"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maxIntegratedHeatLoad"));
+        return false;
+    }
+    m_maxIntegratedHeatLoad = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainTPSReuse"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainTPSReuse"));
+        return false;
+    }
+    m_mainTPSReuse = QSharedPointer<ScenarioOptVarBool>(ScenarioOptVarBool::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainTPSMaterial"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainTPSMaterial"));
+        return false;
+    }
+    m_mainTPSMaterial = QSharedPointer<ScenarioOptVarString>(ScenarioOptVarString::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainTPSThickness"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainTPSThickness"));
+        return false;
+    }
+    m_mainTPSThickness = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:mainTPSMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:mainTPSMass"));
+        return false;
+    }
+    m_mainTPSMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalTPSMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalTPSMass"));
+        return false;
+    }
+    m_totalTPSMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalTPSCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalTPSCoGLongPosition"));
+        return false;
+    }
+    m_totalTPSCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVTPS::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_maxHeatFlux.isNull())
+    {
+        QString tagName = "maxHeatFlux";
+        m_maxHeatFlux->writeElement(writer, tagName);
+    }
+    if (!m_maxIntegratedHeatLoad.isNull())
+    {
+        QString tagName = "maxIntegratedHeatLoad";
+        m_maxIntegratedHeatLoad->writeElement(writer, tagName);
+    }
+    if (!m_mainTPSReuse.isNull())
+    {
+        QString tagName = "mainTPSReuse";
+        m_mainTPSReuse->writeElement(writer, tagName);
+    }
+    if (!m_mainTPSMaterial.isNull())
+    {
+        QString tagName = "mainTPSMaterial";
+        m_mainTPSMaterial->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:mainTPSThickness", m_mainTPSThickness);
+    writeSimpleElement(writer, "tns:mainTPSMass", m_mainTPSMass);
+    writeSimpleElement(writer, "tns:totalTPSMass", m_totalTPSMass);
+    writeSimpleElement(writer, "tns:totalTPSCoGLongPosition", m_totalTPSCoGLongPosition);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVTPS::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9420,6 +19242,55 @@ QDomElement ScenarioREVSecondaryPropulsionType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioREVSecondaryPropulsionType* ScenarioREVSecondaryPropulsionType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSecondaryPropulsionType* v = new ScenarioREVSecondaryPropulsionType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSecondaryPropulsionType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:OMS"))
+        m_OMS = QSharedPointer<ScenarioREVOMSType>(ScenarioREVOMSType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_OMS.isNull())
+        reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RCS"));
+        return false;
+    }
+    m_RCS = QSharedPointer<ScenarioREVRCSType>(ScenarioREVRCSType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVSecondaryPropulsionType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_OMS.isNull())
+    {
+        QString tagName = "OMS";
+        m_OMS->writeElement(writer, tagName);
+    }
+    if (!m_RCS.isNull())
+    {
+        QString tagName = "RCS";
+        m_RCS->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSecondaryPropulsionType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9504,6 +19375,106 @@ QDomElement ScenarioREVOMSType::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioREVOMSType* ScenarioREVOMSType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVOMSType* v = new ScenarioREVOMSType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVOMSType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:thrust"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thrust"));
+        return false;
+    }
+    m_thrust = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:burningTime"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:burningTime"));
+        return false;
+    }
+    m_burningTime = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Isp"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Isp"));
+        return false;
+    }
+    m_Isp = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dryMass"));
+        return false;
+    }
+    m_dryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:dryCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dryCoGLongPosition"));
+        return false;
+    }
+    m_dryCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:propMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propMass"));
+        return false;
+    }
+    m_propMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:length"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:length"));
+        return false;
+    }
+    m_length = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:diameter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:diameter"));
+        return false;
+    }
+    m_diameter = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVOMSType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_thrust.isNull())
+    {
+        QString tagName = "thrust";
+        m_thrust->writeElement(writer, tagName);
+    }
+    if (!m_burningTime.isNull())
+    {
+        QString tagName = "burningTime";
+        m_burningTime->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:Isp", m_Isp);
+    writeSimpleElement(writer, "tns:dryMass", m_dryMass);
+    writeSimpleElement(writer, "tns:dryCoGLongPosition", m_dryCoGLongPosition);
+    writeSimpleElement(writer, "tns:propMass", m_propMass);
+    writeSimpleElement(writer, "tns:length", m_length);
+    writeSimpleElement(writer, "tns:diameter", m_diameter);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVOMSType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9562,6 +19533,60 @@ QDomElement ScenarioREVRCSType::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioREVRCSType* ScenarioREVRCSType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVRCSType* v = new ScenarioREVRCSType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVRCSType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:thrust"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thrust"));
+        return false;
+    }
+    m_thrust = QSharedPointer<ScenarioOptVarDouble>(ScenarioOptVarDouble::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalMass"));
+        return false;
+    }
+    m_totalMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalCoGLongPosition"));
+        return false;
+    }
+    m_totalCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVRCSType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_thrust.isNull())
+    {
+        QString tagName = "thrust";
+        m_thrust->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:totalMass", m_totalMass);
+    writeSimpleElement(writer, "tns:totalCoGLongPosition", m_totalCoGLongPosition);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVRCSType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9622,6 +19647,48 @@ QDomElement ScenarioREVComponentsMassType::toDomElement(QDomDocument& doc, const
     return e;
 }
 
+ScenarioREVComponentsMassType* ScenarioREVComponentsMassType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVComponentsMassType* v = new ScenarioREVComponentsMassType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVComponentsMassType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:avionics"))
+    {
+        m_avionics = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:eps"))
+    {
+        m_eps = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:crewSystems"))
+    {
+        m_crewSystems = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioREVComponentsMassType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:avionics", m_avionics);
+    writeSimpleElement(writer, "tns:eps", m_eps);
+    writeSimpleElement(writer, "tns:crewSystems", m_crewSystems);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVComponentsMassType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9680,6 +19747,58 @@ QDomElement ScenarioREVComponentsType::toDomElement(QDomDocument& doc, const QSt
     return e;
 }
 
+ScenarioREVComponentsType* ScenarioREVComponentsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVComponentsType* v = new ScenarioREVComponentsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVComponentsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Mass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Mass"));
+        return false;
+    }
+    m_Mass = QSharedPointer<ScenarioREVComponentsMassType>(ScenarioREVComponentsMassType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoGLongPosition"));
+        return false;
+    }
+    m_CoGLongPosition = QSharedPointer<ScenarioCoGLongPosition>(ScenarioCoGLongPosition::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVComponentsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Mass.isNull())
+    {
+        QString tagName = "Mass";
+        m_Mass->writeElement(writer, tagName);
+    }
+    if (!m_CoGLongPosition.isNull())
+    {
+        QString tagName = "CoGLongPosition";
+        m_CoGLongPosition->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVComponentsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9741,6 +19860,48 @@ QDomElement ScenarioCoGLongPosition::toDomElement(QDomDocument& doc, const QStri
     return e;
 }
 
+ScenarioCoGLongPosition* ScenarioCoGLongPosition::create(QXmlStreamReader& reader)
+{
+    ScenarioCoGLongPosition* v = new ScenarioCoGLongPosition;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioCoGLongPosition::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (atStartElement(reader, "tns:avionics"))
+    {
+        m_avionics = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:eps"))
+    {
+        m_eps = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (atStartElement(reader, "tns:crewSystems"))
+    {
+        m_crewSystems = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioCoGLongPosition::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:avionics", m_avionics);
+    writeSimpleElement(writer, "tns:eps", m_eps);
+    writeSimpleElement(writer, "tns:crewSystems", m_crewSystems);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioCoGLongPosition::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9849,6 +20010,152 @@ QDomElement ScenarioREVWeights::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioREVWeights* ScenarioREVWeights::create(QXmlStreamReader& reader)
+{
+    ScenarioREVWeights* v = new ScenarioREVWeights;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVWeights::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalDryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalDryMass"));
+        return false;
+    }
+    m_totalDryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalPropellantMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalPropellantMass"));
+        return false;
+    }
+    m_totalPropellantMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalWetMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalWetMass"));
+        return false;
+    }
+    m_totalWetMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalDryCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalDryCoGLongPosition"));
+        return false;
+    }
+    m_totalDryCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalWetCoGLongPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalWetCoGLongPosition"));
+        return false;
+    }
+    m_totalWetCoGLongPosition = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InertialMatrix"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InertialMatrix"));
+        return false;
+    }
+    m_InertialMatrix = QSharedPointer<ScenarioInertialMatrix>(ScenarioInertialMatrix::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:trimStability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:trimStability"));
+        return false;
+    }
+    m_trimStability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:internalVolumeAvailable"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:internalVolumeAvailable"));
+        return false;
+    }
+    m_internalVolumeAvailable = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:internalVolumeRequired"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:internalVolumeRequired"));
+        return false;
+    }
+    m_internalVolumeRequired = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:internalVolumeCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:internalVolumeCstrViolation"));
+        return false;
+    }
+    m_internalVolumeCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CoGShiftCstrViolation"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoGShiftCstrViolation"));
+        return false;
+    }
+    m_CoGShiftCstrViolation = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:redundancyLevel"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:redundancyLevel"));
+        return false;
+    }
+    m_redundancyLevel = QSharedPointer<ScenarioOptVarString>(ScenarioOptVarString::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Components"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Components"));
+        return false;
+    }
+    m_Components = QSharedPointer<ScenarioREVComponentsType>(ScenarioREVComponentsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVWeights::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalDryMass", m_totalDryMass);
+    writeSimpleElement(writer, "tns:totalPropellantMass", m_totalPropellantMass);
+    writeSimpleElement(writer, "tns:totalWetMass", m_totalWetMass);
+    writeSimpleElement(writer, "tns:totalDryCoGLongPosition", m_totalDryCoGLongPosition);
+    writeSimpleElement(writer, "tns:totalWetCoGLongPosition", m_totalWetCoGLongPosition);
+    if (!m_InertialMatrix.isNull())
+    {
+        QString tagName = "InertialMatrix";
+        m_InertialMatrix->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:trimStability", m_trimStability);
+    writeSimpleElement(writer, "tns:internalVolumeAvailable", m_internalVolumeAvailable);
+    writeSimpleElement(writer, "tns:internalVolumeRequired", m_internalVolumeRequired);
+    writeSimpleElement(writer, "tns:internalVolumeCstrViolation", m_internalVolumeCstrViolation);
+    writeSimpleElement(writer, "tns:CoGShiftCstrViolation", m_CoGShiftCstrViolation);
+    if (!m_redundancyLevel.isNull())
+    {
+        QString tagName = "redundancyLevel";
+        m_redundancyLevel->writeElement(writer, tagName);
+    }
+    if (!m_Components.isNull())
+    {
+        QString tagName = "Components";
+        m_Components->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVWeights::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9914,6 +20221,78 @@ QDomElement ScenarioInertialMatrix::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioInertialMatrix* ScenarioInertialMatrix::create(QXmlStreamReader& reader)
+{
+    ScenarioInertialMatrix* v = new ScenarioInertialMatrix;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioInertialMatrix::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ixx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ixx"));
+        return false;
+    }
+    m_ixx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:iyy"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:iyy"));
+        return false;
+    }
+    m_iyy = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:izz"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:izz"));
+        return false;
+    }
+    m_izz = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ixy"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ixy"));
+        return false;
+    }
+    m_ixy = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:ixz"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ixz"));
+        return false;
+    }
+    m_ixz = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:iyz"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:iyz"));
+        return false;
+    }
+    m_iyz = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioInertialMatrix::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:ixx", m_ixx);
+    writeSimpleElement(writer, "tns:iyy", m_iyy);
+    writeSimpleElement(writer, "tns:izz", m_izz);
+    writeSimpleElement(writer, "tns:ixy", m_ixy);
+    writeSimpleElement(writer, "tns:ixz", m_ixz);
+    writeSimpleElement(writer, "tns:iyz", m_iyz);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioInertialMatrix::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -9979,6 +20358,76 @@ QDomElement ScenarioREVSystemCostsType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioREVSystemCostsType* ScenarioREVSystemCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSystemCostsType* v = new ScenarioREVSystemCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSystemCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:systemDevelopmentCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:systemDevelopmentCost"));
+        return false;
+    }
+    m_systemDevelopmentCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:systemProductionCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:systemProductionCost"));
+        return false;
+    }
+    m_systemProductionCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:flightOperationsCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:flightOperationsCost"));
+        return false;
+    }
+    m_flightOperationsCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:recoveryCost"))
+    {
+        m_recoveryCost = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:groundFacilitiesCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:groundFacilitiesCost"));
+        return false;
+    }
+    m_groundFacilitiesCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:fixedGroundCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:fixedGroundCost"));
+        return false;
+    }
+    m_fixedGroundCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVSystemCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:systemDevelopmentCost", m_systemDevelopmentCost);
+    writeSimpleElement(writer, "tns:systemProductionCost", m_systemProductionCost);
+    writeSimpleElement(writer, "tns:flightOperationsCost", m_flightOperationsCost);
+    writeSimpleElement(writer, "tns:recoveryCost", m_recoveryCost);
+    writeSimpleElement(writer, "tns:groundFacilitiesCost", m_groundFacilitiesCost);
+    writeSimpleElement(writer, "tns:fixedGroundCost", m_fixedGroundCost);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSystemCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10069,6 +20518,107 @@ QDomElement ScenarioREVCostsType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioREVCostsType* ScenarioREVCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVCostsType* v = new ScenarioREVCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:lifeCycleCost"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:lifeCycleCost"));
+        return false;
+    }
+    m_lifeCycleCost = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:costPerMission"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:costPerMission"));
+        return false;
+    }
+    m_costPerMission = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:costPerKilo"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:costPerKilo"));
+        return false;
+    }
+    m_costPerKilo = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SystemCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemCosts"));
+        return false;
+    }
+    m_SystemCosts = QSharedPointer<ScenarioREVSystemCostsType>(ScenarioREVSystemCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SubsystemsDevelopCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SubsystemsDevelopCosts"));
+        return false;
+    }
+    m_SubsystemsDevelopCosts = QSharedPointer<ScenarioREVSubsystemsDevelopCostsType>(ScenarioREVSubsystemsDevelopCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SubsystemsProductionCosts"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SubsystemsProductionCosts"));
+        return false;
+    }
+    m_SubsystemsProductionCosts = QSharedPointer<ScenarioREVSubsystemsProductionCostsType>(ScenarioREVSubsystemsProductionCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:SubsystemsRefurbishmentCosts"))
+        m_SubsystemsRefurbishmentCosts = QSharedPointer<ScenarioREVSubsystemsRefurbishmentCostsType>(ScenarioREVSubsystemsRefurbishmentCostsType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_SubsystemsRefurbishmentCosts.isNull())
+        reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:lifeCycleCost", m_lifeCycleCost);
+    writeSimpleElement(writer, "tns:costPerMission", m_costPerMission);
+    writeSimpleElement(writer, "tns:costPerKilo", m_costPerKilo);
+    if (!m_SystemCosts.isNull())
+    {
+        QString tagName = "SystemCosts";
+        m_SystemCosts->writeElement(writer, tagName);
+    }
+    if (!m_SubsystemsDevelopCosts.isNull())
+    {
+        QString tagName = "SubsystemsDevelopCosts";
+        m_SubsystemsDevelopCosts->writeElement(writer, tagName);
+    }
+    if (!m_SubsystemsProductionCosts.isNull())
+    {
+        QString tagName = "SubsystemsProductionCosts";
+        m_SubsystemsProductionCosts->writeElement(writer, tagName);
+    }
+    if (!m_SubsystemsRefurbishmentCosts.isNull())
+    {
+        QString tagName = "SubsystemsRefurbishmentCosts";
+        m_SubsystemsRefurbishmentCosts->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10146,6 +20696,92 @@ QDomElement ScenarioREVSubsystemsRefurbishmentCostsType::toDomElement(QDomDocume
     return e;
 }
 
+ScenarioREVSubsystemsRefurbishmentCostsType* ScenarioREVSubsystemsRefurbishmentCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSubsystemsRefurbishmentCostsType* v = new ScenarioREVSubsystemsRefurbishmentCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSubsystemsRefurbishmentCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:structure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structure"));
+        return false;
+    }
+    m_structure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TPS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TPS"));
+        return false;
+    }
+    m_TPS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:avionics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:avionics"));
+        return false;
+    }
+    m_avionics = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OMS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OMS"));
+        return false;
+    }
+    m_OMS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RCS"));
+        return false;
+    }
+    m_RCS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:parachutes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:parachutes"));
+        return false;
+    }
+    m_parachutes = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:airbags"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:airbags"));
+        return false;
+    }
+    m_airbags = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:crewSystems"))
+    {
+        m_crewSystems = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioREVSubsystemsRefurbishmentCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:structure", m_structure);
+    writeSimpleElement(writer, "tns:TPS", m_TPS);
+    writeSimpleElement(writer, "tns:avionics", m_avionics);
+    writeSimpleElement(writer, "tns:OMS", m_OMS);
+    writeSimpleElement(writer, "tns:RCS", m_RCS);
+    writeSimpleElement(writer, "tns:parachutes", m_parachutes);
+    writeSimpleElement(writer, "tns:airbags", m_airbags);
+    writeSimpleElement(writer, "tns:crewSystems", m_crewSystems);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSubsystemsRefurbishmentCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10223,6 +20859,100 @@ QDomElement ScenarioREVSubsystemsProductionCostsType::toDomElement(QDomDocument&
     return e;
 }
 
+ScenarioREVSubsystemsProductionCostsType* ScenarioREVSubsystemsProductionCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSubsystemsProductionCostsType* v = new ScenarioREVSubsystemsProductionCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSubsystemsProductionCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:structure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structure"));
+        return false;
+    }
+    m_structure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TPS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TPS"));
+        return false;
+    }
+    m_TPS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:avionics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:avionics"));
+        return false;
+    }
+    m_avionics = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OMS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OMS"));
+        return false;
+    }
+    m_OMS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RCS"));
+        return false;
+    }
+    m_RCS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:parachutes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:parachutes"));
+        return false;
+    }
+    m_parachutes = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:airbags"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:airbags"));
+        return false;
+    }
+    m_airbags = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:crewSystems"))
+    {
+        m_crewSystems = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    if (!atStartElement(reader, "tns:propellants"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propellants"));
+        return false;
+    }
+    m_propellants = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVSubsystemsProductionCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:structure", m_structure);
+    writeSimpleElement(writer, "tns:TPS", m_TPS);
+    writeSimpleElement(writer, "tns:avionics", m_avionics);
+    writeSimpleElement(writer, "tns:OMS", m_OMS);
+    writeSimpleElement(writer, "tns:RCS", m_RCS);
+    writeSimpleElement(writer, "tns:parachutes", m_parachutes);
+    writeSimpleElement(writer, "tns:airbags", m_airbags);
+    writeSimpleElement(writer, "tns:crewSystems", m_crewSystems);
+    writeSimpleElement(writer, "tns:propellants", m_propellants);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSubsystemsProductionCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10296,6 +21026,92 @@ QDomElement ScenarioREVSubsystemsDevelopCostsType::toDomElement(QDomDocument& do
     return e;
 }
 
+ScenarioREVSubsystemsDevelopCostsType* ScenarioREVSubsystemsDevelopCostsType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSubsystemsDevelopCostsType* v = new ScenarioREVSubsystemsDevelopCostsType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSubsystemsDevelopCostsType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:structure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structure"));
+        return false;
+    }
+    m_structure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TPS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TPS"));
+        return false;
+    }
+    m_TPS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:avionics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:avionics"));
+        return false;
+    }
+    m_avionics = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OMS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OMS"));
+        return false;
+    }
+    m_OMS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RCS"));
+        return false;
+    }
+    m_RCS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:parachutes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:parachutes"));
+        return false;
+    }
+    m_parachutes = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:airbags"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:airbags"));
+        return false;
+    }
+    m_airbags = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:crewSystems"))
+    {
+        m_crewSystems = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioREVSubsystemsDevelopCostsType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:structure", m_structure);
+    writeSimpleElement(writer, "tns:TPS", m_TPS);
+    writeSimpleElement(writer, "tns:avionics", m_avionics);
+    writeSimpleElement(writer, "tns:OMS", m_OMS);
+    writeSimpleElement(writer, "tns:RCS", m_RCS);
+    writeSimpleElement(writer, "tns:parachutes", m_parachutes);
+    writeSimpleElement(writer, "tns:airbags", m_airbags);
+    writeSimpleElement(writer, "tns:crewSystems", m_crewSystems);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSubsystemsDevelopCostsType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10356,6 +21172,68 @@ QDomElement ScenarioREVReliabilityType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioREVReliabilityType* ScenarioREVReliabilityType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVReliabilityType* v = new ScenarioREVReliabilityType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVReliabilityType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:globalVehicleReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:globalVehicleReliability"));
+        return false;
+    }
+    m_globalVehicleReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:softwareReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:softwareReliability"));
+        return false;
+    }
+    m_softwareReliability = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:crewSafety"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:crewSafety"));
+        return false;
+    }
+    m_crewSafety = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SubsystemsReliability"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SubsystemsReliability"));
+        return false;
+    }
+    m_SubsystemsReliability = QSharedPointer<ScenarioREVSubsystemsReliablityType>(ScenarioREVSubsystemsReliablityType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioREVReliabilityType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:globalVehicleReliability", m_globalVehicleReliability);
+    writeSimpleElement(writer, "tns:softwareReliability", m_softwareReliability);
+    writeSimpleElement(writer, "tns:crewSafety", m_crewSafety);
+    if (!m_SubsystemsReliability.isNull())
+    {
+        QString tagName = "SubsystemsReliability";
+        m_SubsystemsReliability->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVReliabilityType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10430,6 +21308,92 @@ QDomElement ScenarioREVSubsystemsReliablityType::toDomElement(QDomDocument& doc,
     return e;
 }
 
+ScenarioREVSubsystemsReliablityType* ScenarioREVSubsystemsReliablityType::create(QXmlStreamReader& reader)
+{
+    ScenarioREVSubsystemsReliablityType* v = new ScenarioREVSubsystemsReliablityType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioREVSubsystemsReliablityType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:structure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:structure"));
+        return false;
+    }
+    m_structure = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TPS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TPS"));
+        return false;
+    }
+    m_TPS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:avionics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:avionics"));
+        return false;
+    }
+    m_avionics = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OMS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OMS"));
+        return false;
+    }
+    m_OMS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:RCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:RCS"));
+        return false;
+    }
+    m_RCS = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:parachutes"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:parachutes"));
+        return false;
+    }
+    m_parachutes = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:airbags"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:airbags"));
+        return false;
+    }
+    m_airbags = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:crewSystems"))
+    {
+        m_crewSystems = parseDouble(reader.readElementText());
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioREVSubsystemsReliablityType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:structure", m_structure);
+    writeSimpleElement(writer, "tns:TPS", m_TPS);
+    writeSimpleElement(writer, "tns:avionics", m_avionics);
+    writeSimpleElement(writer, "tns:OMS", m_OMS);
+    writeSimpleElement(writer, "tns:RCS", m_RCS);
+    writeSimpleElement(writer, "tns:parachutes", m_parachutes);
+    writeSimpleElement(writer, "tns:airbags", m_airbags);
+    writeSimpleElement(writer, "tns:crewSystems", m_crewSystems);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioREVSubsystemsReliablityType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10486,46 +21450,145 @@ if (!m_OutputFiles.isNull())
     return true;
 }
 
-QDomElement ScenarioSC::toDomElement(QDomDocument& doc, const QString& elementName) const
+QDomElement ScenarioSC::toDomElement(QDomDocument& doc, const QString& elementName) const
+{
+    QDomElement e = ScenarioParticipantType::toDomElement(doc, elementName);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        QDomElement child = m_ElementIdentifier->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_SCProgram.isNull())
+    {
+        QString tagName = "SCProgram";
+        QDomElement child = m_SCProgram->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_SCMission.isNull())
+    {
+        QString tagName = "SCMission";
+        QDomElement child = m_SCMission->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_System.isNull())
+    {
+        QString tagName = "System";
+        QDomElement child = m_System->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_Optimization.isNull())
+    {
+        QString tagName = "Optimization";
+        QDomElement child = m_Optimization->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_OutputFiles.isNull())
+    {
+        QString tagName = "OutputFiles";
+        QDomElement child = m_OutputFiles->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    return e;
+}
+
+ScenarioSC* ScenarioSC::create(QXmlStreamReader& reader)
+{
+    ScenarioSC* v = new ScenarioSC;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSC::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioParticipantType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:SCProgram"))
+        m_SCProgram = QSharedPointer<ScenarioSCProgram>(ScenarioSCProgram::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_SCProgram.isNull())
+        reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SCMission"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SCMission"));
+        return false;
+    }
+    m_SCMission = QSharedPointer<ScenarioSCMission>(ScenarioSCMission::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:System"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:System"));
+        return false;
+    }
+    m_System = QSharedPointer<ScenarioSCSystemType>(ScenarioSCSystemType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:Optimization"))
+        m_Optimization = QSharedPointer<ScenarioOptimization>(ScenarioOptimization::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_Optimization.isNull())
+        reader.readNextStartElement();
+    if (atStartElement(reader, "tns:OutputFiles"))
+        m_OutputFiles = QSharedPointer<ScenarioOutputFiles>(ScenarioOutputFiles::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_OutputFiles.isNull())
+        reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSC::writeContents(QXmlStreamWriter& writer) const
 {
-    QDomElement e = ScenarioParticipantType::toDomElement(doc, elementName);
+    ScenarioParticipantType::writeContents(writer);
     if (!m_ElementIdentifier.isNull())
     {
         QString tagName = "ElementIdentifier";
-        QDomElement child = m_ElementIdentifier->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_ElementIdentifier->writeElement(writer, tagName);
     }
     if (!m_SCProgram.isNull())
     {
         QString tagName = "SCProgram";
-        QDomElement child = m_SCProgram->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_SCProgram->writeElement(writer, tagName);
     }
     if (!m_SCMission.isNull())
     {
         QString tagName = "SCMission";
-        QDomElement child = m_SCMission->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_SCMission->writeElement(writer, tagName);
     }
     if (!m_System.isNull())
     {
         QString tagName = "System";
-        QDomElement child = m_System->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_System->writeElement(writer, tagName);
     }
     if (!m_Optimization.isNull())
     {
         QString tagName = "Optimization";
-        QDomElement child = m_Optimization->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_Optimization->writeElement(writer, tagName);
     }
     if (!m_OutputFiles.isNull())
     {
         QString tagName = "OutputFiles";
-        QDomElement child = m_OutputFiles->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_OutputFiles->writeElement(writer, tagName);
     }
-    return e;
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioSC::children() const
@@ -10572,6 +21635,30 @@ QDomElement ScenarioSCProgram::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioSCProgram* ScenarioSCProgram::create(QXmlStreamReader& reader)
+{
+    ScenarioSCProgram* v = new ScenarioSCProgram;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSCProgram::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioSCProgram::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSCProgram::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10630,6 +21717,58 @@ QDomElement ScenarioSCMission::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioSCMission* ScenarioSCMission::create(QXmlStreamReader& reader)
+{
+    ScenarioSCMission* v = new ScenarioSCMission;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSCMission::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:TrajectoryPlan"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TrajectoryPlan"));
+        return false;
+    }
+    m_TrajectoryPlan = QSharedPointer<ScenarioTrajectoryPlan>(ScenarioTrajectoryPlan::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PayloadSet"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PayloadSet"));
+        return false;
+    }
+    m_PayloadSet = QSharedPointer<ScenarioPayloadSet>(ScenarioPayloadSet::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSCMission::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_TrajectoryPlan.isNull())
+    {
+        QString tagName = "TrajectoryPlan";
+        m_TrajectoryPlan->writeElement(writer, tagName);
+    }
+    if (!m_PayloadSet.isNull())
+    {
+        QString tagName = "PayloadSet";
+        m_PayloadSet->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSCMission::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10716,6 +21855,77 @@ QDomElement ScenarioTrajectoryPlan::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioTrajectoryPlan* ScenarioTrajectoryPlan::create(QXmlStreamReader& reader)
+{
+    ScenarioTrajectoryPlan* v = new ScenarioTrajectoryPlan;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTrajectoryPlan::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    for (;;)
+    {
+        QSharedPointer<ScenarioAbstractTrajectoryType> v;
+        if (atStartElement(reader, "tns:EntryArc"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioEntryArcType::create(reader));
+        else if (atStartElement(reader, "tns:Loitering"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioLoiteringType::create(reader));
+        else if (atStartElement(reader, "tns:Lagrangian"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioLagrangianType::create(reader));
+        else if (atStartElement(reader, "tns:FlyBy"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioFlyByType::create(reader));
+        else if (atStartElement(reader, "tns:LoiteringTLE"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioLoiteringTLEType::create(reader));
+        else if (atStartElement(reader, "tns:External"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioExternalType::create(reader));
+        else if (atStartElement(reader, "tns:DeltaV"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioDeltaVType::create(reader));
+        else if (atStartElement(reader, "tns:RendezVousManoeuvre"))
+            v = QSharedPointer<ScenarioAbstractTrajectoryType>((ScenarioAbstractTrajectoryType*)ScenarioRendezVousManoeuvreType::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_AbstractTrajectory << v;
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void ScenarioTrajectoryPlan::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    foreach (QSharedPointer<ScenarioAbstractTrajectoryType> p, m_AbstractTrajectory)
+    {
+        QString tagName = "AbstractTrajectory";
+        if (dynamic_cast<ScenarioEntryArcType*>(p.data()))
+            tagName = "EntryArc";
+        else if (dynamic_cast<ScenarioLoiteringType*>(p.data()))
+            tagName = "Loitering";
+        else if (dynamic_cast<ScenarioLagrangianType*>(p.data()))
+            tagName = "Lagrangian";
+        else if (dynamic_cast<ScenarioFlyByType*>(p.data()))
+            tagName = "FlyBy";
+        else if (dynamic_cast<ScenarioLoiteringTLEType*>(p.data()))
+            tagName = "LoiteringTLE";
+        else if (dynamic_cast<ScenarioExternalType*>(p.data()))
+            tagName = "External";
+        else if (dynamic_cast<ScenarioDeltaVType*>(p.data()))
+            tagName = "DeltaV";
+        else if (dynamic_cast<ScenarioRendezVousManoeuvreType*>(p.data()))
+            tagName = "RendezVousManoeuvre";
+        p->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTrajectoryPlan::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10835,6 +22045,139 @@ QDomElement ScenarioLoiteringType::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioLoiteringType* ScenarioLoiteringType::create(QXmlStreamReader& reader)
+{
+    ScenarioLoiteringType* v = new ScenarioLoiteringType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLoiteringType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Environment"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Environment"));
+        return false;
+    }
+    m_Environment = QSharedPointer<ScenarioEnvironmentType>(ScenarioEnvironmentType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TimeLine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TimeLine"));
+        return false;
+    }
+    m_TimeLine = QSharedPointer<ScenarioTimeLine>(ScenarioTimeLine::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialPosition"));
+        return false;
+    }
+    m_InitialPosition = QSharedPointer<ScenarioInitialPositionType>(ScenarioInitialPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialAttitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialAttitude"));
+        return false;
+    }
+    m_InitialAttitude = QSharedPointer<ScenarioInitialAttitudeType>(ScenarioInitialAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialAttitudeUsingQuaternions"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialAttitudeUsingQuaternions"));
+        return false;
+    }
+    m_InitialAttitudeUsingQuaternions = QSharedPointer<ScenarioInitialAttitudeUsingQuaternionsType>(ScenarioInitialAttitudeUsingQuaternionsType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropagationPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropagationPosition"));
+        return false;
+    }
+    m_PropagationPosition = QSharedPointer<ScenarioPropagationPositionType>(ScenarioPropagationPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropagationAttitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropagationAttitude"));
+        return false;
+    }
+    m_PropagationAttitude = QSharedPointer<ScenarioPropagationAttitudeType>(ScenarioPropagationAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (atStartElement(reader, "tns:TrajectoryStoppingCondition"))
+        m_TrajectoryStoppingCondition = QSharedPointer<ScenarioTrajectoryStoppingConditionType>(ScenarioTrajectoryStoppingConditionType::create(reader));
+    if (reader.hasError())
+        return false;
+    if (!m_TrajectoryStoppingCondition.isNull())
+        reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLoiteringType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+    if (!m_Environment.isNull())
+    {
+        QString tagName = "Environment";
+        m_Environment->writeElement(writer, tagName);
+    }
+    if (!m_TimeLine.isNull())
+    {
+        QString tagName = "TimeLine";
+        m_TimeLine->writeElement(writer, tagName);
+    }
+    if (!m_InitialPosition.isNull())
+    {
+        QString tagName = "InitialPosition";
+        m_InitialPosition->writeElement(writer, tagName);
+    }
+    if (!m_InitialAttitude.isNull())
+    {
+        QString tagName = "InitialAttitude";
+        m_InitialAttitude->writeElement(writer, tagName);
+    }
+    if (!m_InitialAttitudeUsingQuaternions.isNull())
+    {
+        QString tagName = "InitialAttitudeUsingQuaternions";
+        m_InitialAttitudeUsingQuaternions->writeElement(writer, tagName);
+    }
+    if (!m_PropagationPosition.isNull())
+    {
+        QString tagName = "PropagationPosition";
+        m_PropagationPosition->writeElement(writer, tagName);
+    }
+    if (!m_PropagationAttitude.isNull())
+    {
+        QString tagName = "PropagationAttitude";
+        m_PropagationAttitude->writeElement(writer, tagName);
+    }
+    if (!m_TrajectoryStoppingCondition.isNull())
+    {
+        QString tagName = "TrajectoryStoppingCondition";
+        m_TrajectoryStoppingCondition->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLoiteringType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10900,6 +22243,68 @@ QDomElement ScenarioLoiteringTLEType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioLoiteringTLEType* ScenarioLoiteringTLEType::create(QXmlStreamReader& reader)
+{
+    ScenarioLoiteringTLEType* v = new ScenarioLoiteringTLEType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLoiteringTLEType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:TimeLine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TimeLine"));
+        return false;
+    }
+    m_TimeLine = QSharedPointer<ScenarioTimeLine>(ScenarioTimeLine::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tleLine0"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tleLine0"));
+        return false;
+    }
+    m_tleLine0 = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tleLine1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tleLine1"));
+        return false;
+    }
+    m_tleLine1 = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:tleLine2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:tleLine2"));
+        return false;
+    }
+    m_tleLine2 = reader.readElementText();
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLoiteringTLEType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+    if (!m_TimeLine.isNull())
+    {
+        QString tagName = "TimeLine";
+        m_TimeLine->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:tleLine0", m_tleLine0);
+    writeSimpleElement(writer, "tns:tleLine1", m_tleLine1);
+    writeSimpleElement(writer, "tns:tleLine2", m_tleLine2);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLoiteringTLEType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10939,6 +22344,30 @@ QDomElement ScenarioLagrangianType::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioLagrangianType* ScenarioLagrangianType::create(QXmlStreamReader& reader)
+{
+    ScenarioLagrangianType* v = new ScenarioLagrangianType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLagrangianType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioLagrangianType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLagrangianType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -10977,6 +22406,30 @@ QDomElement ScenarioFlyByType::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioFlyByType* ScenarioFlyByType::create(QXmlStreamReader& reader)
+{
+    ScenarioFlyByType* v = new ScenarioFlyByType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioFlyByType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    return !reader.hasError();
+}
+
+void ScenarioFlyByType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioFlyByType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11034,6 +22487,68 @@ QDomElement ScenarioExternalType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioExternalType* ScenarioExternalType::create(QXmlStreamReader& reader)
+{
+    ScenarioExternalType* v = new ScenarioExternalType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioExternalType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:CentralBody"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CentralBody"));
+        return false;
+    }
+    m_CentralBody = QSharedPointer<ScenarioCentralBodyType>(ScenarioCentralBodyType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CoordinateSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoordinateSystem"));
+        return false;
+    }
+    m_CoordinateSystem = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TimeTags"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TimeTags"));
+        return false;
+    }
+    m_TimeTags = parseDateTimeList(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:States"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:States"));
+        return false;
+    }
+    m_States = parseDoubleList(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioExternalType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+    if (!m_CentralBody.isNull())
+    {
+        QString tagName = "CentralBody";
+        m_CentralBody->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:CoordinateSystem", m_CoordinateSystem);
+    writeSimpleElement(writer, "tns:TimeTags", m_TimeTags);
+    writeSimpleElement(writer, "tns:States", m_States);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioExternalType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11095,38 +22610,150 @@ bool ScenarioDeltaVType::load(const QDomElement& e, QDomElement* next)
     return true;
 }
 
-QDomElement ScenarioDeltaVType::toDomElement(QDomDocument& doc, const QString& elementName) const
+QDomElement ScenarioDeltaVType::toDomElement(QDomDocument& doc, const QString& elementName) const
+{
+    QDomElement e = ScenarioAbstractTrajectoryType::toDomElement(doc, elementName);
+    if (!m_Environment.isNull())
+    {
+        QString tagName = "Environment";
+        QDomElement child = m_Environment->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_TimeLine.isNull())
+    {
+        QString tagName = "TimeLine";
+        QDomElement child = m_TimeLine->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_InitialPosition.isNull())
+    {
+        QString tagName = "InitialPosition";
+        QDomElement child = m_InitialPosition->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    if (!m_InitialAttitude.isNull())
+    {
+        QString tagName = "InitialAttitude";
+        QDomElement child = m_InitialAttitude->toDomElement(doc, tagName);
+        e.appendChild(child);
+    }
+    e.appendChild(createSimpleElement(doc, "tns:DeltaVx", m_DeltaVx));
+    e.appendChild(createSimpleElement(doc, "tns:DeltaVy", m_DeltaVy));
+    e.appendChild(createSimpleElement(doc, "tns:DeltaVz", m_DeltaVz));
+    e.appendChild(createSimpleElement(doc, "tns:Magnitude", m_Magnitude));
+    return e;
+}
+
+ScenarioDeltaVType* ScenarioDeltaVType::create(QXmlStreamReader& reader)
+{
+    ScenarioDeltaVType* v = new ScenarioDeltaVType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioDeltaVType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Environment"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Environment"));
+        return false;
+    }
+    m_Environment = QSharedPointer<ScenarioEnvironmentType>(ScenarioEnvironmentType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TimeLine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TimeLine"));
+        return false;
+    }
+    m_TimeLine = QSharedPointer<ScenarioTimeLine>(ScenarioTimeLine::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialPosition"));
+        return false;
+    }
+    m_InitialPosition = QSharedPointer<ScenarioInitialPositionType>(ScenarioInitialPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialAttitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialAttitude"));
+        return false;
+    }
+    m_InitialAttitude = QSharedPointer<ScenarioInitialAttitudeType>(ScenarioInitialAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DeltaVx"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DeltaVx"));
+        return false;
+    }
+    m_DeltaVx = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DeltaVy"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DeltaVy"));
+        return false;
+    }
+    m_DeltaVy = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DeltaVz"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DeltaVz"));
+        return false;
+    }
+    m_DeltaVz = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Magnitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Magnitude"));
+        return false;
+    }
+    m_Magnitude = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioDeltaVType::writeContents(QXmlStreamWriter& writer) const
 {
-    QDomElement e = ScenarioAbstractTrajectoryType::toDomElement(doc, elementName);
+    ScenarioAbstractTrajectoryType::writeContents(writer);
     if (!m_Environment.isNull())
     {
         QString tagName = "Environment";
-        QDomElement child = m_Environment->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_Environment->writeElement(writer, tagName);
     }
     if (!m_TimeLine.isNull())
     {
         QString tagName = "TimeLine";
-        QDomElement child = m_TimeLine->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_TimeLine->writeElement(writer, tagName);
     }
     if (!m_InitialPosition.isNull())
     {
         QString tagName = "InitialPosition";
-        QDomElement child = m_InitialPosition->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_InitialPosition->writeElement(writer, tagName);
     }
     if (!m_InitialAttitude.isNull())
     {
         QString tagName = "InitialAttitude";
-        QDomElement child = m_InitialAttitude->toDomElement(doc, tagName);
-        e.appendChild(child);
+        m_InitialAttitude->writeElement(writer, tagName);
     }
-    e.appendChild(createSimpleElement(doc, "tns:DeltaVx", m_DeltaVx));
-    e.appendChild(createSimpleElement(doc, "tns:DeltaVy", m_DeltaVy));
-    e.appendChild(createSimpleElement(doc, "tns:DeltaVz", m_DeltaVz));
-    e.appendChild(createSimpleElement(doc, "tns:Magnitude", m_Magnitude));
-    return e;
+    writeSimpleElement(writer, "tns:DeltaVx", m_DeltaVx);
+    writeSimpleElement(writer, "tns:DeltaVy", m_DeltaVy);
+    writeSimpleElement(writer, "tns:DeltaVz", m_DeltaVz);
+    writeSimpleElement(writer, "tns:Magnitude", m_Magnitude);
 }
 
 QList<QSharedPointer<ScenarioObject> >ScenarioDeltaVType::children() const
@@ -11251,6 +22878,154 @@ QDomElement ScenarioRendezVousManoeuvreType::toDomElement(QDomDocument& doc, con
     return e;
 }
 
+ScenarioRendezVousManoeuvreType* ScenarioRendezVousManoeuvreType::create(QXmlStreamReader& reader)
+{
+    ScenarioRendezVousManoeuvreType* v = new ScenarioRendezVousManoeuvreType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioRendezVousManoeuvreType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractTrajectoryType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Environment"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Environment"));
+        return false;
+    }
+    m_Environment = QSharedPointer<ScenarioEnvironmentType>(ScenarioEnvironmentType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TimeLine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TimeLine"));
+        return false;
+    }
+    m_TimeLine = QSharedPointer<ScenarioTimeLine>(ScenarioTimeLine::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DeltaV1"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DeltaV1"));
+        return false;
+    }
+    m_DeltaV1 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DeltaV2"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DeltaV2"));
+        return false;
+    }
+    m_DeltaV2 = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Input"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Input"));
+        return false;
+    }
+    m_Input = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Duration"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Duration"));
+        return false;
+    }
+    m_Duration = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TotalDeltaV"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TotalDeltaV"));
+        return false;
+    }
+    m_TotalDeltaV = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialPosition"));
+        return false;
+    }
+    m_InitialPosition = QSharedPointer<ScenarioInitialPositionType>(ScenarioInitialPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:InitialAttitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:InitialAttitude"));
+        return false;
+    }
+    m_InitialAttitude = QSharedPointer<ScenarioInitialAttitudeType>(ScenarioInitialAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropagationPosition"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropagationPosition"));
+        return false;
+    }
+    m_PropagationPosition = QSharedPointer<ScenarioPropagationPositionType>(ScenarioPropagationPositionType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PropagationAttitude"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PropagationAttitude"));
+        return false;
+    }
+    m_PropagationAttitude = QSharedPointer<ScenarioPropagationAttitudeType>(ScenarioPropagationAttitudeType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioRendezVousManoeuvreType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractTrajectoryType::writeContents(writer);
+    if (!m_Environment.isNull())
+    {
+        QString tagName = "Environment";
+        m_Environment->writeElement(writer, tagName);
+    }
+    if (!m_TimeLine.isNull())
+    {
+        QString tagName = "TimeLine";
+        m_TimeLine->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:DeltaV1", m_DeltaV1);
+    writeSimpleElement(writer, "tns:DeltaV2", m_DeltaV2);
+    writeSimpleElement(writer, "tns:Input", m_Input);
+    writeSimpleElement(writer, "tns:Duration", m_Duration);
+    writeSimpleElement(writer, "tns:TotalDeltaV", m_TotalDeltaV);
+    if (!m_InitialPosition.isNull())
+    {
+        QString tagName = "InitialPosition";
+        m_InitialPosition->writeElement(writer, tagName);
+    }
+    if (!m_InitialAttitude.isNull())
+    {
+        QString tagName = "InitialAttitude";
+        m_InitialAttitude->writeElement(writer, tagName);
+    }
+    if (!m_PropagationPosition.isNull())
+    {
+        QString tagName = "PropagationPosition";
+        m_PropagationPosition->writeElement(writer, tagName);
+    }
+    if (!m_PropagationAttitude.isNull())
+    {
+        QString tagName = "PropagationAttitude";
+        m_PropagationAttitude->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioRendezVousManoeuvreType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11385,6 +23160,156 @@ QDomElement ScenarioSCSystemType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioSCSystemType* ScenarioSCSystemType::create(QXmlStreamReader& reader)
+{
+    ScenarioSCSystemType* v = new ScenarioSCSystemType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSCSystemType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:SystemBudgets"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SystemBudgets"));
+        return false;
+    }
+    m_SystemBudgets = QSharedPointer<ScenarioSystemBudgets>(ScenarioSystemBudgets::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SCAerodynamics"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SCAerodynamics"));
+        return false;
+    }
+    m_SCAerodynamics = QSharedPointer<ScenarioSCAerodynamics>(ScenarioSCAerodynamics::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Propulsion"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Propulsion"));
+        return false;
+    }
+    m_Propulsion = QSharedPointer<ScenarioPropulsion>(ScenarioPropulsion::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Structure"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Structure"));
+        return false;
+    }
+    m_Structure = QSharedPointer<ScenarioStructure>(ScenarioStructure::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TCS"));
+        return false;
+    }
+    m_TCS = QSharedPointer<ScenarioTCS>(ScenarioTCS::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:EPS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:EPS"));
+        return false;
+    }
+    m_EPS = QSharedPointer<ScenarioEPS>(ScenarioEPS::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TTC"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TTC"));
+        return false;
+    }
+    m_TTC = QSharedPointer<ScenarioTTC>(ScenarioTTC::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:AOCS"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:AOCS"));
+        return false;
+    }
+    m_AOCS = QSharedPointer<ScenarioAOCS>(ScenarioAOCS::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:OBDH"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:OBDH"));
+        return false;
+    }
+    m_OBDH = QSharedPointer<ScenarioOBDH>(ScenarioOBDH::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSCSystemType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_SystemBudgets.isNull())
+    {
+        QString tagName = "SystemBudgets";
+        m_SystemBudgets->writeElement(writer, tagName);
+    }
+    if (!m_SCAerodynamics.isNull())
+    {
+        QString tagName = "SCAerodynamics";
+        m_SCAerodynamics->writeElement(writer, tagName);
+    }
+    if (!m_Propulsion.isNull())
+    {
+        QString tagName = "Propulsion";
+        m_Propulsion->writeElement(writer, tagName);
+    }
+    if (!m_Structure.isNull())
+    {
+        QString tagName = "Structure";
+        m_Structure->writeElement(writer, tagName);
+    }
+    if (!m_TCS.isNull())
+    {
+        QString tagName = "TCS";
+        m_TCS->writeElement(writer, tagName);
+    }
+    if (!m_EPS.isNull())
+    {
+        QString tagName = "EPS";
+        m_EPS->writeElement(writer, tagName);
+    }
+    if (!m_TTC.isNull())
+    {
+        QString tagName = "TTC";
+        m_TTC->writeElement(writer, tagName);
+    }
+    if (!m_AOCS.isNull())
+    {
+        QString tagName = "AOCS";
+        m_AOCS->writeElement(writer, tagName);
+    }
+    if (!m_OBDH.isNull())
+    {
+        QString tagName = "OBDH";
+        m_OBDH->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSCSystemType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11462,6 +23387,72 @@ QDomElement ScenarioSystemBudgets::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioSystemBudgets* ScenarioSystemBudgets::create(QXmlStreamReader& reader)
+{
+    ScenarioSystemBudgets* v = new ScenarioSystemBudgets;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSystemBudgets::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:MassOfSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:MassOfSystem"));
+        return false;
+    }
+    m_MassOfSystem = QSharedPointer<ScenarioMassOfSystem>(ScenarioMassOfSystem::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:PowerOfSystem"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:PowerOfSystem"));
+        return false;
+    }
+    m_PowerOfSystem = QSharedPointer<ScenarioPowerOfSystem>(ScenarioPowerOfSystem::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Link"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Link"));
+        return false;
+    }
+    m_Link = QSharedPointer<ScenarioLink>(ScenarioLink::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSystemBudgets::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_MassOfSystem.isNull())
+    {
+        QString tagName = "MassOfSystem";
+        m_MassOfSystem->writeElement(writer, tagName);
+    }
+    if (!m_PowerOfSystem.isNull())
+    {
+        QString tagName = "PowerOfSystem";
+        m_PowerOfSystem->writeElement(writer, tagName);
+    }
+    if (!m_Link.isNull())
+    {
+        QString tagName = "Link";
+        m_Link->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSystemBudgets::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11511,6 +23502,46 @@ QDomElement ScenarioMassOfSystem::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioMassOfSystem* ScenarioMassOfSystem::create(QXmlStreamReader& reader)
+{
+    ScenarioMassOfSystem* v = new ScenarioMassOfSystem;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioMassOfSystem::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:dryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:dryMass"));
+        return false;
+    }
+    m_dryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:wetMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:wetMass"));
+        return false;
+    }
+    m_wetMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioMassOfSystem::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:dryMass", m_dryMass);
+    writeSimpleElement(writer, "tns:wetMass", m_wetMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioMassOfSystem::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11557,6 +23588,46 @@ QDomElement ScenarioPowerOfSystem::toDomElement(QDomDocument& doc, const QString
     return e;
 }
 
+ScenarioPowerOfSystem* ScenarioPowerOfSystem::create(QXmlStreamReader& reader)
+{
+    ScenarioPowerOfSystem* v = new ScenarioPowerOfSystem;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPowerOfSystem::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalPowerBoL"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalPowerBoL"));
+        return false;
+    }
+    m_totalPowerBoL = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalPowerEoL"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalPowerEoL"));
+        return false;
+    }
+    m_totalPowerEoL = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPowerOfSystem::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalPowerBoL", m_totalPowerBoL);
+    writeSimpleElement(writer, "tns:totalPowerEoL", m_totalPowerEoL);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPowerOfSystem::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11603,6 +23674,46 @@ QDomElement ScenarioLink::toDomElement(QDomDocument& doc, const QString& element
     return e;
 }
 
+ScenarioLink* ScenarioLink::create(QXmlStreamReader& reader)
+{
+    ScenarioLink* v = new ScenarioLink;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioLink::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:uplinkMargin"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:uplinkMargin"));
+        return false;
+    }
+    m_uplinkMargin = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:downlinkMargin"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:downlinkMargin"));
+        return false;
+    }
+    m_downlinkMargin = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioLink::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:uplinkMargin", m_uplinkMargin);
+    writeSimpleElement(writer, "tns:downlinkMargin", m_downlinkMargin);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioLink::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11649,6 +23760,46 @@ QDomElement ScenarioSCAerodynamics::toDomElement(QDomDocument& doc, const QStrin
     return e;
 }
 
+ScenarioSCAerodynamics* ScenarioSCAerodynamics::create(QXmlStreamReader& reader)
+{
+    ScenarioSCAerodynamics* v = new ScenarioSCAerodynamics;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSCAerodynamics::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:surfaceArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:surfaceArea"));
+        return false;
+    }
+    m_surfaceArea = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Cd"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Cd"));
+        return false;
+    }
+    m_Cd = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSCAerodynamics::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:surfaceArea", m_surfaceArea);
+    writeSimpleElement(writer, "tns:Cd", m_Cd);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSCAerodynamics::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11707,6 +23858,70 @@ QDomElement ScenarioPropulsion::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioPropulsion* ScenarioPropulsion::create(QXmlStreamReader& reader)
+{
+    ScenarioPropulsion* v = new ScenarioPropulsion;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioPropulsion::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:numberOfEngines"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:numberOfEngines"));
+        return false;
+    }
+    m_numberOfEngines = parseInt(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:thrustPerEngine"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:thrustPerEngine"));
+        return false;
+    }
+    m_thrustPerEngine = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:specificImpulse"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:specificImpulse"));
+        return false;
+    }
+    m_specificImpulse = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:propellantMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:propellantMass"));
+        return false;
+    }
+    m_propellantMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalPropulsionDryMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalPropulsionDryMass"));
+        return false;
+    }
+    m_totalPropulsionDryMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioPropulsion::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:numberOfEngines", m_numberOfEngines);
+    writeSimpleElement(writer, "tns:thrustPerEngine", m_thrustPerEngine);
+    writeSimpleElement(writer, "tns:specificImpulse", m_specificImpulse);
+    writeSimpleElement(writer, "tns:propellantMass", m_propellantMass);
+    writeSimpleElement(writer, "tns:totalPropulsionDryMass", m_totalPropulsionDryMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioPropulsion::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11795,6 +24010,110 @@ QDomElement ScenarioStructure::toDomElement(QDomDocument& doc, const QString& el
     return e;
 }
 
+ScenarioStructure* ScenarioStructure::create(QXmlStreamReader& reader)
+{
+    ScenarioStructure* v = new ScenarioStructure;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioStructure::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:StructuralShape"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:StructuralShape"));
+        return false;
+    }
+    m_StructuralShape = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:StructuralMaterial"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:StructuralMaterial"));
+        return false;
+    }
+    m_StructuralMaterial = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Sizing"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Sizing"));
+        return false;
+    }
+    m_Sizing = QSharedPointer<ScenarioSizing>(ScenarioSizing::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:MomentsOfInertia"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:MomentsOfInertia"));
+        return false;
+    }
+    m_MomentsOfInertia = QSharedPointer<ScenarioMomentsOfInertia>(ScenarioMomentsOfInertia::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:SecondMomentsOfInertia"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SecondMomentsOfInertia"));
+        return false;
+    }
+    m_SecondMomentsOfInertia = QSharedPointer<ScenarioSecondMomentsOfInertia>(ScenarioSecondMomentsOfInertia::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:NaturalFrequency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:NaturalFrequency"));
+        return false;
+    }
+    m_NaturalFrequency = QSharedPointer<ScenarioNaturalFrequency>(ScenarioNaturalFrequency::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalStructureMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalStructureMass"));
+        return false;
+    }
+    m_totalStructureMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioStructure::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:StructuralShape", m_StructuralShape);
+    writeSimpleElement(writer, "tns:StructuralMaterial", m_StructuralMaterial);
+    if (!m_Sizing.isNull())
+    {
+        QString tagName = "Sizing";
+        m_Sizing->writeElement(writer, tagName);
+    }
+    if (!m_MomentsOfInertia.isNull())
+    {
+        QString tagName = "MomentsOfInertia";
+        m_MomentsOfInertia->writeElement(writer, tagName);
+    }
+    if (!m_SecondMomentsOfInertia.isNull())
+    {
+        QString tagName = "SecondMomentsOfInertia";
+        m_SecondMomentsOfInertia->writeElement(writer, tagName);
+    }
+    if (!m_NaturalFrequency.isNull())
+    {
+        QString tagName = "NaturalFrequency";
+        m_NaturalFrequency->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:totalStructureMass", m_totalStructureMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioStructure::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11853,6 +24172,62 @@ QDomElement ScenarioSizing::toDomElement(QDomDocument& doc, const QString& eleme
     return e;
 }
 
+ScenarioSizing* ScenarioSizing::create(QXmlStreamReader& reader)
+{
+    ScenarioSizing* v = new ScenarioSizing;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSizing::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:volume"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:volume"));
+        return false;
+    }
+    m_volume = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:width"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:width"));
+        return false;
+    }
+    m_width = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:length"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:length"));
+        return false;
+    }
+    m_length = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:height"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:height"));
+        return false;
+    }
+    m_height = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSizing::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:volume", m_volume);
+    writeSimpleElement(writer, "tns:width", m_width);
+    writeSimpleElement(writer, "tns:length", m_length);
+    writeSimpleElement(writer, "tns:height", m_height);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSizing::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11903,6 +24278,54 @@ QDomElement ScenarioMomentsOfInertia::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioMomentsOfInertia* ScenarioMomentsOfInertia::create(QXmlStreamReader& reader)
+{
+    ScenarioMomentsOfInertia* v = new ScenarioMomentsOfInertia;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioMomentsOfInertia::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:xAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:xAxis"));
+        return false;
+    }
+    m_xAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:yAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:yAxis"));
+        return false;
+    }
+    m_yAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:zAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:zAxis"));
+        return false;
+    }
+    m_zAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioMomentsOfInertia::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:xAxis", m_xAxis);
+    writeSimpleElement(writer, "tns:yAxis", m_yAxis);
+    writeSimpleElement(writer, "tns:zAxis", m_zAxis);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioMomentsOfInertia::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11953,6 +24376,54 @@ QDomElement ScenarioSecondMomentsOfInertia::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioSecondMomentsOfInertia* ScenarioSecondMomentsOfInertia::create(QXmlStreamReader& reader)
+{
+    ScenarioSecondMomentsOfInertia* v = new ScenarioSecondMomentsOfInertia;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSecondMomentsOfInertia::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:xAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:xAxis"));
+        return false;
+    }
+    m_xAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:yAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:yAxis"));
+        return false;
+    }
+    m_yAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:zAxis"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:zAxis"));
+        return false;
+    }
+    m_zAxis = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSecondMomentsOfInertia::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:xAxis", m_xAxis);
+    writeSimpleElement(writer, "tns:yAxis", m_yAxis);
+    writeSimpleElement(writer, "tns:zAxis", m_zAxis);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSecondMomentsOfInertia::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -11999,6 +24470,46 @@ QDomElement ScenarioNaturalFrequency::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioNaturalFrequency* ScenarioNaturalFrequency::create(QXmlStreamReader& reader)
+{
+    ScenarioNaturalFrequency* v = new ScenarioNaturalFrequency;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioNaturalFrequency::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:axialFrequency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:axialFrequency"));
+        return false;
+    }
+    m_axialFrequency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:lateralFrequency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:lateralFrequency"));
+        return false;
+    }
+    m_lateralFrequency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioNaturalFrequency::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:axialFrequency", m_axialFrequency);
+    writeSimpleElement(writer, "tns:lateralFrequency", m_lateralFrequency);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioNaturalFrequency::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12069,6 +24580,82 @@ QDomElement ScenarioTCS::toDomElement(QDomDocument& doc, const QString& elementN
     return e;
 }
 
+ScenarioTCS* ScenarioTCS::create(QXmlStreamReader& reader)
+{
+    ScenarioTCS* v = new ScenarioTCS;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTCS::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Temperature"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Temperature"));
+        return false;
+    }
+    m_Temperature = QSharedPointer<ScenarioTemperature>(ScenarioTemperature::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:heaterPower"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:heaterPower"));
+        return false;
+    }
+    m_heaterPower = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:radiatedPower"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:radiatedPower"));
+        return false;
+    }
+    m_radiatedPower = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:CoatingArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:CoatingArea"));
+        return false;
+    }
+    m_CoatingArea = QSharedPointer<ScenarioCoatingArea>(ScenarioCoatingArea::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalTCSMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalTCSMass"));
+        return false;
+    }
+    m_totalTCSMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTCS::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_Temperature.isNull())
+    {
+        QString tagName = "Temperature";
+        m_Temperature->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:heaterPower", m_heaterPower);
+    writeSimpleElement(writer, "tns:radiatedPower", m_radiatedPower);
+    if (!m_CoatingArea.isNull())
+    {
+        QString tagName = "CoatingArea";
+        m_CoatingArea->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:totalTCSMass", m_totalTCSMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTCS::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12117,6 +24704,46 @@ QDomElement ScenarioTemperature::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioTemperature* ScenarioTemperature::create(QXmlStreamReader& reader)
+{
+    ScenarioTemperature* v = new ScenarioTemperature;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTemperature::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:maximumSCTemperature"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:maximumSCTemperature"));
+        return false;
+    }
+    m_maximumSCTemperature = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:minimumSCTemperature"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:minimumSCTemperature"));
+        return false;
+    }
+    m_minimumSCTemperature = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTemperature::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:maximumSCTemperature", m_maximumSCTemperature);
+    writeSimpleElement(writer, "tns:minimumSCTemperature", m_minimumSCTemperature);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTemperature::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12175,6 +24802,58 @@ QDomElement ScenarioCoatingArea::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioCoatingArea* ScenarioCoatingArea::create(QXmlStreamReader& reader)
+{
+    ScenarioCoatingArea* v = new ScenarioCoatingArea;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioCoatingArea::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ColdSurface"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ColdSurface"));
+        return false;
+    }
+    m_ColdSurface = QSharedPointer<ScenarioColdSurface>(ScenarioColdSurface::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:HotSurface"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:HotSurface"));
+        return false;
+    }
+    m_HotSurface = QSharedPointer<ScenarioHotSurface>(ScenarioHotSurface::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioCoatingArea::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_ColdSurface.isNull())
+    {
+        QString tagName = "ColdSurface";
+        m_ColdSurface->writeElement(writer, tagName);
+    }
+    if (!m_HotSurface.isNull())
+    {
+        QString tagName = "HotSurface";
+        m_HotSurface->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioCoatingArea::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12229,6 +24908,52 @@ QDomElement ScenarioColdSurface::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioColdSurface* ScenarioColdSurface::create(QXmlStreamReader& reader)
+{
+    ScenarioColdSurface* v = new ScenarioColdSurface;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioColdSurface::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ColdCoating"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ColdCoating"));
+        return false;
+    }
+    m_ColdCoating = QSharedPointer<ScenarioColdCoating>(ScenarioColdCoating::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalColdArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalColdArea"));
+        return false;
+    }
+    m_totalColdArea = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioColdSurface::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_ColdCoating.isNull())
+    {
+        QString tagName = "ColdCoating";
+        m_ColdCoating->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:totalColdArea", m_totalColdArea);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioColdSurface::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12286,6 +25011,60 @@ QDomElement ScenarioColdCoating::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioColdCoating* ScenarioColdCoating::create(QXmlStreamReader& reader)
+{
+    ScenarioColdCoating* v = new ScenarioColdCoating;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioColdCoating::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:emissivity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:emissivity"));
+        return false;
+    }
+    m_emissivity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:absorptivity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:absorptivity"));
+        return false;
+    }
+    m_absorptivity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioColdCoating::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:emissivity", m_emissivity);
+    writeSimpleElement(writer, "tns:absorptivity", m_absorptivity);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioColdCoating::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12339,6 +25118,52 @@ QDomElement ScenarioHotSurface::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioHotSurface* ScenarioHotSurface::create(QXmlStreamReader& reader)
+{
+    ScenarioHotSurface* v = new ScenarioHotSurface;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioHotSurface::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:HotCoating"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:HotCoating"));
+        return false;
+    }
+    m_HotCoating = QSharedPointer<ScenarioHotCoating>(ScenarioHotCoating::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalHotArea"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalHotArea"));
+        return false;
+    }
+    m_totalHotArea = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioHotSurface::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_HotCoating.isNull())
+    {
+        QString tagName = "HotCoating";
+        m_HotCoating->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:totalHotArea", m_totalHotArea);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioHotSurface::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12396,6 +25221,60 @@ QDomElement ScenarioHotCoating::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioHotCoating* ScenarioHotCoating::create(QXmlStreamReader& reader)
+{
+    ScenarioHotCoating* v = new ScenarioHotCoating;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioHotCoating::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:emissivity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:emissivity"));
+        return false;
+    }
+    m_emissivity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:absorptivity"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:absorptivity"));
+        return false;
+    }
+    m_absorptivity = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioHotCoating::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:emissivity", m_emissivity);
+    writeSimpleElement(writer, "tns:absorptivity", m_absorptivity);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioHotCoating::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12463,6 +25342,74 @@ QDomElement ScenarioEPS::toDomElement(QDomDocument& doc, const QString& elementN
     return e;
 }
 
+ScenarioEPS* ScenarioEPS::create(QXmlStreamReader& reader)
+{
+    ScenarioEPS* v = new ScenarioEPS;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioEPS::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:SolarArray"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SolarArray"));
+        return false;
+    }
+    m_SolarArray = QSharedPointer<ScenarioSolarArray>(ScenarioSolarArray::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:BatteryType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:BatteryType"));
+        return false;
+    }
+    m_BatteryType = QSharedPointer<ScenarioBatteryType>(ScenarioBatteryType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:massOfPCU"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:massOfPCU"));
+        return false;
+    }
+    m_massOfPCU = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalEPSMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalEPSMass"));
+        return false;
+    }
+    m_totalEPSMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioEPS::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    if (!m_SolarArray.isNull())
+    {
+        QString tagName = "SolarArray";
+        m_SolarArray->writeElement(writer, tagName);
+    }
+    if (!m_BatteryType.isNull())
+    {
+        QString tagName = "BatteryType";
+        m_BatteryType->writeElement(writer, tagName);
+    }
+    writeSimpleElement(writer, "tns:massOfPCU", m_massOfPCU);
+    writeSimpleElement(writer, "tns:totalEPSMass", m_totalEPSMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioEPS::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12514,6 +25461,54 @@ QDomElement ScenarioSolarArray::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioSolarArray* ScenarioSolarArray::create(QXmlStreamReader& reader)
+{
+    ScenarioSolarArray* v = new ScenarioSolarArray;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioSolarArray::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:SACellType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:SACellType"));
+        return false;
+    }
+    m_SACellType = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:massOfSolarArray"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:massOfSolarArray"));
+        return false;
+    }
+    m_massOfSolarArray = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:areaOfSolarArray"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:areaOfSolarArray"));
+        return false;
+    }
+    m_areaOfSolarArray = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioSolarArray::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:SACellType", m_SACellType);
+    writeSimpleElement(writer, "tns:massOfSolarArray", m_massOfSolarArray);
+    writeSimpleElement(writer, "tns:areaOfSolarArray", m_areaOfSolarArray);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioSolarArray::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12567,6 +25562,62 @@ QDomElement ScenarioBatteryType::toDomElement(QDomDocument& doc, const QString&
     return e;
 }
 
+ScenarioBatteryType* ScenarioBatteryType::create(QXmlStreamReader& reader)
+{
+    ScenarioBatteryType* v = new ScenarioBatteryType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioBatteryType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:BatteryType"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:BatteryType"));
+        return false;
+    }
+    m_BatteryType = reader.readElementText();
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalMassOfBatteries"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalMassOfBatteries"));
+        return false;
+    }
+    m_totalMassOfBatteries = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:numberOfBatteries"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:numberOfBatteries"));
+        return false;
+    }
+    m_numberOfBatteries = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalVolumeOfBatteries"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalVolumeOfBatteries"));
+        return false;
+    }
+    m_totalVolumeOfBatteries = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioBatteryType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:BatteryType", m_BatteryType);
+    writeSimpleElement(writer, "tns:totalMassOfBatteries", m_totalMassOfBatteries);
+    writeSimpleElement(writer, "tns:numberOfBatteries", m_numberOfBatteries);
+    writeSimpleElement(writer, "tns:totalVolumeOfBatteries", m_totalVolumeOfBatteries);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioBatteryType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12619,6 +25670,52 @@ QDomElement ScenarioTTC::toDomElement(QDomDocument& doc, const QString& elementN
     return e;
 }
 
+ScenarioTTC* ScenarioTTC::create(QXmlStreamReader& reader)
+{
+    ScenarioTTC* v = new ScenarioTTC;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTTC::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalTTCMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalTTCMass"));
+        return false;
+    }
+    m_totalTTCMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TTCAntenna"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TTCAntenna"));
+        return false;
+    }
+    m_TTCAntenna = QSharedPointer<ScenarioTTCAntenna>(ScenarioTTCAntenna::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTTC::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalTTCMass", m_totalTTCMass);
+    if (!m_TTCAntenna.isNull())
+    {
+        QString tagName = "TTCAntenna";
+        m_TTCAntenna->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTTC::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12682,6 +25779,78 @@ QDomElement ScenarioTTCAntenna::toDomElement(QDomDocument& doc, const QString& e
     return e;
 }
 
+ScenarioTTCAntenna* ScenarioTTCAntenna::create(QXmlStreamReader& reader)
+{
+    ScenarioTTCAntenna* v = new ScenarioTTCAntenna;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTTCAntenna::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:TransmitterPower"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TransmitterPower"));
+        return false;
+    }
+    m_TransmitterPower = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TransmitterFrequency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TransmitterFrequency"));
+        return false;
+    }
+    m_TransmitterFrequency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TransmitterGain"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TransmitterGain"));
+        return false;
+    }
+    m_TransmitterGain = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:TransmitterEfficiency"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:TransmitterEfficiency"));
+        return false;
+    }
+    m_TransmitterEfficiency = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:LinkDuration"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:LinkDuration"));
+        return false;
+    }
+    m_LinkDuration = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:DataRate"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:DataRate"));
+        return false;
+    }
+    m_DataRate = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTTCAntenna::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:TransmitterPower", m_TransmitterPower);
+    writeSimpleElement(writer, "tns:TransmitterFrequency", m_TransmitterFrequency);
+    writeSimpleElement(writer, "tns:TransmitterGain", m_TransmitterGain);
+    writeSimpleElement(writer, "tns:TransmitterEfficiency", m_TransmitterEfficiency);
+    writeSimpleElement(writer, "tns:LinkDuration", m_LinkDuration);
+    writeSimpleElement(writer, "tns:DataRate", m_DataRate);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTTCAntenna::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12724,6 +25893,38 @@ QDomElement ScenarioAOCS::toDomElement(QDomDocument& doc, const QString& element
     return e;
 }
 
+ScenarioAOCS* ScenarioAOCS::create(QXmlStreamReader& reader)
+{
+    ScenarioAOCS* v = new ScenarioAOCS;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioAOCS::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalAOCSMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalAOCSMass"));
+        return false;
+    }
+    m_totalAOCSMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioAOCS::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalAOCSMass", m_totalAOCSMass);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioAOCS::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12770,6 +25971,46 @@ QDomElement ScenarioOBDH::toDomElement(QDomDocument& doc, const QString& element
     return e;
 }
 
+ScenarioOBDH* ScenarioOBDH::create(QXmlStreamReader& reader)
+{
+    ScenarioOBDH* v = new ScenarioOBDH;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOBDH::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:totalOBDHMass"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalOBDHMass"));
+        return false;
+    }
+    m_totalOBDHMass = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:totalSizeOfMemory"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:totalSizeOfMemory"));
+        return false;
+    }
+    m_totalSizeOfMemory = parseDouble(reader.readElementText());
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOBDH::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:totalOBDHMass", m_totalOBDHMass);
+    writeSimpleElement(writer, "tns:totalSizeOfMemory", m_totalSizeOfMemory);
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOBDH::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12828,6 +26069,58 @@ QDomElement ScenarioTransmitterPayloadType::toDomElement(QDomDocument& doc, cons
     return e;
 }
 
+ScenarioTransmitterPayloadType* ScenarioTransmitterPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioTransmitterPayloadType* v = new ScenarioTransmitterPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioTransmitterPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractPayloadType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Transmitter"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Transmitter"));
+        return false;
+    }
+    m_Transmitter = QSharedPointer<ScenarioTransmitter>(ScenarioTransmitter::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioTransmitterPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractPayloadType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Transmitter.isNull())
+    {
+        QString tagName = "Transmitter";
+        m_Transmitter->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioTransmitterPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12888,6 +26181,58 @@ QDomElement ScenarioReceiverPayloadType::toDomElement(QDomDocument& doc, const Q
     return e;
 }
 
+ScenarioReceiverPayloadType* ScenarioReceiverPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioReceiverPayloadType* v = new ScenarioReceiverPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioReceiverPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractPayloadType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Receiver"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Receiver"));
+        return false;
+    }
+    m_Receiver = QSharedPointer<ScenarioReceiver>(ScenarioReceiver::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioReceiverPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractPayloadType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Receiver.isNull())
+    {
+        QString tagName = "Receiver";
+        m_Receiver->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioReceiverPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -12948,6 +26293,58 @@ QDomElement ScenarioOpticalPayloadType::toDomElement(QDomDocument& doc, const QS
     return e;
 }
 
+ScenarioOpticalPayloadType* ScenarioOpticalPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioOpticalPayloadType* v = new ScenarioOpticalPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioOpticalPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractPayloadType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Telescope"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Telescope"));
+        return false;
+    }
+    m_Telescope = QSharedPointer<ScenarioTelescopeType>(ScenarioTelescopeType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioOpticalPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractPayloadType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Telescope.isNull())
+    {
+        QString tagName = "Telescope";
+        m_Telescope->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioOpticalPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -13008,6 +26405,58 @@ QDomElement ScenarioRadarPayloadType::toDomElement(QDomDocument& doc, const QStr
     return e;
 }
 
+ScenarioRadarPayloadType* ScenarioRadarPayloadType::create(QXmlStreamReader& reader)
+{
+    ScenarioRadarPayloadType* v = new ScenarioRadarPayloadType;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool ScenarioRadarPayloadType::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioAbstractPayloadType::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:ElementIdentifier"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:ElementIdentifier"));
+        return false;
+    }
+    m_ElementIdentifier = QSharedPointer<ScenarioElementIdentifierType>(ScenarioElementIdentifierType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    if (!atStartElement(reader, "tns:Radar"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Radar"));
+        return false;
+    }
+    m_Radar = QSharedPointer<ScenarioRadarType>(ScenarioRadarType::create(reader));
+    if (reader.hasError())
+        return false;
+    reader.readNextStartElement();
+    return !reader.hasError();
+}
+
+void ScenarioRadarPayloadType::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioAbstractPayloadType::writeContents(writer);
+    if (!m_ElementIdentifier.isNull())
+    {
+        QString tagName = "ElementIdentifier";
+        m_ElementIdentifier->writeElement(writer, tagName);
+    }
+    if (!m_Radar.isNull())
+    {
+        QString tagName = "Radar";
+        m_Radar->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >ScenarioRadarPayloadType::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -13093,6 +26542,81 @@ QDomElement SpaceScenario::toDomElement(QDomDocument& doc, const QString& elemen
     return e;
 }
 
+SpaceScenario* SpaceScenario::create(QXmlStreamReader& reader)
+{
+    SpaceScenario* v = new SpaceScenario;
+    if (!v->load(reader))
+    {
+        delete v;
+        return NULL;
+    }
+    skipUnknownElements(reader);
+    return v;
+}
+
+bool SpaceScenario::load(QXmlStreamReader& reader)
+{
+    if (!ScenarioObject::load(reader))
+        return false;
+    if (!atStartElement(reader, "tns:Name"))
+    {
+        reader.raiseError(QObject::tr("Expected tns:Name"));
+        return false;
+    }
+    m_Name = reader.readElementText();
+    reader.readNextStartElement();
+    for (;;)
+    {
+        QSharedPointer<ScenarioParticipantType> v;
+        if (atStartElement(reader, "tns:GroundStation"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioGroundStation::create(reader));
+        else if (atStartElement(reader, "tns:LaunchPad"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioLaunchPad::create(reader));
+        else if (atStartElement(reader, "tns:Point"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioPoint::create(reader));
+        else if (atStartElement(reader, "tns:Region"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioRegion::create(reader));
+        else if (atStartElement(reader, "tns:LV"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioLV::create(reader));
+        else if (atStartElement(reader, "tns:REV"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioREV::create(reader));
+        else if (atStartElement(reader, "tns:SC"))
+            v = QSharedPointer<ScenarioParticipantType>((ScenarioParticipantType*)ScenarioSC::create(reader));
+        if (reader.hasError())
+            return false;
+        if (v.isNull())
+            break;
+        m_AbstractParticipant << v;
+        reader.readNextStartElement();
+    }
+    return !reader.hasError();
+}
+
+void SpaceScenario::writeContents(QXmlStreamWriter& writer) const
+{
+    ScenarioObject::writeContents(writer);
+    writeSimpleElement(writer, "tns:Name", m_Name);
+    foreach (QSharedPointer<ScenarioParticipantType> p, m_AbstractParticipant)
+    {
+        QString tagName = "AbstractParticipant";
+        if (dynamic_cast<ScenarioGroundStation*>(p.data()))
+            tagName = "GroundStation";
+        else if (dynamic_cast<ScenarioLaunchPad*>(p.data()))
+            tagName = "LaunchPad";
+        else if (dynamic_cast<ScenarioPoint*>(p.data()))
+            tagName = "Point";
+        else if (dynamic_cast<ScenarioRegion*>(p.data()))
+            tagName = "Region";
+        else if (dynamic_cast<ScenarioLV*>(p.data()))
+            tagName = "LV";
+        else if (dynamic_cast<ScenarioREV*>(p.data()))
+            tagName = "REV";
+        else if (dynamic_cast<ScenarioSC*>(p.data()))
+            tagName = "SC";
+        p->writeElement(writer, tagName);
+    }
+}
+
 QList<QSharedPointer<ScenarioObject> >SpaceScenario::children() const
 {
     QList<QSharedPointer<ScenarioObject> > children;
@@ -23,6 +23,24 @@ class ScenarioObject
         return e;
         ;
     }
+
+    virtual bool load(QXmlStreamReader& reader)
+    {
+        reader.readNextStartElement();
+        return true;
+    }
+
+    virtual void writeContents(QXmlStreamWriter& /* writer */) const
+    {
+    }
+
+    void writeElement(QXmlStreamWriter& writer, const QString& elementName) const
+    {
+        writer.writeStartElement("tns:" + elementName);
+        writeContents(writer);
+        writer.writeEndElement();
+    }
+
     virtual QString elementName() const = 0;
     virtual QList<QSharedPointer<ScenarioObject> > children() const = 0;
 };
@@ -230,10 +248,13 @@ class ScenarioElementIdentifierType : public ScenarioObject
 public:
     ScenarioElementIdentifierType();
     static ScenarioElementIdentifierType* create(const QDomElement& e);
+    static ScenarioElementIdentifierType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ElementIdentifierType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString Name() const
@@ -267,10 +288,13 @@ class ScenarioPropagationPositionType : public ScenarioObject
 public:
     ScenarioPropagationPositionType();
     static ScenarioPropagationPositionType* create(const QDomElement& e);
+    static ScenarioPropagationPositionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PropagationPositionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString propagator() const
@@ -299,10 +323,13 @@ class ScenarioPropagationAttitudeType : public ScenarioObject
 public:
     ScenarioPropagationAttitudeType();
     static ScenarioPropagationAttitudeType* create(const QDomElement& e);
+    static ScenarioPropagationAttitudeType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PropagationAttitudeType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString propagator() const
@@ -331,10 +358,13 @@ class ScenarioAbstractTrajectoryType : public ScenarioObject
 public:
     ScenarioAbstractTrajectoryType();
     static ScenarioAbstractTrajectoryType* create(const QDomElement& e);
+    static ScenarioAbstractTrajectoryType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "AbstractTrajectoryType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -353,10 +383,13 @@ class ScenarioAbstractPayloadType : public ScenarioObject
 public:
     ScenarioAbstractPayloadType();
     static ScenarioAbstractPayloadType* create(const QDomElement& e);
+    static ScenarioAbstractPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "AbstractPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioBudgetType> Budget() const
@@ -375,10 +408,13 @@ class ScenarioPayloadSet : public ScenarioObject
 public:
     ScenarioPayloadSet();
     static ScenarioPayloadSet* create(const QDomElement& e);
+    static ScenarioPayloadSet* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PayloadSet"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     const QList<QSharedPointer<ScenarioAbstractPayloadType> >& AbstractPayload() const
@@ -399,10 +435,13 @@ class ScenarioInitialPositionType : public ScenarioObject
 public:
     ScenarioInitialPositionType();
     static ScenarioInitialPositionType* create(const QDomElement& e);
+    static ScenarioInitialPositionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "InitialPositionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString CoordinateSystem() const
@@ -426,10 +465,13 @@ class ScenarioInitialAttitudeType : public ScenarioObject
 public:
     ScenarioInitialAttitudeType();
     static ScenarioInitialAttitudeType* create(const QDomElement& e);
+    static ScenarioInitialAttitudeType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "InitialAttitudeType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString CoordinateSystem() const
@@ -453,10 +495,13 @@ class ScenarioInitialAttitudeUsingQuaternionsType : public ScenarioObject
 public:
     ScenarioInitialAttitudeUsingQuaternionsType();
     static ScenarioInitialAttitudeUsingQuaternionsType* create(const QDomElement& e);
+    static ScenarioInitialAttitudeUsingQuaternionsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "InitialAttitudeUsingQuaternionsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString CoordinateSystem() const
@@ -480,10 +525,13 @@ class ScenarioParticipantType : public ScenarioObject
 public:
     ScenarioParticipantType();
     static ScenarioParticipantType* create(const QDomElement& e);
+    static ScenarioParticipantType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ParticipantType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString Name() const
@@ -502,10 +550,13 @@ class ScenarioTimeLine : public ScenarioObject
 public:
     ScenarioTimeLine();
     static ScenarioTimeLine* create(const QDomElement& e);
+    static ScenarioTimeLine* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TimeLine"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QDateTime StartTime() const
@@ -534,10 +585,13 @@ class ScenarioPropagation : public ScenarioObject
 public:
     ScenarioPropagation();
     static ScenarioPropagation* create(const QDomElement& e);
+    static ScenarioPropagation* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Propagation"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString propagator() const
@@ -556,10 +610,13 @@ class ScenarioEnvironmentType : public ScenarioObject
 public:
     ScenarioEnvironmentType();
     static ScenarioEnvironmentType* create(const QDomElement& e);
+    static ScenarioEnvironmentType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "EnvironmentType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioCentralBodyType> CentralBody() const
@@ -583,10 +640,13 @@ class ScenarioCentralBodyType : public ScenarioObject
 public:
     ScenarioCentralBodyType();
     static ScenarioCentralBodyType* create(const QDomElement& e);
+    static ScenarioCentralBodyType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "CentralBodyType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString Name() const
@@ -625,10 +685,13 @@ class ScenarioGravityModel : public ScenarioObject
 public:
     ScenarioGravityModel();
     static ScenarioGravityModel* create(const QDomElement& e);
+    static ScenarioGravityModel* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "GravityModel"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString modelName() const
@@ -657,10 +720,13 @@ class ScenarioPerturbationsForceType : public ScenarioObject
 public:
     ScenarioPerturbationsForceType();
     static ScenarioPerturbationsForceType* create(const QDomElement& e);
+    static ScenarioPerturbationsForceType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PerturbationsForceType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     bool gravityEffets() const
@@ -731,10 +797,13 @@ class ScenarioPerturbationsTorqueType : public ScenarioObject
 public:
     ScenarioPerturbationsTorqueType();
     static ScenarioPerturbationsTorqueType* create(const QDomElement& e);
+    static ScenarioPerturbationsTorqueType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PerturbationsTorqueType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     bool micrometeoroids() const
@@ -758,10 +827,13 @@ class ScenarioTrajectoryStoppingConditionType : public ScenarioObject
 public:
     ScenarioTrajectoryStoppingConditionType();
     static ScenarioTrajectoryStoppingConditionType* create(const QDomElement& e);
+    static ScenarioTrajectoryStoppingConditionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TrajectoryStoppingConditionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString ConditionIdentifier() const
@@ -795,10 +867,13 @@ class ScenarioAbstract3DOFPositionType : public ScenarioObject
 public:
     ScenarioAbstract3DOFPositionType();
     static ScenarioAbstract3DOFPositionType* create(const QDomElement& e);
+    static ScenarioAbstract3DOFPositionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Abstract3DOFPositionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -812,10 +887,13 @@ class ScenarioAbstract6DOFPositionType : public ScenarioObject
 public:
     ScenarioAbstract6DOFPositionType();
     static ScenarioAbstract6DOFPositionType* create(const QDomElement& e);
+    static ScenarioAbstract6DOFPositionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Abstract6DOFPositionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -829,10 +907,13 @@ class ScenarioGroundPositionType : public ScenarioAbstract3DOFPositionType
 public:
     ScenarioGroundPositionType();
     static ScenarioGroundPositionType* create(const QDomElement& e);
+    static ScenarioGroundPositionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "GroundPositionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double latitude() const
@@ -861,10 +942,13 @@ class ScenarioStateVectorType : public ScenarioAbstract6DOFPositionType
 public:
     ScenarioStateVectorType();
     static ScenarioStateVectorType* create(const QDomElement& e);
+    static ScenarioStateVectorType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "StateVectorType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double x() const
@@ -908,10 +992,13 @@ class ScenarioKeplerianElementsType : public ScenarioAbstract6DOFPositionType
 public:
     ScenarioKeplerianElementsType();
     static ScenarioKeplerianElementsType* create(const QDomElement& e);
+    static ScenarioKeplerianElementsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "KeplerianElementsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double semiMajorAxis() const
@@ -955,10 +1042,13 @@ class ScenarioSphericalCoordinatesType : public ScenarioAbstract6DOFPositionType
 public:
     ScenarioSphericalCoordinatesType();
     static ScenarioSphericalCoordinatesType* create(const QDomElement& e);
+    static ScenarioSphericalCoordinatesType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SphericalCoordinatesType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double radialDistance() const
@@ -1002,10 +1092,13 @@ class ScenarioAbstract6DOFAttitudeType : public ScenarioObject
 public:
     ScenarioAbstract6DOFAttitudeType();
     static ScenarioAbstract6DOFAttitudeType* create(const QDomElement& e);
+    static ScenarioAbstract6DOFAttitudeType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Abstract6DOFAttitudeType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -1019,10 +1112,13 @@ class ScenarioAbstract8DOFAttitudeType : public ScenarioObject
 public:
     ScenarioAbstract8DOFAttitudeType();
     static ScenarioAbstract8DOFAttitudeType* create(const QDomElement& e);
+    static ScenarioAbstract8DOFAttitudeType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Abstract8DOFAttitudeType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -1036,10 +1132,13 @@ class ScenarioEulerType : public ScenarioAbstract6DOFAttitudeType
 public:
     ScenarioEulerType();
     static ScenarioEulerType* create(const QDomElement& e);
+    static ScenarioEulerType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "EulerType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double phi() const
@@ -1083,10 +1182,13 @@ class ScenarioQuaternionType : public ScenarioAbstract8DOFAttitudeType
 public:
     ScenarioQuaternionType();
     static ScenarioQuaternionType* create(const QDomElement& e);
+    static ScenarioQuaternionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "QuaternionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double q1() const
@@ -1140,10 +1242,13 @@ class ScenarioAbstract12DOFStateType : public ScenarioObject
 public:
     ScenarioAbstract12DOFStateType();
     static ScenarioAbstract12DOFStateType* create(const QDomElement& e);
+    static ScenarioAbstract12DOFStateType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Abstract12DOFStateType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -1157,10 +1262,13 @@ class ScenarioState12DOF : public ScenarioAbstract12DOFStateType
 public:
     ScenarioState12DOF();
     static ScenarioState12DOF* create(const QDomElement& e);
+    static ScenarioState12DOF* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "State12DOF"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioAbstract6DOFPositionType> Abstract6DOFPosition() const
@@ -1184,10 +1292,13 @@ class ScenarioAbstract14DOFStateType : public ScenarioObject
 public:
     ScenarioAbstract14DOFStateType();
     static ScenarioAbstract14DOFStateType* create(const QDomElement& e);
+    static ScenarioAbstract14DOFStateType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Abstract14DOFStateType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -1201,10 +1312,13 @@ class ScenarioState14DOF : public ScenarioAbstract14DOFStateType
 public:
     ScenarioState14DOF();
     static ScenarioState14DOF* create(const QDomElement& e);
+    static ScenarioState14DOF* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "State14DOF"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioAbstract6DOFPositionType> Abstract6DOFPosition() const
@@ -1228,10 +1342,13 @@ class ScenarioTelescopeType : public ScenarioObject
 public:
     ScenarioTelescopeType();
     static ScenarioTelescopeType* create(const QDomElement& e);
+    static ScenarioTelescopeType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TelescopeType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOpticalProperties> OpticalProperties() const
@@ -1250,10 +1367,13 @@ class ScenarioOpticalProperties : public ScenarioObject
 public:
     ScenarioOpticalProperties();
     static ScenarioOpticalProperties* create(const QDomElement& e);
+    static ScenarioOpticalProperties* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OpticalProperties"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double Diameter() const
@@ -1277,10 +1397,13 @@ class ScenarioRadarType : public ScenarioObject
 public:
     ScenarioRadarType();
     static ScenarioRadarType* create(const QDomElement& e);
+    static ScenarioRadarType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "RadarType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioRadarProperties> RadarProperties() const
@@ -1299,10 +1422,13 @@ class ScenarioRadarProperties : public ScenarioObject
 public:
     ScenarioRadarProperties();
     static ScenarioRadarProperties* create(const QDomElement& e);
+    static ScenarioRadarProperties* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "RadarProperties"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double GainMax() const
@@ -1351,10 +1477,13 @@ class ScenarioCoverageType : public ScenarioObject
 public:
     ScenarioCoverageType();
     static ScenarioCoverageType* create(const QDomElement& e);
+    static ScenarioCoverageType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "CoverageType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString FrustumShape() const
@@ -1383,10 +1512,13 @@ class ScenarioAntennaType : public ScenarioObject
 public:
     ScenarioAntennaType();
     static ScenarioAntennaType* create(const QDomElement& e);
+    static ScenarioAntennaType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "AntennaType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioPointingDirection> PointingDirection() const
@@ -1415,10 +1547,13 @@ class ScenarioPointingDirection : public ScenarioObject
 public:
     ScenarioPointingDirection();
     static ScenarioPointingDirection* create(const QDomElement& e);
+    static ScenarioPointingDirection* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PointingDirection"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString referenceSystem() const
@@ -1467,10 +1602,13 @@ class ScenarioEMproperties : public ScenarioObject
 public:
     ScenarioEMproperties();
     static ScenarioEMproperties* create(const QDomElement& e);
+    static ScenarioEMproperties* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "EMproperties"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double GainMax() const
@@ -1529,10 +1667,13 @@ class ScenarioBudgetType : public ScenarioObject
 public:
     ScenarioBudgetType();
     static ScenarioBudgetType* create(const QDomElement& e);
+    static ScenarioBudgetType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "BudgetType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double Mass() const
@@ -1576,10 +1717,13 @@ class ScenarioPower : public ScenarioObject
 public:
     ScenarioPower();
     static ScenarioPower* create(const QDomElement& e);
+    static ScenarioPower* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Power"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double powerConsumptionInEclipse() const
@@ -1613,10 +1757,13 @@ class ScenarioSize : public ScenarioObject
 public:
     ScenarioSize();
     static ScenarioSize* create(const QDomElement& e);
+    static ScenarioSize* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Size"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double Width() const
@@ -1645,10 +1792,13 @@ class ScenarioTemperatureRange : public ScenarioObject
 public:
     ScenarioTemperatureRange();
     static ScenarioTemperatureRange* create(const QDomElement& e);
+    static ScenarioTemperatureRange* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TemperatureRange"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double MinimumTemperature() const
@@ -1672,10 +1822,13 @@ class ScenarioTransmitter : public ScenarioAntennaType
 public:
     ScenarioTransmitter();
     static ScenarioTransmitter* create(const QDomElement& e);
+    static ScenarioTransmitter* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Transmitter"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     bool ObservationChecked() const
@@ -1714,10 +1867,13 @@ class ScenarioModulation : public ScenarioObject
 public:
     ScenarioModulation();
     static ScenarioModulation* create(const QDomElement& e);
+    static ScenarioModulation* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Modulation"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString ModulationType() const
@@ -1741,10 +1897,13 @@ class ScenarioReceiver : public ScenarioAntennaType
 public:
     ScenarioReceiver();
     static ScenarioReceiver* create(const QDomElement& e);
+    static ScenarioReceiver* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Receiver"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double GoverT() const
@@ -1778,10 +1937,13 @@ class ScenarioSystemTemperature : public ScenarioObject
 public:
     ScenarioSystemTemperature();
     static ScenarioSystemTemperature* create(const QDomElement& e);
+    static ScenarioSystemTemperature* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SystemTemperature"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString choiceTantenna() const
@@ -1825,10 +1987,13 @@ class ScenarioAeroCoefFileType : public ScenarioObject
 public:
     ScenarioAeroCoefFileType();
     static ScenarioAeroCoefFileType* create(const QDomElement& e);
+    static ScenarioAeroCoefFileType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "AeroCoefFileType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString FileLocation() const
@@ -1885,10 +2050,13 @@ class ScenarioOptVarDouble : public ScenarioObject
 public:
     ScenarioOptVarDouble();
     static ScenarioOptVarDouble* create(const QDomElement& e);
+    static ScenarioOptVarDouble* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OptVarDouble"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double min() const
@@ -1917,10 +2085,13 @@ class ScenarioOptVarInt : public ScenarioObject
 public:
     ScenarioOptVarInt();
     static ScenarioOptVarInt* create(const QDomElement& e);
+    static ScenarioOptVarInt* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OptVarInt"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     const QList<int>& list() const
@@ -1946,10 +2117,13 @@ class ScenarioOptVarBool : public ScenarioObject
 public:
     ScenarioOptVarBool();
     static ScenarioOptVarBool* create(const QDomElement& e);
+    static ScenarioOptVarBool* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OptVarBool"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     bool value() const
@@ -1968,10 +2142,13 @@ class ScenarioOptVarString : public ScenarioObject
 public:
     ScenarioOptVarString();
     static ScenarioOptVarString* create(const QDomElement& e);
+    static ScenarioOptVarString* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OptVarString"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     const QList<QString>& list() const
@@ -1997,10 +2174,13 @@ class ScenarioOptimization : public ScenarioObject
 public:
     ScenarioOptimization();
     static ScenarioOptimization* create(const QDomElement& e);
+    static ScenarioOptimization* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Optimization"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     int nVariables() const
@@ -2083,10 +2263,13 @@ class ScenarioOutputFiles : public ScenarioObject
 public:
     ScenarioOutputFiles();
     static ScenarioOutputFiles* create(const QDomElement& e);
+    static ScenarioOutputFiles* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OutputFiles"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString paretoFrontVarsFileName() const
@@ -2140,10 +2323,13 @@ class ScenarioGroundStation : public ScenarioParticipantType
 public:
     ScenarioGroundStation();
     static ScenarioGroundStation* create(const QDomElement& e);
+    static ScenarioGroundStation* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "GroundStation"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -2177,10 +2363,13 @@ class ScenarioGroundStationEnvironment : public ScenarioObject
 public:
     ScenarioGroundStationEnvironment();
     static ScenarioGroundStationEnvironment* create(const QDomElement& e);
+    static ScenarioGroundStationEnvironment* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "GroundStationEnvironment"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioRain> Rain() const
@@ -2219,10 +2408,13 @@ class ScenarioRain : public ScenarioObject
 public:
     ScenarioRain();
     static ScenarioRain* create(const QDomElement& e);
+    static ScenarioRain* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Rain"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double PercentageExceededLimit() const
@@ -2246,10 +2438,13 @@ class ScenarioLaunchPad : public ScenarioParticipantType
 public:
     ScenarioLaunchPad();
     static ScenarioLaunchPad* create(const QDomElement& e);
+    static ScenarioLaunchPad* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LaunchPad"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -2283,10 +2478,13 @@ class ScenarioPoint : public ScenarioParticipantType
 public:
     ScenarioPoint();
     static ScenarioPoint* create(const QDomElement& e);
+    static ScenarioPoint* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Point"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -2315,10 +2513,13 @@ class ScenarioRegion : public ScenarioParticipantType
 public:
     ScenarioRegion();
     static ScenarioRegion* create(const QDomElement& e);
+    static ScenarioRegion* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Region"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -2349,10 +2550,13 @@ class ScenarioLocationType : public ScenarioObject
 public:
     ScenarioLocationType();
     static ScenarioLocationType* create(const QDomElement& e);
+    static ScenarioLocationType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LocationType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString CentralBody() const
@@ -2376,10 +2580,13 @@ class ScenarioLV : public ScenarioParticipantType
 public:
     ScenarioLV();
     static ScenarioLV* create(const QDomElement& e);
+    static ScenarioLV* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LV"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVProgramType> Program() const
@@ -2423,10 +2630,13 @@ class ScenarioLVProgramType : public ScenarioObject
 public:
     ScenarioLVProgramType();
     static ScenarioLVProgramType* create(const QDomElement& e);
+    static ScenarioLVProgramType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVProgramType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     int nLaunches() const
@@ -2460,10 +2670,13 @@ class ScenarioLVMissionType : public ScenarioObject
 public:
     ScenarioLVMissionType();
     static ScenarioLVMissionType* create(const QDomElement& e);
+    static ScenarioLVMissionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVMissionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVPayloadType> Payload() const
@@ -2502,10 +2715,13 @@ class ScenarioLVSystemType : public ScenarioObject
 public:
     ScenarioLVSystemType();
     static ScenarioLVSystemType* create(const QDomElement& e);
+    static ScenarioLVSystemType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVSystemType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVArchitectureType> Architecture() const
@@ -2573,10 +2789,13 @@ class ScenarioLVPropulsionSystemType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemType();
     static ScenarioLVPropulsionSystemType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVPropulsionSystemSystemType> System() const
@@ -2625,10 +2844,13 @@ class ScenarioLVGeometryType : public ScenarioObject
 public:
     ScenarioLVGeometryType();
     static ScenarioLVGeometryType* create(const QDomElement& e);
+    static ScenarioLVGeometryType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVGeometryType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarBool> diameterEqualToUpper() const
@@ -2707,10 +2929,13 @@ class ScenarioLVAerodynamicsType : public ScenarioObject
 public:
     ScenarioLVAerodynamicsType();
     static ScenarioLVAerodynamicsType* create(const QDomElement& e);
+    static ScenarioLVAerodynamicsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVAerodynamicsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     bool userDefinedAero() const
@@ -2754,10 +2979,13 @@ class ScenarioLVComponentWeightsType : public ScenarioObject
 public:
     ScenarioLVComponentWeightsType();
     static ScenarioLVComponentWeightsType* create(const QDomElement& e);
+    static ScenarioLVComponentWeightsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVComponentWeightsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarInt> tanksArrangement() const
@@ -2841,10 +3069,13 @@ class ScenarioLVSystemWeightsType : public ScenarioObject
 public:
     ScenarioLVSystemWeightsType();
     static ScenarioLVSystemWeightsType* create(const QDomElement& e);
+    static ScenarioLVSystemWeightsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVSystemWeightsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double totalDryMass() const
@@ -2903,10 +3134,13 @@ class ScenarioLVComponentCostsType : public ScenarioObject
 public:
     ScenarioLVComponentCostsType();
     static ScenarioLVComponentCostsType* create(const QDomElement& e);
+    static ScenarioLVComponentCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVComponentCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarInt> nEngineTests() const
@@ -2935,10 +3169,13 @@ class ScenarioLVSystemCostsType : public ScenarioObject
 public:
     ScenarioLVSystemCostsType();
     static ScenarioLVSystemCostsType* create(const QDomElement& e);
+    static ScenarioLVSystemCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVSystemCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVTotalProgramCostsType> TotalProgramCosts() const
@@ -2972,10 +3209,13 @@ class ScenarioLVComponentReliabilityType : public ScenarioObject
 public:
     ScenarioLVComponentReliabilityType();
     static ScenarioLVComponentReliabilityType* create(const QDomElement& e);
+    static ScenarioLVComponentReliabilityType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVComponentReliabilityType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVSeparationType> Separation() const
@@ -3019,10 +3259,13 @@ class ScenarioLVSystemReliabilityType : public ScenarioObject
 public:
     ScenarioLVSystemReliabilityType();
     static ScenarioLVSystemReliabilityType* create(const QDomElement& e);
+    static ScenarioLVSystemReliabilityType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVSystemReliabilityType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double globalVehicleReliability() const
@@ -3080,10 +3323,13 @@ class ScenarioLVTrajectoryType : public ScenarioObject
 public:
     ScenarioLVTrajectoryType();
     static ScenarioLVTrajectoryType* create(const QDomElement& e);
+    static ScenarioLVTrajectoryType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVTrajectoryType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVTakeOffType> TakeOff() const
@@ -3122,10 +3368,13 @@ class ScenarioLVProgramCostFactorsType : public ScenarioObject
 public:
     ScenarioLVProgramCostFactorsType();
     static ScenarioLVProgramCostFactorsType* create(const QDomElement& e);
+    static ScenarioLVProgramCostFactorsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVProgramCostFactorsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double f0() const
@@ -3174,10 +3423,13 @@ class ScenarioLVPayloadType : public ScenarioObject
 public:
     ScenarioLVPayloadType();
     static ScenarioLVPayloadType* create(const QDomElement& e);
+    static ScenarioLVPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double mass() const
@@ -3221,10 +3473,13 @@ class ScenarioLVLaunchSiteType : public ScenarioObject
 public:
     ScenarioLVLaunchSiteType();
     static ScenarioLVLaunchSiteType* create(const QDomElement& e);
+    static ScenarioLVLaunchSiteType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVLaunchSiteType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioAbstract3DOFPositionType> Abstract3DOFPosition() const
@@ -3250,10 +3505,13 @@ class ScenarioLVTargetOrbitType : public ScenarioObject
 public:
     ScenarioLVTargetOrbitType();
     static ScenarioLVTargetOrbitType* create(const QDomElement& e);
+    static ScenarioLVTargetOrbitType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVTargetOrbitType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double semiaxis() const
@@ -3297,10 +3555,13 @@ class ScenarioLVArchitectureType : public ScenarioObject
 public:
     ScenarioLVArchitectureType();
     static ScenarioLVArchitectureType* create(const QDomElement& e);
+    static ScenarioLVArchitectureType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVArchitectureType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarInt> boosterConf() const
@@ -3334,10 +3595,13 @@ class ScenarioLVPlFairingType : public ScenarioObject
 public:
     ScenarioLVPlFairingType();
     static ScenarioLVPlFairingType* create(const QDomElement& e);
+    static ScenarioLVPlFairingType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPlFairingType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVGeometryType> Geometry() const
@@ -3371,10 +3635,13 @@ class ScenarioLVLowerStageType : public ScenarioObject
 public:
     ScenarioLVLowerStageType();
     static ScenarioLVLowerStageType* create(const QDomElement& e);
+    static ScenarioLVLowerStageType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVLowerStageType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVGeometryType> Geometry() const
@@ -3413,10 +3680,13 @@ class ScenarioLVUpperStageType : public ScenarioObject
 public:
     ScenarioLVUpperStageType();
     static ScenarioLVUpperStageType* create(const QDomElement& e);
+    static ScenarioLVUpperStageType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVUpperStageType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVGeometryType> Geometry() const
@@ -3455,10 +3725,13 @@ class ScenarioLVBoostersType : public ScenarioObject
 public:
     ScenarioLVBoostersType();
     static ScenarioLVBoostersType* create(const QDomElement& e);
+    static ScenarioLVBoostersType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVBoostersType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioLVGeometryType> Geometry() const
@@ -3497,10 +3770,13 @@ class ScenarioLVSystemConstraintsType : public ScenarioObject
 public:
     ScenarioLVSystemConstraintsType();
     static ScenarioLVSystemConstraintsType* create(const QDomElement& e);
+    static ScenarioLVSystemConstraintsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVSystemConstraintsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -3514,10 +3790,13 @@ class ScenarioLVPropulsionSystemSystemType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemSystemType();
     static ScenarioLVPropulsionSystemSystemType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemSystemType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemSystemType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarInt> propType() const
@@ -3656,10 +3935,13 @@ class ScenarioLVPropulsionSystemLiquidTanksType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemLiquidTanksType();
     static ScenarioLVPropulsionSystemLiquidTanksType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemLiquidTanksType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemLiquidTanksType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> tanksPressureNorm() const
@@ -3733,10 +4015,13 @@ class ScenarioLVPropulsionSystemSolidGrainType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemSolidGrainType();
     static ScenarioLVPropulsionSystemSolidGrainType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemSolidGrainType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemSolidGrainType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> abOverAt() const
@@ -3795,10 +4080,13 @@ class ScenarioLVPropulsionSystemFeedSystemType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemFeedSystemType();
     static ScenarioLVPropulsionSystemFeedSystemType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemFeedSystemType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemFeedSystemType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double pressurizerTankPressure() const
@@ -3857,10 +4145,13 @@ class ScenarioLVPropulsionSystemCombustionChamberType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemCombustionChamberType();
     static ScenarioLVPropulsionSystemCombustionChamberType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemCombustionChamberType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemCombustionChamberType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> accOverAt() const
@@ -3914,10 +4205,13 @@ class ScenarioLVPropulsionSystemNozzleType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemNozzleType();
     static ScenarioLVPropulsionSystemNozzleType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemNozzleType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemNozzleType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double at() const
@@ -4011,10 +4305,13 @@ class ScenarioLVPropulsionSystemPerformanceType : public ScenarioObject
 public:
     ScenarioLVPropulsionSystemPerformanceType();
     static ScenarioLVPropulsionSystemPerformanceType* create(const QDomElement& e);
+    static ScenarioLVPropulsionSystemPerformanceType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionSystemPerformanceType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double seaThrust() const
@@ -4133,10 +4430,13 @@ class ScenarioLVDevelopmentCostsType : public ScenarioObject
 public:
     ScenarioLVDevelopmentCostsType();
     static ScenarioLVDevelopmentCostsType* create(const QDomElement& e);
+    static ScenarioLVDevelopmentCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVDevelopmentCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double enginef2() const
@@ -4175,10 +4475,13 @@ class ScenarioLVProductionCostsType : public ScenarioObject
 public:
     ScenarioLVProductionCostsType();
     static ScenarioLVProductionCostsType* create(const QDomElement& e);
+    static ScenarioLVProductionCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVProductionCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     int totalNumberOfEngines() const
@@ -4222,10 +4525,13 @@ class ScenarioLVTotalProgramCostsType : public ScenarioObject
 public:
     ScenarioLVTotalProgramCostsType();
     static ScenarioLVTotalProgramCostsType* create(const QDomElement& e);
+    static ScenarioLVTotalProgramCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVTotalProgramCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double lifeCycleCostMY() const
@@ -4279,10 +4585,13 @@ class ScenarioLVDirectOperationsCostsType : public ScenarioObject
 public:
     ScenarioLVDirectOperationsCostsType();
     static ScenarioLVDirectOperationsCostsType* create(const QDomElement& e);
+    static ScenarioLVDirectOperationsCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVDirectOperationsCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double transportCost() const
@@ -4341,10 +4650,13 @@ class ScenarioLVIndirectOperationsCostsType : public ScenarioObject
 public:
     ScenarioLVIndirectOperationsCostsType();
     static ScenarioLVIndirectOperationsCostsType* create(const QDomElement& e);
+    static ScenarioLVIndirectOperationsCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVIndirectOperationsCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double groundFacilitiesBuildingCost() const
@@ -4373,10 +4685,13 @@ class ScenarioLVSeparationType : public ScenarioObject
 public:
     ScenarioLVSeparationType();
     static ScenarioLVSeparationType* create(const QDomElement& e);
+    static ScenarioLVSeparationType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVSeparationType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double stageSeparationReliability() const
@@ -4410,10 +4725,13 @@ class ScenarioLVPropulsionReliabilityType : public ScenarioObject
 public:
     ScenarioLVPropulsionReliabilityType();
     static ScenarioLVPropulsionReliabilityType* create(const QDomElement& e);
+    static ScenarioLVPropulsionReliabilityType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVPropulsionReliabilityType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double igniterReliability() const
@@ -4467,10 +4785,13 @@ class ScenarioLVTakeoffReliabilityType : public ScenarioObject
 public:
     ScenarioLVTakeoffReliabilityType();
     static ScenarioLVTakeoffReliabilityType* create(const QDomElement& e);
+    static ScenarioLVTakeoffReliabilityType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVTakeoffReliabilityType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double launchSiteReliability() const
@@ -4504,10 +4825,13 @@ class ScenarioLVTakeOffType : public ScenarioObject
 public:
     ScenarioLVTakeOffType();
     static ScenarioLVTakeOffType* create(const QDomElement& e);
+    static ScenarioLVTakeOffType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVTakeOffType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double padClearingAlt() const
@@ -4546,10 +4870,13 @@ class ScenarioLVIgnitionsType : public ScenarioObject
 public:
     ScenarioLVIgnitionsType();
     static ScenarioLVIgnitionsType* create(const QDomElement& e);
+    static ScenarioLVIgnitionsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVIgnitionsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarBool> coreIgnitionDelayOption() const
@@ -4590,10 +4917,13 @@ class ScenarioLVAtmosphericFlightType : public ScenarioObject
 public:
     ScenarioLVAtmosphericFlightType();
     static ScenarioLVAtmosphericFlightType* create(const QDomElement& e);
+    static ScenarioLVAtmosphericFlightType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVAtmosphericFlightType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     const QList<double>& optimizedPitchValues() const
@@ -4638,10 +4968,13 @@ class ScenarioLVExoatmosphericFlightType : public ScenarioObject
 public:
     ScenarioLVExoatmosphericFlightType();
     static ScenarioLVExoatmosphericFlightType* create(const QDomElement& e);
+    static ScenarioLVExoatmosphericFlightType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVExoatmosphericFlightType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> bilinearLawInitPitch() const
@@ -4685,10 +5018,13 @@ class ScenarioLVTrajectoryConstraintsType : public ScenarioObject
 public:
     ScenarioLVTrajectoryConstraintsType();
     static ScenarioLVTrajectoryConstraintsType* create(const QDomElement& e);
+    static ScenarioLVTrajectoryConstraintsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LVTrajectoryConstraintsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double finalSemiaxisError() const
@@ -4737,10 +5073,13 @@ class ScenarioREV : public ScenarioParticipantType
 public:
     ScenarioREV();
     static ScenarioREV* create(const QDomElement& e);
+    static ScenarioREV* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REV"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -4784,10 +5123,13 @@ class ScenarioREVProgramType : public ScenarioObject
 public:
     ScenarioREVProgramType();
     static ScenarioREVProgramType* create(const QDomElement& e);
+    static ScenarioREVProgramType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVProgramType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     int nMissions() const
@@ -4811,10 +5153,13 @@ class ScenarioREVMissionType : public ScenarioObject
 public:
     ScenarioREVMissionType();
     static ScenarioREVMissionType* create(const QDomElement& e);
+    static ScenarioREVMissionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVMissionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioREVTrajectoryPlanType> REVTrajectoryPlan() const
@@ -4838,10 +5183,13 @@ class ScenarioREVTrajectoryPlanType : public ScenarioObject
 public:
     ScenarioREVTrajectoryPlanType();
     static ScenarioREVTrajectoryPlanType* create(const QDomElement& e);
+    static ScenarioREVTrajectoryPlanType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVTrajectoryPlanType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     const QList<QSharedPointer<ScenarioAbstractTrajectoryType> >& AbstractTrajectory() const
@@ -4862,10 +5210,13 @@ class ScenarioEntryArcType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioEntryArcType();
     static ScenarioEntryArcType* create(const QDomElement& e);
+    static ScenarioEntryArcType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "EntryArcType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -4934,10 +5285,13 @@ class ScenarioREVFinalStateType : public ScenarioObject
 public:
     ScenarioREVFinalStateType();
     static ScenarioREVFinalStateType* create(const QDomElement& e);
+    static ScenarioREVFinalStateType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVFinalStateType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString entryType() const
@@ -4971,10 +5325,13 @@ class ScenarioREVFinalPositionStateType : public ScenarioObject
 public:
     ScenarioREVFinalPositionStateType();
     static ScenarioREVFinalPositionStateType* create(const QDomElement& e);
+    static ScenarioREVFinalPositionStateType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVFinalPositionStateType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioAbstract6DOFPositionType> Abstract6DOFPosition() const
@@ -4993,10 +5350,13 @@ class ScenarioREVDispersionAnalysisType : public ScenarioObject
 public:
     ScenarioREVDispersionAnalysisType();
     static ScenarioREVDispersionAnalysisType* create(const QDomElement& e);
+    static ScenarioREVDispersionAnalysisType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVDispersionAnalysisType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     int nrSimulations() const
@@ -5070,10 +5430,13 @@ class ScenarioEntryCharacteristicsType : public ScenarioObject
 public:
     ScenarioEntryCharacteristicsType();
     static ScenarioEntryCharacteristicsType* create(const QDomElement& e);
+    static ScenarioEntryCharacteristicsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "EntryCharacteristicsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString entryWindowAnalysis() const
@@ -5117,10 +5480,13 @@ class ScenarioREVConstraintsViolationType : public ScenarioObject
 public:
     ScenarioREVConstraintsViolationType();
     static ScenarioREVConstraintsViolationType* create(const QDomElement& e);
+    static ScenarioREVConstraintsViolationType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVConstraintsViolationType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double landingVelCstrViolation() const
@@ -5169,10 +5535,13 @@ class ScenarioREVPayloadType : public ScenarioObject
 public:
     ScenarioREVPayloadType();
     static ScenarioREVPayloadType* create(const QDomElement& e);
+    static ScenarioREVPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double mass() const
@@ -5231,10 +5600,13 @@ class ScenarioREVGeometryType : public ScenarioObject
 public:
     ScenarioREVGeometryType();
     static ScenarioREVGeometryType* create(const QDomElement& e);
+    static ScenarioREVGeometryType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVGeometryType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double REVvolume() const
@@ -5293,10 +5665,13 @@ class ScenariocapsuleShape : public ScenarioObject
 public:
     ScenariocapsuleShape();
     static ScenariocapsuleShape* create(const QDomElement& e);
+    static ScenariocapsuleShape* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "capsuleShape"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> param1() const
@@ -5330,10 +5705,13 @@ class ScenarioprobeShape : public ScenarioObject
 public:
     ScenarioprobeShape();
     static ScenarioprobeShape* create(const QDomElement& e);
+    static ScenarioprobeShape* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "probeShape"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> param1() const
@@ -5372,10 +5750,13 @@ class ScenariobiconicShape : public ScenarioObject
 public:
     ScenariobiconicShape();
     static ScenariobiconicShape* create(const QDomElement& e);
+    static ScenariobiconicShape* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "biconicShape"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> param1() const
@@ -5414,10 +5795,13 @@ class ScenariosphereconeShape : public ScenarioObject
 public:
     ScenariosphereconeShape();
     static ScenariosphereconeShape* create(const QDomElement& e);
+    static ScenariosphereconeShape* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "sphereconeShape"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> param1() const
@@ -5446,10 +5830,13 @@ class ScenarioREVConstraintsType : public ScenarioObject
 public:
     ScenarioREVConstraintsType();
     static ScenarioREVConstraintsType* create(const QDomElement& e);
+    static ScenarioREVConstraintsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVConstraintsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double maxHeatFlux() const
@@ -5498,10 +5885,13 @@ class ScenarioREVSystemType : public ScenarioObject
 public:
     ScenarioREVSystemType();
     static ScenarioREVSystemType* create(const QDomElement& e);
+    static ScenarioREVSystemType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSystemType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioREVWeights> Weights() const
@@ -5560,10 +5950,13 @@ class ScenarioParachutes : public ScenarioObject
 public:
     ScenarioParachutes();
     static ScenarioParachutes* create(const QDomElement& e);
+    static ScenarioParachutes* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Parachutes"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarInt> nChutes() const
@@ -5589,10 +5982,13 @@ class ScenarioParachute : public ScenarioObject
 public:
     ScenarioParachute();
     static ScenarioParachute* create(const QDomElement& e);
+    static ScenarioParachute* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Parachute"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double mass() const
@@ -5631,10 +6027,13 @@ class ScenarioParachuteAerodynamics : public ScenarioObject
 public:
     ScenarioParachuteAerodynamics();
     static ScenarioParachuteAerodynamics* create(const QDomElement& e);
+    static ScenarioParachuteAerodynamics* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ParachuteAerodynamics"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     bool userDefinedAero() const
@@ -5663,10 +6062,13 @@ class ScenarioREVStructureType : public ScenarioObject
 public:
     ScenarioREVStructureType();
     static ScenarioREVStructureType* create(const QDomElement& e);
+    static ScenarioREVStructureType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVStructureType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> maxAxialAcc() const
@@ -5740,10 +6142,13 @@ class ScenarioREVAeroThermodynamicsType : public ScenarioObject
 public:
     ScenarioREVAeroThermodynamicsType();
     static ScenarioREVAeroThermodynamicsType* create(const QDomElement& e);
+    static ScenarioREVAeroThermodynamicsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVAeroThermodynamicsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> hypersonicTrimAngle() const
@@ -5801,10 +6206,13 @@ class ScenarioREVTPS : public ScenarioObject
 public:
     ScenarioREVTPS();
     static ScenarioREVTPS* create(const QDomElement& e);
+    static ScenarioREVTPS* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVTPS"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> maxHeatFlux() const
@@ -5858,10 +6266,13 @@ class ScenarioREVSecondaryPropulsionType : public ScenarioObject
 public:
     ScenarioREVSecondaryPropulsionType();
     static ScenarioREVSecondaryPropulsionType* create(const QDomElement& e);
+    static ScenarioREVSecondaryPropulsionType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSecondaryPropulsionType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioREVOMSType> OMS() const
@@ -5885,10 +6296,13 @@ class ScenarioREVOMSType : public ScenarioObject
 public:
     ScenarioREVOMSType();
     static ScenarioREVOMSType* create(const QDomElement& e);
+    static ScenarioREVOMSType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVOMSType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> thrust() const
@@ -5942,10 +6356,13 @@ class ScenarioREVRCSType : public ScenarioObject
 public:
     ScenarioREVRCSType();
     static ScenarioREVRCSType* create(const QDomElement& e);
+    static ScenarioREVRCSType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVRCSType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioOptVarDouble> thrust() const
@@ -5974,10 +6391,13 @@ class ScenarioREVComponentsMassType : public ScenarioObject
 public:
     ScenarioREVComponentsMassType();
     static ScenarioREVComponentsMassType* create(const QDomElement& e);
+    static ScenarioREVComponentsMassType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVComponentsMassType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double avionics() const
@@ -6006,10 +6426,13 @@ class ScenarioREVComponentsType : public ScenarioObject
 public:
     ScenarioREVComponentsType();
     static ScenarioREVComponentsType* create(const QDomElement& e);
+    static ScenarioREVComponentsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVComponentsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioREVComponentsMassType> Mass() const
@@ -6033,10 +6456,13 @@ class ScenarioCoGLongPosition : public ScenarioObject
 public:
     ScenarioCoGLongPosition();
     static ScenarioCoGLongPosition* create(const QDomElement& e);
+    static ScenarioCoGLongPosition* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "CoGLongPosition"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double avionics() const
@@ -6065,10 +6491,13 @@ class ScenarioREVWeights : public ScenarioObject
 public:
     ScenarioREVWeights();
     static ScenarioREVWeights* create(const QDomElement& e);
+    static ScenarioREVWeights* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVWeights"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double totalDryMass() const
@@ -6147,10 +6576,13 @@ class ScenarioInertialMatrix : public ScenarioObject
 public:
     ScenarioInertialMatrix();
     static ScenarioInertialMatrix* create(const QDomElement& e);
+    static ScenarioInertialMatrix* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "InertialMatrix"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double ixx() const
@@ -6194,10 +6626,13 @@ class ScenarioREVSystemCostsType : public ScenarioObject
 public:
     ScenarioREVSystemCostsType();
     static ScenarioREVSystemCostsType* create(const QDomElement& e);
+    static ScenarioREVSystemCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSystemCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double systemDevelopmentCost() const
@@ -6241,10 +6676,13 @@ class ScenarioREVCostsType : public ScenarioObject
 public:
     ScenarioREVCostsType();
     static ScenarioREVCostsType* create(const QDomElement& e);
+    static ScenarioREVCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double lifeCycleCost() const
@@ -6293,10 +6731,13 @@ class ScenarioREVSubsystemsRefurbishmentCostsType : public ScenarioObject
 public:
     ScenarioREVSubsystemsRefurbishmentCostsType();
     static ScenarioREVSubsystemsRefurbishmentCostsType* create(const QDomElement& e);
+    static ScenarioREVSubsystemsRefurbishmentCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSubsystemsRefurbishmentCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double structure() const
@@ -6350,10 +6791,13 @@ class ScenarioREVSubsystemsProductionCostsType : public ScenarioObject
 public:
     ScenarioREVSubsystemsProductionCostsType();
     static ScenarioREVSubsystemsProductionCostsType* create(const QDomElement& e);
+    static ScenarioREVSubsystemsProductionCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSubsystemsProductionCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double structure() const
@@ -6412,10 +6856,13 @@ class ScenarioREVSubsystemsDevelopCostsType : public ScenarioObject
 public:
     ScenarioREVSubsystemsDevelopCostsType();
     static ScenarioREVSubsystemsDevelopCostsType* create(const QDomElement& e);
+    static ScenarioREVSubsystemsDevelopCostsType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSubsystemsDevelopCostsType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double structure() const
@@ -6469,10 +6916,13 @@ class ScenarioREVReliabilityType : public ScenarioObject
 public:
     ScenarioREVReliabilityType();
     static ScenarioREVReliabilityType* create(const QDomElement& e);
+    static ScenarioREVReliabilityType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVReliabilityType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double globalVehicleReliability() const
@@ -6506,10 +6956,13 @@ class ScenarioREVSubsystemsReliablityType : public ScenarioObject
 public:
     ScenarioREVSubsystemsReliablityType();
     static ScenarioREVSubsystemsReliablityType* create(const QDomElement& e);
+    static ScenarioREVSubsystemsReliablityType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "REVSubsystemsReliablityType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double structure() const
@@ -6563,10 +7016,13 @@ class ScenarioSC : public ScenarioParticipantType
 public:
     ScenarioSC();
     static ScenarioSC* create(const QDomElement& e);
+    static ScenarioSC* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SC"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -6610,10 +7066,13 @@ class ScenarioSCProgram : public ScenarioObject
 public:
     ScenarioSCProgram();
     static ScenarioSCProgram* create(const QDomElement& e);
+    static ScenarioSCProgram* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SCProgram"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -6627,10 +7086,13 @@ class ScenarioSCMission : public ScenarioObject
 public:
     ScenarioSCMission();
     static ScenarioSCMission* create(const QDomElement& e);
+    static ScenarioSCMission* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SCMission"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioTrajectoryPlan> TrajectoryPlan() const
@@ -6654,10 +7116,13 @@ class ScenarioTrajectoryPlan : public ScenarioObject
 public:
     ScenarioTrajectoryPlan();
     static ScenarioTrajectoryPlan* create(const QDomElement& e);
+    static ScenarioTrajectoryPlan* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TrajectoryPlan"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     const QList<QSharedPointer<ScenarioAbstractTrajectoryType> >& AbstractTrajectory() const
@@ -6678,10 +7143,13 @@ class ScenarioLoiteringType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioLoiteringType();
     static ScenarioLoiteringType* create(const QDomElement& e);
+    static ScenarioLoiteringType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LoiteringType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioEnvironmentType> Environment() const
@@ -6735,10 +7203,13 @@ class ScenarioLoiteringTLEType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioLoiteringTLEType();
     static ScenarioLoiteringTLEType* create(const QDomElement& e);
+    static ScenarioLoiteringTLEType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LoiteringTLEType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioTimeLine> TimeLine() const
@@ -6772,10 +7243,13 @@ class ScenarioLagrangianType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioLagrangianType();
     static ScenarioLagrangianType* create(const QDomElement& e);
+    static ScenarioLagrangianType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "LagrangianType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -6789,10 +7263,13 @@ class ScenarioFlyByType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioFlyByType();
     static ScenarioFlyByType* create(const QDomElement& e);
+    static ScenarioFlyByType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "FlyByType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
 
@@ -6806,10 +7283,13 @@ class ScenarioExternalType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioExternalType();
     static ScenarioExternalType* create(const QDomElement& e);
+    static ScenarioExternalType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ExternalType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioCentralBodyType> CentralBody() const
@@ -6847,10 +7327,13 @@ class ScenarioDeltaVType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioDeltaVType();
     static ScenarioDeltaVType* create(const QDomElement& e);
+    static ScenarioDeltaVType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "DeltaVType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioEnvironmentType> Environment() const
@@ -6904,10 +7387,13 @@ class ScenarioRendezVousManoeuvreType : public ScenarioAbstractTrajectoryType
 public:
     ScenarioRendezVousManoeuvreType();
     static ScenarioRendezVousManoeuvreType* create(const QDomElement& e);
+    static ScenarioRendezVousManoeuvreType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "RendezVousManoeuvreType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioEnvironmentType> Environment() const
@@ -6976,10 +7462,13 @@ class ScenarioSCSystemType : public ScenarioObject
 public:
     ScenarioSCSystemType();
     static ScenarioSCSystemType* create(const QDomElement& e);
+    static ScenarioSCSystemType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SCSystemType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioSystemBudgets> SystemBudgets() const
@@ -7038,10 +7527,13 @@ class ScenarioSystemBudgets : public ScenarioObject
 public:
     ScenarioSystemBudgets();
     static ScenarioSystemBudgets* create(const QDomElement& e);
+    static ScenarioSystemBudgets* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SystemBudgets"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioMassOfSystem> MassOfSystem() const
@@ -7070,10 +7562,13 @@ class ScenarioMassOfSystem : public ScenarioObject
 public:
     ScenarioMassOfSystem();
     static ScenarioMassOfSystem* create(const QDomElement& e);
+    static ScenarioMassOfSystem* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "MassOfSystem"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double dryMass() const
@@ -7097,10 +7592,13 @@ class ScenarioPowerOfSystem : public ScenarioObject
 public:
     ScenarioPowerOfSystem();
     static ScenarioPowerOfSystem* create(const QDomElement& e);
+    static ScenarioPowerOfSystem* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "PowerOfSystem"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double totalPowerBoL() const
@@ -7124,10 +7622,13 @@ class ScenarioLink : public ScenarioObject
 public:
     ScenarioLink();
     static ScenarioLink* create(const QDomElement& e);
+    static ScenarioLink* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Link"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double uplinkMargin() const
@@ -7151,10 +7652,13 @@ class ScenarioSCAerodynamics : public ScenarioObject
 public:
     ScenarioSCAerodynamics();
     static ScenarioSCAerodynamics* create(const QDomElement& e);
+    static ScenarioSCAerodynamics* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SCAerodynamics"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double surfaceArea() const
@@ -7178,10 +7682,13 @@ class ScenarioPropulsion : public ScenarioObject
 public:
     ScenarioPropulsion();
     static ScenarioPropulsion* create(const QDomElement& e);
+    static ScenarioPropulsion* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Propulsion"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     int numberOfEngines() const
@@ -7220,10 +7727,13 @@ class ScenarioStructure : public ScenarioObject
 public:
     ScenarioStructure();
     static ScenarioStructure* create(const QDomElement& e);
+    static ScenarioStructure* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Structure"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString StructuralShape() const
@@ -7272,10 +7782,13 @@ class ScenarioSizing : public ScenarioObject
 public:
     ScenarioSizing();
     static ScenarioSizing* create(const QDomElement& e);
+    static ScenarioSizing* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Sizing"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double volume() const
@@ -7309,10 +7822,13 @@ class ScenarioMomentsOfInertia : public ScenarioObject
 public:
     ScenarioMomentsOfInertia();
     static ScenarioMomentsOfInertia* create(const QDomElement& e);
+    static ScenarioMomentsOfInertia* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "MomentsOfInertia"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double xAxis() const
@@ -7341,10 +7857,13 @@ class ScenarioSecondMomentsOfInertia : public ScenarioObject
 public:
     ScenarioSecondMomentsOfInertia();
     static ScenarioSecondMomentsOfInertia* create(const QDomElement& e);
+    static ScenarioSecondMomentsOfInertia* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SecondMomentsOfInertia"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double xAxis() const
@@ -7373,10 +7892,13 @@ class ScenarioNaturalFrequency : public ScenarioObject
 public:
     ScenarioNaturalFrequency();
     static ScenarioNaturalFrequency* create(const QDomElement& e);
+    static ScenarioNaturalFrequency* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "NaturalFrequency"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double axialFrequency() const
@@ -7400,10 +7922,13 @@ class ScenarioTCS : public ScenarioObject
 public:
     ScenarioTCS();
     static ScenarioTCS* create(const QDomElement& e);
+    static ScenarioTCS* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TCS"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioTemperature> Temperature() const
@@ -7442,10 +7967,13 @@ class ScenarioTemperature : public ScenarioObject
 public:
     ScenarioTemperature();
     static ScenarioTemperature* create(const QDomElement& e);
+    static ScenarioTemperature* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "Temperature"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double maximumSCTemperature() const
@@ -7469,10 +7997,13 @@ class ScenarioCoatingArea : public ScenarioObject
 public:
     ScenarioCoatingArea();
     static ScenarioCoatingArea* create(const QDomElement& e);
+    static ScenarioCoatingArea* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "CoatingArea"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioColdSurface> ColdSurface() const
@@ -7496,10 +8027,13 @@ class ScenarioColdSurface : public ScenarioObject
 public:
     ScenarioColdSurface();
     static ScenarioColdSurface* create(const QDomElement& e);
+    static ScenarioColdSurface* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ColdSurface"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioColdCoating> ColdCoating() const
@@ -7523,10 +8057,13 @@ class ScenarioColdCoating : public ScenarioObject
 public:
     ScenarioColdCoating();
     static ScenarioColdCoating* create(const QDomElement& e);
+    static ScenarioColdCoating* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ColdCoating"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -7555,10 +8092,13 @@ class ScenarioHotSurface : public ScenarioObject
 public:
     ScenarioHotSurface();
     static ScenarioHotSurface* create(const QDomElement& e);
+    static ScenarioHotSurface* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "HotSurface"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioHotCoating> HotCoating() const
@@ -7582,10 +8122,13 @@ class ScenarioHotCoating : public ScenarioObject
 public:
     ScenarioHotCoating();
     static ScenarioHotCoating* create(const QDomElement& e);
+    static ScenarioHotCoating* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "HotCoating"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -7614,10 +8157,13 @@ class ScenarioEPS : public ScenarioObject
 public:
     ScenarioEPS();
     static ScenarioEPS* create(const QDomElement& e);
+    static ScenarioEPS* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "EPS"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioSolarArray> SolarArray() const
@@ -7651,10 +8197,13 @@ class ScenarioSolarArray : public ScenarioObject
 public:
     ScenarioSolarArray();
     static ScenarioSolarArray* create(const QDomElement& e);
+    static ScenarioSolarArray* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SolarArray"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString SACellType() const
@@ -7683,10 +8232,13 @@ class ScenarioBatteryType : public ScenarioObject
 public:
     ScenarioBatteryType();
     static ScenarioBatteryType* create(const QDomElement& e);
+    static ScenarioBatteryType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "BatteryType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString BatteryType() const
@@ -7720,10 +8272,13 @@ class ScenarioTTC : public ScenarioObject
 public:
     ScenarioTTC();
     static ScenarioTTC* create(const QDomElement& e);
+    static ScenarioTTC* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TTC"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double totalTTCMass() const
@@ -7747,10 +8302,13 @@ class ScenarioTTCAntenna : public ScenarioObject
 public:
     ScenarioTTCAntenna();
     static ScenarioTTCAntenna* create(const QDomElement& e);
+    static ScenarioTTCAntenna* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TTCAntenna"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double TransmitterPower() const
@@ -7794,10 +8352,13 @@ class ScenarioAOCS : public ScenarioObject
 public:
     ScenarioAOCS();
     static ScenarioAOCS* create(const QDomElement& e);
+    static ScenarioAOCS* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "AOCS"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double totalAOCSMass() const
@@ -7816,10 +8377,13 @@ class ScenarioOBDH : public ScenarioObject
 public:
     ScenarioOBDH();
     static ScenarioOBDH* create(const QDomElement& e);
+    static ScenarioOBDH* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OBDH"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     double totalOBDHMass() const
@@ -7843,10 +8407,13 @@ class ScenarioTransmitterPayloadType : public ScenarioAbstractPayloadType
 public:
     ScenarioTransmitterPayloadType();
     static ScenarioTransmitterPayloadType* create(const QDomElement& e);
+    static ScenarioTransmitterPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "TransmitterPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -7870,10 +8437,13 @@ class ScenarioReceiverPayloadType : public ScenarioAbstractPayloadType
 public:
     ScenarioReceiverPayloadType();
     static ScenarioReceiverPayloadType* create(const QDomElement& e);
+    static ScenarioReceiverPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "ReceiverPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -7897,10 +8467,13 @@ class ScenarioOpticalPayloadType : public ScenarioAbstractPayloadType
 public:
     ScenarioOpticalPayloadType();
     static ScenarioOpticalPayloadType* create(const QDomElement& e);
+    static ScenarioOpticalPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "OpticalPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -7924,10 +8497,13 @@ class ScenarioRadarPayloadType : public ScenarioAbstractPayloadType
 public:
     ScenarioRadarPayloadType();
     static ScenarioRadarPayloadType* create(const QDomElement& e);
+    static ScenarioRadarPayloadType* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "RadarPayloadType"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QSharedPointer<ScenarioElementIdentifierType> ElementIdentifier() const
@@ -7951,10 +8527,13 @@ class SpaceScenario : public ScenarioObject
 public:
     SpaceScenario();
     static SpaceScenario* create(const QDomElement& e);
+    static SpaceScenario* create(QXmlStreamReader& reader);
     virtual QString elementName() const
     { return "SpaceScenario"; }
     virtual bool load(const QDomElement& e, QDomElement* nextElement);
+    virtual bool load(QXmlStreamReader& reader);
     virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;
+    virtual void writeContents(QXmlStreamWriter& writer) const;
 
     virtual QList<QSharedPointer<ScenarioObject> > children() const;
     QString Name() const
@@ -1365,7 +1365,8 @@ void GroundTrackView::paint2DView(QPainter& painter)
                                                                          coverageSampleLessThan);
                 if (m_showCoverageHistory)
                 {
-                    drawCoverage(painter, m_analysis->m_constellationStudySpaceObjectList.at(i).asocolor, false, iter->histpoints);
+                    drawCoverage(painter, m_analysis->m_constellationStudySpaceObjectList.at(i).asocolor, false,
+                                 m_analysis->m_constellationStudySpaceObjectList.at(i).coverage->coveredBefore(m_currentTime));
                 }
                 if (m_showCoverageCurrent)
                 {
@@ -1638,7 +1639,7 @@ void GroundTrackView::drawDiscretization(QPainter& painter, QList<Discretization
     painter.setPen(Qt::NoPen);
 }
 
-void GroundTrackView::drawCoverage(QPainter& painter, QColor asocolor, bool colored, QList<DiscretizationPoint> discretePoints)
+void GroundTrackView::drawCoverage(QPainter& painter, QColor asocolor, bool colored, const QBitArray& coveredPoints)
 {
     painter.setBrush(Qt::NoBrush);
     painter.setPen(Qt::NoPen);
@@ -1654,11 +1655,16 @@ void GroundTrackView::drawCoverage(QPainter& painter, QColor asocolor, bool colo
         painter.setBrush(QColor(0, 0, 0, 60));
     }
     int numRows = m_analysis->m_discreteMesh->numberRows;
-    //plot the list of all discrete points
-    int numberDiscretePoints = discretePoints.length();
+    //plot the covered discrete points
+    const QList<DiscretizationPoint>& discretePoints = m_analysis->m_discreteMesh->meshAsList;
+    int numberDiscretePoints = qMin(discretePoints.length(), coveredPoints.size());
     float ellipseHeight = (4.0/5.0)*90.0/(double)numRows;
     for (int k = 0; k < numberDiscretePoints; k++)
     {
+        if (!coveredPoints.testBit(k))
+        {
+            continue;
+        }
         //float ellipseWidth = (discretePoints.at(k).rectangleWidth)/2;
         float lon = discretePoints.at(k).longitude;
         float lat = discretePoints.at(k).latitude;
@@ -136,7 +136,7 @@ Q_OBJECT
 
     // Analysis (Claas Grohnfeldt, Steffen Peter)
     void drawDiscretization(QPainter& painter, QList<DiscretizationPoint> discretePoints);
-    void drawCoverage(QPainter& painter, QColor asocolor, bool seenPoints, QList<DiscretizationPoint> discretePoints);
+    void drawCoverage(QPainter& painter, QColor asocolor, bool seenPoints, const QBitArray& coveredPoints);
 
  private:
     PropagatedScenario* m_scenario;
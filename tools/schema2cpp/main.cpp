@@ -51,6 +51,10 @@
    schema2cpp emits code that is Qt-friendly: QStrings are used to represent strings,
    QDateTime is used for dates, and the QtXML framework is used for converting to and
    from XML.
+
+   Two sets of loaders and writers are generated: one works on a DOM tree, the other
+   reads and writes the scenario in a single pass with QXmlStreamReader and
+   QXmlStreamWriter, without building a document in memory.
 */
 
 const QString INDENT = "    ";
@@ -556,6 +560,9 @@ private:
     void writeDomFactory(QTextStream& out);
     void writeDomLoader(QTextStream& out);
     void writeDomSaver(QTextStream& out);
+    void writeStreamFactory(QTextStream& out);
+    void writeStreamLoader(QTextStream& out);
+    void writeStreamSaver(QTextStream& out);
     void writeChildCount(QTextStream& out) const;
     void writeChildren(QTextStream& out) const;
 
@@ -697,6 +704,12 @@ ComplexType::writeMethodDefinitions(QTextStream& out)
     out << "\n";
     writeDomSaver(out);
     out << "\n";
+    writeStreamFactory(out);
+    out << "\n";
+    writeStreamLoader(out);
+    out << "\n";
+    writeStreamSaver(out);
+    out << "\n";
     writeChildren(out);
     out << "\n\n";
 }
@@ -730,6 +743,7 @@ ComplexType::writePublicInterface(QTextStream& out)
 
     // Factory method
     out << INDENT << "static " << className() << "* create(const QDomElement& e);\n";
+    out << INDENT << "static " << className() << "* create(QXmlStreamReader& reader);\n";
     
     // elementName() method
     out << INDENT << "virtual QString elementName() const\n";
@@ -738,8 +752,14 @@ ComplexType::writePublicInterface(QTextStream& out)
     // DOM Node loader
     out << INDENT << "virtual bool " << "load(const QDomElement& e, QDomElement* nextElement);\n";
 
+    // Stream loader
+    out << INDENT << "virtual bool load(QXmlStreamReader& reader);\n";
+
     // DOM Node writer
     out << INDENT << "virtual QDomElement toDomElement(QDomDocument& doc, const QString& elementName) const;\n";
+
+    // Stream writer
+    out << INDENT << "virtual void writeContents(QXmlStreamWriter& writer) const;\n";
     out << "\n";
 
     //out << INDENT << "virtual unsigned int childCount();\n";
@@ -1103,6 +1123,245 @@ ComplexType::writeDomSaver(QTextStream& out)
 }
 
 
+void
+ComplexType::writeStreamFactory(QTextStream& out)
+{
+    QString returnType = className() + "*";
+
+    out << returnType << " " << className() << "::create(QXmlStreamReader& reader)\n";
+    out << "{\n";
+    out << INDENT << returnType << " v = new " << className() << ";\n";
+    out << INDENT << "if (!v->load(reader))\n";
+    out << INDENT << "{\n";
+    out << INDENT2 << "delete v;\n";
+    out << INDENT2 << "return NULL;\n";
+    out << INDENT << "}\n";
+    out << INDENT << "skipUnknownElements(reader);\n";
+    out << INDENT << "return v;\n";
+    out << "}\n";
+}
+
+
+// Write code that flags an error on the reader and abandons the load when the
+// reader isn't positioned at the start of a required element.
+static void
+WriteRequiredElementCheck(QTextStream& out, const QString& indent, const QString& name)
+{
+    QString tagName = quoteString(XMLNS + ":" + name);
+    QString message = quoteString("Expected " + XMLNS + ":" + name);
+    out << indent << "if (!atStartElement(reader, " << tagName << "))\n";
+    out << indent << "{\n";
+    out << indent << INDENT << "reader.raiseError(QObject::tr(" << message << "));\n";
+    out << indent << INDENT << "return false;\n";
+    out << indent << "}\n";
+}
+
+
+// The stream loader is the counterpart of the DOM loader. On entry to load(),
+// the reader is positioned on the start of the element; ScenarioObject::load()
+// advances it to the first child element, and each property is read in
+// schema order. A child element is done when the reader is moved to the start
+// of the next sibling (or to the end of the parent) with readNextStartElement().
+// A missing required element raises an error on the reader, and loading stops
+// as soon as the reader has an error.
+void
+ComplexType::writeStreamLoader(QTextStream& out)
+{
+    const QString ADVANCE = "reader.readNextStartElement()";
+
+    out << "bool " << className() << "::load(QXmlStreamReader& reader)\n";
+    out << "{\n";
+
+    out << INDENT << "if (!" << baseClassName() << "::load(reader))\n";
+    out << INDENT2 << "return false;\n";
+
+    foreach (Property p, m_properties)
+    {
+        if (p.type().isComplex())
+        {
+            QList<QSharedPointer<Element> > substitutes;
+            if (g_GlobalElements.contains(p.name()))
+            {
+                substitutes = g_GlobalElements[p.name()]->substitutes();
+            }
+
+            if (p.multipleOccurrencesAllowed())
+            {
+                // Arbitrary number of occurrences are allowed
+                out << INDENT << "for (;;)\n";
+                out << INDENT << "{\n";
+
+                out << INDENT2 << p.type().memberVariableType() << " v;\n";
+                if (substitutes.isEmpty())
+                {
+                    out << INDENT2 << "if (atStartElement(reader, " << quoteString(XMLNS + ":" + p.name()) << "))\n";
+                    out << INDENT3 << "v = " << p.type().memberVariableType() << "(" << p.type().ctype() << "::create(reader));\n";
+                }
+                else
+                {
+                    // Handle substitution group
+                    bool first = true;
+                    foreach (QSharedPointer<Element> e, substitutes)
+                    {
+                        out << INDENT2 << (first ? "" : "else ") << "if (atStartElement(reader, " << quoteString(XMLNS + ":" + e->name()) << "))\n";
+                        out << INDENT3 << "v = " << p.type().memberVariableType() << "((" << p.type().ctype() << "*)" << e->type().ctype() << "::create(reader));\n";
+                        first = false;
+                    }
+                }
+                out << INDENT2 << "if (reader.hasError())\n";
+                out << INDENT3 << "return false;\n";
+                out << INDENT2 << "if (v.isNull())\n";
+                out << INDENT3 << "break;\n";
+                out << INDENT2 << p.memberVariableName() << " << v;\n";
+                out << INDENT2 << ADVANCE << ";\n";
+                out << INDENT << "}\n";
+
+                if (!p.isOptional())
+                {
+                    out << INDENT << "if (" << p.memberVariableName() << ".isEmpty())\n";
+                    out << INDENT << "{\n";
+                    out << INDENT2 << "reader.raiseError(QObject::tr(" << quoteString("Expected " + XMLNS + ":" + p.name()) << "));\n";
+                    out << INDENT2 << "return false;\n";
+                    out << INDENT << "}\n";
+                }
+            }
+            else
+            {
+                // Zero or one occurrence allowed
+                if (substitutes.isEmpty())
+                {
+                    if (p.isOptional())
+                    {
+                        out << INDENT << "if (atStartElement(reader, " << quoteString(XMLNS + ":" + p.name()) << "))\n";
+                        out << INDENT2 << p.memberVariableName() << " = " <<
+                                         p.type().memberVariableType() << "(" << p.type().ctype() << "::create(reader));\n";
+                    }
+                    else
+                    {
+                        WriteRequiredElementCheck(out, INDENT, p.name());
+                        out << INDENT << p.memberVariableName() << " = " <<
+                                         p.type().memberVariableType() << "(" << p.type().ctype() << "::create(reader));\n";
+                    }
+                }
+                else
+                {
+                    // Handle substitution group
+                    bool first = true;
+                    foreach (QSharedPointer<Element> e, substitutes)
+                    {
+                        out << INDENT << (first ? "" : "else ") << "if (atStartElement(reader, " << quoteString(XMLNS + ":" + e->name()) << "))\n";
+                        out << INDENT2 << p.memberVariableName() << " = " << p.type().memberVariableType() << "((" << p.type().ctype() << "*)" << e->type().ctype() << "::create(reader));\n";
+                        first = false;
+                    }
+
+                    if (!p.isOptional())
+                    {
+                        out << INDENT << "else\n";
+                        out << INDENT << "{\n";
+                        out << INDENT2 << "reader.raiseError(QObject::tr(" << quoteString("Expected " + XMLNS + ":" + p.name()) << "));\n";
+                        out << INDENT2 << "return false;\n";
+                        out << INDENT << "}\n";
+                    }
+                }
+
+                out << INDENT << "if (reader.hasError())\n";
+                out << INDENT2 << "return false;\n";
+
+                if (p.isOptional())
+                {
+                    // Only advance if the read was successful
+                    out << INDENT << "if (!" << p.memberVariableName() << ".isNull())\n";
+                    out << INDENT2 << ADVANCE << ";\n";
+                }
+                else
+                {
+                    out << INDENT << ADVANCE << ";\n";
+                }
+            }
+        }
+        else
+        {
+            QString indent = INDENT;
+            if (p.isOptional())
+            {
+                out << INDENT << "if (atStartElement(reader, " << quoteString(XMLNS + ":" + p.name()) << "))\n";
+                out << INDENT << "{\n";
+                indent = INDENT2;
+            }
+            else
+            {
+                WriteRequiredElementCheck(out, INDENT, p.name());
+            }
+
+            if (p.type().parsingFunction().isEmpty())
+            {
+                out << indent << p.memberVariableName() << " = reader.readElementText();\n";
+            }
+            else
+            {
+                out << indent << p.memberVariableName() << " = " << p.type().parsingFunction() << "(reader.readElementText());\n";
+            }
+            out << indent << ADVANCE << ";\n";
+
+            if (p.isOptional())
+            {
+                out << INDENT << "}\n";
+            }
+        }
+    }
+
+    out << INDENT << "return !reader.hasError();\n";
+    out << "}\n";
+}
+
+
+void
+ComplexType::writeStreamSaver(QTextStream& out)
+{
+    out << "void " << className() << "::writeContents(QXmlStreamWriter& writer) const\n";
+    out << "{\n";
+
+    out << INDENT << baseClassName() << "::writeContents(writer);\n";
+    foreach (Property p, m_properties)
+    {
+        if (p.type().isComplex())
+        {
+            QList<QSharedPointer<Element> > substitutes;
+            if (g_GlobalElements.contains(p.name()))
+            {
+                substitutes = g_GlobalElements[p.name()]->substitutes();
+            }
+
+            if (p.multipleOccurrencesAllowed())
+            {
+                out << INDENT << "foreach (" << p.type().memberVariableType() << " p, " << p.memberVariableName() << ")\n";
+                out << INDENT << "{\n";
+                out << INDENT2 << "QString tagName = " << quoteString(p.name()) << ";\n";
+                SetTagName(out, "p", substitutes);
+                out << INDENT2 << "p->writeElement(writer, tagName);\n";
+                out << INDENT << "}\n";
+            }
+            else
+            {
+                out << INDENT  << "if (!" << p.memberVariableName() << ".isNull())\n";
+                out << INDENT  << "{\n";
+                out << INDENT2 << "QString tagName = " << quoteString(p.name()) << ";\n";
+                SetTagName(out, p.memberVariableName(), substitutes);
+                out << INDENT2 << p.memberVariableName() << "->writeElement(writer, tagName);\n";
+                out << INDENT  << "}\n";
+            }
+        }
+        else
+        {
+            out << INDENT << "writeSimpleElement(writer, " << quoteString(XMLNS + ":" + p.name()) << ", " <<
+                              p.memberVariableName() << ");\n";
+        }
+    }
+
+    out << "}\n";
+}
+
+
 void
 ComplexType::writeChildCount(QTextStream& out) const
 {
@@ -1498,6 +1757,24 @@ int main(int argc, char *argv[])
     header << INDENT2 << ";\n";
 
     header << INDENT << "}\n";
+    header << "\n";
+    header << INDENT << "virtual bool load(QXmlStreamReader& reader)\n";
+    header << INDENT << "{\n";
+    header << INDENT2 << "reader.readNextStartElement();\n";
+    header << INDENT2 << "return true;\n";
+    header << INDENT << "}\n";
+    header << "\n";
+    header << INDENT << "virtual void writeContents(QXmlStreamWriter& /* writer */) const\n";
+    header << INDENT << "{\n";
+    header << INDENT << "}\n";
+    header << "\n";
+    header << INDENT << "void writeElement(QXmlStreamWriter& writer, const QString& elementName) const\n";
+    header << INDENT << "{\n";
+    header << INDENT2 << "writer.writeStartElement(" << QString("\"%1:\"").arg(XMLNS) << " + elementName);\n";
+    header << INDENT2 << "writeContents(writer);\n";
+    header << INDENT2 << "writer.writeEndElement();\n";
+    header << INDENT << "}\n";
+    header << "\n";
     header << INDENT << "virtual QString elementName() const = 0;\n";
     header << INDENT << "virtual QList<QSharedPointer<ScenarioObject> > children() const = 0;\n";
     header << "};\n";